@@ -0,0 +1,226 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+/**
+ * Binary AST benchmark.
+ * Compares the time taken to get the AST for a given Wolf source file by lexing and parsing it (with
+ * 'Lexer::process' and 'Module::parse') against loading it from the binary format written by 'ASTBinaryWriter'.
+ * Results are reported in JSON format, like the other front end benchmarks.
+ *
+ * The binary AST is written next to the input file with a '.wast' extension. Before timing anything, the
+ * binary AST is checked to round trip: loading it and writing the loaded AST out again must give the same data.
+ *
+ * Usage: ASTBinaryBenchmark <Input Wolf File> [Num Iterations]
+ */
+#include "AST/ASTBinaryReader.hpp"
+#include "AST/ASTBinaryWriter.hpp"
+#include "AST/Nodes/Module.hpp"
+#include "AST/ParseCtx.hpp"
+#include "Lexer/Lexer.hpp"
+#include "Lexer/SourceLineIndex.hpp"
+#include "Lexer/SymbolTable.hpp"
+#include "LinearAlloc.hpp"
+#include "LinearAllocPool.hpp"
+#include "SourceBuffer.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <chrono>
+    #include <cstdio>
+    #include <cstdlib>
+    #include <string>
+    #include <vector>
+WC_THIRD_PARTY_INCLUDES_END
+
+/* The default number of times to get the AST each way */
+static constexpr const int kDefaultNumIterations = 10;
+
+/* Settings for the linear allocators used to allocate AST nodes, these match what the compiler uses */
+static constexpr const size_t kASTAllocMaxAllocSize = 1024 * 1024;
+static constexpr const size_t kASTAllocBlockSize = 1024 * 1024 * 16;
+
+/**
+ * Lex and parse the given source into an AST, allocated from the given linear allocator.
+ * Returns the number of AST nodes created, or 0 on failure. If requested, any parse errors are printed.
+ */
+static size_t lexAndParse(const Wolfc::SourceBuffer & inputSrc, Wolfc::LinearAlloc & linearAlloc, bool printErrors) {
+    Wolfc::Lexer lexer;
+    
+    if (!lexer.process(inputSrc)) {
+        return 0;
+    }
+    
+    Wolfc::AST::ParseCtx parseCtx(lexer.getTokenList(),
+                                  lexer.getTokenTypeList(),
+                                  lexer.getSrcLineIndex(),
+                                  linearAlloc);
+    
+    Wolfc::AST::Module * module = Wolfc::AST::Module::parse(parseCtx);
+    
+    if (!module || parseCtx.hasErrors()) {
+        if (printErrors) {
+            for (const std::string & errorMsg : parseCtx.getErrorMsgs()) {
+                std::printf("%s\n", errorMsg.c_str());
+            }
+        }
+        
+        return 0;
+    }
+    
+    return parseCtx.getNumASTNodes();
+}
+
+/**
+ * Lex and parse the given source and write the binary AST for it to the given data buffer.
+ * Returns the number of AST nodes, or 0 on failure.
+ */
+static size_t writeBinaryAST(const Wolfc::SourceBuffer & inputSrc,
+                             Wolfc::LinearAllocPool & linearAllocPool,
+                             std::vector<uint8_t> & outData)
+{
+    Wolfc::Lexer lexer;
+    
+    if (!lexer.process(inputSrc)) {
+        return 0;
+    }
+    
+    Wolfc::LinearAlloc linearAlloc(linearAllocPool);
+    Wolfc::AST::ParseCtx parseCtx(lexer.getTokenList(),
+                                  lexer.getTokenTypeList(),
+                                  lexer.getSrcLineIndex(),
+                                  linearAlloc);
+    
+    Wolfc::AST::Module * module = Wolfc::AST::Module::parse(parseCtx);
+    
+    if (!module || parseCtx.hasErrors()) {
+        for (const std::string & errorMsg : parseCtx.getErrorMsgs()) {
+            std::printf("%s\n", errorMsg.c_str());
+        }
+        
+        return 0;
+    }
+    
+    Wolfc::AST::ASTBinaryWriter::write(*module, lexer.getSrcLineIndex(), outData);
+    return parseCtx.getNumASTNodes();
+}
+
+/* Load the binary AST in the given file, allocated from the given linear allocator. Returns null on failure. */
+static const Wolfc::AST::Module * loadBinaryAST(const char * filePath,
+                                                Wolfc::LinearAlloc & linearAlloc,
+                                                Wolfc::SourceLineIndex & srcLineIndex)
+{
+    Wolfc::SymbolTable symbolTable(linearAlloc);
+    return Wolfc::AST::ASTBinaryReader::readFile(filePath, linearAlloc, symbolTable, srcLineIndex);
+}
+
+/* Program entry point */
+int main(int argc, const char * argv[]) {
+    // Arg check
+    if (argc < 2 || argc > 3) {
+        std::printf("Usage: %s <Input Wolf File> [Num Iterations]\n", argv[0]);
+        return -1;
+    }
+    
+    int numIterations = (argc >= 3) ? std::atoi(argv[2]) : kDefaultNumIterations;
+    
+    if (numIterations <= 0) {
+        std::printf("Number of iterations must be greater than zero!\n");
+        return -1;
+    }
+    
+    // Read the source file
+    Wolfc::SourceBuffer inputSrc;
+    
+    if (!inputSrc.load(argv[1])) {
+        std::printf("Failed to read input Wolf source file '%s'!\n", argv[1]);
+        return -1;
+    }
+    
+    // Lex and parse the source once and write out the binary AST for it
+    Wolfc::LinearAllocPool linearAllocPool(kASTAllocMaxAllocSize,
+                                           kASTAllocBlockSize,
+                                           Wolfc::LinearAllocPool::BlockMemType::kHugePages);
+    
+    std::vector<uint8_t> binaryAST;
+    size_t numNodes = writeBinaryAST(inputSrc, linearAllocPool, binaryAST);
+    
+    if (numNodes == 0) {
+        return -1;
+    }
+    
+    std::string binaryASTFilePath = std::string(argv[1]) + ".wast";
+    std::FILE * binaryASTFile = std::fopen(binaryASTFilePath.c_str(), "wb");
+    
+    if (!binaryASTFile ||
+        std::fwrite(binaryAST.data(), 1, binaryAST.size(), binaryASTFile) != binaryAST.size() ||
+        std::fclose(binaryASTFile) != 0)
+    {
+        std::printf("Failed to write binary AST file '%s'!\n", binaryASTFilePath.c_str());
+        return -1;
+    }
+    
+    // Make sure the binary AST round trips: loading it and writing it out again must give the same data
+    {
+        Wolfc::LinearAlloc linearAlloc(linearAllocPool);
+        Wolfc::SourceLineIndex srcLineIndex;
+        const Wolfc::AST::Module * module = loadBinaryAST(binaryASTFilePath.c_str(), linearAlloc, srcLineIndex);
+        
+        if (!module) {
+            std::printf("Failed to load binary AST file '%s'!\n", binaryASTFilePath.c_str());
+            return -1;
+        }
+        
+        std::vector<uint8_t> reloadedBinaryAST;
+        Wolfc::AST::ASTBinaryWriter::write(*module, srcLineIndex, reloadedBinaryAST);
+        
+        if (reloadedBinaryAST != binaryAST) {
+            std::printf("Binary AST did not round trip! Writing the loaded AST gave different data.\n");
+            return -1;
+        }
+    }
+    
+    // Time lexing and parsing
+    auto startTime = std::chrono::high_resolution_clock::now();
+    
+    for (int i = 0; i < numIterations; ++i) {
+        Wolfc::LinearAlloc linearAlloc(linearAllocPool);
+        lexAndParse(inputSrc, linearAlloc, false);
+    }
+    
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double parseSecsPerIteration = std::chrono::duration<double>(endTime - startTime).count() / numIterations;
+    
+    // Time loading the binary AST, including mapping the file
+    startTime = std::chrono::high_resolution_clock::now();
+    
+    for (int i = 0; i < numIterations; ++i) {
+        Wolfc::LinearAlloc linearAlloc(linearAllocPool);
+        Wolfc::SourceLineIndex srcLineIndex;
+        loadBinaryAST(binaryASTFilePath.c_str(), linearAlloc, srcLineIndex);
+    }
+    
+    endTime = std::chrono::high_resolution_clock::now();
+    double loadSecsPerIteration = std::chrono::duration<double>(endTime - startTime).count() / numIterations;
+    
+    // Report the results as JSON
+    std::printf("{\n");
+    std::printf("    \"file\": \"%s\",\n", argv[1]);
+    std::printf("    \"sourceBytes\": %zu,\n", inputSrc.getSize());
+    std::printf("    \"binaryASTBytes\": %zu,\n", binaryAST.size());
+    std::printf("    \"astNodes\": %zu,\n", numNodes);
+    std::printf("    \"iterations\": %d,\n", numIterations);
+    std::printf("    \"lexAndParse\": {\n");
+    std::printf("        \"msPerIteration\": %.3f,\n", parseSecsPerIteration * 1000.0);
+    std::printf("        \"nodesPerSec\": %.0f\n", static_cast<double>(numNodes) / parseSecsPerIteration);
+    std::printf("    },\n");
+    std::printf("    \"binaryLoad\": {\n");
+    std::printf("        \"msPerIteration\": %.3f,\n", loadSecsPerIteration * 1000.0);
+    std::printf("        \"nodesPerSec\": %.0f,\n", static_cast<double>(numNodes) / loadSecsPerIteration);
+    std::printf("        \"speedup\": %.2f\n", parseSecsPerIteration / loadSecsPerIteration);
+    std::printf("    }\n");
+    std::printf("}\n");
+    
+    return 0;
+}
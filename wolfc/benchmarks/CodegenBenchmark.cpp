@@ -0,0 +1,175 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+/**
+ * Compiler codegen benchmark.
+ * Lexes and parses a given Wolf source file once, then repeatedly binds names and generates LLVM IR for it and
+ * reports the time taken by each of these stages in JSON format. Use 'CorpusGenerator' with a large number of
+ * functions and '--globals' to produce modules that stress the name lookups done during codegen.
+ *
+ * Name binding is reported in identifiers bound/s (for 'NameBinder::bind') and codegen in AST nodes/s (for the
+ * 'Codegen' pass, including creating the codegen context). Each iteration generates into a fresh LLVM module.
+ *
+ * Unlike the front end benchmarks this must be linked against LLVM, build it with the 'backend' option for
+ * 'build_benchmark.sh'.
+ *
+ * Usage: CodegenBenchmark <Input Wolf File> [Num Iterations]
+ */
+#include "AST/NameBinder.hpp"
+#include "AST/NameBindings.hpp"
+#include "AST/Nodes/Module.hpp"
+#include "AST/ParseCtx.hpp"
+#include "Backend/LLVM/Codegen/Codegen.hpp"
+#include "Backend/LLVM/CodegenCtx.hpp"
+#include "Lexer/Lexer.hpp"
+#include "LinearAlloc.hpp"
+#include "LinearAllocPool.hpp"
+#include "SourceBuffer.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <chrono>
+    #include <cstdio>
+    #include <cstdlib>
+WC_THIRD_PARTY_INCLUDES_END
+
+/* The default number of times to bind names and generate code for the input file */
+static constexpr const int kDefaultNumIterations = 5;
+
+/* Settings for the linear allocators used to allocate AST nodes, these match what the compiler uses */
+static constexpr const size_t kASTAllocMaxAllocSize = 1024 * 1024;
+static constexpr const size_t kASTAllocBlockSize = 1024 * 1024 * 16;
+
+/* Name of the LLVM module generated */
+static const std::string kModuleName = "WolfBenchmark";
+
+/**
+ * Generate code for the given module using the given name bindings. Returns false on failure.
+ * If requested, any compile errors are printed.
+ */
+static bool generateCode(const Wolfc::AST::Module & module,
+                         const Wolfc::SourceLineIndex & srcLineIndex,
+                         const Wolfc::AST::NameBindings & nameBindings,
+                         bool printErrors)
+{
+    Wolfc::LLVMBackend::CodegenCtx codegenCtx(kModuleName, srcLineIndex, nameBindings);
+    Wolfc::LLVMBackend::Codegen codegen(codegenCtx);
+    codegen.visit(module);
+    
+    if (!codegenCtx.mLLVMModule.get() || codegenCtx.hasErrors()) {
+        if (printErrors) {
+            for (const std::string & errorMsg : codegenCtx.getErrorMsgs()) {
+                std::printf("%s\n", errorMsg.c_str());
+            }
+        }
+        
+        return false;
+    }
+    
+    return true;
+}
+
+/* Program entry point */
+int main(int argc, const char * argv[]) {
+    // Arg check
+    if (argc < 2 || argc > 3) {
+        std::printf("Usage: %s <Input Wolf File> [Num Iterations]\n", argv[0]);
+        return -1;
+    }
+    
+    int numIterations = (argc >= 3) ? std::atoi(argv[2]) : kDefaultNumIterations;
+    
+    if (numIterations <= 0) {
+        std::printf("Number of iterations must be greater than zero!\n");
+        return -1;
+    }
+    
+    // Read the source file
+    Wolfc::SourceBuffer inputSrc;
+    
+    if (!inputSrc.load(argv[1])) {
+        std::printf("Failed to read input Wolf source file '%s'!\n", argv[1]);
+        return -1;
+    }
+    
+    // Lex and parse the source once upfront, the same AST is used for all of the timed runs
+    Wolfc::Lexer lexer;
+    
+    if (!lexer.process(inputSrc)) {
+        return -1;
+    }
+    
+    Wolfc::LinearAllocPool linearAllocPool(kASTAllocMaxAllocSize,
+                                           kASTAllocBlockSize,
+                                           Wolfc::LinearAllocPool::BlockMemType::kHugePages);
+    
+    Wolfc::LinearAlloc linearAlloc(linearAllocPool);
+    Wolfc::AST::ParseCtx parseCtx(lexer.getTokenList(),
+                                  lexer.getTokenTypeList(),
+                                  lexer.getSrcLineIndex(),
+                                  linearAlloc);
+    
+    Wolfc::AST::Module * module = Wolfc::AST::Module::parse(parseCtx);
+    
+    if (!module || parseCtx.hasErrors()) {
+        for (const std::string & errorMsg : parseCtx.getErrorMsgs()) {
+            std::printf("%s\n", errorMsg.c_str());
+        }
+        
+        return -1;
+    }
+    
+    // Bind names and generate code once to warm up and to make sure the code compiles
+    Wolfc::AST::NameBindings nameBindings;
+    Wolfc::AST::NameBinder::bind(*module, nameBindings);
+    
+    if (!generateCode(*module, lexer.getSrcLineIndex(), nameBindings, true)) {
+        return -1;
+    }
+    
+    // Time name binding
+    auto startTime = std::chrono::high_resolution_clock::now();
+    
+    for (int i = 0; i < numIterations; ++i) {
+        Wolfc::AST::NameBindings iterNameBindings;
+        Wolfc::AST::NameBinder::bind(*module, iterNameBindings);
+    }
+    
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double bindSecsPerIteration = std::chrono::duration<double>(endTime - startTime).count() / numIterations;
+    
+    // Time codegen
+    startTime = std::chrono::high_resolution_clock::now();
+    
+    for (int i = 0; i < numIterations; ++i) {
+        generateCode(*module, lexer.getSrcLineIndex(), nameBindings, false);
+    }
+    
+    endTime = std::chrono::high_resolution_clock::now();
+    double codegenSecsPerIteration = std::chrono::duration<double>(endTime - startTime).count() / numIterations;
+    
+    // Report the results as JSON
+    size_t numASTNodes = parseCtx.getNumASTNodes();
+    
+    std::printf("{\n");
+    std::printf("    \"file\": \"%s\",\n", argv[1]);
+    std::printf("    \"sourceBytes\": %zu,\n", inputSrc.getSize());
+    std::printf("    \"astNodes\": %zu,\n", numASTNodes);
+    std::printf("    \"decls\": %zu,\n", nameBindings.getNumDecls());
+    std::printf("    \"bindings\": %zu,\n", nameBindings.getNumBindings());
+    std::printf("    \"iterations\": %d,\n", numIterations);
+    std::printf("    \"nameBinder\": {\n");
+    std::printf("        \"msPerIteration\": %.3f,\n", bindSecsPerIteration * 1000.0);
+    std::printf("        \"bindingsPerSec\": %.0f\n",
+                static_cast<double>(nameBindings.getNumBindings()) / bindSecsPerIteration);
+    std::printf("    },\n");
+    std::printf("    \"codegen\": {\n");
+    std::printf("        \"msPerIteration\": %.3f,\n", codegenSecsPerIteration * 1000.0);
+    std::printf("        \"nodesPerSec\": %.0f\n", static_cast<double>(numASTNodes) / codegenSecsPerIteration);
+    std::printf("    }\n");
+    std::printf("}\n");
+    
+    return 0;
+}
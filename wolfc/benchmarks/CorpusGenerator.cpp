@@ -0,0 +1,518 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+/**
+ * Synthetic corpus generator for the front end benchmarks.
+ * Writes out a Wolf source file with a configurable shape, so that the lexer and parser can be benchmarked
+ * on inputs of any size and mix. The output is valid Wolf code that the front end accepts without errors.
+ * The same options and seed always produce the same output.
+ *
+ * Usage: CorpusGenerator <Output Wolf File> [Options]
+ *
+ * Options:
+ *      --funcs <N>             Number of functions to generate.
+ *      --stmnts <N>            Number of statements in each function.
+ *      --expr-depth <N>        Maximum nesting depth of generated expressions.
+ *      --ident-len <N>         Length of generated identifiers (in chars).
+ *      --comment-density <N>   Percentage chance (0-100) of a comment before each statement.
+ *      --array-size <N>        Number of elements in each generated array literal.
+ *      --globals <N>           Number of global int variables to generate, which functions read from.
+ *      --seed <N>              Seed for the random number generator.
+ */
+#include "Macros.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstdio>
+    #include <cstdlib>
+    #include <cstring>
+    #include <random>
+    #include <string>
+    #include <vector>
+WC_THIRD_PARTY_INCLUDES_END
+
+/* Settings that control the shape of the generated corpus */
+struct CorpusSettings {
+    int numFuncs = 100;
+    int numStmntsPerFunc = 20;
+    int maxExprDepth = 4;
+    int identLen = 8;
+    int commentDensity = 20;
+    int arraySize = 8;
+    int numGlobals = 0;
+    int seed = 1;
+};
+
+/* The number of global arrays to generate */
+static constexpr const int kNumGlobalArrays = 4;
+
+/* Binary operators used in generated arithmetic expressions */
+static const char * const kArithmeticOps[] = { "+", "-", "*", "/", "%", "&", "|", "^", "<<", ">>" };
+
+/* Comparison operators used in generated conditions */
+static const char * const kComparisonOps[] = { "==", "!=", "<", "<=", ">", ">=" };
+
+/* Operators used in generated assignment statements */
+static const char * const kAssignOps[] = { "=", "+=", "-=", "*=", "|=", "&=", "^=" };
+
+/* Words used to build comments and string literals */
+static const char * const kWords[] = {
+    "the", "quick", "brown", "wolf", "jumps", "over", "lazy", "dog", "while", "value", "result", "loop"
+};
+
+/* Generates the Wolf source for the corpus */
+class CorpusGenerator {
+public:
+    CorpusGenerator(const CorpusSettings & settings) :
+        mSettings(settings),
+        mRandom(static_cast<std::mt19937::result_type>(settings.seed))
+    {
+        WC_EMPTY_FUNC_BODY();
+    }
+    
+    /* Generate the entire corpus and return the source */
+    std::string generate() {
+        mOutput.clear();
+        mOutput += "; Synthetic Wolf source corpus for benchmarking the compiler front end\n\n";
+        
+        // Global arrays, which functions index into
+        for (int i = 0; i < kNumGlobalArrays; ++i) {
+            mGlobalArrays.push_back(makeIdentifier("g", i));
+            mOutput += "let ";
+            mOutput += mGlobalArrays.back();
+            mOutput += " = ";
+            genArrayLiteral();
+            mOutput += "\n";
+        }
+        
+        // Global variables, which functions read from. Useful for stressing module level lookups in codegen.
+        for (int i = 0; i < mSettings.numGlobals; ++i) {
+            mGlobalVars.push_back(makeIdentifier("gv", i));
+            mOutput += "let ";
+            mOutput += mGlobalVars.back();
+            mOutput += " = ";
+            mOutput += std::to_string(randInt(0, 1000));
+            mOutput += "\n";
+        }
+        
+        // The functions, each of which can call any of the functions before it
+        for (int i = 0; i < mSettings.numFuncs; ++i) {
+            mOutput += "\n";
+            genFunc(i);
+        }
+        
+        return mOutput;
+    }
+    
+private:
+    /* Random int in the range [min, max] */
+    int randInt(int min, int max) {
+        return std::uniform_int_distribution<int>(min, max)(mRandom);
+    }
+    
+    /* True with the given percentage chance */
+    bool chance(int percent) {
+        return randInt(0, 99) < percent;
+    }
+    
+    /* Pick a random item from the given array */
+    template <typename T, size_t N>
+    const T & pick(const T (&items)[N]) {
+        return items[randInt(0, static_cast<int>(N) - 1)];
+    }
+    
+    /**
+     * Make an identifier with the given prefix and number, padded out to the configured identifier length.
+     * The underscore after the prefix guarantees the identifier never clashes with a keyword.
+     */
+    std::string makeIdentifier(const char * prefix, int number) {
+        std::string ident = prefix;
+        ident += '_';
+        ident += std::to_string(number);
+        
+        while (ident.size() < static_cast<size_t>(mSettings.identLen)) {
+            ident += static_cast<char>('a' + randInt(0, 25));
+        }
+        
+        return ident;
+    }
+    
+    /* Write out the current indentation */
+    void genIndent() {
+        mOutput.append(static_cast<size_t>(mIndent) * 4, ' ');
+    }
+    
+    /* Write out a few random words */
+    void genWords(int minWords, int maxWords) {
+        int numWords = randInt(minWords, maxWords);
+        
+        for (int i = 0; i < numWords; ++i) {
+            if (i > 0) {
+                mOutput += ' ';
+            }
+            
+            mOutput += pick(kWords);
+        }
+    }
+    
+    /* Write out a comment on its own line(s), either single or multi line */
+    void genComment() {
+        genIndent();
+        
+        if (chance(75)) {
+            mOutput += "; ";
+            genWords(2, 8);
+            mOutput += "\n";
+        }
+        else {
+            mOutput += "/; ";
+            genWords(2, 8);
+            mOutput += "\n";
+            genIndent();
+            genWords(2, 8);
+            mOutput += " ;/\n";
+        }
+    }
+    
+    /* Write out an array literal of int literals */
+    void genArrayLiteral() {
+        mOutput += "[ ";
+        
+        for (int i = 0; i < mSettings.arraySize; ++i) {
+            if (i > 0) {
+                mOutput += ", ";
+            }
+            
+            mOutput += std::to_string(randInt(0, 1000));
+        }
+        
+        mOutput += " ]";
+    }
+    
+    /* Write out a leaf expression: a literal, variable, array element or call */
+    void genLeafExpr(int depth) {
+        int leafKind = randInt(0, 9);
+        
+        if (leafKind < 3 || mLocals.empty()) {
+            mOutput += std::to_string(randInt(0, 100000));
+        }
+        else if (leafKind < 7 && !mGlobalVars.empty() && chance(25)) {
+            // Note: no random numbers are drawn here if there are no globals, so the output without them is unchanged
+            mOutput += mGlobalVars[static_cast<size_t>(randInt(0, static_cast<int>(mGlobalVars.size()) - 1))];
+        }
+        else if (leafKind < 7) {
+            mOutput += mLocals[static_cast<size_t>(randInt(0, static_cast<int>(mLocals.size()) - 1))];
+        }
+        else if (leafKind < 9) {
+            mOutput += mGlobalArrays[static_cast<size_t>(randInt(0, kNumGlobalArrays - 1))];
+            mOutput += '[';
+            mOutput += std::to_string(randInt(0, mSettings.arraySize - 1));
+            mOutput += ']';
+        }
+        else if (mCurFuncIndex > 0) {
+            mOutput += mFuncNames[static_cast<size_t>(randInt(0, mCurFuncIndex - 1))];
+            mOutput += '(';
+            genExpr(depth + 1);
+            mOutput += ", ";
+            genExpr(depth + 1);
+            mOutput += ')';
+        }
+        else {
+            mOutput += std::to_string(randInt(0, 100000));
+        }
+    }
+    
+    /* Write out an arithmetic expression, nested up to the configured depth */
+    void genExpr(int depth) {
+        if (depth >= mSettings.maxExprDepth || chance(25)) {
+            genLeafExpr(depth);
+            return;
+        }
+        
+        switch (randInt(0, 5)) {
+            case 0: {
+                mOutput += '(';
+                genExpr(depth + 1);
+                mOutput += ')';
+            }   break;
+            
+            case 1: {
+                // Note: the operand is a leaf so that two unary operators are never adjacent, e.g '--' would be
+                // lexed as a decrement operator.
+                mOutput += chance(50) ? '-' : '+';
+                genLeafExpr(depth + 1);
+            }   break;
+            
+            default: {
+                genExpr(depth + 1);
+                mOutput += ' ';
+                mOutput += pick(kArithmeticOps);
+                mOutput += ' ';
+                genExpr(depth + 1);
+            }   break;
+        }
+    }
+    
+    /* Write out a boolean condition */
+    void genCondition() {
+        genExpr(1);
+        mOutput += ' ';
+        mOutput += pick(kComparisonOps);
+        mOutput += ' ';
+        genExpr(1);
+        
+        if (chance(30)) {
+            mOutput += chance(50) ? " and " : " or ";
+            genExpr(1);
+            mOutput += ' ';
+            mOutput += pick(kComparisonOps);
+            mOutput += ' ';
+            genExpr(1);
+        }
+    }
+    
+    /* Write out a block of statements, which may nest more blocks */
+    void genBlock(int numStmnts, int nestingLevel) {
+        ++mIndent;
+        
+        for (int i = 0; i < numStmnts; ++i) {
+            genStmnt(nestingLevel);
+        }
+        
+        --mIndent;
+    }
+    
+    /**
+     * Write out a random statement. Variables are only declared at function level so that every variable
+     * referenced afterwards is in scope, nested blocks just assign to them.
+     */
+    void genStmnt(int nestingLevel) {
+        if (chance(mSettings.commentDensity)) {
+            genComment();
+        }
+        
+        genIndent();
+        int stmntKind = randInt(0, 9);
+        
+        if (nestingLevel == 0 && (stmntKind < 3 || mLocals.empty())) {
+            std::string localName = makeIdentifier("v", static_cast<int>(mLocals.size()));
+            mOutput += "let ";
+            mOutput += localName;
+            mOutput += " = ";
+            genExpr(0);
+            mLocals.push_back(localName);
+        }
+        else if (stmntKind < 6 || mLocals.empty() || nestingLevel >= 2) {
+            if (mLocals.empty()) {
+                mOutput += "print(\"";
+                genWords(1, 6);
+                mOutput += "\\n\")";
+            }
+            else {
+                mOutput += mLocals[static_cast<size_t>(randInt(0, static_cast<int>(mLocals.size()) - 1))];
+                mOutput += ' ';
+                mOutput += pick(kAssignOps);
+                mOutput += ' ';
+                genExpr(0);
+            }
+        }
+        else if (stmntKind < 8) {
+            mOutput += "if ";
+            genCondition();
+            mOutput += "\n";
+            genBlock(randInt(1, 3), nestingLevel + 1);
+            
+            if (chance(50)) {
+                genIndent();
+                mOutput += "else\n";
+                genBlock(randInt(1, 3), nestingLevel + 1);
+            }
+            
+            genIndent();
+            mOutput += "end";
+        }
+        else if (stmntKind < 9) {
+            mOutput += "while ";
+            genCondition();
+            mOutput += "\n";
+            genBlock(randInt(1, 3), nestingLevel + 1);
+            genIndent();
+            mOutput += "end";
+        }
+        else {
+            mOutput += "print(\"";
+            genWords(1, 6);
+            mOutput += "\\n\")";
+        }
+        
+        mOutput += "\n";
+    }
+    
+    /* Write out a function which takes two ints and returns an int */
+    void genFunc(int funcIndex) {
+        mCurFuncIndex = funcIndex;
+        mFuncNames.push_back(makeIdentifier("f", funcIndex));
+        mLocals.clear();
+        mLocals.push_back(makeIdentifier("a", 0));
+        mLocals.push_back(makeIdentifier("a", 1));
+        
+        if (chance(mSettings.commentDensity)) {
+            genComment();
+        }
+        
+        mOutput += "func ";
+        mOutput += mFuncNames.back();
+        mOutput += "(";
+        mOutput += mLocals[0];
+        mOutput += ": int, ";
+        mOutput += mLocals[1];
+        mOutput += ": int) -> int\n";
+        
+        genBlock(mSettings.numStmntsPerFunc, 0);
+        
+        ++mIndent;
+        genIndent();
+        mOutput += "return ";
+        genExpr(0);
+        mOutput += "\n";
+        --mIndent;
+        mOutput += "end\n";
+    }
+    
+    /* Settings for the corpus */
+    const CorpusSettings mSettings;
+    
+    /* Random number generator for the corpus */
+    std::mt19937 mRandom;
+    
+    /* The source generated so far */
+    std::string mOutput;
+    
+    /* The names of all global arrays */
+    std::vector<std::string> mGlobalArrays;
+    
+    /* The names of all global int variables */
+    std::vector<std::string> mGlobalVars;
+    
+    /* The names of all functions generated so far */
+    std::vector<std::string> mFuncNames;
+    
+    /* The names of the arguments and variables in scope in the current function */
+    std::vector<std::string> mLocals;
+    
+    /* Index of the function currently being generated */
+    int mCurFuncIndex = 0;
+    
+    /* The current indentation level */
+    int mIndent = 0;
+};
+
+/**
+ * Parse a non negative integer option value at the given arg index into the given output, advancing the index.
+ * Returns false on failure.
+ */
+static bool parseIntOption(int argc, const char * argv[], int & argIndex, int & output) {
+    const char * optionName = argv[argIndex];
+    
+    if (argIndex + 1 >= argc) {
+        std::printf("Missing value for option '%s'!\n", optionName);
+        return false;
+    }
+    
+    ++argIndex;
+    char * valueEndPtr = nullptr;
+    long value = std::strtol(argv[argIndex], &valueEndPtr, 10);
+    
+    if (*valueEndPtr != 0 || value < 0 || value > 1000000000) {
+        std::printf("Invalid value '%s' for option '%s'!\n", argv[argIndex], optionName);
+        return false;
+    }
+    
+    output = static_cast<int>(value);
+    return true;
+}
+
+/* Program entry point */
+int main(int argc, const char * argv[]) {
+    // Arg check
+    if (argc < 2) {
+        std::printf("Usage: %s <Output Wolf File> [--funcs N] [--stmnts N] [--expr-depth N] [--ident-len N] "
+                    "[--comment-density N] [--array-size N] [--globals N] [--seed N]\n",
+                    argv[0]);
+        
+        return -1;
+    }
+    
+    // Parse the options
+    CorpusSettings settings;
+    
+    for (int argIndex = 2; argIndex < argc; ++argIndex) {
+        const char * option = argv[argIndex];
+        int * optionValue = nullptr;
+        
+        if (std::strcmp(option, "--funcs") == 0) {
+            optionValue = &settings.numFuncs;
+        }
+        else if (std::strcmp(option, "--stmnts") == 0) {
+            optionValue = &settings.numStmntsPerFunc;
+        }
+        else if (std::strcmp(option, "--expr-depth") == 0) {
+            optionValue = &settings.maxExprDepth;
+        }
+        else if (std::strcmp(option, "--ident-len") == 0) {
+            optionValue = &settings.identLen;
+        }
+        else if (std::strcmp(option, "--comment-density") == 0) {
+            optionValue = &settings.commentDensity;
+        }
+        else if (std::strcmp(option, "--array-size") == 0) {
+            optionValue = &settings.arraySize;
+        }
+        else if (std::strcmp(option, "--globals") == 0) {
+            optionValue = &settings.numGlobals;
+        }
+        else if (std::strcmp(option, "--seed") == 0) {
+            optionValue = &settings.seed;
+        }
+        else {
+            std::printf("Unknown option '%s'!\n", option);
+            return -1;
+        }
+        
+        if (!parseIntOption(argc, argv, argIndex, *optionValue)) {
+            return -1;
+        }
+    }
+    
+    if (settings.commentDensity > 100) {
+        std::printf("Comment density must be a percentage between 0 and 100!\n");
+        return -1;
+    }
+    
+    if (settings.arraySize == 0) {
+        std::printf("Array size must be greater than zero!\n");
+        return -1;
+    }
+    
+    // Generate the corpus and write it out
+    std::string corpus = CorpusGenerator(settings).generate();
+    std::FILE * outputFile = std::fopen(argv[1], "wb");
+    
+    if (!outputFile) {
+        std::printf("Failed to open output file '%s'!\n", argv[1]);
+        return -1;
+    }
+    
+    bool writeSucceeded = std::fwrite(corpus.data(), 1, corpus.size(), outputFile) == corpus.size();
+    writeSucceeded = (std::fclose(outputFile) == 0) && writeSucceeded;
+    
+    if (!writeSucceeded) {
+        std::printf("Failed to write output file '%s'!\n", argv[1]);
+        return -1;
+    }
+    
+    std::printf("Wrote %zu bytes to '%s'\n", corpus.size(), argv[1]);
+    return 0;
+}
@@ -0,0 +1,177 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+/**
+ * Compiler front end benchmark.
+ * Repeatedly lexes and parses a given Wolf source file and reports the throughput of each stage in JSON format,
+ * so that the results can be collected and compared across builds to track regressions.
+ * Use 'CorpusGenerator' to produce synthetic inputs of a given size and shape.
+ *
+ * Lexing is reported in MB/s and tokens/s (for 'Lexer::process') and parsing in AST nodes/s (for 'Module::parse').
+ * The parse timings do not include lexing, the source is lexed once upfront and the same tokens are parsed each time.
+ *
+ * Usage: FrontEndBenchmark <Input Wolf File> [Num Iterations]
+ */
+#include "AST/Nodes/Module.hpp"
+#include "AST/ParseCtx.hpp"
+#include "Lexer/Lexer.hpp"
+#include "Lexer/Token.hpp"
+#include "LinearAlloc.hpp"
+#include "LinearAllocPool.hpp"
+#include "SourceBuffer.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <chrono>
+    #include <cstdio>
+    #include <cstdlib>
+WC_THIRD_PARTY_INCLUDES_END
+
+/* The default number of times to lex and parse the input file */
+static constexpr const int kDefaultNumIterations = 10;
+
+/* Settings for the linear allocators used to allocate AST nodes, these match what the compiler uses */
+static constexpr const size_t kASTAllocMaxAllocSize = 1024 * 1024;
+static constexpr const size_t kASTAllocBlockSize = 1024 * 1024 * 16;
+
+/* Count the number of tokens in the given token list, excluding the EOF token */
+static size_t countTokens(const Wolfc::Token * tokenList) {
+    size_t numTokens = 0;
+    
+    while (tokenList[numTokens].type != Wolfc::TokenType::kEOF) {
+        ++numTokens;
+    }
+    
+    return numTokens;
+}
+
+/* Stats for the AST created by a parse, and for the linear allocator it was created in */
+struct ASTStats {
+    size_t numNodes;
+    size_t numNodeBytes;
+    Wolfc::LinearAlloc::Stats allocStats;
+};
+
+/**
+ * Parse the tokens from the given lexer into an AST and return stats for the AST created.
+ * The AST is allocated from the given pool, and the memory for it is given back to the pool when done.
+ * The number of nodes in the stats is 0 on failure. If requested, any parse errors are printed.
+ */
+static ASTStats parseTokens(const Wolfc::Lexer & lexer, Wolfc::LinearAllocPool & linearAllocPool, bool printErrors) {
+    Wolfc::LinearAlloc linearAlloc(linearAllocPool);
+    Wolfc::AST::ParseCtx parseCtx(lexer.getTokenList(),
+                                  lexer.getTokenTypeList(),
+                                  lexer.getSrcLineIndex(),
+                                  linearAlloc);
+    
+    Wolfc::AST::Module * module = Wolfc::AST::Module::parse(parseCtx);
+    
+    if (!module || parseCtx.hasErrors()) {
+        if (printErrors) {
+            for (const std::string & errorMsg : parseCtx.getErrorMsgs()) {
+                std::printf("%s\n", errorMsg.c_str());
+            }
+        }
+        
+        return ASTStats{ 0, 0, linearAlloc.getStats() };
+    }
+    
+    return ASTStats{ parseCtx.getNumASTNodes(), parseCtx.getNumASTNodeBytes(), linearAlloc.getStats() };
+}
+
+/* Program entry point */
+int main(int argc, const char * argv[]) {
+    // Arg check
+    if (argc < 2 || argc > 3) {
+        std::printf("Usage: %s <Input Wolf File> [Num Iterations]\n", argv[0]);
+        return -1;
+    }
+    
+    int numIterations = (argc >= 3) ? std::atoi(argv[2]) : kDefaultNumIterations;
+    
+    if (numIterations <= 0) {
+        std::printf("Number of iterations must be greater than zero!\n");
+        return -1;
+    }
+    
+    // Read the source file
+    Wolfc::SourceBuffer inputSrc;
+    
+    if (!inputSrc.load(argv[1])) {
+        std::printf("Failed to read input Wolf source file '%s'!\n", argv[1]);
+        return -1;
+    }
+    
+    // Lex and parse the source once upfront to warm up and to make sure it is valid.
+    // The lexer from this is kept around, since its tokens are what get parsed in the timed runs.
+    Wolfc::Lexer lexer;
+    
+    if (!lexer.process(inputSrc)) {
+        return -1;
+    }
+    
+    size_t numTokens = countTokens(lexer.getTokenList());
+    Wolfc::LinearAllocPool linearAllocPool(kASTAllocMaxAllocSize,
+                                           kASTAllocBlockSize,
+                                           Wolfc::LinearAllocPool::BlockMemType::kHugePages);
+    
+    ASTStats astStats = parseTokens(lexer, linearAllocPool, true);
+    
+    if (astStats.numNodes == 0) {
+        return -1;
+    }
+    
+    // Time the lexer
+    auto startTime = std::chrono::high_resolution_clock::now();
+    
+    for (int i = 0; i < numIterations; ++i) {
+        Wolfc::Lexer iterLexer;
+        iterLexer.process(inputSrc);
+    }
+    
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double lexSecsPerIteration = std::chrono::duration<double>(endTime - startTime).count() / numIterations;
+    
+    // Time the parser
+    startTime = std::chrono::high_resolution_clock::now();
+    
+    for (int i = 0; i < numIterations; ++i) {
+        parseTokens(lexer, linearAllocPool, false);
+    }
+    
+    endTime = std::chrono::high_resolution_clock::now();
+    double parseSecsPerIteration = std::chrono::duration<double>(endTime - startTime).count() / numIterations;
+    
+    // Report the results as JSON
+    double srcSizeMB = static_cast<double>(inputSrc.getSize()) / (1024.0 * 1024.0);
+    
+    std::printf("{\n");
+    std::printf("    \"file\": \"%s\",\n", argv[1]);
+    std::printf("    \"sourceBytes\": %zu,\n", inputSrc.getSize());
+    std::printf("    \"tokens\": %zu,\n", numTokens);
+    std::printf("    \"astNodes\": %zu,\n", astStats.numNodes);
+    std::printf("    \"astNodeBytes\": %zu,\n", astStats.numNodeBytes);
+    std::printf("    \"astAlloc\": {\n");
+    std::printf("        \"bytesUsed\": %zu,\n", astStats.allocStats.numBytesUsed);
+    std::printf("        \"bytesWasted\": %zu,\n", astStats.allocStats.numBytesWasted);
+    std::printf("        \"blocks\": %zu,\n", astStats.allocStats.numBlocks);
+    std::printf("        \"sysBlocks\": %zu,\n", astStats.allocStats.numSysBlocks);
+    std::printf("        \"peakBytesUsed\": %zu,\n", astStats.allocStats.peakNumBytesUsed);
+    std::printf("        \"peakBlocks\": %zu\n", astStats.allocStats.peakNumBlocks);
+    std::printf("    },\n");
+    std::printf("    \"iterations\": %d,\n", numIterations);
+    std::printf("    \"lexer\": {\n");
+    std::printf("        \"msPerIteration\": %.3f,\n", lexSecsPerIteration * 1000.0);
+    std::printf("        \"mbPerSec\": %.2f,\n", srcSizeMB / lexSecsPerIteration);
+    std::printf("        \"tokensPerSec\": %.0f\n", static_cast<double>(numTokens) / lexSecsPerIteration);
+    std::printf("    },\n");
+    std::printf("    \"parser\": {\n");
+    std::printf("        \"msPerIteration\": %.3f,\n", parseSecsPerIteration * 1000.0);
+    std::printf("        \"nodesPerSec\": %.0f\n", static_cast<double>(astStats.numNodes) / parseSecsPerIteration);
+    std::printf("    }\n");
+    std::printf("}\n");
+    
+    return 0;
+}
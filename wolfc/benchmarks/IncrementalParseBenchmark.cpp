@@ -0,0 +1,380 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+/**
+ * Incremental parse benchmark.
+ * Compares the time taken to lex and parse a whole Wolf source file against the time taken by 'IncrementalParser'
+ * to update the AST after a small edit, like an editor would make on each keystroke. To show how each scales
+ * with the size of the source, the input file is repeated 1, 2, 4 and 8 times over. Results are reported in JSON
+ * format, like the other front end benchmarks.
+ *
+ * Each edit inserts a newline at the start of a line and then removes it again, at lines spread evenly through
+ * the source. After the edits the incremental AST is checked against the AST from a full parse of the source.
+ * The incremental parser is then checked in the same way with other kinds of edits (see 'checkEdits'), which are
+ * not timed.
+ *
+ * Usage: IncrementalParseBenchmark <Input Wolf File> [Num Edits]
+ */
+#include "AST/ASTBinaryFormat.hpp"
+#include "AST/ASTBinaryWriter.hpp"
+#include "AST/IncrementalParser.hpp"
+#include "AST/Nodes/DeclDef.hpp"
+#include "AST/Nodes/Module.hpp"
+#include "AST/ParseCtx.hpp"
+#include "Lexer/Lexer.hpp"
+#include "LinearAlloc.hpp"
+#include "SourceBuffer.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <chrono>
+    #include <cstdio>
+    #include <cstdlib>
+    #include <cstring>
+    #include <string>
+    #include <vector>
+WC_THIRD_PARTY_INCLUDES_END
+
+/* The default number of edits to time for each size of source */
+static constexpr const int kDefaultNumEdits = 200;
+
+/* How many times over to repeat the input source, for each size of source to benchmark */
+static constexpr const size_t kSrcRepeatCounts[] = { 1, 2, 4, 8 };
+static constexpr const size_t kNumSrcRepeatCounts = sizeof(kSrcRepeatCounts) / sizeof(kSrcRepeatCounts[0]);
+
+/* The number of full parses to time for each size of source */
+static constexpr const int kNumFullParses = 5;
+
+/* Settings for the linear allocator used for full parses, these match what the compiler uses */
+static constexpr const size_t kASTAllocMaxAllocSize = 1024 * 1024;
+static constexpr const size_t kASTAllocBlockSize = 1024 * 1024 * 16;
+
+/**
+ * Check that the AST from the incremental parser matches what a full lex and parse of the same source gives.
+ * The last edit made to the incremental parser must be given, along with whether it succeeded.
+ *
+ * If either has errors (including failing to lex) then both must, since the ASTs for code with errors are allowed
+ * to differ slightly. Otherwise both ASTs are written out in the binary AST format and must have the same number of
+ * nodes and the same amount of node data, with each decldef starting and ending at the same place. If no decldefs
+ * have moved since they were parsed then the node data must be identical too, which checks the kind of every node
+ * and the shape of the whole tree. Note: the node data refers to tokens by index, and the writer tells tokens apart
+ * by their source offset, so this can't be compared when the tokens of moved decldefs have stale offsets.
+ * Prints what is wrong on failure.
+ */
+static bool checkMatchesFullParse(const Wolfc::AST::IncrementalParser & incrementalParser, bool lastEditSucceeded) {
+    Wolfc::Lexer lexer;
+    bool fullLexSucceeded = lexer.process(incrementalParser.getSrcText());
+    Wolfc::LinearAlloc linearAlloc(kASTAllocMaxAllocSize, kASTAllocBlockSize);
+    Wolfc::AST::ParseCtx parseCtx(lexer.getTokenList(),
+                                  lexer.getTokenTypeList(),
+                                  lexer.getSrcLineIndex(),
+                                  linearAlloc);
+    
+    const Wolfc::AST::Module * fullModule = fullLexSucceeded ? Wolfc::AST::Module::parse(parseCtx) : nullptr;
+    const Wolfc::AST::Module * incrementalModule = incrementalParser.getModule();
+    
+    bool fullParseHasErrors = !fullModule || parseCtx.hasErrors();
+    bool incrementalParseHasErrors = !lastEditSucceeded || incrementalParser.hasErrors();
+    
+    if (fullParseHasErrors != incrementalParseHasErrors) {
+        std::printf("Full parse %s errors, but the incremental parse %s!\n",
+                    fullParseHasErrors ? "has" : "has no",
+                    incrementalParseHasErrors ? "does" : "does not");
+        
+        return false;
+    }
+    
+    if (fullParseHasErrors) {
+        return true;
+    }
+    
+    // Compare the decldefs
+    if (fullModule->mDeclDefs.size() != incrementalModule->mDeclDefs.size()) {
+        std::printf("Incremental parse has %zu decldefs, full parse has %zu!\n",
+                    incrementalModule->mDeclDefs.size(),
+                    fullModule->mDeclDefs.size());
+        
+        return false;
+    }
+    
+    bool anyDeclDefsMoved = false;
+    
+    for (size_t i = 0; i < fullModule->mDeclDefs.size(); ++i) {
+        const Wolfc::AST::DeclDef * fullDeclDef = fullModule->mDeclDefs[i];
+        const Wolfc::AST::DeclDef * incrementalDeclDef = incrementalModule->mDeclDefs[i];
+        int64_t srcOffsetDelta = incrementalParser.getSrcOffsetDelta(i);
+        anyDeclDefsMoved = anyDeclDefsMoved || (srcOffsetDelta != 0);
+        
+        if (fullDeclDef->mKind != incrementalDeclDef->mKind ||
+            fullDeclDef->getStartToken().startSrcOffset !=
+                incrementalDeclDef->getStartToken().startSrcOffset + srcOffsetDelta ||
+            fullDeclDef->getEndToken().endSrcOffset !=
+                incrementalDeclDef->getEndToken().endSrcOffset + srcOffsetDelta)
+        {
+            std::printf("Decldef %zu from the incremental parse does not match the full parse!\n", i);
+            return false;
+        }
+    }
+    
+    // Compare the nodes
+    std::vector<uint8_t> fullData;
+    std::vector<uint8_t> incrementalData;
+    Wolfc::AST::ASTBinaryWriter::write(*fullModule, lexer.getSrcLineIndex(), fullData);
+    Wolfc::AST::ASTBinaryWriter::write(*incrementalModule, incrementalParser.getSrcLineIndex(), incrementalData);
+    
+    Wolfc::AST::ASTBinaryFormat::Header fullHeader;
+    Wolfc::AST::ASTBinaryFormat::Header incrementalHeader;
+    std::memcpy(&fullHeader, fullData.data(), sizeof(fullHeader));
+    std::memcpy(&incrementalHeader, incrementalData.data(), sizeof(incrementalHeader));
+    
+    if (fullHeader.numNodes != incrementalHeader.numNodes ||
+        fullHeader.nodeDataNumWords != incrementalHeader.nodeDataNumWords)
+    {
+        std::printf("Incremental parse has %zu nodes (%zu words of node data), full parse has %zu (%zu words)!\n",
+                    static_cast<size_t>(incrementalHeader.numNodes),
+                    static_cast<size_t>(incrementalHeader.nodeDataNumWords),
+                    static_cast<size_t>(fullHeader.numNodes),
+                    static_cast<size_t>(fullHeader.nodeDataNumWords));
+        
+        return false;
+    }
+    
+    if (!anyDeclDefsMoved) {
+        Wolfc::AST::ASTBinaryFormat::Layout fullLayout;
+        Wolfc::AST::ASTBinaryFormat::Layout incrementalLayout;
+        WC_ASSERTED_OP(Wolfc::AST::ASTBinaryFormat::getLayout(fullHeader, fullLayout));
+        WC_ASSERTED_OP(Wolfc::AST::ASTBinaryFormat::getLayout(incrementalHeader, incrementalLayout));
+        
+        if (std::memcmp(fullData.data() + fullLayout.nodeDataOffset,
+                        incrementalData.data() + incrementalLayout.nodeDataOffset,
+                        fullHeader.nodeDataNumWords * sizeof(uint32_t)) != 0)
+        {
+            std::printf("Node data from the incremental parse does not match the full parse!\n");
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+/* An edit to check the incremental parser with. It is applied and then undone, see 'checkEdit'. */
+struct CheckedEdit {
+    const char * name;
+    size_t srcOffset;
+    size_t numBytesRemoved;
+    const char * insertedText;
+};
+
+/**
+ * Make the given edit with the incremental parser and check the result against a full parse, then undo the edit
+ * and check again. Edits which have no offset (i.e. what they edit was not found in the source) are skipped.
+ * Prints what is wrong on failure.
+ */
+static bool checkEdit(Wolfc::AST::IncrementalParser & incrementalParser, const CheckedEdit & edit) {
+    WC_GUARD(edit.srcOffset != std::string::npos, true);
+    std::string removedText(incrementalParser.getSrcText() + edit.srcOffset, edit.numBytesRemoved);
+    size_t insertedTextSize = std::strlen(edit.insertedText);
+    
+    bool editSucceeded = incrementalParser.applyEdit(static_cast<uint32_t>(edit.srcOffset),
+                                                     edit.numBytesRemoved,
+                                                     edit.insertedText,
+                                                     insertedTextSize);
+    
+    if (!checkMatchesFullParse(incrementalParser, editSucceeded)) {
+        std::printf("Incremental parse does not match a full parse after edit '%s'!\n", edit.name);
+        return false;
+    }
+    
+    editSucceeded = incrementalParser.applyEdit(static_cast<uint32_t>(edit.srcOffset),
+                                                insertedTextSize,
+                                                removedText.data(),
+                                                removedText.size());
+    
+    if (!checkMatchesFullParse(incrementalParser, editSucceeded)) {
+        std::printf("Incremental parse does not match a full parse after undoing edit '%s'!\n", edit.name);
+        return false;
+    }
+    
+    return true;
+}
+
+/**
+ * Check the incremental parser with edits of different kinds: to the insides of functions, comments and string
+ * literals, along with edits which cause lex and parse errors. Each edit is made at the first place in the source
+ * where it applies. Returns false if any edit gives the wrong AST, or fails to put the source back when undone.
+ * Note: the lexer prints the errors for edits which fail to lex to stderr, these are expected.
+ */
+static bool checkEdits(Wolfc::AST::IncrementalParser & incrementalParser) {
+    const std::string srcText = incrementalParser.getSrcText();
+    const size_t npos = std::string::npos;
+    
+    // Find the places to edit
+    size_t midLineStart = incrementalParser.getSrcLineIndex().getLineStart(
+        incrementalParser.getSrcLineIndex().getNumLines() / 2
+    );
+    
+    size_t funcStart = srcText.find("\nfunc ");
+    size_t funcBodyStart = (funcStart != npos) ? srcText.find('\n', funcStart + 1) : npos;
+    funcBodyStart = (funcBodyStart != npos) ? funcBodyStart + 1 : npos;
+    size_t returnExprStart = srcText.find("return ");
+    returnExprStart = (returnExprStart != npos) ? returnExprStart + 7 : npos;
+    size_t funcEnd = srcText.find("\nend\n");
+    funcEnd = (funcEnd != npos) ? funcEnd + 1 : npos;
+    size_t singleLineCommentStart = srcText.find("; ");
+    singleLineCommentStart = (singleLineCommentStart != npos) ? singleLineCommentStart + 2 : npos;
+    size_t multiLineCommentStart = srcText.find("/;");
+    multiLineCommentStart = (multiLineCommentStart != npos) ? multiLineCommentStart + 2 : npos;
+    size_t strLitStart = srcText.find('"');
+    strLitStart = (strLitStart != npos) ? strLitStart + 1 : npos;
+    
+    const CheckedEdit edits[] = {
+        { "Insert a comment line", midLineStart, 0, "; An added comment\n" },
+        { "Insert a multi line comment", midLineStart, 0, "/; An added\nmulti line comment ;/\n" },
+        { "Insert a statement in a function", funcBodyStart, 0, "    let added_var = 1 + 2\n" },
+        { "Insert a partial statement in a function", funcBodyStart, 0, "    let ad\n" },
+        { "Edit an expression in a function", returnExprStart, 0, "1 + " },
+        { "Break an expression in a function", returnExprStart, 0, "+ * " },
+        { "Remove the end of a function", funcEnd, 3, "" },
+        { "Edit a single line comment", singleLineCommentStart, 0, "edited " },
+        { "Break a single line comment", singleLineCommentStart, 0, "edited\n" },
+        { "Edit a multi line comment", multiLineCommentStart, 0, " edited\n" },
+        { "Open a multi line comment", midLineStart, 0, "/; " },
+        { "Edit a string literal", strLitStart, 0, "edited " },
+        { "Break a string literal", strLitStart, 0, "edited\n" },
+        { "Open a string literal", midLineStart, 0, "\"" },
+    };
+    
+    for (const CheckedEdit & edit : edits) {
+        if (!checkEdit(incrementalParser, edit)) {
+            return false;
+        }
+    }
+    
+    // All the edits were undone, so the source should be back as it was
+    if (srcText != incrementalParser.getSrcText()) {
+        std::printf("Source was not put back as it was after undoing edits!\n");
+        return false;
+    }
+    
+    return true;
+}
+
+/* Program entry point */
+int main(int argc, const char * argv[]) {
+    // Arg check
+    if (argc < 2 || argc > 3) {
+        std::printf("Usage: %s <Input Wolf File> [Num Edits]\n", argv[0]);
+        return -1;
+    }
+    
+    int numEdits = (argc >= 3) ? std::atoi(argv[2]) : kDefaultNumEdits;
+    
+    if (numEdits <= 0) {
+        std::printf("Number of edits must be greater than zero!\n");
+        return -1;
+    }
+    
+    // Read the source file
+    Wolfc::SourceBuffer inputSrc;
+    
+    if (!inputSrc.load(argv[1])) {
+        std::printf("Failed to read input Wolf source file '%s'!\n", argv[1]);
+        return -1;
+    }
+    
+    std::string inputSrcText(inputSrc.getText(), inputSrc.getSize());
+    
+    if (!inputSrcText.empty() && inputSrcText.back() != '\n') {
+        inputSrcText += '\n';
+    }
+    
+    // Benchmark each size of source
+    std::printf("{\n");
+    std::printf("    \"file\": \"%s\",\n", argv[1]);
+    std::printf("    \"edits\": %d,\n", numEdits);
+    std::printf("    \"results\": [\n");
+    
+    for (size_t repeatCountIdx = 0; repeatCountIdx < kNumSrcRepeatCounts; ++repeatCountIdx) {
+        size_t repeatCount = kSrcRepeatCounts[repeatCountIdx];
+        std::string srcText;
+        
+        for (size_t i = 0; i < repeatCount; ++i) {
+            srcText += inputSrcText;
+        }
+        
+        // Time full lexing and parsing
+        auto startTime = std::chrono::high_resolution_clock::now();
+        
+        for (int i = 0; i < kNumFullParses; ++i) {
+            Wolfc::Lexer lexer;
+            lexer.process(srcText.c_str());
+            Wolfc::LinearAlloc linearAlloc(kASTAllocMaxAllocSize, kASTAllocBlockSize);
+            Wolfc::AST::ParseCtx parseCtx(lexer.getTokenList(),
+                                          lexer.getTokenTypeList(),
+                                          lexer.getSrcLineIndex(),
+                                          linearAlloc);
+            
+            Wolfc::AST::Module::parse(parseCtx);
+        }
+        
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double fullParseSecs = std::chrono::duration<double>(endTime - startTime).count() / kNumFullParses;
+        
+        // Parse the source with the incremental parser, then time the edits
+        Wolfc::AST::IncrementalParser incrementalParser;
+        
+        if (!incrementalParser.parse(srcText.data(), srcText.size()) || incrementalParser.hasErrors()) {
+            std::printf("Failed to parse input Wolf source file '%s'!\n", argv[1]);
+            return -1;
+        }
+        
+        size_t numLines = incrementalParser.getSrcLineIndex().getNumLines();
+        size_t numBytesLexed = 0;
+        size_t numASTNodesCreated = 0;
+        startTime = std::chrono::high_resolution_clock::now();
+        
+        for (int i = 0; i < numEdits; ++i) {
+            size_t line = (static_cast<size_t>(i) * numLines) / static_cast<size_t>(numEdits);
+            uint32_t lineStart = incrementalParser.getSrcLineIndex().getLineStart(line);
+            
+            incrementalParser.applyEdit(lineStart, 0, "\n", 1);
+            numBytesLexed += incrementalParser.getLastReparseStats().numBytesLexed;
+            numASTNodesCreated += incrementalParser.getLastReparseStats().numASTNodesCreated;
+            
+            incrementalParser.applyEdit(lineStart, 1, "", 0);
+            numBytesLexed += incrementalParser.getLastReparseStats().numBytesLexed;
+            numASTNodesCreated += incrementalParser.getLastReparseStats().numASTNodesCreated;
+        }
+        
+        endTime = std::chrono::high_resolution_clock::now();
+        size_t numEditsMade = static_cast<size_t>(numEdits) * 2;
+        double editSecs = std::chrono::duration<double>(endTime - startTime).count() / numEditsMade;
+        
+        // Make sure the edits left things as they should be, then check more kinds of edits
+        if (srcText != incrementalParser.getSrcText() || !checkMatchesFullParse(incrementalParser, true)) {
+            std::printf("Incremental parse does not match a full parse after edits!\n");
+            return -1;
+        }
+        
+        if (!checkEdits(incrementalParser)) {
+            return -1;
+        }
+        
+        // Report the results for this size of source as JSON
+        std::printf("        {\n");
+        std::printf("            \"sourceBytes\": %zu,\n", srcText.size());
+        std::printf("            \"fullParseMs\": %.3f,\n", fullParseSecs * 1000.0);
+        std::printf("            \"usPerEdit\": %.2f,\n", editSecs * 1000000.0);
+        std::printf("            \"bytesLexedPerEdit\": %zu,\n", numBytesLexed / numEditsMade);
+        std::printf("            \"astNodesPerEdit\": %zu,\n", numASTNodesCreated / numEditsMade);
+        std::printf("            \"speedup\": %.1f\n", fullParseSecs / editSecs);
+        std::printf("        }%s\n", (repeatCountIdx + 1 < kNumSrcRepeatCounts) ? "," : "");
+    }
+    
+    std::printf("    ]\n");
+    std::printf("}\n");
+    
+    return 0;
+}
@@ -0,0 +1,227 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+/**
+ * Lexer micro benchmark.
+ * Repeatedly runs the lexer over a given Wolf source file and reports the throughput achieved.
+ *
+ * If a number of threads is given then the parallel lexer is benchmarked as well. Before timing it, the token
+ * stream produced by the parallel lexer is checked against the one produced by the serial lexer: these must be
+ * identical and the benchmark fails if they are not.
+ *
+ * Usage: LexerBenchmark <Input Wolf File> [Num Iterations] [Num Threads]
+ */
+#include "Lexer/Lexer.hpp"
+#include "Lexer/SourceLineIndex.hpp"
+#include "Lexer/Token.hpp"
+#include "SourceBuffer.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <chrono>
+    #include <cstdio>
+    #include <cstdlib>
+    #include <cstring>
+WC_THIRD_PARTY_INCLUDES_END
+
+/* The default number of times to lex the input file */
+static constexpr const int kDefaultNumIterations = 20;
+
+/* Count the number of tokens in the given token list, excluding the EOF token */
+static size_t countTokens(const Wolfc::Token * tokenList) {
+    size_t numTokens = 0;
+    
+    while (tokenList[numTokens].type != Wolfc::TokenType::kEOF) {
+        ++numTokens;
+    }
+    
+    return numTokens;
+}
+
+/* Tells if the data for the two given tokens of the given type matches */
+static bool tokenDataMatches(Wolfc::TokenType tokenType, const Wolfc::Token & tokenA, const Wolfc::Token & tokenB) {
+    switch (tokenType) {
+        case Wolfc::TokenType::kIdentifier: {
+            const auto & identA = tokenA.data.identData;
+            const auto & identB = tokenB.data.identData;
+            return identA.symbolId == identB.symbolId &&
+                   identA.nameLen == identB.nameLen &&
+                   std::memcmp(identA.name, identB.name, identA.nameLen) == 0;
+        }
+        
+        case Wolfc::TokenType::kIntLit: {
+            const auto & intA = tokenA.data.intData;
+            const auto & intB = tokenB.data.intData;
+            return tokenA.intDataTypeId == tokenB.intDataTypeId &&
+                   tokenA.intBitsRequired == tokenB.intBitsRequired &&
+                   intA.valueWords[0] == intB.valueWords[0] &&
+                   intA.valueWords[1] == intB.valueWords[1];
+        }
+        
+        case Wolfc::TokenType::kStrLit: {
+            const auto & strA = tokenA.data.strVal;
+            const auto & strB = tokenB.data.strVal;
+            return strA.size == strB.size && std::memcmp(strA.ptr, strB.ptr, strA.size) == 0;
+        }
+        
+        default:
+            break;
+    }
+    
+    // No data for any other type of token
+    return true;
+}
+
+/**
+ * Check that the tokens and line index produced by the parallel lexer match what the serial lexer produced.
+ * Reports the first mismatch found, if any.
+ */
+static bool parallelLexMatchesSerial(const Wolfc::Lexer & serialLexer, const Wolfc::Lexer & parallelLexer) {
+    if (serialLexer.getTokenCount() != parallelLexer.getTokenCount()) {
+        std::printf("Parallel lex mismatch! Serial lexer produced %zu tokens, parallel lexer produced %zu tokens!\n",
+                    serialLexer.getTokenCount(),
+                    parallelLexer.getTokenCount());
+        
+        return false;
+    }
+    
+    const Wolfc::SourceLineIndex & serialLineIndex = serialLexer.getSrcLineIndex();
+    const Wolfc::SourceLineIndex & parallelLineIndex = parallelLexer.getSrcLineIndex();
+    
+    if (serialLineIndex.getNumLines() != parallelLineIndex.getNumLines()) {
+        std::printf("Parallel lex mismatch! Serial lexer found %zu lines, parallel lexer found %zu lines!\n",
+                    serialLineIndex.getNumLines(),
+                    parallelLineIndex.getNumLines());
+        
+        return false;
+    }
+    
+    for (size_t i = 0; i < serialLexer.getTokenCount(); ++i) {
+        const Wolfc::Token & serialTok = serialLexer.getTokenList()[i];
+        const Wolfc::Token & parallelTok = parallelLexer.getTokenList()[i];
+        
+        if (serialTok.type != parallelTok.type ||
+            serialLexer.getTokenTypeList()[i] != parallelLexer.getTokenTypeList()[i] ||
+            serialTok.flags != parallelTok.flags ||
+            serialTok.startSrcOffset != parallelTok.startSrcOffset ||
+            serialTok.endSrcOffset != parallelTok.endSrcOffset ||
+            serialTok.nextTokenSrcOffset != parallelTok.nextTokenSrcOffset ||
+            serialLineIndex.getLine(serialTok.startSrcOffset) != parallelLineIndex.getLine(parallelTok.startSrcOffset) ||
+            !tokenDataMatches(serialTok.type, serialTok, parallelTok))
+        {
+            std::printf("Parallel lex mismatch! Token %zu (at source offset %u) differs from the serial lexer!\n",
+                        i,
+                        serialTok.startSrcOffset);
+            
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+/* Program entry point */
+int main(int argc, const char * argv[]) {
+    // Arg check
+    if (argc < 2 || argc > 4) {
+        std::printf("Usage: %s <Input Wolf File> [Num Iterations] [Num Threads]\n", argv[0]);
+        return -1;
+    }
+    
+    int numIterations = (argc >= 3) ? std::atoi(argv[2]) : kDefaultNumIterations;
+    
+    if (numIterations <= 0) {
+        std::printf("Number of iterations must be greater than zero!\n");
+        return -1;
+    }
+    
+    int numThreads = (argc >= 4) ? std::atoi(argv[3]) : 0;
+    
+    if (argc >= 4 && numThreads <= 0) {
+        std::printf("Number of threads must be greater than zero!\n");
+        return -1;
+    }
+    
+    // Read the source file
+    Wolfc::SourceBuffer inputSrc;
+    
+    if (!inputSrc.load(argv[1])) {
+        std::printf("Failed to read input Wolf source file '%s'!\n", argv[1]);
+        return -1;
+    }
+    
+    // Lex the source once upfront to warm up and to make sure it is valid
+    size_t numTokens = 0;
+    
+    {
+        Wolfc::Lexer lexer;
+        
+        if (!lexer.process(inputSrc)) {
+            return -1;
+        }
+        
+        numTokens = countTokens(lexer.getTokenList());
+        
+        // If benchmarking the parallel lexer then make sure it gives exactly the same results
+        if (numThreads > 0) {
+            Wolfc::Lexer parallelLexer;
+            
+            if (!parallelLexer.processParallel(inputSrc, static_cast<size_t>(numThreads))) {
+                return -1;
+            }
+            
+            if (!parallelLexMatchesSerial(lexer, parallelLexer)) {
+                return -1;
+            }
+        }
+    }
+    
+    // Now do the timed runs
+    auto startTime = std::chrono::high_resolution_clock::now();
+    
+    for (int i = 0; i < numIterations; ++i) {
+        Wolfc::Lexer lexer;
+        lexer.process(inputSrc);
+    }
+    
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double totalSecs = std::chrono::duration<double>(endTime - startTime).count();
+    double secsPerIteration = totalSecs / numIterations;
+    
+    // Time the parallel lexer too, if requested
+    double parallelSecsPerIteration = 0.0;
+    
+    if (numThreads > 0) {
+        startTime = std::chrono::high_resolution_clock::now();
+        
+        for (int i = 0; i < numIterations; ++i) {
+            Wolfc::Lexer lexer;
+            lexer.processParallel(inputSrc, static_cast<size_t>(numThreads));
+        }
+        
+        endTime = std::chrono::high_resolution_clock::now();
+        parallelSecsPerIteration = std::chrono::duration<double>(endTime - startTime).count() / numIterations;
+    }
+    
+    // Report the results
+    std::printf("File: %s\n", argv[1]);
+    std::printf("Source size: %zu bytes%s\n", inputSrc.getSize(), inputSrc.isMemoryMapped() ? " (memory mapped)" : "");
+    std::printf("Tokens: %zu\n", numTokens);
+    std::printf("Iterations: %d\n", numIterations);
+    std::printf("Time per iteration: %.3f ms\n", secsPerIteration * 1000.0);
+    std::printf("Throughput: %.2f MB/s, %.0f tokens/s\n",
+                (static_cast<double>(inputSrc.getSize()) / (1024.0 * 1024.0)) / secsPerIteration,
+                static_cast<double>(numTokens) / secsPerIteration);
+    
+    if (numThreads > 0) {
+        std::printf("Parallel threads: %d (output matches serial lexer)\n", numThreads);
+        std::printf("Parallel time per iteration: %.3f ms\n", parallelSecsPerIteration * 1000.0);
+        std::printf("Parallel throughput: %.2f MB/s, %.0f tokens/s\n",
+                    (static_cast<double>(inputSrc.getSize()) / (1024.0 * 1024.0)) / parallelSecsPerIteration,
+                    static_cast<double>(numTokens) / parallelSecsPerIteration);
+    }
+    
+    return 0;
+}
@@ -0,0 +1,53 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#include "ASTBinaryFormat.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <limits>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+WC_AST_BEGIN_NAMESPACE
+
+namespace ASTBinaryFormat {
+    /**
+     * Add a section of the given size (number of items by item size) onto the end of the data so far, which is
+     * moved along. Returns false if the data would no longer fit in the address space.
+     */
+    static bool addSection(size_t & dataSize, uint64_t numItems, size_t itemSize, size_t & outSectionOffset) {
+        static constexpr const size_t kMaxSize = std::numeric_limits<size_t>::max() / 2;
+        
+        // Align the start of the section
+        size_t sectionOffset = (dataSize + (kSectionAlign - 1)) & ~(kSectionAlign - 1);
+        WC_GUARD(sectionOffset <= kMaxSize, false);
+        
+        // Make sure the section size can't overflow
+        WC_GUARD(numItems <= (kMaxSize - sectionOffset) / itemSize, false);
+        outSectionOffset = sectionOffset;
+        dataSize = sectionOffset + static_cast<size_t>(numItems) * itemSize;
+        return true;
+    }
+    
+    bool getLayout(const Header & header, Layout & outLayout) {
+        size_t dataSize = sizeof(Header);
+        
+        // Note: the source text has a null terminator
+        WC_GUARD(header.srcTextSize < std::numeric_limits<uint64_t>::max(), false);
+        WC_GUARD(addSection(dataSize, header.srcTextSize + 1, 1, outLayout.srcTextOffset), false);
+        WC_GUARD(addSection(dataSize, header.numLineStarts, sizeof(uint32_t), outLayout.lineStartsOffset), false);
+        WC_GUARD(addSection(dataSize, header.numTokens, sizeof(TokenRecord), outLayout.tokensOffset), false);
+        WC_GUARD(addSection(dataSize, header.tokenValuesNumWords, sizeof(uint32_t), outLayout.tokenValuesOffset),
+                 false);
+        WC_GUARD(addSection(dataSize, header.strDataSize, 1, outLayout.strDataOffset), false);
+        WC_GUARD(addSection(dataSize, header.nodeDataNumWords, sizeof(uint32_t), outLayout.nodeDataOffset), false);
+        outLayout.totalSize = dataSize;
+        return true;
+    }
+}
+
+WC_AST_END_NAMESPACE
+WC_END_NAMESPACE
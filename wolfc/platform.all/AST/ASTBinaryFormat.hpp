@@ -0,0 +1,138 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#pragma once
+
+#include "Lexer/TokenType.hpp"
+#include "Macros.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstddef>
+    #include <cstdint>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+WC_AST_BEGIN_NAMESPACE
+
+/**
+ * Layout of the binary format for a module AST, written by 'ASTBinaryWriter' and loaded by 'ASTBinaryReader'.
+ * This allows the AST for a source file to be reloaded without lexing or parsing it again.
+ *
+ * The format contains no pointers, so it can be loaded at any address. It starts with a header, which is
+ * followed by these sections in order. Each section starts on a 'kSectionAlign' boundary:
+ *
+ * 1 - Source text: the source code that the AST was parsed from, followed by a null terminator.
+ *     Kept so that the source can still be referred to (e.g. in assert messages) without the original file.
+ * 2 - Line starts: the start offset of each line in the source text except the first, see 'SourceLineIndex'.
+ * 3 - Tokens: every distinct token referred to by the AST, as 'TokenRecord' structs. Token 0 is always the EOF
+ *     token for the module.
+ * 4 - Token values: the data for the tokens which have any, as 32-bit words in the same order as the tokens.
+ *     See 'getNumTokenValueWords' for what is stored for each type of token.
+ * 5 - String data: the null terminated names of identifiers and the values of string literals. Each distinct
+ *     string is stored only once, since identifier names are interned by the lexer.
+ * 6 - Node data: the AST nodes as a stream of 32-bit words, with each node written before its children.
+ *     A node is its kind followed by the arguments for its constructor in order: a token is written as its
+ *     index in the token section, a child node is written in full at that point and a list of child nodes is
+ *     written as the number of nodes followed by each node. An optional child node which is not present is
+ *     written as 'kNoNode'.
+ *
+ * Everything is stored in the byte order of the machine that wrote it, the magic number is used to reject data
+ * written with a different byte order.
+ */
+namespace ASTBinaryFormat {
+    /* Magic number at the start of the data: 'WAST' when the bytes are read in order */
+    static constexpr const uint32_t kMagic = 0x54534157;
+    
+    /* Version of the format, must be bumped whenever the format, the node kinds or any node constructor changes */
+    static constexpr const uint32_t kVersion = 1;
+    
+    /* Alignment for the start of each section in the data */
+    static constexpr const size_t kSectionAlign = 8;
+    
+    /* Written in place of an optional child node which is not present */
+    static constexpr const uint32_t kNoNode = 0xFFFFFFFF;
+    
+    /* Header at the start of the data */
+    struct Header {
+        /* Must be 'kMagic', this also checks the byte order */
+        uint32_t magic;
+        
+        /* Must be 'kVersion' */
+        uint32_t version;
+        
+        /* The number of AST nodes in the node data */
+        uint32_t numNodes;
+        
+        /* The number of lines in the line starts section, which does not include the first line */
+        uint32_t numLineStarts;
+        
+        /* The number of tokens in the token section */
+        uint32_t numTokens;
+        
+        /* Unused, must be zero */
+        uint32_t reserved;
+        
+        /* The size in bytes of the source text section, not including the null terminator */
+        uint64_t srcTextSize;
+        
+        /* The number of 32-bit words in the token values section */
+        uint64_t tokenValuesNumWords;
+        
+        /* The size in bytes of the string data section */
+        uint64_t strDataSize;
+        
+        /* The number of 32-bit words in the node data section */
+        uint64_t nodeDataNumWords;
+    };
+    
+    /* A token in the token section. Holds all the fields of a 'Token' apart from its data, see 'Token'. */
+    struct TokenRecord {
+        uint8_t type;
+        uint8_t flags;
+        uint8_t intDataTypeId;
+        uint8_t intBitsRequired;
+        uint32_t startSrcOffset;
+        uint32_t endSrcOffset;
+        uint32_t nextTokenSrcOffset;
+    };
+    
+    /**
+     * Get the number of words in the token values section used by a token of the given type:
+     *
+     *  - Identifiers: the offset of the name in the string data, then the length of the name.
+     *  - String literals: the offset of the value in the string data, then the size of the value.
+     *  - Integer literals: the value, as 32-bit words with the least significant word first.
+     *  - Anything else: nothing.
+     */
+    inline uint32_t getNumTokenValueWords(TokenType tokenType) {
+        switch (tokenType) {
+            case TokenType::kIdentifier: return 2;
+            case TokenType::kStrLit: return 2;
+            case TokenType::kIntLit: return 4;
+            default: return 0;
+        }
+    }
+    
+    /* The offset of each section from the start of the data, and the total size of the data */
+    struct Layout {
+        size_t srcTextOffset;
+        size_t lineStartsOffset;
+        size_t tokensOffset;
+        size_t tokenValuesOffset;
+        size_t strDataOffset;
+        size_t nodeDataOffset;
+        size_t totalSize;
+    };
+    
+    /**
+     * Work out the layout of the data from the given header. Returns false if the sizes in the header are too big
+     * to be valid, i.e. the data would not fit in the address space.
+     */
+    bool getLayout(const Header & header, Layout & outLayout);
+}
+
+WC_AST_END_NAMESPACE
+WC_END_NAMESPACE
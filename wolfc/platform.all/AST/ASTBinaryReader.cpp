@@ -0,0 +1,875 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#include "ASTBinaryReader.hpp"
+
+#include "ASTBinaryFormat.hpp"
+#include "Finally.hpp"
+#include "Lexer/SourceLineIndex.hpp"
+#include "Lexer/SymbolTable.hpp"
+#include "Lexer/Token.hpp"
+#include "LinearAlloc.hpp"
+#include "Nodes/AddExpr.hpp"
+#include "Nodes/ArrayLit.hpp"
+#include "Nodes/AssertStmnt.hpp"
+#include "Nodes/AssignExpr.hpp"
+#include "Nodes/BoolLit.hpp"
+#include "Nodes/BreakStmnt.hpp"
+#include "Nodes/CastExpr.hpp"
+#include "Nodes/CmpExpr.hpp"
+#include "Nodes/DeclDef.hpp"
+#include "Nodes/Func.hpp"
+#include "Nodes/FuncArg.hpp"
+#include "Nodes/Identifier.hpp"
+#include "Nodes/IfStmnt.hpp"
+#include "Nodes/IntLit.hpp"
+#include "Nodes/LAndExpr.hpp"
+#include "Nodes/LOrExpr.hpp"
+#include "Nodes/LoopStmnt.hpp"
+#include "Nodes/Module.hpp"
+#include "Nodes/MulExpr.hpp"
+#include "Nodes/NextStmnt.hpp"
+#include "Nodes/NoOpStmnt.hpp"
+#include "Nodes/NotExpr.hpp"
+#include "Nodes/NullLit.hpp"
+#include "Nodes/PostfixExpr.hpp"
+#include "Nodes/PrefixExpr.hpp"
+#include "Nodes/PrimaryExpr.hpp"
+#include "Nodes/PrimitiveType.hpp"
+#include "Nodes/PrintStmnt.hpp"
+#include "Nodes/RandExpr.hpp"
+#include "Nodes/ReadnumExpr.hpp"
+#include "Nodes/ReturnStmnt.hpp"
+#include "Nodes/Scope.hpp"
+#include "Nodes/ScopeStmnt.hpp"
+#include "Nodes/ShiftExpr.hpp"
+#include "Nodes/Stmnt.hpp"
+#include "Nodes/StrLit.hpp"
+#include "Nodes/TernaryExpr.hpp"
+#include "Nodes/TimeExpr.hpp"
+#include "Nodes/Type.hpp"
+#include "Nodes/VarDecl.hpp"
+#include "Nodes/WhileStmnt.hpp"
+#include "ParseCtx.hpp"
+#include "ScratchList.hpp"
+#include "SourceBuffer.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstring>
+    #include <vector>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+WC_AST_BEGIN_NAMESPACE
+
+/**
+ * Tells if a node of the given kind is of the type 'T'. Concrete node types have just the one kind, abstract
+ * node types have a specialization below which lists the kinds of all the concrete types derived from them.
+ */
+template <typename T>
+struct NodeTypeKinds {
+    static inline bool contains(ASTNodeKind kind) {
+        return kind == ASTNodeKindOf<T>::kKind;
+    }
+};
+
+template <>
+struct NodeTypeKinds<Expr> {
+    static inline bool contains(ASTNodeKind kind) {
+        // Note: some of the expression kinds are not actually derived from 'Expr', only from 'IExpr'
+        switch (kind) {
+            case ASTNodeKind::kArrayLit:
+            case ASTNodeKind::kBoolLit:
+            case ASTNodeKind::kIdentifier:
+            case ASTNodeKind::kIntLit:
+            case ASTNodeKind::kNullLit:
+            case ASTNodeKind::kRandExprRand:
+            case ASTNodeKind::kRandExprSRand:
+            case ASTNodeKind::kReadnumExpr:
+            case ASTNodeKind::kStrLit:
+            case ASTNodeKind::kTimeExpr:
+                return false;
+            
+            default:
+                return isExprKind(kind);
+        }
+    }
+};
+
+template <>
+struct NodeTypeKinds<Stmnt> {
+    static inline bool contains(ASTNodeKind kind) {
+        return kind >= ASTNodeKind::kStmntAssertStmnt && kind <= ASTNodeKind::kStmntWhileStmnt;
+    }
+};
+
+template <>
+struct NodeTypeKinds<Type> {
+    static inline bool contains(ASTNodeKind kind) {
+        return kind == ASTNodeKind::kTypeArray ||
+               kind == ASTNodeKind::kTypePrimitive ||
+               kind == ASTNodeKind::kTypePtr;
+    }
+};
+
+template <>
+struct NodeTypeKinds<DeclDef> {
+    static inline bool contains(ASTNodeKind kind) {
+        return kind == ASTNodeKind::kDeclDefFunc || kind == ASTNodeKind::kDeclDefVarDecl;
+    }
+};
+
+template <>
+struct NodeTypeKinds<VarDecl> {
+    static inline bool contains(ASTNodeKind kind) {
+        return kind == ASTNodeKind::kVarDeclExplicitType || kind == ASTNodeKind::kVarDeclInferType;
+    }
+};
+
+template <>
+struct NodeTypeKinds<IfStmnt> {
+    static inline bool contains(ASTNodeKind kind) {
+        return kind == ASTNodeKind::kIfStmntElse ||
+               kind == ASTNodeKind::kIfStmntElseIf ||
+               kind == ASTNodeKind::kIfStmntNoElse;
+    }
+};
+
+template <>
+struct NodeTypeKinds<LoopStmnt> {
+    static inline bool contains(ASTNodeKind kind) {
+        return kind == ASTNodeKind::kLoopStmntNoCond || kind == ASTNodeKind::kLoopStmntWithCond;
+    }
+};
+
+template <>
+struct NodeTypeKinds<BreakStmnt> {
+    static inline bool contains(ASTNodeKind kind) {
+        return kind == ASTNodeKind::kBreakStmntNoCond || kind == ASTNodeKind::kBreakStmntWithCond;
+    }
+};
+
+template <>
+struct NodeTypeKinds<NextStmnt> {
+    static inline bool contains(ASTNodeKind kind) {
+        return kind == ASTNodeKind::kNextStmntNoCond || kind == ASTNodeKind::kNextStmntWithCond;
+    }
+};
+
+template <>
+struct NodeTypeKinds<ReturnStmnt> {
+    static inline bool contains(ASTNodeKind kind) {
+        return kind == ASTNodeKind::kReturnStmntNoCondVoid ||
+               kind == ASTNodeKind::kReturnStmntNoCondWithValue ||
+               kind == ASTNodeKind::kReturnStmntWithCondAndValue ||
+               kind == ASTNodeKind::kReturnStmntWithCondVoid;
+    }
+};
+
+template <>
+struct NodeTypeKinds<RandExpr> {
+    static inline bool contains(ASTNodeKind kind) {
+        return kind == ASTNodeKind::kRandExprRand || kind == ASTNodeKind::kRandExprSRand;
+    }
+};
+
+/**
+ * Create the tokens for the AST from the token section and token values section of the binary data, checking
+ * that they are valid. Identifier names are interned in the given symbol table and string literals are pointed
+ * at the given copy of the string data section. Returns false if any of the tokens are not valid.
+ */
+static bool loadTokens(const ASTBinaryFormat::TokenRecord * tokenRecords,
+                       size_t numTokens,
+                       const uint32_t * tokenValues,
+                       size_t tokenValuesNumWords,
+                       size_t srcTextSize,
+                       const char * strData,
+                       size_t strDataSize,
+                       SymbolTable & symbolTable,
+                       std::vector<Token> & outTokens)
+{
+    const uint32_t * tokenValuesEnd = tokenValues + tokenValuesNumWords;
+    outTokens.resize(numTokens);
+    
+    for (size_t i = 0; i < numTokens; ++i) {
+        const ASTBinaryFormat::TokenRecord & tokenRecord = tokenRecords[i];
+        WC_GUARD(tokenRecord.type < kNumTokenTypes, false);
+        WC_GUARD(tokenRecord.startSrcOffset <= tokenRecord.endSrcOffset, false);
+        WC_GUARD(tokenRecord.endSrcOffset <= srcTextSize, false);
+        WC_GUARD(tokenRecord.nextTokenSrcOffset <= srcTextSize, false);
+        
+        Token & token = outTokens[i];
+        token.type = static_cast<TokenType>(tokenRecord.type);
+        token.flags = tokenRecord.flags;
+        token.intDataTypeId = static_cast<DataTypeId>(tokenRecord.intDataTypeId);
+        token.intBitsRequired = tokenRecord.intBitsRequired;
+        token.startSrcOffset = tokenRecord.startSrcOffset;
+        token.endSrcOffset = tokenRecord.endSrcOffset;
+        token.nextTokenSrcOffset = tokenRecord.nextTokenSrcOffset;
+        
+        // Read the value for the token, if it has one
+        size_t numValueWords = ASTBinaryFormat::getNumTokenValueWords(token.type);
+        WC_GUARD(numValueWords <= static_cast<size_t>(tokenValuesEnd - tokenValues), false);
+        
+        switch (token.type) {
+            case TokenType::kIdentifier: {
+                // The name must lie within the string data and be null terminated
+                uint32_t nameOffset = tokenValues[0];
+                uint32_t nameLen = tokenValues[1];
+                WC_GUARD(nameOffset < strDataSize && nameLen < strDataSize - nameOffset, false);
+                WC_GUARD(strData[nameOffset + nameLen] == 0, false);
+                
+                SymbolId symbolId = symbolTable.intern(strData + nameOffset, nameLen);
+                token.data.identData.name = symbolTable.getSymbolName(symbolId);
+                token.data.identData.nameLen = nameLen;
+                token.data.identData.symbolId = symbolId;
+            }   break;
+            
+            case TokenType::kStrLit: {
+                // The value must lie within the string data and be null terminated
+                uint32_t strOffset = tokenValues[0];
+                uint32_t strSize = tokenValues[1];
+                WC_GUARD(strOffset < strDataSize && strSize < strDataSize - strOffset, false);
+                WC_GUARD(strData[strOffset + strSize] == 0, false);
+                
+                token.data.strVal.ptr = const_cast<char*>(strData + strOffset);
+                token.data.strVal.size = strSize;
+            }   break;
+            
+            case TokenType::kIntLit: {
+                WC_GUARD(token.intDataTypeId >= DataTypeId::kInt8 && token.intDataTypeId <= DataTypeId::kUInt128,
+                         false);
+                
+                token.data.intData.valueWords[0] = tokenValues[0] | (static_cast<uint64_t>(tokenValues[1]) << 32);
+                token.data.intData.valueWords[1] = tokenValues[2] | (static_cast<uint64_t>(tokenValues[3]) << 32);
+            }   break;
+            
+            default:
+                break;
+        }
+        
+        tokenValues += numValueWords;
+    }
+    
+    // All the token values must have been used, and token 0 must be the EOF token for the module
+    WC_GUARD(tokenValues == tokenValuesEnd, false);
+    WC_GUARD(!outTokens.empty() && outTokens[0].type == TokenType::kEOF, false);
+    return true;
+}
+
+Module * ASTBinaryReader::read(const void * data,
+                               size_t dataSize,
+                               LinearAlloc & linearAlloc,
+                               SymbolTable & symbolTable,
+                               SourceLineIndex & srcLineIndex)
+{
+    // Check the header and that all of the sections are within the data
+    const uint8_t * dataPtr = static_cast<const uint8_t*>(data);
+    WC_GUARD((reinterpret_cast<uintptr_t>(dataPtr) & (ASTBinaryFormat::kSectionAlign - 1)) == 0, nullptr);
+    WC_GUARD(dataSize >= sizeof(ASTBinaryFormat::Header), nullptr);
+    
+    ASTBinaryFormat::Header header;
+    std::memcpy(&header, dataPtr, sizeof(header));
+    WC_GUARD(header.magic == ASTBinaryFormat::kMagic, nullptr);
+    WC_GUARD(header.version == ASTBinaryFormat::kVersion, nullptr);
+    WC_GUARD(header.reserved == 0, nullptr);
+    
+    ASTBinaryFormat::Layout layout;
+    WC_GUARD(ASTBinaryFormat::getLayout(header, layout), nullptr);
+    WC_GUARD(layout.totalSize == dataSize, nullptr);
+    
+    // Source offsets in tokens are 32-bit, so the source text can't be any bigger than that
+    WC_GUARD(header.srcTextSize <= UINT32_MAX, nullptr);
+    
+    // Copy the source text into the linear allocator, so it lives as long as the AST does.
+    // Note: the null terminator is not taken from the data, since it is not included in the source text size.
+    size_t srcTextSize = static_cast<size_t>(header.srcTextSize);
+    char * srcText = static_cast<char*>(linearAlloc.alloc(srcTextSize + 1, 1));
+    std::memcpy(srcText, dataPtr + layout.srcTextOffset, srcTextSize);
+    srcText[srcTextSize] = 0;
+    
+    // Rebuild the line index, line starts must be in order and within the source text
+    srcLineIndex.reset(srcText);
+    const uint32_t * lineStarts = reinterpret_cast<const uint32_t*>(dataPtr + layout.lineStartsOffset);
+    uint32_t prevLineStart = 0;
+    
+    for (uint32_t i = 0; i < header.numLineStarts; ++i) {
+        uint32_t lineStart = lineStarts[i];
+        WC_GUARD(lineStart > prevLineStart && lineStart <= srcTextSize, nullptr);
+        srcLineIndex.addLineStart(lineStart);
+        prevLineStart = lineStart;
+    }
+    
+    // Copy the string data into the linear allocator for the values of string literals, then load the tokens.
+    // Note: the tokens are only needed while reading, since AST nodes keep their own copies of tokens.
+    size_t strDataSize = static_cast<size_t>(header.strDataSize);
+    char * strData = static_cast<char*>(linearAlloc.alloc(strDataSize, 1));
+    std::memcpy(strData, dataPtr + layout.strDataOffset, strDataSize);
+    
+    std::vector<Token> tokens;
+    WC_GUARD(loadTokens(reinterpret_cast<const ASTBinaryFormat::TokenRecord*>(dataPtr + layout.tokensOffset),
+                        header.numTokens,
+                        reinterpret_cast<const uint32_t*>(dataPtr + layout.tokenValuesOffset),
+                        static_cast<size_t>(header.tokenValuesNumWords),
+                        srcTextSize,
+                        strData,
+                        strDataSize,
+                        symbolTable,
+                        tokens),
+             nullptr);
+    
+    // Now read all of the nodes, these must make up exactly one module and use all of the node data
+    ParseCtx parseCtx(&tokens[0], &tokens[0].type, srcLineIndex, linearAlloc);
+    ASTBinaryReader reader(parseCtx,
+                           tokens.data(),
+                           tokens.size(),
+                           reinterpret_cast<const uint32_t*>(dataPtr + layout.nodeDataOffset),
+                           static_cast<size_t>(header.nodeDataNumWords));
+    
+    Module * module = reader.readNode<Module>();
+    WC_GUARD(module, nullptr);
+    WC_GUARD(reader.isAtEnd(), nullptr);
+    WC_GUARD(parseCtx.getNumASTNodes() == header.numNodes, nullptr);
+    return module;
+}
+
+Module * ASTBinaryReader::readFile(const char * filePath,
+                                   LinearAlloc & linearAlloc,
+                                   SymbolTable & symbolTable,
+                                   SourceLineIndex & srcLineIndex)
+{
+    // Note: the data is copied out of the buffer while reading, so it doesn't need to be kept around
+    SourceBuffer fileData;
+    WC_GUARD(fileData.load(filePath), nullptr);
+    return read(fileData.getText(), fileData.getSize(), linearAlloc, symbolTable, srcLineIndex);
+}
+
+ASTBinaryReader::ASTBinaryReader(ParseCtx & parseCtx,
+                                 const Token * tokens,
+                                 size_t numTokens,
+                                 const uint32_t * nodeData,
+                                 size_t nodeDataNumWords)
+:
+    mParseCtx(parseCtx),
+    mTokens(tokens),
+    mNumTokens(numTokens),
+    mNodeDataPtr(nodeData),
+    mNodeDataEndPtr(nodeData + nodeDataNumWords)
+{
+    WC_EMPTY_FUNC_BODY();
+}
+
+bool ASTBinaryReader::readWord(uint32_t & outWord) {
+    WC_GUARD(mNodeDataPtr < mNodeDataEndPtr, false);
+    outWord = *mNodeDataPtr;
+    ++mNodeDataPtr;
+    return true;
+}
+
+const Token * ASTBinaryReader::readToken() {
+    uint32_t tokenIndex = 0;
+    WC_GUARD(readWord(tokenIndex), nullptr);
+    WC_GUARD(tokenIndex < mNumTokens, nullptr);
+    return &mTokens[tokenIndex];
+}
+
+template <typename T>
+T * ASTBinaryReader::readNode() {
+    // Check the kind of the node is one we expect before reading the rest of it
+    uint32_t kindWord = 0;
+    WC_GUARD(readWord(kindWord), nullptr);
+    WC_GUARD(kindWord <= UINT8_MAX, nullptr);
+    ASTNodeKind kind = static_cast<ASTNodeKind>(kindWord);
+    WC_GUARD(NodeTypeKinds<T>::contains(kind), nullptr);
+    return static_cast<T*>(readNodeOfKind(kind));
+}
+
+template <typename T>
+bool ASTBinaryReader::readOptionalNode(T *& outNode) {
+    WC_GUARD(mNodeDataPtr < mNodeDataEndPtr, false);
+    
+    if (*mNodeDataPtr == ASTBinaryFormat::kNoNode) {
+        ++mNodeDataPtr;
+        outNode = nullptr;
+        return true;
+    }
+    
+    outNode = readNode<T>();
+    return outNode != nullptr;
+}
+
+template <typename T>
+bool ASTBinaryReader::readNodeList(Span<T*> & outNodes) {
+    uint32_t numNodes = 0;
+    WC_GUARD(readWord(numNodes), false);
+    
+    // Every node takes up at least one word, so the count can be sanity checked against what is left
+    WC_GUARD(numNodes <= static_cast<size_t>(mNodeDataEndPtr - mNodeDataPtr), false);
+    ScratchList<T> nodes(mParseCtx);
+    
+    for (uint32_t i = 0; i < numNodes; ++i) {
+        T * node = readNode<T>();
+        WC_GUARD(node, false);
+        nodes.push(node);
+    }
+    
+    outNodes = nodes.finish();
+    return true;
+}
+
+template <typename T>
+T * ASTBinaryReader::readTwoOpsNode() {
+    Expr * leftExpr = readNode<Expr>();
+    WC_GUARD(leftExpr, nullptr);
+    Expr * rightExpr = readNode<Expr>();
+    WC_GUARD(rightExpr, nullptr);
+    return WC_NEW_AST_NODE(mParseCtx, T, *leftExpr, *rightExpr);
+}
+
+template <typename T>
+T * ASTBinaryReader::readTokenNode() {
+    const Token * token = readToken();
+    WC_GUARD(token, nullptr);
+    return WC_NEW_AST_NODE(mParseCtx, T, *token);
+}
+
+template <typename T, typename ChildT>
+T * ASTBinaryReader::readWrapperNode() {
+    ChildT * child = readNode<ChildT>();
+    WC_GUARD(child, nullptr);
+    return WC_NEW_AST_NODE(mParseCtx, T, *child);
+}
+
+template <typename T>
+T * ASTBinaryReader::readTokenExprNode() {
+    const Token * token = readToken();
+    WC_GUARD(token, nullptr);
+    Expr * expr = readNode<Expr>();
+    WC_GUARD(expr, nullptr);
+    return WC_NEW_AST_NODE(mParseCtx, T, *token, *expr);
+}
+
+template <typename T>
+T * ASTBinaryReader::readExprTokenNode() {
+    Expr * expr = readNode<Expr>();
+    WC_GUARD(expr, nullptr);
+    const Token * token = readToken();
+    WC_GUARD(token, nullptr);
+    return WC_NEW_AST_NODE(mParseCtx, T, *expr, *token);
+}
+
+template <typename T>
+T * ASTBinaryReader::readTokenTokenNode() {
+    const Token * startToken = readToken();
+    WC_GUARD(startToken, nullptr);
+    const Token * endToken = readToken();
+    WC_GUARD(endToken, nullptr);
+    return WC_NEW_AST_NODE(mParseCtx, T, *startToken, *endToken);
+}
+
+template <typename T>
+T * ASTBinaryReader::readTokenExprTokenNode() {
+    const Token * startToken = readToken();
+    WC_GUARD(startToken, nullptr);
+    Expr * expr = readNode<Expr>();
+    WC_GUARD(expr, nullptr);
+    const Token * endToken = readToken();
+    WC_GUARD(endToken, nullptr);
+    return WC_NEW_AST_NODE(mParseCtx, T, *startToken, *expr, *endToken);
+}
+
+template <typename T>
+T * ASTBinaryReader::readTokenTokenExprNode() {
+    const Token * token = readToken();
+    WC_GUARD(token, nullptr);
+    const Token * condToken = readToken();
+    WC_GUARD(condToken, nullptr);
+    Expr * condExpr = readNode<Expr>();
+    WC_GUARD(condExpr, nullptr);
+    return WC_NEW_AST_NODE(mParseCtx, T, *token, *condToken, *condExpr);
+}
+
+Func * ASTBinaryReader::readFunc() {
+    // All nodes read from here on until the function is done are inside of it
+    Func * func = mParseCtx.reserveASTNode<Func>();
+    Func * outerFunc = mParseCtx.setCurrentFunc(func);
+    Finally restoreOuterFunc([&](){ mParseCtx.setCurrentFunc(outerFunc); });
+    
+    const Token * startToken = readToken();
+    WC_GUARD(startToken, nullptr);
+    Identifier * identifier = readNode<Identifier>();
+    WC_GUARD(identifier, nullptr);
+    Span<FuncArg*> funcArgs;
+    WC_GUARD(readNodeList(funcArgs), nullptr);
+    Type * explicitReturnType = nullptr;
+    WC_GUARD(readOptionalNode(explicitReturnType), nullptr);
+    Scope * scope = readNode<Scope>();
+    WC_GUARD(scope, nullptr);
+    const Token * endToken = readToken();
+    WC_GUARD(endToken, nullptr);
+    
+    // The function itself is inside of the outer function (if any)
+    mParseCtx.setCurrentFunc(outerFunc);
+    return WC_NEW_RESERVED_AST_NODE(mParseCtx,
+                                    func,
+                                    Func,
+                                    *startToken,
+                                    *identifier,
+                                    funcArgs,
+                                    explicitReturnType,
+                                    *scope,
+                                    *endToken);
+}
+
+Scope * ASTBinaryReader::readScope() {
+    // All nodes read from here on until the scope is done are inside of it
+    Scope * scope = mParseCtx.reserveASTNode<Scope>();
+    Scope * outerScope = mParseCtx.setCurrentScope(scope);
+    Finally restoreOuterScope([&](){ mParseCtx.setCurrentScope(outerScope); });
+    
+    const Token * startToken = readToken();
+    WC_GUARD(startToken, nullptr);
+    Span<Stmnt*> stmnts;
+    WC_GUARD(readNodeList(stmnts), nullptr);
+    
+    // The scope itself is inside of the outer scope
+    mParseCtx.setCurrentScope(outerScope);
+    return WC_NEW_RESERVED_AST_NODE(mParseCtx, scope, Scope, *startToken, stmnts);
+}
+
+ASTNode * ASTBinaryReader::readNodeOfKind(ASTNodeKind kind) {
+    switch (kind) {
+        case ASTNodeKind::kAddExprAdd: return readTwoOpsNode<AddExprAdd>();
+        case ASTNodeKind::kAddExprBOr: return readTwoOpsNode<AddExprBOr>();
+        case ASTNodeKind::kAddExprBXor: return readTwoOpsNode<AddExprBXor>();
+        case ASTNodeKind::kAddExprSub: return readTwoOpsNode<AddExprSub>();
+        
+        case ASTNodeKind::kArrayLit: {
+            const Token * lBrack = readToken();
+            WC_GUARD(lBrack, nullptr);
+            Span<Expr*> exprs;
+            WC_GUARD(readNodeList(exprs), nullptr);
+            const Token * rBrack = readToken();
+            WC_GUARD(rBrack, nullptr);
+            return WC_NEW_AST_NODE(mParseCtx, ArrayLit, *lBrack, exprs, *rBrack);
+        }
+        
+        case ASTNodeKind::kAssignExprAssign: return readTwoOpsNode<AssignExprAssign>();
+        case ASTNodeKind::kAssignExprAssignARShift: return readTwoOpsNode<AssignExprAssignARShift>();
+        case ASTNodeKind::kAssignExprAssignAdd: return readTwoOpsNode<AssignExprAssignAdd>();
+        case ASTNodeKind::kAssignExprAssignBAnd: return readTwoOpsNode<AssignExprAssignBAnd>();
+        case ASTNodeKind::kAssignExprAssignBOr: return readTwoOpsNode<AssignExprAssignBOr>();
+        case ASTNodeKind::kAssignExprAssignBXor: return readTwoOpsNode<AssignExprAssignBXor>();
+        case ASTNodeKind::kAssignExprAssignDiv: return readTwoOpsNode<AssignExprAssignDiv>();
+        case ASTNodeKind::kAssignExprAssignLRShift: return readTwoOpsNode<AssignExprAssignLRShift>();
+        case ASTNodeKind::kAssignExprAssignLShift: return readTwoOpsNode<AssignExprAssignLShift>();
+        case ASTNodeKind::kAssignExprAssignMul: return readTwoOpsNode<AssignExprAssignMul>();
+        case ASTNodeKind::kAssignExprAssignRem: return readTwoOpsNode<AssignExprAssignRem>();
+        case ASTNodeKind::kAssignExprAssignSub: return readTwoOpsNode<AssignExprAssignSub>();
+        case ASTNodeKind::kBoolLit: return readTokenNode<BoolLit>();
+        
+        case ASTNodeKind::kCastExprCast: {
+            const Token * startToken = readToken();
+            WC_GUARD(startToken, nullptr);
+            Expr * expr = readNode<Expr>();
+            WC_GUARD(expr, nullptr);
+            Type * type = readNode<Type>();
+            WC_GUARD(type, nullptr);
+            const Token * endToken = readToken();
+            WC_GUARD(endToken, nullptr);
+            return WC_NEW_AST_NODE(mParseCtx, CastExprCast, *startToken, *expr, *type, *endToken);
+        }
+        
+        case ASTNodeKind::kCmpExprEQ: return readTwoOpsNode<CmpExprEQ>();
+        case ASTNodeKind::kCmpExprGE: return readTwoOpsNode<CmpExprGE>();
+        case ASTNodeKind::kCmpExprGT: return readTwoOpsNode<CmpExprGT>();
+        case ASTNodeKind::kCmpExprLE: return readTwoOpsNode<CmpExprLE>();
+        case ASTNodeKind::kCmpExprLT: return readTwoOpsNode<CmpExprLT>();
+        case ASTNodeKind::kCmpExprNE: return readTwoOpsNode<CmpExprNE>();
+        case ASTNodeKind::kIdentifier: return readTokenNode<Identifier>();
+        case ASTNodeKind::kIntLit: return readTokenNode<IntLit>();
+        case ASTNodeKind::kLAndExprAnd: return readTwoOpsNode<LAndExprAnd>();
+        case ASTNodeKind::kLOrExprOr: return readTwoOpsNode<LOrExprOr>();
+        case ASTNodeKind::kMulExprBAnd: return readTwoOpsNode<MulExprBAnd>();
+        case ASTNodeKind::kMulExprDiv: return readTwoOpsNode<MulExprDiv>();
+        case ASTNodeKind::kMulExprMul: return readTwoOpsNode<MulExprMul>();
+        case ASTNodeKind::kMulExprRem: return readTwoOpsNode<MulExprRem>();
+        case ASTNodeKind::kNotExprBNot: return readExprTokenNode<NotExprBNot>();
+        case ASTNodeKind::kNotExprLNot: return readExprTokenNode<NotExprLNot>();
+        case ASTNodeKind::kNullLit: return readTokenNode<NullLit>();
+        
+        case ASTNodeKind::kPostfixExprArrayLookup: {
+            Expr * arrayExpr = readNode<Expr>();
+            WC_GUARD(arrayExpr, nullptr);
+            Expr * indexExpr = readNode<Expr>();
+            WC_GUARD(indexExpr, nullptr);
+            const Token * endToken = readToken();
+            WC_GUARD(endToken, nullptr);
+            return WC_NEW_AST_NODE(mParseCtx, PostfixExprArrayLookup, *arrayExpr, *indexExpr, *endToken);
+        }
+        
+        case ASTNodeKind::kPostfixExprDec: return readExprTokenNode<PostfixExprDec>();
+        
+        case ASTNodeKind::kPostfixExprFuncCall: {
+            Expr * operandExpr = readNode<Expr>();
+            WC_GUARD(operandExpr, nullptr);
+            const Token * openingParen = readToken();
+            WC_GUARD(openingParen, nullptr);
+            Span<Expr*> argExprs;
+            WC_GUARD(readNodeList(argExprs), nullptr);
+            const Token * closingParen = readToken();
+            WC_GUARD(closingParen, nullptr);
+            return WC_NEW_AST_NODE(mParseCtx,
+                                   PostfixExprFuncCall,
+                                   *operandExpr,
+                                   *openingParen,
+                                   argExprs,
+                                   *closingParen);
+        }
+        
+        case ASTNodeKind::kPostfixExprInc: return readExprTokenNode<PostfixExprInc>();
+        case ASTNodeKind::kPrefixExprAddrOf: return readTokenExprNode<PrefixExprAddrOf>();
+        case ASTNodeKind::kPrefixExprMinus: return readTokenExprNode<PrefixExprMinus>();
+        case ASTNodeKind::kPrefixExprPlus: return readTokenExprNode<PrefixExprPlus>();
+        case ASTNodeKind::kPrefixExprPtrDenull: return readTokenExprNode<PrefixExprPtrDenull>();
+        case ASTNodeKind::kPrefixExprPtrDeref: return readTokenExprNode<PrefixExprPtrDeref>();
+        case ASTNodeKind::kPrimaryExprArrayLit: return readWrapperNode<PrimaryExprArrayLit, ArrayLit>();
+        case ASTNodeKind::kPrimaryExprBoolLit: return readWrapperNode<PrimaryExprBoolLit, BoolLit>();
+        case ASTNodeKind::kPrimaryExprIdentifier: return readWrapperNode<PrimaryExprIdentifier, Identifier>();
+        case ASTNodeKind::kPrimaryExprIntLit: return readWrapperNode<PrimaryExprIntLit, IntLit>();
+        case ASTNodeKind::kPrimaryExprNullLit: return readWrapperNode<PrimaryExprNullLit, NullLit>();
+        case ASTNodeKind::kPrimaryExprParen: return readTokenExprTokenNode<PrimaryExprParen>();
+        case ASTNodeKind::kPrimaryExprRandExpr: return readWrapperNode<PrimaryExprRandExpr, RandExpr>();
+        case ASTNodeKind::kPrimaryExprReadnumExpr: return readWrapperNode<PrimaryExprReadnumExpr, ReadnumExpr>();
+        case ASTNodeKind::kPrimaryExprStrLit: return readWrapperNode<PrimaryExprStrLit, StrLit>();
+        case ASTNodeKind::kPrimaryExprTimeExpr: return readWrapperNode<PrimaryExprTimeExpr, TimeExpr>();
+        case ASTNodeKind::kRandExprRand: return readTokenTokenNode<RandExprRand>();
+        case ASTNodeKind::kRandExprSRand: return readTokenExprTokenNode<RandExprSRand>();
+        case ASTNodeKind::kReadnumExpr: return readTokenTokenNode<ReadnumExpr>();
+        case ASTNodeKind::kShiftExprARShift: return readTwoOpsNode<ShiftExprARShift>();
+        case ASTNodeKind::kShiftExprLRShift: return readTwoOpsNode<ShiftExprLRShift>();
+        case ASTNodeKind::kShiftExprLShift: return readTwoOpsNode<ShiftExprLShift>();
+        case ASTNodeKind::kStrLit: return readTokenNode<StrLit>();
+        
+        case ASTNodeKind::kTernaryExprWithCond: {
+            Expr * condExpr = readNode<Expr>();
+            WC_GUARD(condExpr, nullptr);
+            Expr * trueExpr = readNode<Expr>();
+            WC_GUARD(trueExpr, nullptr);
+            Expr * falseExpr = readNode<Expr>();
+            WC_GUARD(falseExpr, nullptr);
+            return WC_NEW_AST_NODE(mParseCtx, TernaryExprWithCond, *condExpr, *trueExpr, *falseExpr);
+        }
+        
+        case ASTNodeKind::kTimeExpr: return readTokenTokenNode<TimeExpr>();
+        case ASTNodeKind::kAssertStmnt: return readTokenExprTokenNode<AssertStmnt>();
+        case ASTNodeKind::kBreakStmntNoCond: return readTokenNode<BreakStmntNoCond>();
+        case ASTNodeKind::kBreakStmntWithCond: return readTokenTokenExprNode<BreakStmntWithCond>();
+        
+        case ASTNodeKind::kIfStmntElse: {
+            Expr * ifExpr = readNode<Expr>();
+            WC_GUARD(ifExpr, nullptr);
+            Scope * thenScope = readNode<Scope>();
+            WC_GUARD(thenScope, nullptr);
+            Scope * elseScope = readNode<Scope>();
+            WC_GUARD(elseScope, nullptr);
+            const Token * startToken = readToken();
+            WC_GUARD(startToken, nullptr);
+            const Token * endToken = readToken();
+            WC_GUARD(endToken, nullptr);
+            return WC_NEW_AST_NODE(mParseCtx,
+                                   IfStmntElse,
+                                   *ifExpr,
+                                   *thenScope,
+                                   *elseScope,
+                                   *startToken,
+                                   *endToken);
+        }
+        
+        case ASTNodeKind::kIfStmntElseIf: {
+            Expr * ifExpr = readNode<Expr>();
+            WC_GUARD(ifExpr, nullptr);
+            Scope * thenScope = readNode<Scope>();
+            WC_GUARD(thenScope, nullptr);
+            IfStmnt * elseIfStmnt = readNode<IfStmnt>();
+            WC_GUARD(elseIfStmnt, nullptr);
+            const Token * startToken = readToken();
+            WC_GUARD(startToken, nullptr);
+            return WC_NEW_AST_NODE(mParseCtx, IfStmntElseIf, *ifExpr, *thenScope, *elseIfStmnt, *startToken);
+        }
+        
+        case ASTNodeKind::kIfStmntNoElse: {
+            Expr * ifExpr = readNode<Expr>();
+            WC_GUARD(ifExpr, nullptr);
+            Scope * thenScope = readNode<Scope>();
+            WC_GUARD(thenScope, nullptr);
+            const Token * startToken = readToken();
+            WC_GUARD(startToken, nullptr);
+            const Token * endToken = readToken();
+            WC_GUARD(endToken, nullptr);
+            return WC_NEW_AST_NODE(mParseCtx, IfStmntNoElse, *ifExpr, *thenScope, *startToken, *endToken);
+        }
+        
+        case ASTNodeKind::kNextStmntNoCond: return readTokenNode<NextStmntNoCond>();
+        case ASTNodeKind::kNextStmntWithCond: return readTokenTokenExprNode<NextStmntWithCond>();
+        case ASTNodeKind::kNoOpStmnt: return readTokenNode<NoOpStmnt>();
+        case ASTNodeKind::kPrintStmnt: return readTokenExprTokenNode<PrintStmnt>();
+        case ASTNodeKind::kReturnStmntNoCondVoid: return readTokenNode<ReturnStmntNoCondVoid>();
+        case ASTNodeKind::kReturnStmntNoCondWithValue: return readTokenExprNode<ReturnStmntNoCondWithValue>();
+        
+        case ASTNodeKind::kReturnStmntWithCondAndValue: {
+            const Token * returnToken = readToken();
+            WC_GUARD(returnToken, nullptr);
+            Expr * returnExpr = readNode<Expr>();
+            WC_GUARD(returnExpr, nullptr);
+            const Token * condToken = readToken();
+            WC_GUARD(condToken, nullptr);
+            Expr * condExpr = readNode<Expr>();
+            WC_GUARD(condExpr, nullptr);
+            return WC_NEW_AST_NODE(mParseCtx,
+                                   ReturnStmntWithCondAndValue,
+                                   *returnToken,
+                                   *returnExpr,
+                                   *condToken,
+                                   *condExpr);
+        }
+        
+        case ASTNodeKind::kReturnStmntWithCondVoid: return readTokenTokenExprNode<ReturnStmntWithCondVoid>();
+        case ASTNodeKind::kScope: return readScope();
+        
+        case ASTNodeKind::kScopeStmnt: {
+            const Token * startToken = readToken();
+            WC_GUARD(startToken, nullptr);
+            Scope * bodyScope = readNode<Scope>();
+            WC_GUARD(bodyScope, nullptr);
+            const Token * endToken = readToken();
+            WC_GUARD(endToken, nullptr);
+            return WC_NEW_AST_NODE(mParseCtx, ScopeStmnt, *startToken, *bodyScope, *endToken);
+        }
+        
+        case ASTNodeKind::kStmntAssertStmnt: return readWrapperNode<StmntAssertStmnt, AssertStmnt>();
+        case ASTNodeKind::kStmntAssignExpr: return readWrapperNode<StmntAssignExpr, Expr>();
+        case ASTNodeKind::kStmntBreakStmnt: return readWrapperNode<StmntBreakStmnt, BreakStmnt>();
+        case ASTNodeKind::kStmntIfStmnt: return readWrapperNode<StmntIfStmnt, IfStmnt>();
+        case ASTNodeKind::kStmntLoopStmnt: return readWrapperNode<StmntLoopStmnt, LoopStmnt>();
+        case ASTNodeKind::kStmntNextStmnt: return readWrapperNode<StmntNextStmnt, NextStmnt>();
+        case ASTNodeKind::kStmntNoOpStmnt: return readWrapperNode<StmntNoOpStmnt, NoOpStmnt>();
+        case ASTNodeKind::kStmntPrintStmnt: return readWrapperNode<StmntPrintStmnt, PrintStmnt>();
+        case ASTNodeKind::kStmntReturnStmnt: return readWrapperNode<StmntReturnStmnt, ReturnStmnt>();
+        case ASTNodeKind::kStmntScopeStmnt: return readWrapperNode<StmntScopeStmnt, ScopeStmnt>();
+        case ASTNodeKind::kStmntVarDecl: return readWrapperNode<StmntVarDecl, VarDecl>();
+        case ASTNodeKind::kStmntWhileStmnt: return readWrapperNode<StmntWhileStmnt, WhileStmnt>();
+        
+        case ASTNodeKind::kVarDeclExplicitType: {
+            const Token * startToken = readToken();
+            WC_GUARD(startToken, nullptr);
+            Identifier * ident = readNode<Identifier>();
+            WC_GUARD(ident, nullptr);
+            Type * type = readNode<Type>();
+            WC_GUARD(type, nullptr);
+            Expr * initExpr = readNode<Expr>();
+            WC_GUARD(initExpr, nullptr);
+            return WC_NEW_AST_NODE(mParseCtx, VarDeclExplicitType, *startToken, *ident, *type, *initExpr);
+        }
+        
+        case ASTNodeKind::kVarDeclInferType: {
+            const Token * startToken = readToken();
+            WC_GUARD(startToken, nullptr);
+            Identifier * ident = readNode<Identifier>();
+            WC_GUARD(ident, nullptr);
+            Expr * initExpr = readNode<Expr>();
+            WC_GUARD(initExpr, nullptr);
+            return WC_NEW_AST_NODE(mParseCtx, VarDeclInferType, *startToken, *ident, *initExpr);
+        }
+        
+        case ASTNodeKind::kLoopStmntNoCond: {
+            Scope * bodyScope = readNode<Scope>();
+            WC_GUARD(bodyScope, nullptr);
+            const Token * startToken = readToken();
+            WC_GUARD(startToken, nullptr);
+            const Token * endToken = readToken();
+            WC_GUARD(endToken, nullptr);
+            return WC_NEW_AST_NODE(mParseCtx, LoopStmntNoCond, *bodyScope, *startToken, *endToken);
+        }
+        
+        case ASTNodeKind::kLoopStmntWithCond: {
+            Scope * bodyScope = readNode<Scope>();
+            WC_GUARD(bodyScope, nullptr);
+            const Token * startToken = readToken();
+            WC_GUARD(startToken, nullptr);
+            const Token * condTypeToken = readToken();
+            WC_GUARD(condTypeToken, nullptr);
+            Expr * loopCondExpr = readNode<Expr>();
+            WC_GUARD(loopCondExpr, nullptr);
+            return WC_NEW_AST_NODE(mParseCtx,
+                                   LoopStmntWithCond,
+                                   *bodyScope,
+                                   *startToken,
+                                   *condTypeToken,
+                                   *loopCondExpr);
+        }
+        
+        case ASTNodeKind::kWhileStmnt: {
+            Expr * whileExpr = readNode<Expr>();
+            WC_GUARD(whileExpr, nullptr);
+            Scope * bodyScope = readNode<Scope>();
+            WC_GUARD(bodyScope, nullptr);
+            const Token * startToken = readToken();
+            WC_GUARD(startToken, nullptr);
+            const Token * endToken = readToken();
+            WC_GUARD(endToken, nullptr);
+            return WC_NEW_AST_NODE(mParseCtx, WhileStmnt, *whileExpr, *bodyScope, *startToken, *endToken);
+        }
+        
+        case ASTNodeKind::kDeclDefFunc: return readWrapperNode<DeclDefFunc, Func>();
+        case ASTNodeKind::kDeclDefVarDecl: return readWrapperNode<DeclDefVarDecl, VarDecl>();
+        case ASTNodeKind::kFunc: return readFunc();
+        
+        case ASTNodeKind::kFuncArg: {
+            Type * type = readNode<Type>();
+            WC_GUARD(type, nullptr);
+            Identifier * ident = readNode<Identifier>();
+            WC_GUARD(ident, nullptr);
+            return WC_NEW_AST_NODE(mParseCtx, FuncArg, *type, *ident);
+        }
+        
+        case ASTNodeKind::kModule: {
+            Span<DeclDef*> declDefs;
+            WC_GUARD(readNodeList(declDefs), nullptr);
+            const Token * eofToken = readToken();
+            WC_GUARD(eofToken, nullptr);
+            return WC_NEW_AST_NODE(mParseCtx, Module, declDefs, *eofToken);
+        }
+        
+        case ASTNodeKind::kPrimitiveType: return readTokenNode<PrimitiveType>();
+        
+        case ASTNodeKind::kTypeArray: {
+            const Token * startToken = readToken();
+            WC_GUARD(startToken, nullptr);
+            Expr * sizeExpr = readNode<Expr>();
+            WC_GUARD(sizeExpr, nullptr);
+            Type * elemType = readNode<Type>();
+            WC_GUARD(elemType, nullptr);
+            return WC_NEW_AST_NODE(mParseCtx, TypeArray, *startToken, *sizeExpr, *elemType);
+        }
+        
+        case ASTNodeKind::kTypePrimitive: return readWrapperNode<TypePrimitive, PrimitiveType>();
+        
+        case ASTNodeKind::kTypePtr: {
+            const Token * startToken = readToken();
+            WC_GUARD(startToken, nullptr);
+            Type * pointedToType = readNode<Type>();
+            WC_GUARD(pointedToType, nullptr);
+            return WC_NEW_AST_NODE(mParseCtx, TypePtr, *startToken, *pointedToType);
+        }
+    }
+    
+    // Unknown node kind
+    return nullptr;
+}
+
+WC_AST_END_NAMESPACE
+WC_END_NAMESPACE
@@ -0,0 +1,140 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#pragma once
+
+#include "ASTNodeKind.hpp"
+#include "Span.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstddef>
+    #include <cstdint>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+
+class LinearAlloc;
+class SourceLineIndex;
+class SymbolTable;
+struct Token;
+
+WC_AST_BEGIN_NAMESPACE
+
+class ASTNode;
+class Func;
+class Module;
+class ParseCtx;
+class Scope;
+
+/**
+ * Loads the AST for a module from the binary format described in 'ASTBinaryFormat.hpp', as written by
+ * 'ASTBinaryWriter'. The nodes are created exactly as the parser would have created them (see 'ParseCtx'),
+ * so the loaded AST can be used in place of parsing the source again.
+ *
+ * The data is checked as it is read, and data which is truncated, corrupt or for a different build of the
+ * compiler is rejected rather than producing a broken AST.
+ */
+class ASTBinaryReader {
+public:
+    /**
+     * Load the AST for a module from the given data, which must be aligned to 'ASTBinaryFormat::kSectionAlign'.
+     * The nodes, the source text and the values of string literals are all allocated with the given linear
+     * allocator and identifier names are interned in the given symbol table, so nothing refers to the data once
+     * done. The line index is reset for the loaded source text. Returns null if the data is not valid.
+     */
+    static Module * read(const void * data,
+                         size_t dataSize,
+                         LinearAlloc & linearAlloc,
+                         SymbolTable & symbolTable,
+                         SourceLineIndex & srcLineIndex);
+    
+    /* Load the AST for a module from the given file, which is memory mapped where possible. See 'read'. */
+    static Module * readFile(const char * filePath,
+                             LinearAlloc & linearAlloc,
+                             SymbolTable & symbolTable,
+                             SourceLineIndex & srcLineIndex);
+                             
+private:
+    WC_DISALLOW_COPY_AND_ASSIGN(ASTBinaryReader)
+    
+    ASTBinaryReader(ParseCtx & parseCtx,
+                    const Token * tokens,
+                    size_t numTokens,
+                    const uint32_t * nodeData,
+                    size_t nodeDataNumWords);
+    
+    /* Tells if all of the node data has been read */
+    inline bool isAtEnd() const {
+        return mNodeDataPtr == mNodeDataEndPtr;
+    }
+    
+    /* Read the next word of node data. Returns false if there are no words left. */
+    bool readWord(uint32_t & outWord);
+    
+    /* Read a token, returns null if the token index is not valid */
+    const Token * readToken();
+    
+    /* Read a node which must be of the given type, which can be an abstract type. Returns null on failure. */
+    template <typename T>
+    T * readNode();
+    
+    /* Read an optional node which must be of the given type. Returns false on failure. */
+    template <typename T>
+    bool readOptionalNode(T *& outNode);
+    
+    /* Read a list of nodes which must all be of the given type. Returns false on failure. */
+    template <typename T>
+    bool readNodeList(Span<T*> & outNodes);
+    
+    /* Read the rest of a node of the given kind, once the kind itself has been read. Returns null on failure. */
+    ASTNode * readNodeOfKind(ASTNodeKind kind);
+    
+    /**
+     * Readers for the various shapes of node that share the same constructor arguments.
+     * Named after the arguments they read in order.
+     */
+    template <typename T>
+    T * readTwoOpsNode();
+    
+    template <typename T>
+    T * readTokenNode();
+    
+    template <typename T, typename ChildT>
+    T * readWrapperNode();
+    
+    template <typename T>
+    T * readTokenExprNode();
+    
+    template <typename T>
+    T * readExprTokenNode();
+    
+    template <typename T>
+    T * readTokenTokenNode();
+    
+    template <typename T>
+    T * readTokenExprTokenNode();
+    
+    template <typename T>
+    T * readTokenTokenExprNode();
+    
+    /* Functions and scopes are read like the parser does, so the nodes inside of them know their parent */
+    Func * readFunc();
+    Scope * readScope();
+    
+    /* The parse context that the nodes are created with */
+    ParseCtx & mParseCtx;
+    
+    /* The tokens for the AST, after pointers in their data have been fixed up */
+    const Token * mTokens;
+    size_t mNumTokens;
+    
+    /* The next word of node data to read and the end of the node data */
+    const uint32_t * mNodeDataPtr;
+    const uint32_t * mNodeDataEndPtr;
+};
+
+WC_AST_END_NAMESPACE
+WC_END_NAMESPACE
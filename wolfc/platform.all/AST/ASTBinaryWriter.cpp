@@ -0,0 +1,822 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#include "ASTBinaryWriter.hpp"
+
+#include "ASTBinaryFormat.hpp"
+#include "Lexer/SourceLineIndex.hpp"
+#include "Nodes/AddExpr.hpp"
+#include "Nodes/ArrayLit.hpp"
+#include "Nodes/AssertStmnt.hpp"
+#include "Nodes/AssignExpr.hpp"
+#include "Nodes/BoolLit.hpp"
+#include "Nodes/BreakStmnt.hpp"
+#include "Nodes/CastExpr.hpp"
+#include "Nodes/CmpExpr.hpp"
+#include "Nodes/DeclDef.hpp"
+#include "Nodes/Func.hpp"
+#include "Nodes/FuncArg.hpp"
+#include "Nodes/Identifier.hpp"
+#include "Nodes/IfStmnt.hpp"
+#include "Nodes/IntLit.hpp"
+#include "Nodes/LAndExpr.hpp"
+#include "Nodes/LOrExpr.hpp"
+#include "Nodes/LoopStmnt.hpp"
+#include "Nodes/Module.hpp"
+#include "Nodes/MulExpr.hpp"
+#include "Nodes/NextStmnt.hpp"
+#include "Nodes/NoOpStmnt.hpp"
+#include "Nodes/NotExpr.hpp"
+#include "Nodes/NullLit.hpp"
+#include "Nodes/PostfixExpr.hpp"
+#include "Nodes/PrefixExpr.hpp"
+#include "Nodes/PrimaryExpr.hpp"
+#include "Nodes/PrimitiveType.hpp"
+#include "Nodes/PrintStmnt.hpp"
+#include "Nodes/RandExpr.hpp"
+#include "Nodes/ReadnumExpr.hpp"
+#include "Nodes/ReturnStmnt.hpp"
+#include "Nodes/Scope.hpp"
+#include "Nodes/ScopeStmnt.hpp"
+#include "Nodes/ShiftExpr.hpp"
+#include "Nodes/Stmnt.hpp"
+#include "Nodes/StrLit.hpp"
+#include "Nodes/TernaryExpr.hpp"
+#include "Nodes/TimeExpr.hpp"
+#include "Nodes/Type.hpp"
+#include "Nodes/VarDecl.hpp"
+#include "Nodes/WhileStmnt.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstdio>
+    #include <cstring>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+WC_AST_BEGIN_NAMESPACE
+
+void ASTBinaryWriter::write(const Module & module,
+                            const SourceLineIndex & srcLineIndex,
+                            std::vector<uint8_t> & outData)
+{
+    // Write all the nodes, which also gathers up the tokens and strings they refer to.
+    // Note: the EOF token for the module is always added first so it is token 0.
+    ASTBinaryWriter writer;
+    writer.addToken(module.getEndToken());
+    module.accept(writer);
+    
+    // Fill in the header and figure out where everything goes
+    const char * srcText = srcLineIndex.getSrcText();
+    size_t numLines = srcLineIndex.getNumLines();
+    
+    ASTBinaryFormat::Header header = {};
+    header.magic = ASTBinaryFormat::kMagic;
+    header.version = ASTBinaryFormat::kVersion;
+    header.numNodes = writer.mNumNodes;
+    header.numLineStarts = static_cast<uint32_t>(numLines - 1);
+    header.numTokens = static_cast<uint32_t>(writer.mTokens.size());
+    header.srcTextSize = std::strlen(srcText);
+    header.tokenValuesNumWords = writer.mTokenValues.size();
+    header.strDataSize = writer.mStrData.size();
+    header.nodeDataNumWords = writer.mNodeData.size();
+    
+    ASTBinaryFormat::Layout layout;
+    bool gotLayout = ASTBinaryFormat::getLayout(header, layout);
+    WC_ASSERT(gotLayout);
+    
+    // Now copy everything into the output buffer. Note: any padding in between the sections is zeroed.
+    outData.assign(layout.totalSize, 0);
+    uint8_t * dataPtr = outData.data();
+    std::memcpy(dataPtr, &header, sizeof(header));
+    std::memcpy(dataPtr + layout.srcTextOffset, srcText, header.srcTextSize);
+    
+    for (size_t line = 1; line < numLines; ++line) {
+        uint32_t lineStart = srcLineIndex.getLineStart(line);
+        std::memcpy(dataPtr + layout.lineStartsOffset + (line - 1) * sizeof(uint32_t), &lineStart, sizeof(uint32_t));
+    }
+    
+    std::memcpy(dataPtr + layout.tokensOffset,
+                writer.mTokens.data(),
+                writer.mTokens.size() * sizeof(ASTBinaryFormat::TokenRecord));
+    
+    std::memcpy(dataPtr + layout.tokenValuesOffset,
+                writer.mTokenValues.data(),
+                writer.mTokenValues.size() * sizeof(uint32_t));
+    
+    std::memcpy(dataPtr + layout.strDataOffset, writer.mStrData.data(), writer.mStrData.size());
+    std::memcpy(dataPtr + layout.nodeDataOffset,
+                writer.mNodeData.data(),
+                writer.mNodeData.size() * sizeof(uint32_t));
+}
+
+bool ASTBinaryWriter::writeFile(const Module & module, const SourceLineIndex & srcLineIndex, const char * filePath) {
+    std::vector<uint8_t> data;
+    write(module, srcLineIndex, data);
+    
+    std::FILE * file = std::fopen(filePath, "wb");
+    WC_GUARD(file, false);
+    bool success = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    
+    if (std::fclose(file) != 0) {
+        success = false;
+    }
+    
+    return success;
+}
+
+ASTBinaryWriter::ASTBinaryWriter() : mNumNodes(0) {
+    WC_EMPTY_FUNC_BODY();
+}
+
+template <typename T>
+void ASTBinaryWriter::writeKind(const T & astNode) {
+    WC_ASSERT(astNode.mKind == ASTNodeKindOf<T>::kKind);
+    mNodeData.push_back(static_cast<uint32_t>(ASTNodeKindOf<T>::kKind));
+    ++mNumNodes;
+}
+
+void ASTBinaryWriter::writeToken(const Token & token) {
+    mNodeData.push_back(addToken(token));
+}
+
+void ASTBinaryWriter::writeNode(const ASTNode & astNode) {
+    astNode.accept(*this);
+}
+
+void ASTBinaryWriter::writeOptionalNode(const ASTNode * astNode) {
+    if (astNode) {
+        astNode->accept(*this);
+    }
+    else {
+        mNodeData.push_back(ASTBinaryFormat::kNoNode);
+    }
+}
+
+template <typename T>
+void ASTBinaryWriter::writeNodeList(const Span<T*> & astNodes) {
+    mNodeData.push_back(static_cast<uint32_t>(astNodes.size()));
+    
+    for (const ASTNode * astNode : astNodes) {
+        astNode->accept(*this);
+    }
+}
+
+template <typename T>
+void ASTBinaryWriter::writeTwoOpsNode(const T & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mLeftExpr);
+    writeNode(astNode.mRightExpr);
+}
+
+uint32_t ASTBinaryWriter::addToken(const Token & token) {
+    // See if the token has been added already, tokens are copied into nodes so look it up by source offset
+    auto tokenIndexIter = mTokenIndexes.find(token.startSrcOffset);
+    
+    if (tokenIndexIter != mTokenIndexes.end() &&
+        mTokens[tokenIndexIter->second].type == static_cast<uint8_t>(token.type))
+    {
+        return tokenIndexIter->second;
+    }
+    
+    // Add the token
+    ASTBinaryFormat::TokenRecord tokenRecord;
+    tokenRecord.type = static_cast<uint8_t>(token.type);
+    tokenRecord.flags = token.flags;
+    tokenRecord.intDataTypeId = static_cast<uint8_t>(token.intDataTypeId);
+    tokenRecord.intBitsRequired = token.intBitsRequired;
+    tokenRecord.startSrcOffset = token.startSrcOffset;
+    tokenRecord.endSrcOffset = token.endSrcOffset;
+    tokenRecord.nextTokenSrcOffset = token.nextTokenSrcOffset;
+    
+    uint32_t tokenIndex = static_cast<uint32_t>(mTokens.size());
+    mTokens.push_back(tokenRecord);
+    mTokenIndexes.emplace(token.startSrcOffset, tokenIndex);
+    
+    // Add the value for the token, if it has one. See 'ASTBinaryFormat::getNumTokenValueWords'.
+    switch (token.type) {
+        case TokenType::kIdentifier: {
+            mTokenValues.push_back(addStrData(token.data.identData.name, token.data.identData.nameLen));
+            mTokenValues.push_back(token.data.identData.nameLen);
+        }   break;
+        
+        case TokenType::kStrLit: {
+            mTokenValues.push_back(addStrData(token.data.strVal.ptr, token.data.strVal.size));
+            mTokenValues.push_back(static_cast<uint32_t>(token.data.strVal.size));
+        }   break;
+        
+        case TokenType::kIntLit: {
+            for (uint64_t valueWord : token.data.intData.valueWords) {
+                mTokenValues.push_back(static_cast<uint32_t>(valueWord));
+                mTokenValues.push_back(static_cast<uint32_t>(valueWord >> 32));
+            }
+        }   break;
+        
+        default:
+            break;
+    }
+    
+    return tokenIndex;
+}
+
+uint32_t ASTBinaryWriter::addStrData(const char * str, size_t strSize) {
+    // Identifier names are interned so the same name is always at the same address, only store it once
+    auto strOffsetIter = mStrDataOffsets.find(str);
+    
+    if (strOffsetIter != mStrDataOffsets.end()) {
+        return strOffsetIter->second;
+    }
+    
+    // Note: strings all come from the source code so they can't take up more than 4 GB in total
+    uint32_t strOffset = static_cast<uint32_t>(mStrData.size());
+    mStrData.insert(mStrData.end(), str, str + strSize);
+    mStrData.push_back(0);
+    mStrDataOffsets.emplace(str, strOffset);
+    return strOffset;
+}
+
+//-----------------------------------------------------------------------------
+// Visitor functions
+//-----------------------------------------------------------------------------
+
+void ASTBinaryWriter::visit(const AddExprAdd & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const AddExprBOr & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const AddExprBXor & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const AddExprSub & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const ArrayLit & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.getStartToken());
+    writeNodeList(astNode.getExprs());
+    writeToken(astNode.getEndToken());
+}
+
+void ASTBinaryWriter::visit(const AssertStmnt & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mStartToken);
+    writeNode(astNode.mExpr);
+    writeToken(astNode.mEndToken);
+}
+
+void ASTBinaryWriter::visit(const AssignExprAssign & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const AssignExprAssignARShift & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const AssignExprAssignAdd & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const AssignExprAssignBAnd & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const AssignExprAssignBOr & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const AssignExprAssignBXor & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const AssignExprAssignDiv & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const AssignExprAssignLRShift & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const AssignExprAssignLShift & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const AssignExprAssignMul & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const AssignExprAssignRem & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const AssignExprAssignSub & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const BoolLit & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mToken);
+}
+
+void ASTBinaryWriter::visit(const BreakStmntNoCond & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mBreakToken);
+}
+
+void ASTBinaryWriter::visit(const BreakStmntWithCond & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mBreakToken);
+    writeToken(astNode.mCondToken);
+    writeNode(astNode.mCondExpr);
+}
+
+void ASTBinaryWriter::visit(const CastExprCast & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mStartToken);
+    writeNode(astNode.mExpr);
+    writeNode(astNode.mType);
+    writeToken(astNode.mEndToken);
+}
+
+void ASTBinaryWriter::visit(const CmpExprEQ & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const CmpExprGE & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const CmpExprGT & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const CmpExprLE & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const CmpExprLT & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const CmpExprNE & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const DeclDefFunc & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mFunc);
+}
+
+void ASTBinaryWriter::visit(const DeclDefVarDecl & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mVarDecl);
+}
+
+void ASTBinaryWriter::visit(const Func & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.getStartToken());
+    writeNode(astNode.getIdentifier());
+    writeNodeList(astNode.getArgs());
+    writeOptionalNode(astNode.getExplicitReturnType());
+    writeNode(astNode.getScope());
+    writeToken(astNode.getEndToken());
+}
+
+void ASTBinaryWriter::visit(const FuncArg & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mType);
+    writeNode(astNode.mIdent);
+}
+
+void ASTBinaryWriter::visit(const Identifier & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mToken);
+}
+
+void ASTBinaryWriter::visit(const IfStmntElse & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mIfExpr);
+    writeNode(astNode.mThenScope);
+    writeNode(astNode.mElseScope);
+    writeToken(astNode.mStartToken);
+    writeToken(astNode.mEndToken);
+}
+
+void ASTBinaryWriter::visit(const IfStmntElseIf & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mIfExpr);
+    writeNode(astNode.mThenScope);
+    writeNode(astNode.mElseIfStmnt);
+    writeToken(astNode.mStartToken);
+}
+
+void ASTBinaryWriter::visit(const IfStmntNoElse & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mIfExpr);
+    writeNode(astNode.mThenScope);
+    writeToken(astNode.mStartToken);
+    writeToken(astNode.mEndToken);
+}
+
+void ASTBinaryWriter::visit(const IntLit & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mToken);
+}
+
+void ASTBinaryWriter::visit(const LAndExprAnd & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const LOrExprOr & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const LoopStmntNoCond & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mBodyScope);
+    writeToken(astNode.mStartToken);
+    writeToken(astNode.mEndToken);
+}
+
+void ASTBinaryWriter::visit(const LoopStmntWithCond & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mBodyScope);
+    writeToken(astNode.mStartToken);
+    writeToken(astNode.mCondTypeToken);
+    writeNode(astNode.mLoopCondExpr);
+}
+
+void ASTBinaryWriter::visit(const Module & astNode) {
+    writeKind(astNode);
+    writeNodeList(astNode.mDeclDefs);
+    writeToken(astNode.getEndToken());
+}
+
+void ASTBinaryWriter::visit(const MulExprBAnd & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const MulExprDiv & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const MulExprMul & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const MulExprRem & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const NextStmntNoCond & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mNextToken);
+}
+
+void ASTBinaryWriter::visit(const NextStmntWithCond & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mNextToken);
+    writeToken(astNode.mCondToken);
+    writeNode(astNode.mCondExpr);
+}
+
+void ASTBinaryWriter::visit(const NoOpStmnt & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mToken);
+}
+
+void ASTBinaryWriter::visit(const NotExprBNot & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mExpr);
+    writeToken(astNode.mStartToken);
+}
+
+void ASTBinaryWriter::visit(const NotExprLNot & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mExpr);
+    writeToken(astNode.mStartToken);
+}
+
+void ASTBinaryWriter::visit(const NullLit & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mToken);
+}
+
+void ASTBinaryWriter::visit(const PostfixExprArrayLookup & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mArrayExpr);
+    writeNode(astNode.mIndexExpr);
+    writeToken(astNode.mEndToken);
+}
+
+void ASTBinaryWriter::visit(const PostfixExprDec & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mExpr);
+    writeToken(astNode.mEndToken);
+}
+
+void ASTBinaryWriter::visit(const PostfixExprFuncCall & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mOperandExpr);
+    writeToken(astNode.mCallOpeningParen);
+    writeNodeList(astNode.mArgExprs);
+    writeToken(astNode.mCallClosingParen);
+}
+
+void ASTBinaryWriter::visit(const PostfixExprInc & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mExpr);
+    writeToken(astNode.mEndToken);
+}
+
+void ASTBinaryWriter::visit(const PrefixExprAddrOf & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mStartToken);
+    writeNode(astNode.mExpr);
+}
+
+void ASTBinaryWriter::visit(const PrefixExprMinus & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mStartToken);
+    writeNode(astNode.mExpr);
+}
+
+void ASTBinaryWriter::visit(const PrefixExprPlus & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mStartToken);
+    writeNode(astNode.mExpr);
+}
+
+void ASTBinaryWriter::visit(const PrefixExprPtrDenull & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mStartToken);
+    writeNode(astNode.mExpr);
+}
+
+void ASTBinaryWriter::visit(const PrefixExprPtrDeref & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mStartToken);
+    writeNode(astNode.mExpr);
+}
+
+void ASTBinaryWriter::visit(const PrimaryExprArrayLit & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mLit);
+}
+
+void ASTBinaryWriter::visit(const PrimaryExprBoolLit & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mLit);
+}
+
+void ASTBinaryWriter::visit(const PrimaryExprIdentifier & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mIdent);
+}
+
+void ASTBinaryWriter::visit(const PrimaryExprIntLit & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mLit);
+}
+
+void ASTBinaryWriter::visit(const PrimaryExprNullLit & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mLit);
+}
+
+void ASTBinaryWriter::visit(const PrimaryExprParen & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mStartToken);
+    writeNode(astNode.mExpr);
+    writeToken(astNode.mEndToken);
+}
+
+void ASTBinaryWriter::visit(const PrimaryExprRandExpr & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mExpr);
+}
+
+void ASTBinaryWriter::visit(const PrimaryExprReadnumExpr & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mExpr);
+}
+
+void ASTBinaryWriter::visit(const PrimaryExprStrLit & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mLit);
+}
+
+void ASTBinaryWriter::visit(const PrimaryExprTimeExpr & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mExpr);
+}
+
+void ASTBinaryWriter::visit(const PrimitiveType & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mToken);
+}
+
+void ASTBinaryWriter::visit(const PrintStmnt & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mStartToken);
+    writeNode(astNode.mExpr);
+    writeToken(astNode.mEndToken);
+}
+
+void ASTBinaryWriter::visit(const RandExprRand & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mStartToken);
+    writeToken(astNode.mEndToken);
+}
+
+void ASTBinaryWriter::visit(const RandExprSRand & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mStartToken);
+    writeNode(astNode.mSeedExpr);
+    writeToken(astNode.mEndToken);
+}
+
+void ASTBinaryWriter::visit(const ReadnumExpr & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mStartToken);
+    writeToken(astNode.mEndToken);
+}
+
+void ASTBinaryWriter::visit(const ReturnStmntNoCondVoid & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mReturnToken);
+}
+
+void ASTBinaryWriter::visit(const ReturnStmntNoCondWithValue & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mReturnToken);
+    writeNode(astNode.mReturnExpr);
+}
+
+void ASTBinaryWriter::visit(const ReturnStmntWithCondAndValue & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mReturnToken);
+    writeNode(astNode.mReturnExpr);
+    writeToken(astNode.mCondToken);
+    writeNode(astNode.mCondExpr);
+}
+
+void ASTBinaryWriter::visit(const ReturnStmntWithCondVoid & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mReturnToken);
+    writeToken(astNode.mCondToken);
+    writeNode(astNode.mCondExpr);
+}
+
+void ASTBinaryWriter::visit(const Scope & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.getScopeStartToken());
+    writeNodeList(astNode.getStmnts());
+}
+
+void ASTBinaryWriter::visit(const ScopeStmnt & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mStartToken);
+    writeNode(astNode.mBodyScope);
+    writeToken(astNode.mEndToken);
+}
+
+void ASTBinaryWriter::visit(const ShiftExprARShift & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const ShiftExprLRShift & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const ShiftExprLShift & astNode) {
+    writeTwoOpsNode(astNode);
+}
+
+void ASTBinaryWriter::visit(const StmntAssertStmnt & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mStmnt);
+}
+
+void ASTBinaryWriter::visit(const StmntAssignExpr & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mExpr);
+}
+
+void ASTBinaryWriter::visit(const StmntBreakStmnt & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mBreakStmnt);
+}
+
+void ASTBinaryWriter::visit(const StmntIfStmnt & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mIfStmnt);
+}
+
+void ASTBinaryWriter::visit(const StmntLoopStmnt & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mLoopStmnt);
+}
+
+void ASTBinaryWriter::visit(const StmntNextStmnt & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mNextStmnt);
+}
+
+void ASTBinaryWriter::visit(const StmntNoOpStmnt & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mStmnt);
+}
+
+void ASTBinaryWriter::visit(const StmntPrintStmnt & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mStmnt);
+}
+
+void ASTBinaryWriter::visit(const StmntReturnStmnt & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mReturnStmnt);
+}
+
+void ASTBinaryWriter::visit(const StmntScopeStmnt & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mScopeStmnt);
+}
+
+void ASTBinaryWriter::visit(const StmntVarDecl & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mDecl);
+}
+
+void ASTBinaryWriter::visit(const StmntWhileStmnt & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mWhileStmnt);
+}
+
+void ASTBinaryWriter::visit(const StrLit & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mToken);
+}
+
+void ASTBinaryWriter::visit(const TernaryExprWithCond & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mCondExpr);
+    writeNode(astNode.mTrueExpr);
+    writeNode(astNode.mFalseExpr);
+}
+
+void ASTBinaryWriter::visit(const TimeExpr & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mStartToken);
+    writeToken(astNode.mEndToken);
+}
+
+void ASTBinaryWriter::visit(const TypeArray & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mStartToken);
+    writeNode(astNode.mSizeExpr);
+    writeNode(astNode.mElemType);
+}
+
+void ASTBinaryWriter::visit(const TypePrimitive & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mType);
+}
+
+void ASTBinaryWriter::visit(const TypePtr & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mStartToken);
+    writeNode(astNode.mPointedToType);
+}
+
+void ASTBinaryWriter::visit(const VarDeclExplicitType & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mStartToken);
+    writeNode(astNode.mIdent);
+    writeNode(astNode.mType);
+    writeNode(astNode.mInitExpr);
+}
+
+void ASTBinaryWriter::visit(const VarDeclInferType & astNode) {
+    writeKind(astNode);
+    writeToken(astNode.mStartToken);
+    writeNode(astNode.mIdent);
+    writeNode(astNode.mInitExpr);
+}
+
+void ASTBinaryWriter::visit(const WhileStmnt & astNode) {
+    writeKind(astNode);
+    writeNode(astNode.mWhileExpr);
+    writeNode(astNode.mBodyScope);
+    writeToken(astNode.mStartToken);
+    writeToken(astNode.mEndToken);
+}
+
+WC_AST_END_NAMESPACE
+WC_END_NAMESPACE
@@ -0,0 +1,208 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#pragma once
+
+#include "ASTBinaryFormat.hpp"
+#include "ASTNodeVisitor.hpp"
+#include "Span.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstdint>
+    #include <unordered_map>
+    #include <vector>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+
+class SourceLineIndex;
+struct Token;
+
+WC_AST_BEGIN_NAMESPACE
+
+class ASTNode;
+
+/**
+ * Writes the AST for a module out in the binary format described in 'ASTBinaryFormat.hpp', so that it can be
+ * loaded again later with 'ASTBinaryReader' instead of lexing and parsing the source again.
+ * The AST is walked as a visitor, with each node writing its kind and then its constructor arguments.
+ */
+class ASTBinaryWriter final : public ASTNodeVisitor {
+public:
+    /**
+     * Write the AST for the given module to the given data buffer, replacing any existing contents.
+     * The line index must be the one for the source code that the module was parsed from.
+     */
+    static void write(const Module & module, const SourceLineIndex & srcLineIndex, std::vector<uint8_t> & outData);
+    
+    /**
+     * Write the AST for the given module to the given file, replacing the file if it already exists.
+     * The data is built up in memory first and then written with a single write. Returns false on failure.
+     */
+    static bool writeFile(const Module & module, const SourceLineIndex & srcLineIndex, const char * filePath);
+    
+    /* ASTNode visitor functions: these write out the node visited along with all of its children */
+    virtual void visit(const AddExprAdd & astNode) override;
+    virtual void visit(const AddExprBOr & astNode) override;
+    virtual void visit(const AddExprBXor & astNode) override;
+    virtual void visit(const AddExprSub & astNode) override;
+    virtual void visit(const ArrayLit & astNode) override;
+    virtual void visit(const AssertStmnt & astNode) override;
+    virtual void visit(const AssignExprAssign & astNode) override;
+    virtual void visit(const AssignExprAssignARShift & astNode) override;
+    virtual void visit(const AssignExprAssignAdd & astNode) override;
+    virtual void visit(const AssignExprAssignBAnd & astNode) override;
+    virtual void visit(const AssignExprAssignBOr & astNode) override;
+    virtual void visit(const AssignExprAssignBXor & astNode) override;
+    virtual void visit(const AssignExprAssignDiv & astNode) override;
+    virtual void visit(const AssignExprAssignLRShift & astNode) override;
+    virtual void visit(const AssignExprAssignLShift & astNode) override;
+    virtual void visit(const AssignExprAssignMul & astNode) override;
+    virtual void visit(const AssignExprAssignRem & astNode) override;
+    virtual void visit(const AssignExprAssignSub & astNode) override;
+    virtual void visit(const BoolLit & astNode) override;
+    virtual void visit(const BreakStmntNoCond & astNode) override;
+    virtual void visit(const BreakStmntWithCond & astNode) override;
+    virtual void visit(const CastExprCast & astNode) override;
+    virtual void visit(const CmpExprEQ & astNode) override;
+    virtual void visit(const CmpExprGE & astNode) override;
+    virtual void visit(const CmpExprGT & astNode) override;
+    virtual void visit(const CmpExprLE & astNode) override;
+    virtual void visit(const CmpExprLT & astNode) override;
+    virtual void visit(const CmpExprNE & astNode) override;
+    virtual void visit(const DeclDefFunc & astNode) override;
+    virtual void visit(const DeclDefVarDecl & astNode) override;
+    virtual void visit(const Func & astNode) override;
+    virtual void visit(const FuncArg & astNode) override;
+    virtual void visit(const Identifier & astNode) override;
+    virtual void visit(const IfStmntElse & astNode) override;
+    virtual void visit(const IfStmntElseIf & astNode) override;
+    virtual void visit(const IfStmntNoElse & astNode) override;
+    virtual void visit(const IntLit & astNode) override;
+    virtual void visit(const LAndExprAnd & astNode) override;
+    virtual void visit(const LOrExprOr & astNode) override;
+    virtual void visit(const LoopStmntNoCond & astNode) override;
+    virtual void visit(const LoopStmntWithCond & astNode) override;
+    virtual void visit(const Module & astNode) override;
+    virtual void visit(const MulExprBAnd & astNode) override;
+    virtual void visit(const MulExprDiv & astNode) override;
+    virtual void visit(const MulExprMul & astNode) override;
+    virtual void visit(const MulExprRem & astNode) override;
+    virtual void visit(const NextStmntNoCond & astNode) override;
+    virtual void visit(const NextStmntWithCond & astNode) override;
+    virtual void visit(const NoOpStmnt & astNode) override;
+    virtual void visit(const NotExprBNot & astNode) override;
+    virtual void visit(const NotExprLNot & astNode) override;
+    virtual void visit(const NullLit & astNode) override;
+    virtual void visit(const PostfixExprArrayLookup & astNode) override;
+    virtual void visit(const PostfixExprDec & astNode) override;
+    virtual void visit(const PostfixExprFuncCall & astNode) override;
+    virtual void visit(const PostfixExprInc & astNode) override;
+    virtual void visit(const PrefixExprAddrOf & astNode) override;
+    virtual void visit(const PrefixExprMinus & astNode) override;
+    virtual void visit(const PrefixExprPlus & astNode) override;
+    virtual void visit(const PrefixExprPtrDenull & astNode) override;
+    virtual void visit(const PrefixExprPtrDeref & astNode) override;
+    virtual void visit(const PrimaryExprArrayLit & astNode) override;
+    virtual void visit(const PrimaryExprBoolLit & astNode) override;
+    virtual void visit(const PrimaryExprIdentifier & astNode) override;
+    virtual void visit(const PrimaryExprIntLit & astNode) override;
+    virtual void visit(const PrimaryExprNullLit & astNode) override;
+    virtual void visit(const PrimaryExprParen & astNode) override;
+    virtual void visit(const PrimaryExprRandExpr & astNode) override;
+    virtual void visit(const PrimaryExprReadnumExpr & astNode) override;
+    virtual void visit(const PrimaryExprStrLit & astNode) override;
+    virtual void visit(const PrimaryExprTimeExpr & astNode) override;
+    virtual void visit(const PrimitiveType & astNode) override;
+    virtual void visit(const PrintStmnt & astNode) override;
+    virtual void visit(const RandExprRand & astNode) override;
+    virtual void visit(const RandExprSRand & astNode) override;
+    virtual void visit(const ReadnumExpr & astNode) override;
+    virtual void visit(const ReturnStmntNoCondVoid & astNode) override;
+    virtual void visit(const ReturnStmntNoCondWithValue & astNode) override;
+    virtual void visit(const ReturnStmntWithCondAndValue & astNode) override;
+    virtual void visit(const ReturnStmntWithCondVoid & astNode) override;
+    virtual void visit(const Scope & astNode) override;
+    virtual void visit(const ScopeStmnt & astNode) override;
+    virtual void visit(const ShiftExprARShift & astNode) override;
+    virtual void visit(const ShiftExprLRShift & astNode) override;
+    virtual void visit(const ShiftExprLShift & astNode) override;
+    virtual void visit(const StmntAssertStmnt & astNode) override;
+    virtual void visit(const StmntAssignExpr & astNode) override;
+    virtual void visit(const StmntBreakStmnt & astNode) override;
+    virtual void visit(const StmntIfStmnt & astNode) override;
+    virtual void visit(const StmntLoopStmnt & astNode) override;
+    virtual void visit(const StmntNextStmnt & astNode) override;
+    virtual void visit(const StmntNoOpStmnt & astNode) override;
+    virtual void visit(const StmntPrintStmnt & astNode) override;
+    virtual void visit(const StmntReturnStmnt & astNode) override;
+    virtual void visit(const StmntScopeStmnt & astNode) override;
+    virtual void visit(const StmntVarDecl & astNode) override;
+    virtual void visit(const StmntWhileStmnt & astNode) override;
+    virtual void visit(const StrLit & astNode) override;
+    virtual void visit(const TernaryExprWithCond & astNode) override;
+    virtual void visit(const TimeExpr & astNode) override;
+    virtual void visit(const TypeArray & astNode) override;
+    virtual void visit(const TypePrimitive & astNode) override;
+    virtual void visit(const TypePtr & astNode) override;
+    virtual void visit(const VarDeclExplicitType & astNode) override;
+    virtual void visit(const VarDeclInferType & astNode) override;
+    virtual void visit(const WhileStmnt & astNode) override;
+    
+private:
+    WC_DISALLOW_COPY_AND_ASSIGN(ASTBinaryWriter)
+    
+    ASTBinaryWriter();
+    
+    /* Write the kind of the given node, which starts the data for the node */
+    template <typename T>
+    void writeKind(const T & astNode);
+    
+    /* Write a token, as the index of the token in the token section */
+    void writeToken(const Token & token);
+    
+    /* Write a child node */
+    void writeNode(const ASTNode & astNode);
+    
+    /* Write an optional child node, which may be null */
+    void writeOptionalNode(const ASTNode * astNode);
+    
+    /* Write a list of child nodes */
+    template <typename T>
+    void writeNodeList(const Span<T*> & astNodes);
+    
+    /* Write a node with two operands, of which there are many kinds of expression */
+    template <typename T>
+    void writeTwoOpsNode(const T & astNode);
+    
+    /* Add the given token to the token section if not already added, and return the index of the token */
+    uint32_t addToken(const Token & token);
+    
+    /* Add the string data for an identifier or string literal token and return its offset in the string data */
+    uint32_t addStrData(const char * str, size_t strSize);
+    
+    /* The AST nodes as they are written */
+    std::vector<uint32_t> mNodeData;
+    
+    /* The number of nodes written so far */
+    uint32_t mNumNodes;
+    
+    /* The tokens referred to by the nodes written so far, and the values for them */
+    std::vector<ASTBinaryFormat::TokenRecord> mTokens;
+    std::vector<uint32_t> mTokenValues;
+    
+    /* The index in the token list of each token added so far, keyed by the source offset of the token */
+    std::unordered_map<uint32_t, uint32_t> mTokenIndexes;
+    
+    /* The string data for the tokens added so far */
+    std::vector<char> mStrData;
+    
+    /* The offset in the string data of each string added so far, keyed by the original pointer to the string */
+    std::unordered_map<const char*, uint32_t> mStrDataOffsets;
+};
+
+WC_AST_END_NAMESPACE
+WC_END_NAMESPACE
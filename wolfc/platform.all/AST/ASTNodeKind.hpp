@@ -0,0 +1,307 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#pragma once
+
+#include "Macros.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstdint>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+WC_AST_BEGIN_NAMESPACE
+
+/**
+ * Enum identifying the concrete type of an AST node. Every node stores its kind (see 'ASTNode::mKind'),
+ * so the type of a node can be checked with a simple compare rather than through RTTI.
+ *
+ * The kinds are grouped so that the broad categories of node are contiguous ranges of values, and testing
+ * whether a node is an expression or statement is just a range check. The '...First' and '...Last' values
+ * mark out these ranges: when adding a new kind, add it to the correct group and update the range markers if
+ * it is added at either end of a group.
+ */
+enum class ASTNodeKind : uint8_t {
+    /*=========================================================================
+    | Expressions: nodes implementing 'IExpr'
+    =========================================================================*/
+    
+    kAddExprAdd,
+    kAddExprBOr,
+    kAddExprBXor,
+    kAddExprSub,
+    kArrayLit,
+    kAssignExprAssign,
+    kAssignExprAssignARShift,
+    kAssignExprAssignAdd,
+    kAssignExprAssignBAnd,
+    kAssignExprAssignBOr,
+    kAssignExprAssignBXor,
+    kAssignExprAssignDiv,
+    kAssignExprAssignLRShift,
+    kAssignExprAssignLShift,
+    kAssignExprAssignMul,
+    kAssignExprAssignRem,
+    kAssignExprAssignSub,
+    kBoolLit,
+    kCastExprCast,
+    kCmpExprEQ,
+    kCmpExprGE,
+    kCmpExprGT,
+    kCmpExprLE,
+    kCmpExprLT,
+    kCmpExprNE,
+    kIdentifier,
+    kIntLit,
+    kLAndExprAnd,
+    kLOrExprOr,
+    kMulExprBAnd,
+    kMulExprDiv,
+    kMulExprMul,
+    kMulExprRem,
+    kNotExprBNot,
+    kNotExprLNot,
+    kNullLit,
+    kPostfixExprArrayLookup,
+    kPostfixExprDec,
+    kPostfixExprFuncCall,
+    kPostfixExprInc,
+    kPrefixExprAddrOf,
+    kPrefixExprMinus,
+    kPrefixExprPlus,
+    kPrefixExprPtrDenull,
+    kPrefixExprPtrDeref,
+    kPrimaryExprArrayLit,
+    kPrimaryExprBoolLit,
+    kPrimaryExprIdentifier,
+    kPrimaryExprIntLit,
+    kPrimaryExprNullLit,
+    kPrimaryExprParen,
+    kPrimaryExprRandExpr,
+    kPrimaryExprReadnumExpr,
+    kPrimaryExprStrLit,
+    kPrimaryExprTimeExpr,
+    kRandExprRand,
+    kRandExprSRand,
+    kReadnumExpr,
+    kShiftExprARShift,
+    kShiftExprLRShift,
+    kShiftExprLShift,
+    kStrLit,
+    kTernaryExprWithCond,
+    kTimeExpr,
+    
+    /*=========================================================================
+    | Statements: nodes implementing 'IStmnt' (but not 'IRepeatableStmnt')
+    =========================================================================*/
+    
+    kAssertStmnt,
+    kBreakStmntNoCond,
+    kBreakStmntWithCond,
+    kIfStmntElse,
+    kIfStmntElseIf,
+    kIfStmntNoElse,
+    kNextStmntNoCond,
+    kNextStmntWithCond,
+    kNoOpStmnt,
+    kPrintStmnt,
+    kReturnStmntNoCondVoid,
+    kReturnStmntNoCondWithValue,
+    kReturnStmntWithCondAndValue,
+    kReturnStmntWithCondVoid,
+    kScope,
+    kScopeStmnt,
+    kStmntAssertStmnt,
+    kStmntAssignExpr,
+    kStmntBreakStmnt,
+    kStmntIfStmnt,
+    kStmntLoopStmnt,
+    kStmntNextStmnt,
+    kStmntNoOpStmnt,
+    kStmntPrintStmnt,
+    kStmntReturnStmnt,
+    kStmntScopeStmnt,
+    kStmntVarDecl,
+    kStmntWhileStmnt,
+    kVarDeclExplicitType,
+    kVarDeclInferType,
+    
+    /*=========================================================================
+    | Repeatable statements: nodes implementing 'IRepeatableStmnt'
+    =========================================================================*/
+    
+    kLoopStmntNoCond,
+    kLoopStmntWithCond,
+    kWhileStmnt,
+    
+    /*=========================================================================
+    | Other nodes
+    =========================================================================*/
+    
+    kDeclDefFunc,
+    kDeclDefVarDecl,
+    kFunc,
+    kFuncArg,
+    kModule,
+    kPrimitiveType,
+    kTypeArray,
+    kTypePrimitive,
+    kTypePtr,
+    
+    /*=========================================================================
+    | Range markers for the groups above
+    =========================================================================*/
+    
+    kExprFirst = kAddExprAdd,
+    kExprLast = kTimeExpr,
+    kStmntFirst = kAssertStmnt,
+    kStmntLast = kWhileStmnt,       /* Note: includes the repeatable statements */
+    kRepeatableStmntFirst = kLoopStmntNoCond,
+    kRepeatableStmntLast = kWhileStmnt
+};
+
+/* Tells if the given node kind is for an expression (implements 'IExpr') */
+inline constexpr bool isExprKind(ASTNodeKind kind) {
+    return kind >= ASTNodeKind::kExprFirst && kind <= ASTNodeKind::kExprLast;
+}
+
+/* Tells if the given node kind is for a statement (implements 'IStmnt') */
+inline constexpr bool isStmntKind(ASTNodeKind kind) {
+    return kind >= ASTNodeKind::kStmntFirst && kind <= ASTNodeKind::kStmntLast;
+}
+
+/* Tells if the given node kind is for a repeatable statement (implements 'IRepeatableStmnt') */
+inline constexpr bool isRepeatableStmntKind(ASTNodeKind kind) {
+    return kind >= ASTNodeKind::kRepeatableStmntFirst && kind <= ASTNodeKind::kRepeatableStmntLast;
+}
+
+/**
+ * Gives the node kind for a concrete AST node type, as 'ASTNodeKindOf<NodeType>::kKind'.
+ * Only defined for concrete node types, which all must have an entry below.
+ */
+template <class NodeType>
+struct ASTNodeKindOf;
+
+/* Declares the node kind for a concrete AST node type */
+#define WC_AST_NODE_KIND(NodeType)\
+    class NodeType;\
+    \
+    template <>\
+    struct ASTNodeKindOf<NodeType> {\
+        static constexpr const ASTNodeKind kKind = ASTNodeKind::k##NodeType;\
+    };
+
+WC_AST_NODE_KIND(AddExprAdd)
+WC_AST_NODE_KIND(AddExprBOr)
+WC_AST_NODE_KIND(AddExprBXor)
+WC_AST_NODE_KIND(AddExprSub)
+WC_AST_NODE_KIND(ArrayLit)
+WC_AST_NODE_KIND(AssertStmnt)
+WC_AST_NODE_KIND(AssignExprAssign)
+WC_AST_NODE_KIND(AssignExprAssignARShift)
+WC_AST_NODE_KIND(AssignExprAssignAdd)
+WC_AST_NODE_KIND(AssignExprAssignBAnd)
+WC_AST_NODE_KIND(AssignExprAssignBOr)
+WC_AST_NODE_KIND(AssignExprAssignBXor)
+WC_AST_NODE_KIND(AssignExprAssignDiv)
+WC_AST_NODE_KIND(AssignExprAssignLRShift)
+WC_AST_NODE_KIND(AssignExprAssignLShift)
+WC_AST_NODE_KIND(AssignExprAssignMul)
+WC_AST_NODE_KIND(AssignExprAssignRem)
+WC_AST_NODE_KIND(AssignExprAssignSub)
+WC_AST_NODE_KIND(BoolLit)
+WC_AST_NODE_KIND(BreakStmntNoCond)
+WC_AST_NODE_KIND(BreakStmntWithCond)
+WC_AST_NODE_KIND(CastExprCast)
+WC_AST_NODE_KIND(CmpExprEQ)
+WC_AST_NODE_KIND(CmpExprGE)
+WC_AST_NODE_KIND(CmpExprGT)
+WC_AST_NODE_KIND(CmpExprLE)
+WC_AST_NODE_KIND(CmpExprLT)
+WC_AST_NODE_KIND(CmpExprNE)
+WC_AST_NODE_KIND(DeclDefFunc)
+WC_AST_NODE_KIND(DeclDefVarDecl)
+WC_AST_NODE_KIND(Func)
+WC_AST_NODE_KIND(FuncArg)
+WC_AST_NODE_KIND(Identifier)
+WC_AST_NODE_KIND(IfStmntElse)
+WC_AST_NODE_KIND(IfStmntElseIf)
+WC_AST_NODE_KIND(IfStmntNoElse)
+WC_AST_NODE_KIND(IntLit)
+WC_AST_NODE_KIND(LAndExprAnd)
+WC_AST_NODE_KIND(LOrExprOr)
+WC_AST_NODE_KIND(LoopStmntNoCond)
+WC_AST_NODE_KIND(LoopStmntWithCond)
+WC_AST_NODE_KIND(Module)
+WC_AST_NODE_KIND(MulExprBAnd)
+WC_AST_NODE_KIND(MulExprDiv)
+WC_AST_NODE_KIND(MulExprMul)
+WC_AST_NODE_KIND(MulExprRem)
+WC_AST_NODE_KIND(NextStmntNoCond)
+WC_AST_NODE_KIND(NextStmntWithCond)
+WC_AST_NODE_KIND(NoOpStmnt)
+WC_AST_NODE_KIND(NotExprBNot)
+WC_AST_NODE_KIND(NotExprLNot)
+WC_AST_NODE_KIND(NullLit)
+WC_AST_NODE_KIND(PostfixExprArrayLookup)
+WC_AST_NODE_KIND(PostfixExprDec)
+WC_AST_NODE_KIND(PostfixExprFuncCall)
+WC_AST_NODE_KIND(PostfixExprInc)
+WC_AST_NODE_KIND(PrefixExprAddrOf)
+WC_AST_NODE_KIND(PrefixExprMinus)
+WC_AST_NODE_KIND(PrefixExprPlus)
+WC_AST_NODE_KIND(PrefixExprPtrDenull)
+WC_AST_NODE_KIND(PrefixExprPtrDeref)
+WC_AST_NODE_KIND(PrimaryExprArrayLit)
+WC_AST_NODE_KIND(PrimaryExprBoolLit)
+WC_AST_NODE_KIND(PrimaryExprIdentifier)
+WC_AST_NODE_KIND(PrimaryExprIntLit)
+WC_AST_NODE_KIND(PrimaryExprNullLit)
+WC_AST_NODE_KIND(PrimaryExprParen)
+WC_AST_NODE_KIND(PrimaryExprRandExpr)
+WC_AST_NODE_KIND(PrimaryExprReadnumExpr)
+WC_AST_NODE_KIND(PrimaryExprStrLit)
+WC_AST_NODE_KIND(PrimaryExprTimeExpr)
+WC_AST_NODE_KIND(PrimitiveType)
+WC_AST_NODE_KIND(PrintStmnt)
+WC_AST_NODE_KIND(RandExprRand)
+WC_AST_NODE_KIND(RandExprSRand)
+WC_AST_NODE_KIND(ReadnumExpr)
+WC_AST_NODE_KIND(ReturnStmntNoCondVoid)
+WC_AST_NODE_KIND(ReturnStmntNoCondWithValue)
+WC_AST_NODE_KIND(ReturnStmntWithCondAndValue)
+WC_AST_NODE_KIND(ReturnStmntWithCondVoid)
+WC_AST_NODE_KIND(Scope)
+WC_AST_NODE_KIND(ScopeStmnt)
+WC_AST_NODE_KIND(ShiftExprARShift)
+WC_AST_NODE_KIND(ShiftExprLRShift)
+WC_AST_NODE_KIND(ShiftExprLShift)
+WC_AST_NODE_KIND(StmntAssertStmnt)
+WC_AST_NODE_KIND(StmntAssignExpr)
+WC_AST_NODE_KIND(StmntBreakStmnt)
+WC_AST_NODE_KIND(StmntIfStmnt)
+WC_AST_NODE_KIND(StmntLoopStmnt)
+WC_AST_NODE_KIND(StmntNextStmnt)
+WC_AST_NODE_KIND(StmntNoOpStmnt)
+WC_AST_NODE_KIND(StmntPrintStmnt)
+WC_AST_NODE_KIND(StmntReturnStmnt)
+WC_AST_NODE_KIND(StmntScopeStmnt)
+WC_AST_NODE_KIND(StmntVarDecl)
+WC_AST_NODE_KIND(StmntWhileStmnt)
+WC_AST_NODE_KIND(StrLit)
+WC_AST_NODE_KIND(TernaryExprWithCond)
+WC_AST_NODE_KIND(TimeExpr)
+WC_AST_NODE_KIND(TypeArray)
+WC_AST_NODE_KIND(TypePrimitive)
+WC_AST_NODE_KIND(TypePtr)
+WC_AST_NODE_KIND(VarDeclExplicitType)
+WC_AST_NODE_KIND(VarDeclInferType)
+WC_AST_NODE_KIND(WhileStmnt)
+
+#undef WC_AST_NODE_KIND
+
+WC_AST_END_NAMESPACE
+WC_END_NAMESPACE
@@ -14,7 +14,6 @@ WC_AST_BEGIN_NAMESPACE
 class AddExprAdd;
 class AddExprBOr;
 class AddExprBXor;
-class AddExprNoOp;
 class AddExprSub;
 class ArrayLit;
 class AssertStmnt;
@@ -30,19 +29,16 @@ class AssignExprAssignLShift;
 class AssignExprAssignMul;
 class AssignExprAssignRem;
 class AssignExprAssignSub;
-class AssignExprNoAssign;
 class BoolLit;
 class BreakStmntNoCond;
 class BreakStmntWithCond;
 class CastExprCast;
-class CastExprNoCast;
 class CmpExprEQ;
 class CmpExprGE;
 class CmpExprGT;
 class CmpExprLE;
 class CmpExprLT;
 class CmpExprNE;
-class CmpExprNoOp;
 class DeclDefFunc;
 class DeclDefVarDecl;
 class Func;
@@ -53,8 +49,6 @@ class IfStmntElseIf;
 class IfStmntNoElse;
 class IntLit;
 class LAndExprAnd;
-class LAndExprNoOp;
-class LOrExprNoOp;
 class LOrExprOr;
 class LoopStmntNoCond;
 class LoopStmntWithCond;
@@ -62,23 +56,19 @@ class Module;
 class MulExprBAnd;
 class MulExprDiv;
 class MulExprMul;
-class MulExprNoOp;
 class MulExprRem;
 class NextStmntNoCond;
 class NextStmntWithCond;
 class NoOpStmnt;
 class NotExprBNot;
 class NotExprLNot;
-class NotExprNoOp;
 class NullLit;
 class PostfixExprArrayLookup;
 class PostfixExprDec;
 class PostfixExprFuncCall;
 class PostfixExprInc;
-class PostfixExprNoOp;
 class PrefixExprAddrOf;
 class PrefixExprMinus;
-class PrefixExprNoOp;
 class PrefixExprPlus;
 class PrefixExprPtrDenull;
 class PrefixExprPtrDeref;
@@ -106,7 +96,6 @@ class ScopeStmnt;
 class ShiftExprARShift;
 class ShiftExprLRShift;
 class ShiftExprLShift;
-class ShiftExprNoOp;
 class StmntAssertStmnt;
 class StmntAssignExpr;
 class StmntBreakStmnt;
@@ -120,7 +109,6 @@ class StmntScopeStmnt;
 class StmntVarDecl;
 class StmntWhileStmnt;
 class StrLit;
-class TernaryExprNoCond;
 class TernaryExprWithCond;
 class TimeExpr;
 class TypeArray;
@@ -138,7 +126,6 @@ public:
     virtual void visit(const AddExprAdd & astNode) = 0;
     virtual void visit(const AddExprBOr & astNode) = 0;
     virtual void visit(const AddExprBXor & astNode) = 0;
-    virtual void visit(const AddExprNoOp & astNode) = 0;
     virtual void visit(const AddExprSub & astNode) = 0;
     virtual void visit(const ArrayLit & astNode) = 0;
     virtual void visit(const AssertStmnt & astNode) = 0;
@@ -154,19 +141,16 @@ public:
     virtual void visit(const AssignExprAssignMul & astNode) = 0;
     virtual void visit(const AssignExprAssignRem & astNode) = 0;
     virtual void visit(const AssignExprAssignSub & astNode) = 0;
-    virtual void visit(const AssignExprNoAssign & astNode) = 0;
     virtual void visit(const BoolLit & astNode) = 0;
     virtual void visit(const BreakStmntNoCond & astNode) = 0;
     virtual void visit(const BreakStmntWithCond & astNode) = 0;
     virtual void visit(const CastExprCast & astNode) = 0;
-    virtual void visit(const CastExprNoCast & astNode) = 0;
     virtual void visit(const CmpExprEQ & astNode) = 0;
     virtual void visit(const CmpExprGE & astNode) = 0;
     virtual void visit(const CmpExprGT & astNode) = 0;
     virtual void visit(const CmpExprLE & astNode) = 0;
     virtual void visit(const CmpExprLT & astNode) = 0;
     virtual void visit(const CmpExprNE & astNode) = 0;
-    virtual void visit(const CmpExprNoOp & astNode) = 0;
     virtual void visit(const DeclDefFunc & astNode) = 0;
     virtual void visit(const DeclDefVarDecl & astNode) = 0;
     virtual void visit(const Func & astNode) = 0;
@@ -177,8 +161,6 @@ public:
     virtual void visit(const IfStmntNoElse & astNode) = 0;
     virtual void visit(const IntLit & astNode) = 0;
     virtual void visit(const LAndExprAnd & astNode) = 0;
-    virtual void visit(const LAndExprNoOp & astNode) = 0;
-    virtual void visit(const LOrExprNoOp & astNode) = 0;
     virtual void visit(const LOrExprOr & astNode) = 0;
     virtual void visit(const LoopStmntNoCond & astNode) = 0;
     virtual void visit(const LoopStmntWithCond & astNode) = 0;
@@ -186,23 +168,19 @@ public:
     virtual void visit(const MulExprBAnd & astNode) = 0;
     virtual void visit(const MulExprDiv & astNode) = 0;
     virtual void visit(const MulExprMul & astNode) = 0;
-    virtual void visit(const MulExprNoOp & astNode) = 0;
     virtual void visit(const MulExprRem & astNode) = 0;
     virtual void visit(const NextStmntNoCond & astNode) = 0;
     virtual void visit(const NextStmntWithCond & astNode) = 0;
     virtual void visit(const NoOpStmnt & astNode) = 0;
     virtual void visit(const NotExprBNot & astNode) = 0;
     virtual void visit(const NotExprLNot & astNode) = 0;
-    virtual void visit(const NotExprNoOp & astNode) = 0;
     virtual void visit(const NullLit & astNode) = 0;
     virtual void visit(const PostfixExprArrayLookup & astNode) = 0;
     virtual void visit(const PostfixExprDec & astNode) = 0;
     virtual void visit(const PostfixExprFuncCall & astNode) = 0;
     virtual void visit(const PostfixExprInc & astNode) = 0;
-    virtual void visit(const PostfixExprNoOp & astNode) = 0;
     virtual void visit(const PrefixExprAddrOf & astNode) = 0;
     virtual void visit(const PrefixExprMinus & astNode) = 0;
-    virtual void visit(const PrefixExprNoOp & astNode) = 0;
     virtual void visit(const PrefixExprPlus & astNode) = 0;
     virtual void visit(const PrefixExprPtrDenull & astNode) = 0;
     virtual void visit(const PrefixExprPtrDeref & astNode) = 0;
@@ -230,7 +208,6 @@ public:
     virtual void visit(const ShiftExprARShift & astNode) = 0;
     virtual void visit(const ShiftExprLRShift & astNode) = 0;
     virtual void visit(const ShiftExprLShift & astNode) = 0;
-    virtual void visit(const ShiftExprNoOp & astNode) = 0;
     virtual void visit(const StmntAssertStmnt & astNode) = 0;
     virtual void visit(const StmntAssignExpr & astNode) = 0;
     virtual void visit(const StmntBreakStmnt & astNode) = 0;
@@ -244,7 +221,6 @@ public:
     virtual void visit(const StmntVarDecl & astNode) = 0;
     virtual void visit(const StmntWhileStmnt & astNode) = 0;
     virtual void visit(const StrLit & astNode) = 0;
-    virtual void visit(const TernaryExprNoCond & astNode) = 0;
     virtual void visit(const TernaryExprWithCond & astNode) = 0;
     virtual void visit(const TimeExpr & astNode) = 0;
     virtual void visit(const TypeArray & astNode) = 0;
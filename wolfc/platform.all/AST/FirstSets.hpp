@@ -0,0 +1,140 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#pragma once
+
+#include "Lexer/TokenTypeSet.hpp"
+
+WC_BEGIN_NAMESPACE
+WC_AST_BEGIN_NAMESPACE
+
+/**
+ * The FIRST set of each grammar production: the set of token types which can begin the production.
+ * These are built at compile time and are what the 'peek()' function for each AST node checks against, so
+ * peeking at any production is a single lookup no matter how deep down the grammar its first token comes from.
+ *
+ * The sets are composed in the same way as the grammar itself (see the comments for each AST node), so when
+ * the grammar changes the set for the changed production must be updated here too.
+ */
+namespace FirstSets {
+    //-------------------------------------------------------------------------
+    // Literals and primary expressions
+    //-------------------------------------------------------------------------
+    static constexpr const TokenTypeSet kIntLit{ TokenType::kIntLit };
+    static constexpr const TokenTypeSet kBoolLit{ TokenType::kTrue, TokenType::kFalse };
+    static constexpr const TokenTypeSet kStrLit{ TokenType::kStrLit };
+    static constexpr const TokenTypeSet kNullLit{ TokenType::kNull };
+    static constexpr const TokenTypeSet kArrayLit{ TokenType::kLBrack };
+    static constexpr const TokenTypeSet kIdentifier{ TokenType::kIdentifier };
+    static constexpr const TokenTypeSet kReadnumExpr{ TokenType::kReadnum };
+    static constexpr const TokenTypeSet kTimeExpr{ TokenType::kTime };
+    static constexpr const TokenTypeSet kRandExpr{ TokenType::kRand, TokenType::kSRand };
+    
+    /* Note: the '(' is for a parenthesized expression */
+    static constexpr const TokenTypeSet kPrimaryExpr = kIntLit |
+                                                       kBoolLit |
+                                                       kStrLit |
+                                                       kNullLit |
+                                                       kArrayLit |
+                                                       kIdentifier |
+                                                       kReadnumExpr |
+                                                       kTimeExpr |
+                                                       kRandExpr |
+                                                       TokenTypeSet{ TokenType::kLParen };
+    
+    //-------------------------------------------------------------------------
+    // Operator expressions, from highest to lowest precedence
+    //-------------------------------------------------------------------------
+    static constexpr const TokenTypeSet kCastExpr = kPrimaryExpr | TokenTypeSet{ TokenType::kCast };
+    static constexpr const TokenTypeSet kPostfixExpr = kCastExpr;
+    static constexpr const TokenTypeSet kPrefixExpr = kPostfixExpr | TokenTypeSet{
+        TokenType::kMinus,
+        TokenType::kPlus,
+        TokenType::kAmpersand,
+        TokenType::kDollar,
+        TokenType::kHat
+    };
+    
+    static constexpr const TokenTypeSet kShiftExpr = kPrefixExpr;
+    static constexpr const TokenTypeSet kMulExpr = kShiftExpr;
+    static constexpr const TokenTypeSet kAddExpr = kMulExpr;
+    static constexpr const TokenTypeSet kCmpExpr = kAddExpr;
+    static constexpr const TokenTypeSet kNotExpr = kCmpExpr | TokenTypeSet{ TokenType::kNot, TokenType::kTilde };
+    static constexpr const TokenTypeSet kLAndExpr = kNotExpr;
+    static constexpr const TokenTypeSet kLOrExpr = kLAndExpr;
+    static constexpr const TokenTypeSet kTernaryExpr = kLOrExpr;
+    static constexpr const TokenTypeSet kAssignExpr = kTernaryExpr;
+    
+    //-------------------------------------------------------------------------
+    // Statements
+    //-------------------------------------------------------------------------
+    static constexpr const TokenTypeSet kNoOpStmnt{ TokenType::kNoOp };
+    static constexpr const TokenTypeSet kPrintStmnt{ TokenType::kPrint };
+    static constexpr const TokenTypeSet kAssertStmnt{ TokenType::kAssert };
+    static constexpr const TokenTypeSet kVarDecl{ TokenType::kLet };
+    static constexpr const TokenTypeSet kIfStmnt{ TokenType::kIf, TokenType::kUnless };
+    static constexpr const TokenTypeSet kWhileStmnt{ TokenType::kWhile, TokenType::kUntil };
+    static constexpr const TokenTypeSet kLoopStmnt{ TokenType::kLoop };
+    static constexpr const TokenTypeSet kScopeStmnt{ TokenType::kScope };
+    static constexpr const TokenTypeSet kBreakStmnt{ TokenType::kBreak };
+    static constexpr const TokenTypeSet kNextStmnt{ TokenType::kNext };
+    static constexpr const TokenTypeSet kReturnStmnt{ TokenType::kReturn };
+    
+    static constexpr const TokenTypeSet kStmnt = kNoOpStmnt |
+                                                 kPrintStmnt |
+                                                 kAssertStmnt |
+                                                 kVarDecl |
+                                                 kIfStmnt |
+                                                 kWhileStmnt |
+                                                 kLoopStmnt |
+                                                 kScopeStmnt |
+                                                 kBreakStmnt |
+                                                 kNextStmnt |
+                                                 kReturnStmnt |
+                                                 kAssignExpr;
+    
+    //-------------------------------------------------------------------------
+    // Declarations and definitions
+    //-------------------------------------------------------------------------
+    static constexpr const TokenTypeSet kFunc{ TokenType::kFunc };
+    static constexpr const TokenTypeSet kFuncArg = kIdentifier;
+    static constexpr const TokenTypeSet kDeclDef = kFunc | kVarDecl;
+    
+    //-------------------------------------------------------------------------
+    // Types
+    //-------------------------------------------------------------------------
+    
+    /* Note: must match the keywords handled by 'PrimitiveDataTypes::getTypeIdForLangKeyword' */
+    static constexpr const TokenTypeSet kPrimitiveType{
+        TokenType::kVoid,
+        TokenType::kAny,
+        TokenType::kNullptr,
+        TokenType::kInt,
+        TokenType::kInt8,
+        TokenType::kInt16,
+        TokenType::kInt32,
+        TokenType::kInt64,
+        TokenType::kInt128,
+        TokenType::kUInt,
+        TokenType::kUInt8,
+        TokenType::kUInt16,
+        TokenType::kUInt32,
+        TokenType::kUInt64,
+        TokenType::kUInt128,
+        TokenType::kBool,
+        TokenType::kString
+    };
+    
+    /* Note: '^' is for pointer types, '?' for nullable types and '[' for array types */
+    static constexpr const TokenTypeSet kType = kPrimitiveType | TokenTypeSet{
+        TokenType::kHat,
+        TokenType::kQMark,
+        TokenType::kLBrack
+    };
+}
+
+WC_AST_END_NAMESPACE
+WC_END_NAMESPACE
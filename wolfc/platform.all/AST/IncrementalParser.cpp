@@ -0,0 +1,510 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#include "IncrementalParser.hpp"
+
+#include "Assert.hpp"
+#include "Lexer/Lexer.hpp"
+#include "Nodes/DeclDef.hpp"
+#include "Nodes/Module.hpp"
+#include "ParseCtx.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <algorithm>
+    #include <cstdio>
+    #include <cstring>
+    #include <iterator>
+    #include <limits>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+WC_AST_BEGIN_NAMESPACE
+
+/* Settings for the allocator that identifier names are interned in */
+static constexpr const size_t kSymbolAllocMaxAllocSize = 1024 * 64;
+static constexpr const size_t kSymbolAllocBlockSize = 1024 * 256;
+
+/* Settings for the allocator that the module node is created in */
+static constexpr const size_t kModuleAllocSize = 1024;
+
+/**
+ * Roughly how many bytes of source there are for each token, used to guess how many tokens to make room for
+ * when lexing part of the source. The lexer grows its token list if the guess is too small.
+ */
+static constexpr const size_t kSrcBytesPerTokenEstimate = 4;
+static constexpr const size_t kMinTokenCapacity = 64;
+
+IncrementalParser::ParsedRange::ParsedRange(LinearAllocPool & nodeAllocPool) :
+    nodeAlloc(nodeAllocPool)
+{
+    WC_EMPTY_FUNC_BODY();
+}
+
+IncrementalParser::IncrementalParser() :
+    mSymbolAlloc(kSymbolAllocMaxAllocSize, kSymbolAllocBlockSize),
+    mSymbolTable(mSymbolAlloc),
+    mNodeAllocPool(kASTAllocMaxAllocSize, kASTAllocBlockSize),
+    mNumErrorMsgs(0),
+    mEOFToken(),
+    mModuleAlloc(kModuleAllocSize, kModuleAllocSize),
+    mModule(nullptr),
+    mLastReparseStats()
+{
+    mSrcLineIndex.reset(mSrcText.c_str());
+    mEOFToken.type = TokenType::kEOF;
+    mSymbolAllocStartMark = mSymbolAlloc.mark();
+}
+
+IncrementalParser::~IncrementalParser() {
+    // Note: the elements must go before the pool that their allocators return memory blocks to, which is already
+    // the case given the order of the members. Just make that explicit here.
+    mTopLevelElems.clear();
+}
+
+bool IncrementalParser::parse(const char * utf8Src, size_t srcSize) {
+    WC_ASSERT(utf8Src);
+    WC_GUARD(srcSize <= std::numeric_limits<uint32_t>::max(), false);
+    mLastReparseStats = ReparseStats();
+    
+    // Take a copy of the source and start again with it, the EOF token is updated when the end is lexed
+    mSrcText.assign(utf8Src, srcSize);
+    mSrcLineIndex.reset(mSrcText.c_str());
+    mEOFToken.startSrcOffset = static_cast<uint32_t>(srcSize);
+    mEOFToken.endSrcOffset = mEOFToken.startSrcOffset;
+    mEOFToken.nextTokenSrcOffset = mEOFToken.startSrcOffset;
+    
+    // Throw away the elements from before, then all of the names interned for them. Names are never removed from
+    // the symbol table as edits are made, so this is where names from old edits (e.g partly typed identifiers)
+    // get cleared out.
+    std::vector<TopLevelElem> noElems;
+    replaceElems(0, mTopLevelElems.size(), noElems);
+    mSymbolTable.clear();
+    mSymbolAlloc.rollback(mSymbolAllocStartMark);
+    
+    // Parse everything as one range
+    size_t endElemIdx = 0;
+    return reparseElems(0, 0, 0, endElemIdx);
+}
+
+bool IncrementalParser::applyEdit(uint32_t srcOffset,
+                                  size_t numBytesRemoved,
+                                  const char * insertedText,
+                                  size_t numBytesInserted)
+{
+    WC_ASSERT(insertedText || numBytesInserted == 0);
+    WC_GUARD(srcOffset <= mSrcText.size(), false);
+    WC_GUARD(numBytesRemoved <= mSrcText.size() - srcOffset, false);
+    WC_GUARD(mSrcText.size() - numBytesRemoved + numBytesInserted <= std::numeric_limits<uint32_t>::max(), false);
+    mLastReparseStats = ReparseStats();
+    
+    // Find the range of top level elements which the edit touches: from the last one starting before the edit
+    // up to and including the last one starting at or before the end of the edit. An edit right at the start of
+    // an element touches the element before too, since the edit could run on from the end of that.
+    const uint32_t editEndSrcOffset = srcOffset + static_cast<uint32_t>(numBytesRemoved);
+    
+    auto startElemIter = std::lower_bound(mTopLevelElems.begin(),
+                                          mTopLevelElems.end(),
+                                          srcOffset,
+                                          [](const TopLevelElem & elem, uint32_t offset) {
+                                              return elem.srcOffset < offset;
+                                          });
+    
+    auto endElemIter = std::upper_bound(mTopLevelElems.begin(),
+                                        mTopLevelElems.end(),
+                                        editEndSrcOffset,
+                                        [](uint32_t offset, const TopLevelElem & elem) {
+                                            return offset < elem.srcOffset;
+                                        });
+    
+    size_t startElemIdx = static_cast<size_t>(startElemIter - mTopLevelElems.begin());
+    size_t endElemIdx = static_cast<size_t>(endElemIter - mTopLevelElems.begin());
+    
+    if (startElemIdx > 0) {
+        --startElemIdx;
+    }
+    
+    // Make the edit and move along the elements after it, along with the EOF token.
+    // Note: the EOF token is replaced if the reparse runs to the end of the source.
+    mSrcText.replace(srcOffset, numBytesRemoved, insertedText, numBytesInserted);
+    const int64_t srcOffsetDelta = static_cast<int64_t>(numBytesInserted) - static_cast<int64_t>(numBytesRemoved);
+    
+    for (size_t i = endElemIdx; i < mTopLevelElems.size(); ++i) {
+        mTopLevelElems[i].srcOffset = static_cast<uint32_t>(mTopLevelElems[i].srcOffset + srcOffsetDelta);
+    }
+    
+    mEOFToken.startSrcOffset = static_cast<uint32_t>(mSrcText.size());
+    mEOFToken.endSrcOffset = mEOFToken.startSrcOffset;
+    mEOFToken.nextTokenSrcOffset = mEOFToken.startSrcOffset;
+    
+    // Parse the edited elements again
+    const size_t numLinesBeforeEdit = mSrcLineIndex.getNumLines();
+    size_t elemIdx = 0;
+    bool lexedOk = reparseElems(startElemIdx, endElemIdx, srcOffsetDelta, elemIdx);
+    
+    // Errors and warnings are saved with their line and column, so the elements after the edit which have any
+    // must be parsed again if the edit moved them. This is the case for all of them if the number of lines
+    // changed, otherwise it's only the case for those starting on the line where the reparsed range ended.
+    WC_GUARD(elemIdx < mTopLevelElems.size(), lexedOk);
+    const bool linesMoved = mSrcLineIndex.getNumLines() != numLinesBeforeEdit;
+    const uint32_t rangeEndLine = mSrcLineIndex.getLine(mTopLevelElems[elemIdx].srcOffset);
+    
+    while (elemIdx < mTopLevelElems.size()) {
+        if (!linesMoved && mSrcLineIndex.getLine(mTopLevelElems[elemIdx].srcOffset) != rangeEndLine) {
+            break;
+        }
+        
+        if (elemHasMsgs(elemIdx)) {
+            // Note: always move on, in case the range was widened to take in elements before this one
+            size_t reparsedEndElemIdx = 0;
+            reparseElems(elemIdx, elemIdx + 1, 0, reparsedEndElemIdx);
+            elemIdx = std::max(elemIdx + 1, reparsedEndElemIdx);
+        }
+        else {
+            ++elemIdx;
+        }
+    }
+    
+    return lexedOk;
+}
+
+std::vector<std::string> IncrementalParser::getErrorMsgs() const {
+    std::vector<std::string> errorMsgs;
+    
+    for (const TopLevelElem & elem : mTopLevelElems) {
+        if (elem.msgs) {
+            errorMsgs.insert(errorMsgs.end(), elem.msgs->errorMsgs.begin(), elem.msgs->errorMsgs.end());
+        }
+    }
+    
+    return errorMsgs;
+}
+
+std::vector<std::string> IncrementalParser::getWarningMsgs() const {
+    std::vector<std::string> warningMsgs;
+    
+    for (const TopLevelElem & elem : mTopLevelElems) {
+        if (elem.msgs) {
+            warningMsgs.insert(warningMsgs.end(), elem.msgs->warningMsgs.begin(), elem.msgs->warningMsgs.end());
+        }
+    }
+    
+    return warningMsgs;
+}
+
+bool IncrementalParser::reparseElems(size_t startElemIdx,
+                                     size_t endElemIdx,
+                                     int64_t srcOffsetDelta,
+                                     size_t & outEndElemIdx)
+{
+    WC_ASSERT(startElemIdx <= endElemIdx);
+    WC_ASSERT(endElemIdx <= mTopLevelElems.size());
+    WC_ASSERT(startElemIdx < endElemIdx || mTopLevelElems.empty());
+    
+    // Widen the range to take in the neighbouring elements whose parse depends on the elements in the range:
+    //
+    //  (1) Elements which failed to parse: the junk skipped after an error runs on until the next decldef, and the
+    //      junk at the start of one of these might have been part of the element before had that been different.
+    //  (2) Elements which must be on a new line from the element before them, since that is checked against the
+    //      end of the element before.
+    const size_t numElems = mTopLevelElems.size();
+    
+    while (startElemIdx > 0 &&
+           (!mTopLevelElems[startElemIdx - 1].declDef || mTopLevelElems[startElemIdx - 1].requireNewlineAfter))
+    {
+        --startElemIdx;
+    }
+    
+    auto widenRangeEnd = [&](){
+        while (endElemIdx < numElems &&
+               (!mTopLevelElems[endElemIdx].declDef || mTopLevelElems[endElemIdx - 1].requireNewlineAfter))
+        {
+            ++endElemIdx;
+        }
+    };
+    
+    widenRangeEnd();
+    
+    // Keep trying until the range is wide enough, which at the very least is once it covers the rest of the source
+    while (true) {
+        // Figure out what part of the source the range covers. Note: the first element always covers the start of
+        // the source, even if it has been edited to start later.
+        const bool rangeAtSrcEnd = endElemIdx >= numElems;
+        const uint32_t rangeStartSrcOffset = (startElemIdx > 0) ? mTopLevelElems[startElemIdx].srcOffset : 0;
+        const uint32_t rangeEndSrcOffset = rangeAtSrcEnd ?
+            static_cast<uint32_t>(mSrcText.size()) :
+            mTopLevelElems[endElemIdx].srcOffset;
+        
+        const uint8_t firstTokenFlags = (startElemIdx > 0) ? mTopLevelElems[startElemIdx].startTokenFlags : 0;
+        
+        // Lex the range
+        const char * srcText = mSrcText.c_str();
+        size_t rangeSize = rangeEndSrcOffset - rangeStartSrcOffset;
+        Lexer lexer(kMinTokenCapacity + rangeSize / kSrcBytesPerTokenEstimate);
+        bool lexedOk = lexer.processRange(srcText,
+                                          srcText + rangeStartSrcOffset,
+                                          rangeAtSrcEnd ? nullptr : srcText + rangeEndSrcOffset,
+                                          firstTokenFlags,
+                                          &mSrcLineIndex);
+        
+        mLastReparseStats.numBytesLexed += rangeSize;
+        mLastReparseStats.numTokensLexed += lexer.getTokenCount();
+        
+        if (lexedOk && !rangeAtSrcEnd) {
+            // If a token or comment ran on past the end of the range then the lexer went on to the end of the
+            // source, so take in the rest of the elements.
+            if (lexer.isFinished()) {
+                endElemIdx = numElems;
+                continue;
+            }
+            
+            // If the token after the range has different flags now (e.g. the newline before it was removed) then
+            // the element starting at it must be parsed again too.
+            if (lexer.getNextTokenFlags() != mTopLevelElems[endElemIdx].startTokenFlags) {
+                ++endElemIdx;
+                widenRangeEnd();
+                continue;
+            }
+        }
+        
+        // Build the line index for the edited source: the lines up until the end of the range come from lexing
+        // the range, and the lines after are the same as before but moved along by the edit.
+        SourceLineIndex srcLineIndex;
+        
+        if (lexedOk) {
+            srcLineIndex = lexer.getSrcLineIndex();
+        }
+        else {
+            // The lexer stopped part way through the range, so find the lines in the range the slow way
+            srcLineIndex.reset(srcText, mSrcLineIndex, rangeStartSrcOffset);
+            srcLineIndex.scanLineStarts(rangeStartSrcOffset, rangeEndSrcOffset);
+        }
+        
+        srcLineIndex.appendMovedLineStarts(mSrcLineIndex,
+                                           static_cast<uint32_t>(rangeEndSrcOffset - srcOffsetDelta),
+                                           srcOffsetDelta);
+        
+        std::vector<TopLevelElem> newElems;
+        
+        if (!lexedOk) {
+            // Put a single element without a decldef in place of the range, with an error saying what is wrong.
+            // Since it has no decldef it will be lexed again along with its neighbours when they are edited.
+            mSrcLineIndex = std::move(srcLineIndex);
+            SourceLoc srcLoc = mSrcLineIndex.getLoc(rangeStartSrcOffset);
+            char msgBuf[256];
+            std::snprintf(msgBuf,
+                          sizeof(msgBuf),
+                          "@line %zu, col %zu: Error! Failed to split the source code starting here into tokens!",
+                          size_t(srcLoc.line) + 1,
+                          size_t(srcLoc.col) + 1);
+            
+            newElems.emplace_back();
+            TopLevelElem & elem = newElems.back();
+            elem.declDef = nullptr;
+            elem.srcOffset = rangeStartSrcOffset;
+            elem.parsedSrcOffset = rangeStartSrcOffset;
+            elem.startTokenFlags = firstTokenFlags;
+            elem.requireNewlineAfter = false;
+            elem.msgs.reset(new Msgs());
+            elem.msgs->errorMsgs.push_back(msgBuf);
+            
+            replaceElems(startElemIdx, endElemIdx, newElems);
+            outEndElemIdx = startElemIdx + 1;
+            return false;
+        }
+        
+        // Parse the elements in the range. Each group of elements parsed gets its own tokens and allocator.
+        std::shared_ptr<ParsedRange> parsedRange(new ParsedRange(mNodeAllocPool));
+        copyTokens(lexer, rangeEndSrcOffset, *parsedRange);
+        ParseCtx parseCtx(parsedRange->tokens.data(), mTokenTypes.data(), srcLineIndex, parsedRange->nodeAlloc);
+        
+        if (startElemIdx == 0) {
+            parseCtx.skipSeparators();
+        }
+        
+        const DeclDef * prevDeclDef = nullptr;
+        bool requireNewline = false;
+        
+        while (parseCtx.tokType() != TokenType::kEOF) {
+            newElems.emplace_back();
+            TopLevelElem & elem = newElems.back();
+            elem.srcOffset = (startElemIdx == 0 && newElems.size() == 1) ? 0 : parseCtx.tok()->startSrcOffset;
+            elem.parsedSrcOffset = elem.srcOffset;
+            elem.startTokenFlags = parseCtx.tok()->flags;
+            
+            size_t numErrorMsgsBefore = parseCtx.getErrorMsgs().size();
+            size_t numWarningMsgsBefore = parseCtx.getWarningMsgs().size();
+            elem.declDef = Module::parseTopLevelElem(parseCtx, prevDeclDef, requireNewline);
+            elem.requireNewlineAfter = requireNewline;
+            elem.parsedRange = parsedRange;
+            
+            if (elem.declDef) {
+                prevDeclDef = elem.declDef;
+            }
+            
+            // Save any errors and warnings for the element
+            const auto & errorMsgs = parseCtx.getErrorMsgs();
+            const auto & warningMsgs = parseCtx.getWarningMsgs();
+            
+            if (errorMsgs.size() > numErrorMsgsBefore || warningMsgs.size() > numWarningMsgsBefore) {
+                elem.msgs.reset(new Msgs());
+                elem.msgs->errorMsgs.assign(errorMsgs.begin() + numErrorMsgsBefore, errorMsgs.end());
+                elem.msgs->warningMsgs.assign(warningMsgs.begin() + numWarningMsgsBefore, warningMsgs.end());
+            }
+        }
+        
+        if (!rangeAtSrcEnd) {
+            // The first element must cover the start of the source, so if there is nothing left in a range at the
+            // start then take in the element after it.
+            if (startElemIdx == 0 && newElems.empty()) {
+                ++endElemIdx;
+                widenRangeEnd();
+                continue;
+            }
+            
+            // If the last element here failed to parse then it might have run on past the end of the range had
+            // the range not ended there, e.g. a function missing its 'end'. Take in more elements, doubling the
+            // range each time so this doesn't get too expensive when there are a lot of elements to take in.
+            if (!newElems.empty() && !newElems.back().declDef) {
+                endElemIdx = std::min(numElems, endElemIdx + (endElemIdx - startElemIdx));
+                widenRangeEnd();
+                continue;
+            }
+            
+            // If the element after the range must be on a new line from the last element here then it depends on
+            // this range, so take it in too.
+            if (requireNewline) {
+                ++endElemIdx;
+                widenRangeEnd();
+                continue;
+            }
+        }
+        
+        // All good, save the results
+        mLastReparseStats.numTopLevelElemsParsed += newElems.size();
+        mLastReparseStats.numASTNodesCreated += parseCtx.getNumASTNodes();
+        
+        if (rangeAtSrcEnd) {
+            mEOFToken = *parseCtx.tok();
+        }
+        
+        mSrcLineIndex = std::move(srcLineIndex);
+        replaceElems(startElemIdx, endElemIdx, newElems);
+        outEndElemIdx = startElemIdx + newElems.size();
+        return true;
+    }
+}
+
+void IncrementalParser::copyTokens(const Lexer & lexer, uint32_t rangeEndSrcOffset, ParsedRange & parsedRange) {
+    const size_t numTokens = lexer.getTokenCount();
+    const Token * tokens = lexer.getTokenList();
+    const TokenType * tokenTypes = lexer.getTokenTypeList();
+    std::vector<Token> & rangeTokens = parsedRange.tokens;
+    rangeTokens.reserve(numTokens + 1);
+    rangeTokens.assign(tokens, tokens + numTokens);
+    mTokenTypes.assign(tokenTypes, tokenTypes + numTokens);
+    
+    // If the lexer stopped at the end of the range then end the tokens with an EOF token there. This is given the
+    // flags for the token after the range, so separators at the end of the range are handled as they would be
+    // when parsing the whole source.
+    if (!lexer.isFinished()) {
+        if (numTokens > 0) {
+            rangeTokens.back().nextTokenSrcOffset = rangeEndSrcOffset;
+        }
+        
+        Token eofToken = {};
+        eofToken.type = TokenType::kEOF;
+        eofToken.flags = lexer.getNextTokenFlags();
+        eofToken.startSrcOffset = rangeEndSrcOffset;
+        eofToken.endSrcOffset = rangeEndSrcOffset;
+        eofToken.nextTokenSrcOffset = rangeEndSrcOffset;
+        rangeTokens.push_back(eofToken);
+        mTokenTypes.push_back(TokenType::kEOF);
+    }
+    
+    // The symbol ids handed out by the lexer are only valid for the lexer, and the data for the tokens is owned by
+    // it. Intern the names of identifiers in our own symbol table so the ids are the same for the whole module,
+    // and copy the values of string literals so that they live as long as the nodes referring to them.
+    const SymbolTable & lexerSymbolTable = lexer.getSymbolTable();
+    std::vector<SymbolId> symbolIdMapping(lexerSymbolTable.getNumSymbols());
+    
+    for (size_t i = 0; i < symbolIdMapping.size(); ++i) {
+        SymbolId lexerSymbolId = static_cast<SymbolId>(i);
+        symbolIdMapping[i] = mSymbolTable.intern(lexerSymbolTable.getSymbolName(lexerSymbolId),
+                                                 lexerSymbolTable.getSymbolNameLen(lexerSymbolId));
+    }
+    
+    for (size_t i = 0; i < numTokens; ++i) {
+        switch (mTokenTypes[i]) {
+            case TokenType::kIdentifier: {
+                auto & identData = rangeTokens[i].data.identData;
+                identData.symbolId = symbolIdMapping[identData.symbolId];
+                identData.name = mSymbolTable.getSymbolName(identData.symbolId);
+            }   break;
+            
+            case TokenType::kStrLit: {
+                auto & strVal = rangeTokens[i].data.strVal;
+                char * strCopy = reinterpret_cast<char*>(parsedRange.nodeAlloc.alloc(strVal.size + 1, alignof(char)));
+                std::memcpy(strCopy, strVal.ptr, strVal.size + 1);
+                strVal.ptr = strCopy;
+            }   break;
+            
+            default:
+                break;
+        }
+    }
+}
+
+void IncrementalParser::replaceElems(size_t startElemIdx, size_t endElemIdx, std::vector<TopLevelElem> & newElems) {
+    // Keep the count of errors up to date
+    for (size_t i = startElemIdx; i < endElemIdx; ++i) {
+        if (mTopLevelElems[i].msgs) {
+            mNumErrorMsgs -= mTopLevelElems[i].msgs->errorMsgs.size();
+        }
+    }
+    
+    for (const TopLevelElem & elem : newElems) {
+        if (elem.msgs) {
+            mNumErrorMsgs += elem.msgs->errorMsgs.size();
+        }
+    }
+    
+    // Swap in the new elements. Note: this frees the tokens and nodes of the old elements if nothing else uses them.
+    mTopLevelElems.erase(mTopLevelElems.begin() + static_cast<ptrdiff_t>(startElemIdx),
+                         mTopLevelElems.begin() + static_cast<ptrdiff_t>(endElemIdx));
+    
+    mTopLevelElems.insert(mTopLevelElems.begin() + static_cast<ptrdiff_t>(startElemIdx),
+                          std::make_move_iterator(newElems.begin()),
+                          std::make_move_iterator(newElems.end()));
+    
+    // Gather up the decldefs for the module again
+    mDeclDefs.clear();
+    mDeclDefSrcOffsetDeltas.clear();
+    
+    for (const TopLevelElem & elem : mTopLevelElems) {
+        if (elem.declDef) {
+            mDeclDefs.push_back(elem.declDef);
+            mDeclDefSrcOffsetDeltas.push_back(static_cast<int64_t>(elem.srcOffset) -
+                                              static_cast<int64_t>(elem.parsedSrcOffset));
+        }
+    }
+    
+    // Create the module again with the new list of decldefs, in the same memory as before
+    TokenType eofTokenType = TokenType::kEOF;
+    ParseCtx moduleParseCtx(&mEOFToken, &eofTokenType, mSrcLineIndex, mModuleAlloc);
+    
+    if (!mModule) {
+        mModule = moduleParseCtx.reserveASTNode<Module>();
+    }
+    
+    WC_NEW_RESERVED_AST_NODE(moduleParseCtx,
+                             mModule,
+                             Module,
+                             Span<DeclDef*>(mDeclDefs.data(), mDeclDefs.size()),
+                             mEOFToken);
+}
+
+WC_AST_END_NAMESPACE
+WC_END_NAMESPACE
@@ -0,0 +1,255 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#pragma once
+
+#include "Lexer/SourceLineIndex.hpp"
+#include "Lexer/SymbolTable.hpp"
+#include "Lexer/Token.hpp"
+#include "LinearAlloc.hpp"
+#include "LinearAllocPool.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstddef>
+    #include <cstdint>
+    #include <memory>
+    #include <string>
+    #include <vector>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+
+class Lexer;
+
+WC_AST_BEGIN_NAMESPACE
+
+class DeclDef;
+class Module;
+
+/**
+ * Keeps the AST for a module up to date as the source for it is edited, for tools such as editor integrations
+ * which need the AST after every keystroke. Rather than lexing and parsing the whole source again after each edit,
+ * only the top level elements of the module (see 'Module::parseTopLevelElem') that the edit touches are lexed and
+ * parsed again, and the new decldefs are spliced into the decldefs for the module. So the work done for an edit
+ * depends on the size of the decldefs edited rather than the size of the source.
+ *
+ * The nodes and tokens for decldefs which are not touched by an edit are kept as they are, so anything caching
+ * info against them stays valid. One consequence of this is that the source offsets in the tokens of a decldef are
+ * those from when it was last parsed: decldefs after an edit which changes the size of the source are moved along
+ * without updating their tokens. Use 'getSrcOffsetDelta' to get where their tokens are in the current source.
+ *
+ * Each group of decldefs parsed together is allocated from its own linear allocator, which is freed (and its
+ * memory blocks recycled) once all of the decldefs in it have been replaced by edits. The module node stays at
+ * the same address, but is created again after every edit since its list of decldefs changes.
+ *
+ * The names of identifiers are interned in a symbol table for the module. Names are never removed from it as edits
+ * are made, so over many edits it also collects names which are no longer in the source (e.g partly typed
+ * identifiers). The table is only cleared out when the source is parsed from scratch with 'parse'.
+ *
+ * Valid code always gives the same AST as lexing and parsing the whole source. Where there are parse errors the
+ * messages can differ slightly, since a decldef that is parsed again cannot run on into the decldefs after it.
+ * If lexing the edited part of the source fails then it is left without any decldefs until it is edited again.
+ */
+class IncrementalParser {
+public:
+    /* Settings for the linear allocators that AST nodes are allocated from. Each reparse gets its own allocator. */
+    static constexpr const size_t kASTAllocMaxAllocSize = 1024 * 64;
+    static constexpr const size_t kASTAllocBlockSize = 1024 * 256;
+    
+    /* Stats on the work done by the last call to 'parse' or 'applyEdit' */
+    struct ReparseStats {
+        /* The number of bytes of source code that were lexed, and the number of tokens produced */
+        size_t numBytesLexed;
+        size_t numTokensLexed;
+        
+        /* The number of top level elements of the module that were parsed, and the number of AST nodes created */
+        size_t numTopLevelElemsParsed;
+        size_t numASTNodesCreated;
+    };
+    
+    IncrementalParser();
+    
+    ~IncrementalParser();
+    
+    /**
+     * Lex and parse the given source from scratch, replacing anything parsed previously. A copy of the source is
+     * kept, so that it can be edited. Returns false if the source can't be lexed or if it is too large.
+     */
+    bool parse(const char * utf8Src, size_t srcSize);
+    
+    /**
+     * Replace the given number of bytes at the given offset in the source with the given text, then update the
+     * AST to match. Returns false if the edit is outside of the source, if the source would be too large or if
+     * the edited part of the source can't be lexed. Parse errors do not cause a failure, see 'getErrorMsgs'.
+     */
+    bool applyEdit(uint32_t srcOffset, size_t numBytesRemoved, const char * insertedText, size_t numBytesInserted);
+    
+    /* Get the AST for the current source, or null if nothing has been parsed yet */
+    inline Module * getModule() const {
+        return mModule;
+    }
+    
+    /* Get the current source text, which is null terminated */
+    inline const char * getSrcText() const {
+        return mSrcText.c_str();
+    }
+    
+    /* Get the size of the current source text in bytes, excluding the null terminator */
+    inline size_t getSrcSize() const {
+        return mSrcText.size();
+    }
+    
+    /* Get the line index for the current source text */
+    inline const SourceLineIndex & getSrcLineIndex() const {
+        return mSrcLineIndex;
+    }
+    
+    /**
+     * Get the symbol table holding the names of all identifiers in the AST. Symbol ids stay the same over edits,
+     * but not over calls to 'parse'.
+     */
+    inline const SymbolTable & getSymbolTable() const {
+        return mSymbolTable;
+    }
+    
+    /**
+     * Get how far the tokens of the given decldef in the module have moved since it was parsed. Adding this to a
+     * source offset in any of its tokens gives the offset in the current source.
+     */
+    inline int64_t getSrcOffsetDelta(size_t declDefIndex) const {
+        return mDeclDefSrcOffsetDeltas[declDefIndex];
+    }
+    
+    /* Tells if there are errors for the current source */
+    inline bool hasErrors() const {
+        return mNumErrorMsgs > 0;
+    }
+    
+    /* Get the error messages for the current source, in source order. These are gathered up on each call. */
+    std::vector<std::string> getErrorMsgs() const;
+    
+    /* Get the warning messages for the current source, in source order. These are gathered up on each call. */
+    std::vector<std::string> getWarningMsgs() const;
+    
+    /* Get stats on the work done by the last call to 'parse' or 'applyEdit' */
+    inline const ReparseStats & getLastReparseStats() const {
+        return mLastReparseStats;
+    }
+    
+private:
+    WC_DISALLOW_COPY_AND_ASSIGN(IncrementalParser)
+    
+    /* The error and warning messages for a top level element */
+    struct Msgs {
+        std::vector<std::string> errorMsgs;
+        std::vector<std::string> warningMsgs;
+    };
+    
+    /**
+     * The memory for a group of top level elements that were parsed together: their tokens and their AST nodes.
+     * This is shared by the elements and freed once all of them have been replaced.
+     */
+    struct ParsedRange {
+        ParsedRange(LinearAllocPool & nodeAllocPool);
+        
+        /* The tokens that the nodes refer to */
+        std::vector<Token> tokens;
+        
+        /* The allocator that the nodes (and the values of string literal tokens) are in */
+        LinearAlloc nodeAlloc;
+    };
+    
+    /**
+     * A top level element of the module: a decldef, or something which failed to parse. It covers the source from
+     * the token it started at up until the start of the next element, so comments and separators after it included.
+     * The first element always starts at offset 0, so that any leading whitespace and separators are included too.
+     */
+    struct TopLevelElem {
+        /* The decldef, or null if the element failed to parse */
+        DeclDef * declDef;
+        
+        /* The tokens and nodes for the element, shared with the elements parsed along with it */
+        std::shared_ptr<ParsedRange> parsedRange;
+        
+        /* Where the element currently starts in the source, and where it started when it was parsed */
+        uint32_t srcOffset;
+        uint32_t parsedSrcOffset;
+        
+        /* The flags for the token the element starts at (see 'TokenFlags') */
+        uint8_t startTokenFlags;
+        
+        /* Whether the next element must be on a new line, see 'Module::parseTopLevelElem' */
+        bool requireNewlineAfter;
+        
+        /* Errors and warnings for the element, or null if there are none */
+        std::unique_ptr<Msgs> msgs;
+    };
+    
+    /**
+     * Lex and parse the source for the given range of top level elements again, replacing them. The source for
+     * the elements may have been edited, with the elements after the range already moved along by the given amount.
+     * The range is widened to take in neighbouring elements whose parse could be affected. Saves the index of the
+     * element after the new elements, and returns false if lexing failed (the range is still replaced in that case).
+     */
+    bool reparseElems(size_t startElemIdx, size_t endElemIdx, int64_t srcOffsetDelta, size_t & outEndElemIdx);
+    
+    /**
+     * Copy the tokens lexed for a range of the source into the given parsed range, ending them with an EOF token
+     * at the given offset if the lexer stopped before the end of the source. Identifiers are interned in our own
+     * symbol table and the values of string literals are copied into the allocator for the range.
+     */
+    void copyTokens(const Lexer & lexer, uint32_t rangeEndSrcOffset, ParsedRange & parsedRange);
+    
+    /* Replace the given range of top level elements with the given ones, updating the module to match */
+    void replaceElems(size_t startElemIdx, size_t endElemIdx, std::vector<TopLevelElem> & newElems);
+    
+    /* Tells if the given top level element has any errors or warnings */
+    inline bool elemHasMsgs(size_t elemIdx) const {
+        return mTopLevelElems[elemIdx].msgs != nullptr;
+    }
+    
+    /* The current source text */
+    std::string mSrcText;
+    
+    /* The line index for the current source text */
+    SourceLineIndex mSrcLineIndex;
+    
+    /* Allocator for the names of identifiers, and the symbol table that interns them */
+    LinearAlloc mSymbolAlloc;
+    SymbolTable mSymbolTable;
+    
+    /* The start of the allocator for names, which it is rolled back to when parsing from scratch */
+    LinearAlloc::Mark mSymbolAllocStartMark;
+    
+    /* The pool that the allocators for AST nodes get their memory blocks from, see 'ParsedRange' */
+    LinearAllocPool mNodeAllocPool;
+    
+    /* All of the top level elements of the module, in source order */
+    std::vector<TopLevelElem> mTopLevelElems;
+    
+    /* The decldefs of the module and how far each has moved since it was parsed, see 'getSrcOffsetDelta' */
+    std::vector<DeclDef*> mDeclDefs;
+    std::vector<int64_t> mDeclDefSrcOffsetDeltas;
+    
+    /* The total number of error messages for all of the top level elements */
+    size_t mNumErrorMsgs;
+    
+    /* The EOF token for the module, at the end of the current source */
+    Token mEOFToken;
+    
+    /* Allocator for the module node, which is created in the same memory every time */
+    LinearAlloc mModuleAlloc;
+    Module * mModule;
+    
+    /* The token types for the part of the source being parsed, only needed while parsing so reused between reparses */
+    std::vector<TokenType> mTokenTypes;
+    
+    /* Stats on the work done by the last call to 'parse' or 'applyEdit' */
+    ReparseStats mLastReparseStats;
+};
+
+WC_AST_END_NAMESPACE
+WC_END_NAMESPACE
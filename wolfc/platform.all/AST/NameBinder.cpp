@@ -0,0 +1,617 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#include "NameBinder.hpp"
+
+#include "Assert.hpp"
+#include "Nodes/AddExpr.hpp"
+#include "Nodes/ArrayLit.hpp"
+#include "Nodes/AssertStmnt.hpp"
+#include "Nodes/AssignExpr.hpp"
+#include "Nodes/BoolLit.hpp"
+#include "Nodes/BreakStmnt.hpp"
+#include "Nodes/CastExpr.hpp"
+#include "Nodes/CmpExpr.hpp"
+#include "Nodes/DeclDef.hpp"
+#include "Nodes/Func.hpp"
+#include "Nodes/FuncArg.hpp"
+#include "Nodes/Identifier.hpp"
+#include "Nodes/IfStmnt.hpp"
+#include "Nodes/IntLit.hpp"
+#include "Nodes/LAndExpr.hpp"
+#include "Nodes/LOrExpr.hpp"
+#include "Nodes/LoopStmnt.hpp"
+#include "Nodes/Module.hpp"
+#include "Nodes/MulExpr.hpp"
+#include "Nodes/NextStmnt.hpp"
+#include "Nodes/NoOpStmnt.hpp"
+#include "Nodes/NotExpr.hpp"
+#include "Nodes/NullLit.hpp"
+#include "Nodes/PostfixExpr.hpp"
+#include "Nodes/PrefixExpr.hpp"
+#include "Nodes/PrimaryExpr.hpp"
+#include "Nodes/PrimitiveType.hpp"
+#include "Nodes/PrintStmnt.hpp"
+#include "Nodes/RandExpr.hpp"
+#include "Nodes/ReadnumExpr.hpp"
+#include "Nodes/ReturnStmnt.hpp"
+#include "Nodes/Scope.hpp"
+#include "Nodes/ScopeStmnt.hpp"
+#include "Nodes/ShiftExpr.hpp"
+#include "Nodes/Stmnt.hpp"
+#include "Nodes/StrLit.hpp"
+#include "Nodes/TernaryExpr.hpp"
+#include "Nodes/TimeExpr.hpp"
+#include "Nodes/Type.hpp"
+#include "Nodes/VarDecl.hpp"
+#include "Nodes/WhileStmnt.hpp"
+
+WC_BEGIN_NAMESPACE
+WC_AST_BEGIN_NAMESPACE
+
+void NameBinder::bind(const Module & module, NameBindings & outNameBindings) {
+    outNameBindings.clear();
+    NameBinder binder(outNameBindings);
+    module.accept(binder);
+}
+
+NameBinder::NameBinder(NameBindings & nameBindings) : mNameBindings(nameBindings) {
+    // Reserving some room for these things
+    mShadowedDecls.reserve(256);
+    mScopeStack.reserve(128);
+    mDeferredFuncs.reserve(1024);
+}
+
+void NameBinder::enterScope(const Scope & scope) {
+    mScopeStack.push_back(ScopeEntry{ &scope, mShadowedDecls.size() });
+}
+
+void NameBinder::leaveScope() {
+    // Undo the declarations made in the scope, in reverse order, which makes what they hid visible again
+    WC_ASSERT(!mScopeStack.empty());
+    size_t shadowedDeclsStart = mScopeStack.back().shadowedDeclsStart;
+    mScopeStack.pop_back();
+    
+    while (mShadowedDecls.size() > shadowedDeclsStart) {
+        const ShadowedDecl & shadowedDecl = mShadowedDecls.back();
+        mVisibleDecls[shadowedDecl.symbolId] = shadowedDecl.visibleDecl;
+        mShadowedDecls.pop_back();
+    }
+}
+
+template <typename T>
+void NameBinder::declare(const T & declaringNode, const Identifier & ident) {
+    // Every declaration gets an id, even if nothing ends up binding to it
+    const Scope * scope = mScopeStack.empty() ? nullptr : mScopeStack.back().scope;
+    DeclId declId = mNameBindings.addDecl(declaringNode, ident, scope);
+    declaringNode.mDeclId = declId;
+    
+    // Make room for the name if it hasn't been seen before
+    SymbolId symbolId = ident.symbolId();
+    
+    if (symbolId >= mVisibleDecls.size()) {
+        mVisibleDecls.resize(symbolId + 1, VisibleDecl{ kInvalidDeclId, 0 });
+    }
+    
+    // If the name is already declared in this same scope then the first declaration is the one that is used.
+    // Code generation reports the duplicate.
+    uint32_t scopeDepth = static_cast<uint32_t>(mScopeStack.size());
+    VisibleDecl & visibleDecl = mVisibleDecls[symbolId];
+    
+    if (visibleDecl.declId != kInvalidDeclId && visibleDecl.scopeDepth == scopeDepth) {
+        return;
+    }
+    
+    // Hide whatever was visible before until the scope is left. Nothing is ever hidden at the module level.
+    if (scopeDepth > 0) {
+        mShadowedDecls.push_back(ShadowedDecl{ symbolId, visibleDecl });
+    }
+    
+    visibleDecl = VisibleDecl{ declId, scopeDepth };
+}
+
+template <typename T>
+void NameBinder::visitNodeList(const Span<T*> & astNodes) {
+    for (const ASTNode * astNode : astNodes) {
+        astNode->accept(*this);
+    }
+}
+
+template <typename T>
+void NameBinder::visitTwoOpsNode(const T & astNode) {
+    astNode.mLeftExpr.accept(*this);
+    astNode.mRightExpr.accept(*this);
+}
+
+void NameBinder::visitVarDecl(const VarDecl & astNode, const Type * explicitType) {
+    // Note: the variable can't be referred to in its own type or initializer
+    if (explicitType) {
+        explicitType->accept(*this);
+    }
+    
+    astNode.mInitExpr.accept(*this);
+    declare(astNode, astNode.mIdent);
+}
+
+//-----------------------------------------------------------------------------
+// Visitor functions
+//-----------------------------------------------------------------------------
+
+void NameBinder::visit(const AddExprAdd & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const AddExprBOr & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const AddExprBXor & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const AddExprSub & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const ArrayLit & astNode) {
+    visitNodeList(astNode.getExprs());
+}
+
+void NameBinder::visit(const AssertStmnt & astNode) {
+    astNode.mExpr.accept(*this);
+}
+
+void NameBinder::visit(const AssignExprAssign & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const AssignExprAssignARShift & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const AssignExprAssignAdd & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const AssignExprAssignBAnd & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const AssignExprAssignBOr & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const AssignExprAssignBXor & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const AssignExprAssignDiv & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const AssignExprAssignLRShift & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const AssignExprAssignLShift & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const AssignExprAssignMul & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const AssignExprAssignRem & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const AssignExprAssignSub & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const BoolLit & astNode) {
+    WC_UNUSED_PARAM(astNode);
+}
+
+void NameBinder::visit(const BreakStmntNoCond & astNode) {
+    WC_UNUSED_PARAM(astNode);
+}
+
+void NameBinder::visit(const BreakStmntWithCond & astNode) {
+    astNode.mCondExpr.accept(*this);
+}
+
+void NameBinder::visit(const CastExprCast & astNode) {
+    astNode.mExpr.accept(*this);
+    astNode.mType.accept(*this);
+}
+
+void NameBinder::visit(const CmpExprEQ & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const CmpExprGE & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const CmpExprGT & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const CmpExprLE & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const CmpExprLT & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const CmpExprNE & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const DeclDefFunc & astNode) {
+    // Functions can be called from anywhere in the module, so bind the body once everything has been declared
+    declare(astNode.mFunc, astNode.mFunc.getIdentifier());
+    mDeferredFuncs.push_back(&astNode.mFunc);
+}
+
+void NameBinder::visit(const DeclDefVarDecl & astNode) {
+    astNode.mVarDecl.accept(*this);
+}
+
+void NameBinder::visit(const Func & astNode) {
+    // The types in the signature are evaluated at the module level, bind those first
+    const Span<FuncArg*> & funcArgs = astNode.getArgs();
+    visitNodeList(funcArgs);
+    const Type * returnType = astNode.getExplicitReturnType();
+    
+    if (returnType) {
+        returnType->accept(*this);
+    }
+    
+    // The arguments are declared in the same scope as the top level of the function body
+    const Scope & scope = astNode.getScope();
+    enterScope(scope);
+    
+    for (const FuncArg * funcArg : funcArgs) {
+        declare(*funcArg, funcArg->mIdent);
+    }
+    
+    visitNodeList(scope.getStmnts());
+    leaveScope();
+}
+
+void NameBinder::visit(const FuncArg & astNode) {
+    // Note: the argument itself is declared when binding the function body
+    astNode.mType.accept(*this);
+}
+
+void NameBinder::visit(const Identifier & astNode) {
+    // Bind to whatever declaration of the name is visible, if any.
+    // Note: this also unbinds the identifier if nothing is visible, in case the module was bound before.
+    SymbolId symbolId = astNode.symbolId();
+    DeclId declId = (symbolId < mVisibleDecls.size()) ? mVisibleDecls[symbolId].declId : kInvalidDeclId;
+    mNameBindings.bind(astNode, declId);
+}
+
+void NameBinder::visit(const IfStmntElse & astNode) {
+    astNode.mIfExpr.accept(*this);
+    astNode.mThenScope.accept(*this);
+    astNode.mElseScope.accept(*this);
+}
+
+void NameBinder::visit(const IfStmntElseIf & astNode) {
+    astNode.mIfExpr.accept(*this);
+    astNode.mThenScope.accept(*this);
+    astNode.mElseIfStmnt.accept(*this);
+}
+
+void NameBinder::visit(const IfStmntNoElse & astNode) {
+    astNode.mIfExpr.accept(*this);
+    astNode.mThenScope.accept(*this);
+}
+
+void NameBinder::visit(const IntLit & astNode) {
+    WC_UNUSED_PARAM(astNode);
+}
+
+void NameBinder::visit(const LAndExprAnd & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const LOrExprOr & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const LoopStmntNoCond & astNode) {
+    astNode.mBodyScope.accept(*this);
+}
+
+void NameBinder::visit(const LoopStmntWithCond & astNode) {
+    astNode.mBodyScope.accept(*this);
+    astNode.mLoopCondExpr.accept(*this);
+}
+
+void NameBinder::visit(const Module & astNode) {
+    // Declare everything at the module level first, binding the initializers of variables along the way
+    visitNodeList(astNode.mDeclDefs);
+    
+    // Then bind the function bodies, which can see all of the module level declarations
+    for (const Func * func : mDeferredFuncs) {
+        func->accept(*this);
+    }
+    
+    mDeferredFuncs.clear();
+}
+
+void NameBinder::visit(const MulExprBAnd & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const MulExprDiv & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const MulExprMul & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const MulExprRem & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const NextStmntNoCond & astNode) {
+    WC_UNUSED_PARAM(astNode);
+}
+
+void NameBinder::visit(const NextStmntWithCond & astNode) {
+    astNode.mCondExpr.accept(*this);
+}
+
+void NameBinder::visit(const NoOpStmnt & astNode) {
+    WC_UNUSED_PARAM(astNode);
+}
+
+void NameBinder::visit(const NotExprBNot & astNode) {
+    astNode.mExpr.accept(*this);
+}
+
+void NameBinder::visit(const NotExprLNot & astNode) {
+    astNode.mExpr.accept(*this);
+}
+
+void NameBinder::visit(const NullLit & astNode) {
+    WC_UNUSED_PARAM(astNode);
+}
+
+void NameBinder::visit(const PostfixExprArrayLookup & astNode) {
+    astNode.mArrayExpr.accept(*this);
+    astNode.mIndexExpr.accept(*this);
+}
+
+void NameBinder::visit(const PostfixExprDec & astNode) {
+    astNode.mExpr.accept(*this);
+}
+
+void NameBinder::visit(const PostfixExprFuncCall & astNode) {
+    astNode.mOperandExpr.accept(*this);
+    visitNodeList(astNode.mArgExprs);
+}
+
+void NameBinder::visit(const PostfixExprInc & astNode) {
+    astNode.mExpr.accept(*this);
+}
+
+void NameBinder::visit(const PrefixExprAddrOf & astNode) {
+    astNode.mExpr.accept(*this);
+}
+
+void NameBinder::visit(const PrefixExprMinus & astNode) {
+    astNode.mExpr.accept(*this);
+}
+
+void NameBinder::visit(const PrefixExprPlus & astNode) {
+    astNode.mExpr.accept(*this);
+}
+
+void NameBinder::visit(const PrefixExprPtrDenull & astNode) {
+    astNode.mExpr.accept(*this);
+}
+
+void NameBinder::visit(const PrefixExprPtrDeref & astNode) {
+    astNode.mExpr.accept(*this);
+}
+
+void NameBinder::visit(const PrimaryExprArrayLit & astNode) {
+    astNode.mLit.accept(*this);
+}
+
+void NameBinder::visit(const PrimaryExprBoolLit & astNode) {
+    astNode.mLit.accept(*this);
+}
+
+void NameBinder::visit(const PrimaryExprIdentifier & astNode) {
+    astNode.mIdent.accept(*this);
+}
+
+void NameBinder::visit(const PrimaryExprIntLit & astNode) {
+    astNode.mLit.accept(*this);
+}
+
+void NameBinder::visit(const PrimaryExprNullLit & astNode) {
+    astNode.mLit.accept(*this);
+}
+
+void NameBinder::visit(const PrimaryExprParen & astNode) {
+    astNode.mExpr.accept(*this);
+}
+
+void NameBinder::visit(const PrimaryExprRandExpr & astNode) {
+    astNode.mExpr.accept(*this);
+}
+
+void NameBinder::visit(const PrimaryExprReadnumExpr & astNode) {
+    astNode.mExpr.accept(*this);
+}
+
+void NameBinder::visit(const PrimaryExprStrLit & astNode) {
+    astNode.mLit.accept(*this);
+}
+
+void NameBinder::visit(const PrimaryExprTimeExpr & astNode) {
+    astNode.mExpr.accept(*this);
+}
+
+void NameBinder::visit(const PrimitiveType & astNode) {
+    WC_UNUSED_PARAM(astNode);
+}
+
+void NameBinder::visit(const PrintStmnt & astNode) {
+    astNode.mExpr.accept(*this);
+}
+
+void NameBinder::visit(const RandExprRand & astNode) {
+    WC_UNUSED_PARAM(astNode);
+}
+
+void NameBinder::visit(const RandExprSRand & astNode) {
+    astNode.mSeedExpr.accept(*this);
+}
+
+void NameBinder::visit(const ReadnumExpr & astNode) {
+    WC_UNUSED_PARAM(astNode);
+}
+
+void NameBinder::visit(const ReturnStmntNoCondVoid & astNode) {
+    WC_UNUSED_PARAM(astNode);
+}
+
+void NameBinder::visit(const ReturnStmntNoCondWithValue & astNode) {
+    astNode.mReturnExpr.accept(*this);
+}
+
+void NameBinder::visit(const ReturnStmntWithCondAndValue & astNode) {
+    astNode.mReturnExpr.accept(*this);
+    astNode.mCondExpr.accept(*this);
+}
+
+void NameBinder::visit(const ReturnStmntWithCondVoid & astNode) {
+    astNode.mCondExpr.accept(*this);
+}
+
+void NameBinder::visit(const Scope & astNode) {
+    enterScope(astNode);
+    visitNodeList(astNode.getStmnts());
+    leaveScope();
+}
+
+void NameBinder::visit(const ScopeStmnt & astNode) {
+    astNode.mBodyScope.accept(*this);
+}
+
+void NameBinder::visit(const ShiftExprARShift & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const ShiftExprLRShift & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const ShiftExprLShift & astNode) {
+    visitTwoOpsNode(astNode);
+}
+
+void NameBinder::visit(const StmntAssertStmnt & astNode) {
+    astNode.mStmnt.accept(*this);
+}
+
+void NameBinder::visit(const StmntAssignExpr & astNode) {
+    astNode.mExpr.accept(*this);
+}
+
+void NameBinder::visit(const StmntBreakStmnt & astNode) {
+    astNode.mBreakStmnt.accept(*this);
+}
+
+void NameBinder::visit(const StmntIfStmnt & astNode) {
+    astNode.mIfStmnt.accept(*this);
+}
+
+void NameBinder::visit(const StmntLoopStmnt & astNode) {
+    astNode.mLoopStmnt.accept(*this);
+}
+
+void NameBinder::visit(const StmntNextStmnt & astNode) {
+    astNode.mNextStmnt.accept(*this);
+}
+
+void NameBinder::visit(const StmntNoOpStmnt & astNode) {
+    astNode.mStmnt.accept(*this);
+}
+
+void NameBinder::visit(const StmntPrintStmnt & astNode) {
+    astNode.mStmnt.accept(*this);
+}
+
+void NameBinder::visit(const StmntReturnStmnt & astNode) {
+    astNode.mReturnStmnt.accept(*this);
+}
+
+void NameBinder::visit(const StmntScopeStmnt & astNode) {
+    astNode.mScopeStmnt.accept(*this);
+}
+
+void NameBinder::visit(const StmntVarDecl & astNode) {
+    astNode.mDecl.accept(*this);
+}
+
+void NameBinder::visit(const StmntWhileStmnt & astNode) {
+    astNode.mWhileStmnt.accept(*this);
+}
+
+void NameBinder::visit(const StrLit & astNode) {
+    WC_UNUSED_PARAM(astNode);
+}
+
+void NameBinder::visit(const TernaryExprWithCond & astNode) {
+    astNode.mCondExpr.accept(*this);
+    astNode.mTrueExpr.accept(*this);
+    astNode.mFalseExpr.accept(*this);
+}
+
+void NameBinder::visit(const TimeExpr & astNode) {
+    WC_UNUSED_PARAM(astNode);
+}
+
+void NameBinder::visit(const TypeArray & astNode) {
+    astNode.mSizeExpr.accept(*this);
+    astNode.mElemType.accept(*this);
+}
+
+void NameBinder::visit(const TypePrimitive & astNode) {
+    astNode.mType.accept(*this);
+}
+
+void NameBinder::visit(const TypePtr & astNode) {
+    astNode.mPointedToType.accept(*this);
+}
+
+void NameBinder::visit(const VarDeclExplicitType & astNode) {
+    visitVarDecl(astNode, &astNode.mType);
+}
+
+void NameBinder::visit(const VarDeclInferType & astNode) {
+    visitVarDecl(astNode, nullptr);
+}
+
+void NameBinder::visit(const WhileStmnt & astNode) {
+    astNode.mWhileExpr.accept(*this);
+    astNode.mBodyScope.accept(*this);
+}
+
+WC_AST_END_NAMESPACE
+WC_END_NAMESPACE
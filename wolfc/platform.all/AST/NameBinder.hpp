@@ -0,0 +1,219 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#pragma once
+
+#include "ASTNodeVisitor.hpp"
+#include "Lexer/SymbolTable.hpp"
+#include "NameBindings.hpp"
+#include "Span.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstddef>
+    #include <cstdint>
+    #include <vector>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+WC_AST_BEGIN_NAMESPACE
+
+class ASTNode;
+class Type;
+class VarDecl;
+
+/**
+ * Semantic pass which resolves the names used in a module, run once after parsing and before code generation.
+ * Walks the AST as a visitor and records the declaration that each identifier refers to (see 'NameBindings'), so
+ * that code generation and other tools can go straight from an identifier to its declaration instead of searching
+ * through scopes for the name. Each node is visited once, so the pass is linear in the size of the AST.
+ *
+ * The scoping rules match how code generation registers names:
+ *
+ *  - Functions and variables declared at the module level are visible from the point of declaration onwards for
+ *    the initializers of module level variables, and everywhere inside of function bodies. Function bodies are
+ *    bound after all the declarations in the module, since they are code generated last.
+ *  - Function arguments and the variables declared at the top level of a function body share the same scope.
+ *  - A local variable is visible from the end of its declaration until the end of the scope it is declared in,
+ *    and hides any declarations of the same name in enclosing scopes. Its initializer can't see it.
+ *  - If a name is declared more than once in the same scope then the first declaration is used. The others still
+ *    get declaration ids but nothing binds to them.
+ */
+class NameBinder final : public ASTNodeVisitor {
+public:
+    /* Bind all of the identifiers in the given module, replacing the contents of the given table */
+    static void bind(const Module & module, NameBindings & outNameBindings);
+    
+    /* ASTNode visitor functions: these bind the identifiers in the node visited and all of its children */
+    virtual void visit(const AddExprAdd & astNode) override;
+    virtual void visit(const AddExprBOr & astNode) override;
+    virtual void visit(const AddExprBXor & astNode) override;
+    virtual void visit(const AddExprSub & astNode) override;
+    virtual void visit(const ArrayLit & astNode) override;
+    virtual void visit(const AssertStmnt & astNode) override;
+    virtual void visit(const AssignExprAssign & astNode) override;
+    virtual void visit(const AssignExprAssignARShift & astNode) override;
+    virtual void visit(const AssignExprAssignAdd & astNode) override;
+    virtual void visit(const AssignExprAssignBAnd & astNode) override;
+    virtual void visit(const AssignExprAssignBOr & astNode) override;
+    virtual void visit(const AssignExprAssignBXor & astNode) override;
+    virtual void visit(const AssignExprAssignDiv & astNode) override;
+    virtual void visit(const AssignExprAssignLRShift & astNode) override;
+    virtual void visit(const AssignExprAssignLShift & astNode) override;
+    virtual void visit(const AssignExprAssignMul & astNode) override;
+    virtual void visit(const AssignExprAssignRem & astNode) override;
+    virtual void visit(const AssignExprAssignSub & astNode) override;
+    virtual void visit(const BoolLit & astNode) override;
+    virtual void visit(const BreakStmntNoCond & astNode) override;
+    virtual void visit(const BreakStmntWithCond & astNode) override;
+    virtual void visit(const CastExprCast & astNode) override;
+    virtual void visit(const CmpExprEQ & astNode) override;
+    virtual void visit(const CmpExprGE & astNode) override;
+    virtual void visit(const CmpExprGT & astNode) override;
+    virtual void visit(const CmpExprLE & astNode) override;
+    virtual void visit(const CmpExprLT & astNode) override;
+    virtual void visit(const CmpExprNE & astNode) override;
+    virtual void visit(const DeclDefFunc & astNode) override;
+    virtual void visit(const DeclDefVarDecl & astNode) override;
+    virtual void visit(const Func & astNode) override;
+    virtual void visit(const FuncArg & astNode) override;
+    virtual void visit(const Identifier & astNode) override;
+    virtual void visit(const IfStmntElse & astNode) override;
+    virtual void visit(const IfStmntElseIf & astNode) override;
+    virtual void visit(const IfStmntNoElse & astNode) override;
+    virtual void visit(const IntLit & astNode) override;
+    virtual void visit(const LAndExprAnd & astNode) override;
+    virtual void visit(const LOrExprOr & astNode) override;
+    virtual void visit(const LoopStmntNoCond & astNode) override;
+    virtual void visit(const LoopStmntWithCond & astNode) override;
+    virtual void visit(const Module & astNode) override;
+    virtual void visit(const MulExprBAnd & astNode) override;
+    virtual void visit(const MulExprDiv & astNode) override;
+    virtual void visit(const MulExprMul & astNode) override;
+    virtual void visit(const MulExprRem & astNode) override;
+    virtual void visit(const NextStmntNoCond & astNode) override;
+    virtual void visit(const NextStmntWithCond & astNode) override;
+    virtual void visit(const NoOpStmnt & astNode) override;
+    virtual void visit(const NotExprBNot & astNode) override;
+    virtual void visit(const NotExprLNot & astNode) override;
+    virtual void visit(const NullLit & astNode) override;
+    virtual void visit(const PostfixExprArrayLookup & astNode) override;
+    virtual void visit(const PostfixExprDec & astNode) override;
+    virtual void visit(const PostfixExprFuncCall & astNode) override;
+    virtual void visit(const PostfixExprInc & astNode) override;
+    virtual void visit(const PrefixExprAddrOf & astNode) override;
+    virtual void visit(const PrefixExprMinus & astNode) override;
+    virtual void visit(const PrefixExprPlus & astNode) override;
+    virtual void visit(const PrefixExprPtrDenull & astNode) override;
+    virtual void visit(const PrefixExprPtrDeref & astNode) override;
+    virtual void visit(const PrimaryExprArrayLit & astNode) override;
+    virtual void visit(const PrimaryExprBoolLit & astNode) override;
+    virtual void visit(const PrimaryExprIdentifier & astNode) override;
+    virtual void visit(const PrimaryExprIntLit & astNode) override;
+    virtual void visit(const PrimaryExprNullLit & astNode) override;
+    virtual void visit(const PrimaryExprParen & astNode) override;
+    virtual void visit(const PrimaryExprRandExpr & astNode) override;
+    virtual void visit(const PrimaryExprReadnumExpr & astNode) override;
+    virtual void visit(const PrimaryExprStrLit & astNode) override;
+    virtual void visit(const PrimaryExprTimeExpr & astNode) override;
+    virtual void visit(const PrimitiveType & astNode) override;
+    virtual void visit(const PrintStmnt & astNode) override;
+    virtual void visit(const RandExprRand & astNode) override;
+    virtual void visit(const RandExprSRand & astNode) override;
+    virtual void visit(const ReadnumExpr & astNode) override;
+    virtual void visit(const ReturnStmntNoCondVoid & astNode) override;
+    virtual void visit(const ReturnStmntNoCondWithValue & astNode) override;
+    virtual void visit(const ReturnStmntWithCondAndValue & astNode) override;
+    virtual void visit(const ReturnStmntWithCondVoid & astNode) override;
+    virtual void visit(const Scope & astNode) override;
+    virtual void visit(const ScopeStmnt & astNode) override;
+    virtual void visit(const ShiftExprARShift & astNode) override;
+    virtual void visit(const ShiftExprLRShift & astNode) override;
+    virtual void visit(const ShiftExprLShift & astNode) override;
+    virtual void visit(const StmntAssertStmnt & astNode) override;
+    virtual void visit(const StmntAssignExpr & astNode) override;
+    virtual void visit(const StmntBreakStmnt & astNode) override;
+    virtual void visit(const StmntIfStmnt & astNode) override;
+    virtual void visit(const StmntLoopStmnt & astNode) override;
+    virtual void visit(const StmntNextStmnt & astNode) override;
+    virtual void visit(const StmntNoOpStmnt & astNode) override;
+    virtual void visit(const StmntPrintStmnt & astNode) override;
+    virtual void visit(const StmntReturnStmnt & astNode) override;
+    virtual void visit(const StmntScopeStmnt & astNode) override;
+    virtual void visit(const StmntVarDecl & astNode) override;
+    virtual void visit(const StmntWhileStmnt & astNode) override;
+    virtual void visit(const StrLit & astNode) override;
+    virtual void visit(const TernaryExprWithCond & astNode) override;
+    virtual void visit(const TimeExpr & astNode) override;
+    virtual void visit(const TypeArray & astNode) override;
+    virtual void visit(const TypePrimitive & astNode) override;
+    virtual void visit(const TypePtr & astNode) override;
+    virtual void visit(const VarDeclExplicitType & astNode) override;
+    virtual void visit(const VarDeclInferType & astNode) override;
+    virtual void visit(const WhileStmnt & astNode) override;
+    
+private:
+    WC_DISALLOW_COPY_AND_ASSIGN(NameBinder)
+    
+    /* The declaration of a name which is currently visible and the depth of the scope it was declared in */
+    struct VisibleDecl {
+        DeclId declId;
+        uint32_t scopeDepth;
+    };
+    
+    /* A declaration that was hidden or replaced by a declaration in an inner scope, restored when leaving it */
+    struct ShadowedDecl {
+        SymbolId symbolId;
+        VisibleDecl visibleDecl;
+    };
+    
+    /* A scope currently being bound and where its entries in the list of shadowed declarations start */
+    struct ScopeEntry {
+        const Scope * scope;
+        size_t shadowedDeclsStart;
+    };
+    
+    NameBinder(NameBindings & nameBindings);
+    
+    /* Enter or leave a scope. Leaving a scope makes the declarations hidden by it visible again. */
+    void enterScope(const Scope & scope);
+    void leaveScope();
+    
+    /**
+     * Declare the given name in the current scope (or at the module level if none), made by the given node.
+     * The node is a 'Func', 'FuncArg' or 'VarDecl' and is given the id of the declaration.
+     */
+    template <typename T>
+    void declare(const T & declaringNode, const Identifier & ident);
+    
+    /* Visit a list of child nodes */
+    template <typename T>
+    void visitNodeList(const Span<T*> & astNodes);
+    
+    /* Visit a node with two operands, of which there are many kinds of expression */
+    template <typename T>
+    void visitTwoOpsNode(const T & astNode);
+    
+    /* Visit a variable declaration, which declares its name after its type and initializer are bound */
+    void visitVarDecl(const VarDecl & astNode, const Type * explicitType);
+    
+    /* The table being filled in */
+    NameBindings & mNameBindings;
+    
+    /* The declaration currently visible for each name, indexed by symbol id and grown as needed */
+    std::vector<VisibleDecl> mVisibleDecls;
+    
+    /* Declarations hidden by the scopes currently being bound, restored as each scope is left */
+    std::vector<ShadowedDecl> mShadowedDecls;
+    
+    /* The scopes currently being bound, innermost last */
+    std::vector<ScopeEntry> mScopeStack;
+    
+    /* Functions declared at the module level, the bodies of which are bound after all module declarations */
+    std::vector<const Func*> mDeferredFuncs;
+};
+
+WC_AST_END_NAMESPACE
+WC_END_NAMESPACE
@@ -0,0 +1,40 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#include "NameBindings.hpp"
+
+#include "Assert.hpp"
+#include "Nodes/Identifier.hpp"
+
+WC_BEGIN_NAMESPACE
+WC_AST_BEGIN_NAMESPACE
+
+NameBindings::NameBindings() : mNumBindings(0) {
+    WC_EMPTY_FUNC_BODY();
+}
+
+void NameBindings::clear() {
+    mDecls.clear();
+    mNumBindings = 0;
+}
+
+DeclId NameBindings::addDecl(const ASTNode & declaringNode, const Identifier & ident, const Scope * scope) {
+    DeclId declId = static_cast<DeclId>(mDecls.size());
+    mDecls.push_back(Decl{ &declaringNode, &ident, scope });
+    return declId;
+}
+
+void NameBindings::bind(const Identifier & ident, DeclId declId) {
+    WC_ASSERT(declId == kInvalidDeclId || declId < mDecls.size());
+    ident.mDeclId = declId;
+    
+    if (declId != kInvalidDeclId) {
+        ++mNumBindings;
+    }
+}
+
+WC_AST_END_NAMESPACE
+WC_END_NAMESPACE
@@ -0,0 +1,96 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#pragma once
+
+#include "Macros.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstddef>
+    #include <cstdint>
+    #include <vector>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+WC_AST_BEGIN_NAMESPACE
+
+class ASTNode;
+class Identifier;
+class Scope;
+
+/**
+ * A dense id for a declaration in 'NameBindings'. Ids are handed out sequentially starting at zero in the order
+ * the declarations are found, so they can be used to index arrays of per declaration info.
+ */
+typedef uint32_t DeclId;
+
+/* Id used to mean 'no declaration' */
+static constexpr const DeclId kInvalidDeclId = 0xFFFFFFFF;
+
+/**
+ * The declarations of names in a module and what each identifier in it refers to, built by 'NameBinder' once the
+ * module has been parsed. Each declaration of a name (a variable, function or function argument) is given a dense
+ * id, and each identifier used in an expression is bound to the id of the declaration it refers to under the
+ * scoping rules of the language. Identifiers which don't refer to anything that is declared are left unbound.
+ *
+ * The ids are stored in the AST itself: in the 'mDeclId' field of each 'Identifier', and of each 'Func', 'FuncArg'
+ * and 'VarDecl' node for the declaration it makes. Getting the declaration for a node is then just a field read.
+ * Because of this a module can only have one set of bindings at a time: binding it again overwrites the ids.
+ */
+class NameBindings {
+public:
+    /* Info for a declaration of a name */
+    struct Decl {
+        /* The node that makes the declaration: a 'VarDecl', 'Func' or 'FuncArg' node */
+        const ASTNode * declaringNode;
+        
+        /* The identifier giving the name that is declared */
+        const Identifier * ident;
+        
+        /* The scope the name is declared in, or null if declared at the module level */
+        const Scope * scope;
+    };
+    
+    NameBindings();
+    
+    /* Clear out all declarations and bindings */
+    void clear();
+    
+    /* Get the number of declarations */
+    inline size_t getNumDecls() const {
+        return mDecls.size();
+    }
+    
+    /* Get the info for the given declaration */
+    inline const Decl & getDecl(DeclId declId) const {
+        return mDecls[declId];
+    }
+    
+    /* Get the number of identifiers which are bound to a declaration */
+    inline size_t getNumBindings() const {
+        return mNumBindings;
+    }
+    
+private:
+    WC_DISALLOW_COPY_AND_ASSIGN(NameBindings)
+    
+    friend class NameBinder;
+    
+    /* Add a declaration and return the id for it */
+    DeclId addDecl(const ASTNode & declaringNode, const Identifier & ident, const Scope * scope);
+    
+    /* Bind the given identifier to the given declaration, or unbind it if the id is 'kInvalidDeclId' */
+    void bind(const Identifier & ident, DeclId declId);
+    
+    /* All of the declarations, indexed by declaration id */
+    std::vector<Decl> mDecls;
+    
+    /* The number of identifiers which are bound to a declaration */
+    size_t mNumBindings;
+};
+
+WC_AST_END_NAMESPACE
+WC_END_NAMESPACE
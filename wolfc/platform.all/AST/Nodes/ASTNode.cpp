@@ -10,7 +10,6 @@
 #include "../ParseCtx.hpp"
 #include "Func.hpp"
 #include "Module.hpp"
-#include "Scope.hpp"
 
 WC_THIRD_PARTY_INCLUDES_BEGIN
     #include <cstdarg>
@@ -20,7 +19,11 @@ WC_THIRD_PARTY_INCLUDES_END
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-ASTNode::ASTNode() : mParent(nullptr) {
+ASTNode::ASTNode() :
+    mParent(nullptr),
+    mParentFunc(nullptr),
+    mParentScope(nullptr)
+{
     WC_EMPTY_FUNC_BODY();
 }
 
@@ -28,38 +31,29 @@ ASTNode::~ASTNode() {
     WC_EMPTY_FUNC_BODY();
 }
 
-const Token & ASTNode::getPastEndToken() const {
-    const Token & endToken = getEndToken();
-    
-    if (endToken.type == TokenType::kEOF) {
-        return endToken;
-    }
-    
-    return (&endToken)[1];
-}
-
-Scope * ASTNode::getParentScope() {
-    return firstParentOfType<Scope>();
-}
-
-const Scope * ASTNode::getParentScope() const {
-    return firstParentOfType<Scope>();
-}
-
-Func * ASTNode::getParentFunc() {
-    return firstParentOfType<Func>();
-}
-
-const Func * ASTNode::getParentFunc() const {
-    return firstParentOfType<Func>();
+uint32_t ASTNode::getPastEndSrcOffset() const {
+    return getEndToken().nextTokenSrcOffset;
 }
 
 Module * ASTNode::getParentModule() {
-    return firstParentOfType<Module>();
+    // Skip straight to the enclosing function if there is one, since that is much closer to the module
+    ASTNode * node = mParentFunc ? mParentFunc : this;
+    
+    while (node->mParent) {
+        node = node->mParent;
+    }
+    
+    return node->mKind == ASTNodeKind::kModule && node != this ? static_cast<Module*>(node) : nullptr;
 }
 
 const Module * ASTNode::getParentModule() const {
-    return firstParentOfType<Module>();
+    const ASTNode * node = mParentFunc ? mParentFunc : this;
+    
+    while (node->mParent) {
+        node = node->mParent;
+    }
+    
+    return node->mKind == ASTNodeKind::kModule && node != this ? static_cast<const Module*>(node) : nullptr;
 }
 
 WC_AST_END_NAMESPACE
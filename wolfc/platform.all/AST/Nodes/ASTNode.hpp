@@ -6,17 +6,17 @@
 
 #pragma once
 
+#include "../ASTNodeKind.hpp"
+#include "Lexer/Token.hpp"
 #include "Macros.hpp"
 
 WC_THIRD_PARTY_INCLUDES_BEGIN
     #include <cstdarg>
+    #include <cstdint>
     #include <string>
 WC_THIRD_PARTY_INCLUDES_END
 
 WC_BEGIN_NAMESPACE
-
-struct Token;
-
 WC_AST_BEGIN_NAMESPACE
 
 class ASTNodeVisitor;
@@ -25,9 +25,16 @@ class Module;
 class ParseCtx;
 class Scope;
 
-/* Macro for allocating an AST tree node */
+/**
+ * Macro for allocating an AST tree node. All nodes must be created through this (or the macro below), since it
+ * also sets the kind of the node and the function and scope it is inside of. See 'ParseCtx::addASTNode'.
+ */
 #define WC_NEW_AST_NODE(parseCtx, NodeType, ...)\
-    new(parseCtx.getAlloc().allocSizeOf<NodeType>()) NodeType(__VA_ARGS__)
+    parseCtx.addASTNode(new(parseCtx.allocASTNode<NodeType>()) NodeType(__VA_ARGS__))
+
+/* Macro for creating an AST tree node in memory previously reserved with 'ParseCtx::reserveASTNode' */
+#define WC_NEW_RESERVED_AST_NODE(parseCtx, nodeMem, NodeType, ...)\
+    parseCtx.addASTNode(new(nodeMem) NodeType(__VA_ARGS__))
 
 /* Abstract base class for all AST nodes. */
 class ASTNode {
@@ -46,22 +53,45 @@ public:
     virtual const Token & getEndToken() const = 0;
     
     /**
-     * Return a token which is 1 token past the last token of the AST node. 
-     * One exception however, if the end token happens to be EOF then the EOF token will just be returned.
+     * Return the source offset of the token which is 1 token past the last token of the AST node.
+     * One exception however, if the end token happens to be EOF then the offset of the EOF token will just be returned.
      */
-    const Token & getPastEndToken() const;
+    uint32_t getPastEndSrcOffset() const;
+    
+    /* Tells if this node is an expression (implements 'IExpr') */
+    inline bool isExpr() const {
+        return isExprKind(mKind);
+    }
     
-    /* Figure out what the parent scope of this node is. */
-    Scope * getParentScope();
+    /* Tells if this node is a statement (implements 'IStmnt') */
+    inline bool isStmnt() const {
+        return isStmntKind(mKind);
+    }
     
-    /* Figure out what the parent scope of this node is (const version). */
-    const Scope * getParentScope() const;
+    /* Tells if this node is a repeatable statement (implements 'IRepeatableStmnt') */
+    inline bool isRepeatableStmnt() const {
+        return isRepeatableStmntKind(mKind);
+    }
     
-    /* Figure out what the parent function of this node is. */
-    Func * getParentFunc();
+    /* Get the scope that this node is inside of, if any. */
+    inline Scope * getParentScope() {
+        return mParentScope;
+    }
     
-    /* Figure out what the parent function of this node is (const version). */
-    const Func * getParentFunc() const;
+    /* Get the scope that this node is inside of, if any (const version). */
+    inline const Scope * getParentScope() const {
+        return mParentScope;
+    }
+    
+    /* Get the function that this node is inside of, if any. */
+    inline Func * getParentFunc() {
+        return mParentFunc;
+    }
+    
+    /* Get the function that this node is inside of, if any (const version). */
+    inline const Func * getParentFunc() const {
+        return mParentFunc;
+    }
     
     /* Figure out what the parent module of this node is. */
     Module * getParentModule();
@@ -69,14 +99,17 @@ public:
     /* Figure out what the parent module of this node is (const version). */
     const Module * getParentModule() const;
     
-    /* Get the first parent node of a certain type */
+    /**
+     * Get the first parent node of a certain type. The type must be a concrete node type, i.e. one which
+     * has a node kind (see 'ASTNodeKindOf').
+     */
     template <class T>
     inline T * firstParentOfType() {
         ASTNode * parent = mParent;
         
         while (parent) {
-            if (T * nodeCast = dynamic_cast<T*>(parent)) {
-                return nodeCast;
+            if (parent->mKind == ASTNodeKindOf<T>::kKind) {
+                return static_cast<T*>(parent);
             }
             
             parent = parent->mParent;
@@ -91,8 +124,8 @@ public:
         const ASTNode * parent = mParent;
         
         while (parent) {
-            if (const T * nodeCast = dynamic_cast<const T*>(parent)) {
-                return nodeCast;
+            if (parent->mKind == ASTNodeKindOf<T>::kKind) {
+                return static_cast<const T*>(parent);
             }
             
             parent = parent->mParent;
@@ -101,8 +134,18 @@ public:
         return nullptr;
     }
     
+    /* The kind of AST node this is. Set by 'WC_NEW_AST_NODE' when the node is created. */
+    ASTNodeKind mKind;
+    
     /* The parent of this AST node. This should be set by the parent itself in the constructor. */
     ASTNode * mParent;
+    
+    /**
+     * The function and scope that this node is inside of, or null if none. Set by 'WC_NEW_AST_NODE' when the node
+     * is created, from the function and scope currently being parsed. See 'ParseCtx::setCurrentScope'.
+     */
+    Func * mParentFunc;
+    Scope * mParentScope;
 };
 
 WC_AST_END_NAMESPACE
@@ -7,6 +7,7 @@
 #include "AddExpr.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "LinearAlloc.hpp"
 #include "MulExpr.hpp"
@@ -18,13 +19,18 @@ WC_AST_BEGIN_NAMESPACE
 // AddExpr
 //-----------------------------------------------------------------------------
 bool AddExpr::peek(const Token * tokenPtr) {
-    return MulExpr::peek(tokenPtr);
+    return FirstSets::kAddExpr.contains(tokenPtr->type);
 }
 
-AddExpr * AddExpr::parse(ParseCtx & parseCtx) {
-    MulExpr * leftExpr = MulExpr::parse(parseCtx);
+Expr * AddExpr::parse(ParseCtx & parseCtx) {
+    Expr * leftExpr = MulExpr::parse(parseCtx);
     WC_GUARD(leftExpr, nullptr);
     
+    // Operators must be on the same line as the left operand: a newline before the operator ends the expression
+    if (parseCtx.tokIsPrecededByNewline()) {
+        return leftExpr;
+    }
+    
     // See if there is a known operator ahead.
     // If we find a known operator parse the operator token, the right operand and
     // return the AST node for the operation.
@@ -32,15 +38,13 @@ AddExpr * AddExpr::parse(ParseCtx & parseCtx) {
         case TokenType: {\
             /* Consume the operator token */\
             parseCtx.nextTok();\
-            /* Skip any newlines that follow */\
-            parseCtx.skipNewlines();\
             /* Parse the right side of the operator */\
-            AddExpr * rightExpr = AddExpr::parse(parseCtx);\
+            Expr * rightExpr = AddExpr::parse(parseCtx);\
             WC_GUARD(rightExpr, nullptr);\
             return WC_NEW_AST_NODE(parseCtx, ASTNodeType, *leftExpr, *rightExpr);\
         }
 
-    switch (parseCtx.tok()->type) {
+    switch (parseCtx.tokType()) {
         PARSE_OP(TokenType::kPlus, AddExprAdd)      // +
         PARSE_OP(TokenType::kMinus, AddExprSub)     // -
         PARSE_OP(TokenType::kVBar, AddExprBOr)      // |
@@ -52,33 +56,14 @@ AddExpr * AddExpr::parse(ParseCtx & parseCtx) {
     
     #undef PARSE_OP
     
-    // Basic no-op expression:
-    return WC_NEW_AST_NODE(parseCtx, AddExprNoOp, *leftExpr);
-}
-
-//-----------------------------------------------------------------------------
-// AddExprNoOp
-//-----------------------------------------------------------------------------
-AddExprNoOp::AddExprNoOp(MulExpr & expr) : mExpr(expr) {
-    mExpr.mParent = this;
-}
-
-void AddExprNoOp::accept(ASTNodeVisitor & visitor) const {
-    visitor.visit(*this);
-}
-
-const Token & AddExprNoOp::getStartToken() const {
-    return mExpr.getStartToken();
-}
-
-const Token & AddExprNoOp::getEndToken() const {
-    return mExpr.getEndToken();
+    // No operator follows: the expression is just the left operand
+    return leftExpr;
 }
 
 //-----------------------------------------------------------------------------
 // AddExprTwoOps
 //-----------------------------------------------------------------------------
-AddExprTwoOps::AddExprTwoOps(MulExpr & leftExpr, AddExpr & rightExpr) :
+AddExprTwoOps::AddExprTwoOps(Expr & leftExpr, Expr & rightExpr) :
     mLeftExpr(leftExpr),
     mRightExpr(rightExpr)
 {
@@ -97,7 +82,7 @@ const Token & AddExprTwoOps::getEndToken() const {
 //-----------------------------------------------------------------------------
 // AddExprAdd
 //-----------------------------------------------------------------------------
-AddExprAdd::AddExprAdd(MulExpr & leftExpr, AddExpr & rightExpr) :
+AddExprAdd::AddExprAdd(Expr & leftExpr, Expr & rightExpr) :
     AddExprTwoOps(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -110,7 +95,7 @@ void AddExprAdd::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // AddExprSub
 //-----------------------------------------------------------------------------
-AddExprSub::AddExprSub(MulExpr & leftExpr, AddExpr & rightExpr) :
+AddExprSub::AddExprSub(Expr & leftExpr, Expr & rightExpr) :
     AddExprTwoOps(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -123,7 +108,7 @@ void AddExprSub::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // AddExprBOr
 //-----------------------------------------------------------------------------
-AddExprBOr::AddExprBOr(MulExpr & leftExpr, AddExpr & rightExpr) :
+AddExprBOr::AddExprBOr(Expr & leftExpr, Expr & rightExpr) :
     AddExprTwoOps(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -136,7 +121,7 @@ void AddExprBOr::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // AddExprBXor
 //-----------------------------------------------------------------------------
-AddExprBXor::AddExprBXor(MulExpr & leftExpr, AddExpr & rightExpr) :
+AddExprBXor::AddExprBXor(Expr & leftExpr, Expr & rightExpr) :
     AddExprTwoOps(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -6,14 +6,11 @@
 
 #pragma once
 
-#include "ASTNode.hpp"
-#include "IExpr.hpp"
+#include "Expr.hpp"
 
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class MulExpr;
-
 /*
 AddExpr:
     MulExpr
@@ -22,40 +19,28 @@ AddExpr:
     MulExpr | AddExpr
     MulExpr ^ AddExpr
 */
-class AddExpr : public ASTNode, public IExpr {
+class AddExpr : public Expr {
 public:
     static bool peek(const Token * tokenPtr);
-    static AddExpr * parse(ParseCtx & parseCtx);
-};
-
-/* MulExpr */
-class AddExprNoOp final : public AddExpr {
-public:
-    AddExprNoOp(MulExpr & expr);
-    
-    virtual void accept(ASTNodeVisitor & visitor) const override;
-    virtual const Token & getStartToken() const override;
-    virtual const Token & getEndToken() const override;
-    
-    MulExpr & mExpr;
+    static Expr * parse(ParseCtx & parseCtx);
 };
 
 /* Base class for an AddExpr with two operands */
 class AddExprTwoOps : public AddExpr {
 public:
-    AddExprTwoOps(MulExpr & leftExpr, AddExpr & rightExpr);
+    AddExprTwoOps(Expr & leftExpr, Expr & rightExpr);
     
     virtual const Token & getStartToken() const final override;
     virtual const Token & getEndToken() const final override;
     
-    MulExpr & mLeftExpr;
-    AddExpr & mRightExpr;
+    Expr & mLeftExpr;
+    Expr & mRightExpr;
 };
 
 /* MulExpr + AddExpr */
 class AddExprAdd final : public AddExprTwoOps {
 public:
-    AddExprAdd(MulExpr & leftExpr, AddExpr & rightExpr);
+    AddExprAdd(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -63,7 +48,7 @@ public:
 /* MulExpr - AddExpr */
 class AddExprSub final : public AddExprTwoOps {
 public:
-    AddExprSub(MulExpr & leftExpr, AddExpr & rightExpr);
+    AddExprSub(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -71,7 +56,7 @@ public:
 /* MulExpr | AddExpr */
 class AddExprBOr final : public AddExprTwoOps {
 public:
-    AddExprBOr(MulExpr & leftExpr, AddExpr & rightExpr);
+    AddExprBOr(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -79,7 +64,7 @@ public:
 /* MulExpr ^ AddExpr */
 class AddExprBXor final : public AddExprTwoOps {
 public:
-    AddExprBXor(MulExpr & leftExpr, AddExpr & rightExpr);
+    AddExprBXor(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
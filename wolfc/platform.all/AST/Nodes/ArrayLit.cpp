@@ -7,7 +7,9 @@
 #include "ArrayLit.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
+#include "../ScratchList.hpp"
 #include "AssignExpr.hpp"
 #include "LinearAlloc.hpp"
 
@@ -15,45 +17,41 @@ WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
 bool ArrayLit::peek(const Token * tokenPtr) {
-    return tokenPtr->type == TokenType::kLBrack;
+    return FirstSets::kArrayLit.contains(tokenPtr->type);
 }
 
 ArrayLit * ArrayLit::parse(ParseCtx & parseCtx) {
     // Parse the initial '[':
-    if (parseCtx.tok()->type != TokenType::kLBrack) {
+    if (parseCtx.tokType() != TokenType::kLBrack) {
         parseCtx.error("Expected integer literal!");
         return nullptr;
     }
     
     const Token * lBrack = parseCtx.tok();
     parseCtx.nextTok();         // Consume '['
-    parseCtx.skipNewlines();    // Skip any newlines that follow
     
     // Start parsing the list of sub expressions
-    std::vector<AssignExpr*> exprs;
+    ScratchList<Expr> exprs(parseCtx);
     
     while (AssignExpr::peek(parseCtx.tok())) {
-        // Parse the expression and save if it was parsed ok.
-        // Also skip any newlines that follow:
-        AssignExpr * expr = AssignExpr::parse(parseCtx);
-        parseCtx.skipNewlines();
+        // Parse the expression and save if it was parsed ok:
+        Expr * expr = AssignExpr::parse(parseCtx);
         
         if (expr) {
-            exprs.push_back(expr);
+            exprs.push(expr);
         }
         
         // If a comma does not follow then we are done
-        if (parseCtx.tok()->type != TokenType::kComma) {
+        if (parseCtx.tokType() != TokenType::kComma) {
             break;
         }
         
         // Otherwise carry parsing
         parseCtx.nextTok();         // Consume ','
-        parseCtx.skipNewlines();    // Skip any newlines that follow
     }
     
     // Parse the closing ']'
-    if (parseCtx.tok()->type != TokenType::kRBrack) {
+    if (parseCtx.tokType() != TokenType::kRBrack) {
         parseCtx.error("Expected closing ']' for array literal!");
         return nullptr;
     }
@@ -62,22 +60,19 @@ ArrayLit * ArrayLit::parse(ParseCtx & parseCtx) {
     parseCtx.nextTok();
     
     // Now return the parsed node:
-    return WC_NEW_AST_NODE(parseCtx, ArrayLit, *lBrack, exprs, *rBrack);
+    return WC_NEW_AST_NODE(parseCtx, ArrayLit, *lBrack, exprs.finish(), *rBrack);
 }
 
 ArrayLit::ArrayLit(const Token & lBrack,
-                   const std::vector<AssignExpr*> & exprs,
+                   const Span<Expr*> & exprs,
                    const Token & rBrack)
 :
     mLBrack(lBrack),
-    mExprs(),
+    mExprs(exprs),
     mRBrack(rBrack)
 {
-    mExprs.reserve(exprs.size());
-    
-    for (AssignExpr * expr : exprs) {
+    for (Expr * expr : exprs) {
         expr->mParent = this;
-        mExprs.push_back(expr);
     }
 }
 
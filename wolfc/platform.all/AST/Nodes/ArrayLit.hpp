@@ -8,15 +8,12 @@
 
 #include "ASTNode.hpp"
 #include "IExpr.hpp"
-
-WC_THIRD_PARTY_INCLUDES_BEGIN
-    #include <vector>
-WC_THIRD_PARTY_INCLUDES_END
+#include "Span.hpp"
 
 WC_BEGIN_NAMESPACE
 
 namespace AST {
-    class AssignExpr;
+    class Expr;
 }
 
 WC_AST_BEGIN_NAMESPACE
@@ -31,7 +28,7 @@ public:
     static ArrayLit * parse(ParseCtx & parseCtx);
     
     ArrayLit(const Token & lBrack,
-             const std::vector<AssignExpr*> & exprs,
+             const Span<Expr*> & exprs,
              const Token & rBrack);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
@@ -39,19 +36,19 @@ public:
     virtual const Token & getEndToken() const override;
     
     /* Get the sub expressions that constitute the array literal */
-    inline const std::vector<const AssignExpr*> & getExprs() const {
+    inline const Span<const Expr*> & getExprs() const {
         return mExprs;
     }
     
 private:
     /* Left bracket token */
-    const Token & mLBrack;
+    const Token mLBrack;
     
     /* The assign expression for all array literal sub expressions */
-    std::vector<const AssignExpr*> mExprs;
+    Span<const Expr*> mExprs;
     
     /* Right bracket token */
-    const Token & mRBrack;
+    const Token mRBrack;
 };
 
 WC_AST_END_NAMESPACE
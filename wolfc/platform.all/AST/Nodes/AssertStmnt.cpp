@@ -7,6 +7,7 @@
 #include "AssertStmnt.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "AssignExpr.hpp"
 #include "LinearAlloc.hpp"
@@ -15,34 +16,31 @@ WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
 bool AssertStmnt::peek(const Token * tokenPtr) {
-    return tokenPtr->type == TokenType::kAssert;
+    return FirstSets::kAssertStmnt.contains(tokenPtr->type);
 }
 
 AssertStmnt * AssertStmnt::parse(ParseCtx & parseCtx) {
-    if (parseCtx.tok()->type != TokenType::kAssert) {
+    if (parseCtx.tokType() != TokenType::kAssert) {
         parseCtx.error("Expected keyword 'assert' for 'assert()' statement!");
         return nullptr;
     }
     
     const Token * assertTok = parseCtx.tok();
     parseCtx.nextTok();         // Consume 'assert'
-    parseCtx.skipNewlines();    // Skip any newlines that follow
     
-    if (parseCtx.tok()->type != TokenType::kLParen) {
+    if (parseCtx.tokType() != TokenType::kLParen) {
         parseCtx.error("Expected '(' following 'assert'!");
         return nullptr;
     }
     
     parseCtx.nextTok();         // Consume '('
-    parseCtx.skipNewlines();    // Skip any newlines that follow
     
-    // Parse the inner expression and skip any newlines that follow
-    AssignExpr * assignExpr = AssignExpr::parse(parseCtx);
+    // Parse the inner expression
+    Expr * assignExpr = AssignExpr::parse(parseCtx);
     WC_GUARD(assignExpr, nullptr);
-    parseCtx.skipNewlines();
     
     // Expect ')' following all that:
-    if (parseCtx.tok()->type != TokenType::kRParen) {
+    if (parseCtx.tokType() != TokenType::kRParen) {
         parseCtx.error("Expected closing ')' for 'assert()' statement!");
         return nullptr;
     }
@@ -55,7 +53,7 @@ AssertStmnt * AssertStmnt::parse(ParseCtx & parseCtx) {
     return WC_NEW_AST_NODE(parseCtx, AssertStmnt, *assertTok, *assignExpr, *closingParenTok);
 }
 
-AssertStmnt::AssertStmnt(const Token & startToken, AssignExpr & expr, const Token & endToken) :
+AssertStmnt::AssertStmnt(const Token & startToken, Expr & expr, const Token & endToken) :
     mStartToken(startToken),
     mExpr(expr),
     mEndToken(endToken)
@@ -12,7 +12,7 @@
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class AssignExpr;
+class Expr;
 
 /*
 AssertStmnt:
@@ -23,7 +23,7 @@ public:
     static bool peek(const Token * tokenPtr);
     static AssertStmnt * parse(ParseCtx & parseCtx);
     
-    AssertStmnt(const Token & startToken, AssignExpr & expr, const Token & endToken);
+    AssertStmnt(const Token & startToken, Expr & expr, const Token & endToken);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
     virtual const Token & getStartToken() const override;
@@ -31,9 +31,9 @@ public:
     
     virtual bool allCodepathsHaveUncondRet() const override;
     
-    const Token &   mStartToken;
-    AssignExpr &    mExpr;
-    const Token &   mEndToken;
+    const Token     mStartToken;
+    Expr &          mExpr;
+    const Token     mEndToken;
 };
 
 WC_AST_END_NAMESPACE
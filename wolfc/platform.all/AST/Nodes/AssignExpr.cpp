@@ -7,6 +7,7 @@
 #include "AssignExpr.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "LinearAlloc.hpp"
 #include "TernaryExpr.hpp"
@@ -18,13 +19,18 @@ WC_AST_BEGIN_NAMESPACE
 // AssignExpr
 //-----------------------------------------------------------------------------
 bool AssignExpr::peek(const Token * tokenPtr) {
-    return TernaryExpr::peek(tokenPtr);
+    return FirstSets::kAssignExpr.contains(tokenPtr->type);
 }
 
-AssignExpr * AssignExpr::parse(ParseCtx & parseCtx) {
+Expr * AssignExpr::parse(ParseCtx & parseCtx) {
     // Parse the initial expression
-    TernaryExpr * leftExpr = TernaryExpr::parse(parseCtx);
+    Expr * leftExpr = TernaryExpr::parse(parseCtx);
     WC_GUARD(leftExpr, nullptr);
+    
+    // Operators must be on the same line as the left operand: a newline before the operator ends the expression
+    if (parseCtx.tokIsPrecededByNewline()) {
+        return leftExpr;
+    }
 
     // See if there is a known operator ahead.
     // If we find a known operator parse the operator token, the right operand and
@@ -33,15 +39,13 @@ AssignExpr * AssignExpr::parse(ParseCtx & parseCtx) {
         case TokenType: {\
             /* Consume the operator token */\
             parseCtx.nextTok();\
-            /* Skip any newlines that follow */\
-            parseCtx.skipNewlines();\
             /* Parse the right side of the operator */\
-            AssignExpr * rightExpr = AssignExpr::parse(parseCtx);\
+            Expr * rightExpr = AssignExpr::parse(parseCtx);\
             WC_GUARD(rightExpr, nullptr);\
             return WC_NEW_AST_NODE(parseCtx, ASTNodeType, *leftExpr, *rightExpr);\
         }
 
-    switch (parseCtx.tok()->type) {
+    switch (parseCtx.tokType()) {
         PARSE_OP(TokenType::kAssign, AssignExprAssign)                  // =
         PARSE_OP(TokenType::kAssignBOr, AssignExprAssignBOr)            // |=
         PARSE_OP(TokenType::kAssignBXor, AssignExprAssignBXor)          // ^=
@@ -61,33 +65,14 @@ AssignExpr * AssignExpr::parse(ParseCtx & parseCtx) {
     
     #undef PARSE_OP
 
-    // Assign expression with no assign
-    return WC_NEW_AST_NODE(parseCtx, AssignExprNoAssign, *leftExpr);
-}
-
-//-----------------------------------------------------------------------------
-// AssignExprNoAssign
-//-----------------------------------------------------------------------------
-AssignExprNoAssign::AssignExprNoAssign(TernaryExpr & expr) : mExpr(expr) {
-    mExpr.mParent = this;
-}
-
-void AssignExprNoAssign::accept(ASTNodeVisitor & visitor) const {
-    visitor.visit(*this);
-}
-
-const Token & AssignExprNoAssign::getStartToken() const {
-    return mExpr.getStartToken();
-}
-
-const Token & AssignExprNoAssign::getEndToken() const {
-    return mExpr.getEndToken();
+    // No assign follows: the expression is just the left operand
+    return leftExpr;
 }
 
 //-----------------------------------------------------------------------------
 // AssignExprAssignBase
 //-----------------------------------------------------------------------------
-AssignExprAssignBase::AssignExprAssignBase(TernaryExpr & leftExpr, AssignExpr & rightExpr) :
+AssignExprAssignBase::AssignExprAssignBase(Expr & leftExpr, Expr & rightExpr) :
     mLeftExpr(leftExpr),
     mRightExpr(rightExpr)
 {
@@ -106,7 +91,7 @@ const Token & AssignExprAssignBase::getEndToken() const {
 //-----------------------------------------------------------------------------
 // AssignExprBinaryOpBase
 //-----------------------------------------------------------------------------
-AssignExprBinaryOpBase::AssignExprBinaryOpBase(TernaryExpr & leftExpr, AssignExpr & rightExpr) :
+AssignExprBinaryOpBase::AssignExprBinaryOpBase(Expr & leftExpr, Expr & rightExpr) :
     AssignExprAssignBase(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -115,7 +100,7 @@ AssignExprBinaryOpBase::AssignExprBinaryOpBase(TernaryExpr & leftExpr, AssignExp
 //-----------------------------------------------------------------------------
 // AssignExprAssign
 //-----------------------------------------------------------------------------
-AssignExprAssign::AssignExprAssign(TernaryExpr & leftExpr, AssignExpr & rightExpr) :
+AssignExprAssign::AssignExprAssign(Expr & leftExpr, Expr & rightExpr) :
     AssignExprAssignBase(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -128,7 +113,7 @@ void AssignExprAssign::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // AssignExprAssignAdd
 //-----------------------------------------------------------------------------
-AssignExprAssignAdd::AssignExprAssignAdd(TernaryExpr & leftExpr, AssignExpr & rightExpr) :
+AssignExprAssignAdd::AssignExprAssignAdd(Expr & leftExpr, Expr & rightExpr) :
     AssignExprBinaryOpBase(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -141,7 +126,7 @@ void AssignExprAssignAdd::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // AssignExprAssignSub
 //-----------------------------------------------------------------------------
-AssignExprAssignSub::AssignExprAssignSub(TernaryExpr & leftExpr, AssignExpr & rightExpr) :
+AssignExprAssignSub::AssignExprAssignSub(Expr & leftExpr, Expr & rightExpr) :
     AssignExprBinaryOpBase(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -154,7 +139,7 @@ void AssignExprAssignSub::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // AssignExprAssignBOr
 //-----------------------------------------------------------------------------
-AssignExprAssignBOr::AssignExprAssignBOr(TernaryExpr & leftExpr, AssignExpr & rightExpr) :
+AssignExprAssignBOr::AssignExprAssignBOr(Expr & leftExpr, Expr & rightExpr) :
     AssignExprBinaryOpBase(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -167,7 +152,7 @@ void AssignExprAssignBOr::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // AssignExprAssignBXor
 //-----------------------------------------------------------------------------
-AssignExprAssignBXor::AssignExprAssignBXor(TernaryExpr & leftExpr, AssignExpr & rightExpr) :
+AssignExprAssignBXor::AssignExprAssignBXor(Expr & leftExpr, Expr & rightExpr) :
     AssignExprBinaryOpBase(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -180,7 +165,7 @@ void AssignExprAssignBXor::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // AssignExprAssignMul
 //-----------------------------------------------------------------------------
-AssignExprAssignMul::AssignExprAssignMul(TernaryExpr & leftExpr, AssignExpr & rightExpr) :
+AssignExprAssignMul::AssignExprAssignMul(Expr & leftExpr, Expr & rightExpr) :
     AssignExprBinaryOpBase(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -193,7 +178,7 @@ void AssignExprAssignMul::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // AssignExprAssignDiv
 //-----------------------------------------------------------------------------
-AssignExprAssignDiv::AssignExprAssignDiv(TernaryExpr & leftExpr, AssignExpr & rightExpr) :
+AssignExprAssignDiv::AssignExprAssignDiv(Expr & leftExpr, Expr & rightExpr) :
     AssignExprBinaryOpBase(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -206,7 +191,7 @@ void AssignExprAssignDiv::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // AssignExprAssignRem
 //-----------------------------------------------------------------------------
-AssignExprAssignRem::AssignExprAssignRem(TernaryExpr & leftExpr, AssignExpr & rightExpr) :
+AssignExprAssignRem::AssignExprAssignRem(Expr & leftExpr, Expr & rightExpr) :
     AssignExprBinaryOpBase(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -219,7 +204,7 @@ void AssignExprAssignRem::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // AssignExprAssignBAnd
 //-----------------------------------------------------------------------------
-AssignExprAssignBAnd::AssignExprAssignBAnd(TernaryExpr & leftExpr, AssignExpr & rightExpr) :
+AssignExprAssignBAnd::AssignExprAssignBAnd(Expr & leftExpr, Expr & rightExpr) :
     AssignExprBinaryOpBase(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -232,7 +217,7 @@ void AssignExprAssignBAnd::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // AssignExprAssignLShift
 //-----------------------------------------------------------------------------
-AssignExprAssignLShift::AssignExprAssignLShift(TernaryExpr & leftExpr, AssignExpr & rightExpr) :
+AssignExprAssignLShift::AssignExprAssignLShift(Expr & leftExpr, Expr & rightExpr) :
     AssignExprBinaryOpBase(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -245,7 +230,7 @@ void AssignExprAssignLShift::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // AssignExprAssignARShift
 //-----------------------------------------------------------------------------
-AssignExprAssignARShift::AssignExprAssignARShift(TernaryExpr & leftExpr, AssignExpr & rightExpr) :
+AssignExprAssignARShift::AssignExprAssignARShift(Expr & leftExpr, Expr & rightExpr) :
     AssignExprBinaryOpBase(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -258,7 +243,7 @@ void AssignExprAssignARShift::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // AssignExprAssignLRShift
 //-----------------------------------------------------------------------------
-AssignExprAssignLRShift::AssignExprAssignLRShift(TernaryExpr & leftExpr, AssignExpr & rightExpr) :
+AssignExprAssignLRShift::AssignExprAssignLRShift(Expr & leftExpr, Expr & rightExpr) :
     AssignExprBinaryOpBase(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
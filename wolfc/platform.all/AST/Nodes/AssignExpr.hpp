@@ -6,14 +6,11 @@
 
 #pragma once
 
-#include "ASTNode.hpp"
-#include "IExpr.hpp"
+#include "Expr.hpp"
 
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class TernaryExpr;
-
 /*
 AssignExpr:
     TernaryExpr
@@ -30,40 +27,28 @@ AssignExpr:
     TernaryExpr >>= AssignExpr
     TernaryExpr >>>= AssignExpr
 */
-class AssignExpr : public ASTNode, public IExpr {
+class AssignExpr : public Expr {
 public:
     static bool peek(const Token * tokenPtr);
-    static AssignExpr * parse(ParseCtx & parseCtx);
-};
-
-/* TernaryExpr */
-class AssignExprNoAssign final : public AssignExpr {
-public:
-    AssignExprNoAssign(TernaryExpr & expr);
-    
-    virtual void accept(ASTNodeVisitor & visitor) const override;
-    virtual const Token & getStartToken() const override;
-    virtual const Token & getEndToken() const override;
-    
-    TernaryExpr & mExpr;
+    static Expr * parse(ParseCtx & parseCtx);
 };
 
 /* Base class for assign expressions actually do an assign */
 class AssignExprAssignBase : public AssignExpr {
 public:
-    AssignExprAssignBase(TernaryExpr & leftExpr, AssignExpr & rightExpr);
+    AssignExprAssignBase(Expr & leftExpr, Expr & rightExpr);
 
     virtual const Token & getStartToken() const final override;
     virtual const Token & getEndToken() const final override;
     
-    TernaryExpr &   mLeftExpr;
-    AssignExpr &    mRightExpr;
+    Expr &          mLeftExpr;
+    Expr &          mRightExpr;
 };
 
 /* TernaryExpr = AssignExpr */
 class AssignExprAssign final : public AssignExprAssignBase {
 public:
-    AssignExprAssign(TernaryExpr & leftExpr, AssignExpr & rightExpr);
+    AssignExprAssign(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -71,13 +56,13 @@ public:
 /* Base class for an assign expression that does a binary operation (add, mul etc.) */
 class AssignExprBinaryOpBase : public AssignExprAssignBase {
 public:
-    AssignExprBinaryOpBase(TernaryExpr & leftExpr, AssignExpr & rightExpr);
+    AssignExprBinaryOpBase(Expr & leftExpr, Expr & rightExpr);
 };
 
 /* TernaryExpr += AssignExpr */
 class AssignExprAssignAdd final : public AssignExprBinaryOpBase {
 public:
-    AssignExprAssignAdd(TernaryExpr & leftExpr, AssignExpr & rightExpr);
+    AssignExprAssignAdd(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -85,7 +70,7 @@ public:
 /* TernaryExpr -= AssignExpr */
 class AssignExprAssignSub final : public AssignExprBinaryOpBase {
 public:
-    AssignExprAssignSub(TernaryExpr & leftExpr, AssignExpr & rightExpr);
+    AssignExprAssignSub(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -93,7 +78,7 @@ public:
 /* TernaryExpr |= AssignExpr */
 class AssignExprAssignBOr final : public AssignExprBinaryOpBase {
 public:
-    AssignExprAssignBOr(TernaryExpr & leftExpr, AssignExpr & rightExpr);
+    AssignExprAssignBOr(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -101,7 +86,7 @@ public:
 /* TernaryExpr ^= AssignExpr */
 class AssignExprAssignBXor final : public AssignExprBinaryOpBase {
 public:
-    AssignExprAssignBXor(TernaryExpr & leftExpr, AssignExpr & rightExpr);
+    AssignExprAssignBXor(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -109,7 +94,7 @@ public:
 /* TernaryExpr *= AssignExpr */
 class AssignExprAssignMul final : public AssignExprBinaryOpBase {
 public:
-    AssignExprAssignMul(TernaryExpr & leftExpr, AssignExpr & rightExpr);
+    AssignExprAssignMul(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -117,7 +102,7 @@ public:
 /* TernaryExpr /= AssignExpr */
 class AssignExprAssignDiv final : public AssignExprBinaryOpBase {
 public:
-    AssignExprAssignDiv(TernaryExpr & leftExpr, AssignExpr & rightExpr);
+    AssignExprAssignDiv(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -125,7 +110,7 @@ public:
 /* TernaryExpr %= AssignExpr */
 class AssignExprAssignRem final : public AssignExprBinaryOpBase {
 public:
-    AssignExprAssignRem(TernaryExpr & leftExpr, AssignExpr & rightExpr);
+    AssignExprAssignRem(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -133,7 +118,7 @@ public:
 /* TernaryExpr &= AssignExpr */
 class AssignExprAssignBAnd final : public AssignExprBinaryOpBase {
 public:
-    AssignExprAssignBAnd(TernaryExpr & leftExpr, AssignExpr & rightExpr);
+    AssignExprAssignBAnd(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -141,7 +126,7 @@ public:
 /* TernaryExpr <<= AssignExpr */
 class AssignExprAssignLShift final : public AssignExprBinaryOpBase {
 public:
-    AssignExprAssignLShift(TernaryExpr & leftExpr, AssignExpr & rightExpr);
+    AssignExprAssignLShift(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -149,7 +134,7 @@ public:
 /* TernaryExpr >>= AssignExpr */
 class AssignExprAssignARShift final : public AssignExprBinaryOpBase {
 public:
-    AssignExprAssignARShift(TernaryExpr & leftExpr, AssignExpr & rightExpr);
+    AssignExprAssignARShift(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -157,7 +142,7 @@ public:
 /* TernaryExpr >>>= AssignExpr */
 class AssignExprAssignLRShift final : public AssignExprBinaryOpBase {
 public:
-    AssignExprAssignLRShift(TernaryExpr & leftExpr, AssignExpr & rightExpr);
+    AssignExprAssignLRShift(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -7,6 +7,7 @@
 #include "BoolLit.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "LinearAlloc.hpp"
 
@@ -14,8 +15,7 @@ WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
 bool BoolLit::peek(const Token * tokenPtr) {
-    TokenType tokenType = tokenPtr->type;
-    return tokenType == TokenType::kTrue || tokenType == TokenType::kFalse;
+    return FirstSets::kBoolLit.contains(tokenPtr->type);
 }
 
 BoolLit * BoolLit::parse(ParseCtx & parseCtx) {
@@ -7,6 +7,7 @@
 #include "BreakStmnt.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "AssignExpr.hpp"
 #include "LinearAlloc.hpp"
@@ -18,7 +19,7 @@ WC_AST_BEGIN_NAMESPACE
 // BreakStmnt
 //-----------------------------------------------------------------------------
 bool BreakStmnt::peek(const Token * tokenPtr) {
-    return tokenPtr->type == TokenType::kBreak;
+    return FirstSets::kBreakStmnt.contains(tokenPtr->type);
 }
 
 BreakStmnt * BreakStmnt::parse(ParseCtx & parseCtx) {
@@ -31,15 +32,16 @@ BreakStmnt * BreakStmnt::parse(ParseCtx & parseCtx) {
     const Token * breakTok = parseCtx.tok();
     parseCtx.nextTok();
     
-    // See whether 'if' or 'unless' follow, in which case the 'break' statement is conditional:
-    if (parseCtx.tok()->type == TokenType::kIf || parseCtx.tok()->type == TokenType::kUnless) {
-        // Parse the condition token and skip any newlines that follow:
+    // See whether 'if' or 'unless' follow on the same line, in which case the 'break' statement is conditional:
+    if (!parseCtx.tokIsPrecededByNewline() &&
+        (parseCtx.tokType() == TokenType::kIf || parseCtx.tokType() == TokenType::kUnless))
+    {
+        // Parse the condition token:
         const Token * condTok = parseCtx.tok();
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
         
         // Parse the condition assign expression:
-        AssignExpr * condExpr = AssignExpr::parse(parseCtx);
+        Expr * condExpr = AssignExpr::parse(parseCtx);
         WC_GUARD(condExpr, nullptr);
         
         // 'break' with a condition:
@@ -82,7 +84,7 @@ const Token & BreakStmntNoCond::getEndToken() const {
 //-----------------------------------------------------------------------------
 BreakStmntWithCond::BreakStmntWithCond(const Token & breakToken,
                                        const Token & condToken,
-                                       AssignExpr & condExpr)
+                                       Expr & condExpr)
 :
     BreakStmnt(breakToken),
     mCondToken(condToken),
@@ -12,7 +12,7 @@
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class AssignExpr;
+class Expr;
 
 /*
 BreakStmnt:
@@ -31,7 +31,7 @@ public:
     virtual bool allCodepathsHaveUncondRet() const override;
     
     /* The 'break' token */
-    const Token & mBreakToken;
+    const Token mBreakToken;
 };
 
 /* break */
@@ -48,7 +48,7 @@ class BreakStmntWithCond final : public BreakStmnt {
 public:
     BreakStmntWithCond(const Token & breakToken,
                        const Token & condToken,
-                       AssignExpr & condExpr);
+                       Expr & condExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
     virtual const Token & getEndToken() const override;
@@ -57,10 +57,10 @@ public:
     bool isIfCondInverted() const;
 
     /* This is either 'if' or 'unless' (inverted condition) */
-    const Token & mCondToken;
+    const Token mCondToken;
 
     /* The condition expression itself */
-    AssignExpr & mCondExpr;
+    Expr & mCondExpr;
 };
 
 WC_AST_END_NAMESPACE
@@ -7,6 +7,7 @@
 #include "CastExpr.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "AssignExpr.hpp"
 #include "LinearAlloc.hpp"
@@ -20,49 +21,44 @@ WC_AST_BEGIN_NAMESPACE
 // CastExpr
 //-----------------------------------------------------------------------------
 bool CastExpr::peek(const Token * currentToken) {
-    return PrimaryExpr::peek(currentToken) || currentToken->type == TokenType::kCast;
+    return FirstSets::kCastExpr.contains(currentToken->type);
 }
 
-CastExpr * CastExpr::parse(ParseCtx & parseCtx) {
+Expr * CastExpr::parse(ParseCtx & parseCtx) {
     // See if 'cast' follows:
-    if (parseCtx.tok()->type == TokenType::kCast) {
-        // Casting expression: skip 'cast' and any newlines that follow
+    if (parseCtx.tokType() == TokenType::kCast) {
+        // Casting expression: skip 'cast'
         const Token * startToken = parseCtx.tok();
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
         
         // Expect opening '('
-        if (parseCtx.tok()->type != TokenType::kLParen) {
+        if (parseCtx.tokType() != TokenType::kLParen) {
             parseCtx.error("Expect '(' following 'cast' for 'cast()' operator!");
             return nullptr;
         }
         
-        // Skip '(' any newlines that follow
+        // Skip '('
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
         
-        // Parse the initial assign expression and skip any newlines that follow:
-        AssignExpr * expr = AssignExpr::parse(parseCtx);
+        // Parse the initial assign expression:
+        Expr * expr = AssignExpr::parse(parseCtx);
         WC_GUARD(expr, nullptr);
-        parseCtx.skipNewlines();
         
         // Expect keyword 'to':
-        if (parseCtx.tok()->type != TokenType::kTo) {
+        if (parseCtx.tokType() != TokenType::kTo) {
             parseCtx.error("Expecting keyword 'to' following the expression to cast inside 'cast()' operator!");
             return nullptr;
         }
         
-        // Skip 'to' and any newlines that follow
+        // Skip 'to'
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
         
-        // Parse the type to cast to and skip any newlines that follow:
+        // Parse the type to cast to:
         Type * type = Type::parse(parseCtx);
         WC_GUARD(type, nullptr);
-        parseCtx.skipNewlines();
         
         // Expect closing ')'
-        if (parseCtx.tok()->type != TokenType::kRParen) {
+        if (parseCtx.tokType() != TokenType::kRParen) {
             parseCtx.error("Expecting closing ')' for 'cast()' operator!");
             return nullptr;
         }
@@ -81,35 +77,14 @@ CastExpr * CastExpr::parse(ParseCtx & parseCtx) {
     }
     
     // Normal expression that does no cast:
-    PrimaryExpr * primaryExpr = PrimaryExpr::parse(parseCtx);
-    WC_GUARD(primaryExpr, nullptr);
-    return WC_NEW_AST_NODE(parseCtx, CastExprNoCast, *primaryExpr);
-}
-
-//-----------------------------------------------------------------------------
-// CastExprNoCast
-//-----------------------------------------------------------------------------
-CastExprNoCast::CastExprNoCast(PrimaryExpr & expr) : mExpr(expr) {
-    mExpr.mParent = this;
-}
-
-void CastExprNoCast::accept(ASTNodeVisitor & visitor) const {
-    visitor.visit(*this);
-}
-
-const Token & CastExprNoCast::getStartToken() const {
-    return mExpr.getStartToken();
-}
-
-const Token & CastExprNoCast::getEndToken() const {
-    return mExpr.getEndToken();
+    return PrimaryExpr::parse(parseCtx);
 }
 
 //-----------------------------------------------------------------------------
 // CastExprCast
 //-----------------------------------------------------------------------------
 CastExprCast::CastExprCast(const Token & startToken,
-                           AssignExpr & expr,
+                           Expr & expr,
                            Type & type,
                            const Token & endToken)
 :
@@ -6,14 +6,11 @@
 
 #pragma once
 
-#include "ASTNode.hpp"
-#include "IExpr.hpp"
+#include "Expr.hpp"
 
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class AssignExpr;
-class PrimaryExpr;
 class Type;
 
 /*
@@ -21,29 +18,17 @@ CastExpr:
     PrimaryExpr
     cast ( AssignExpr to Type )
 */
-class CastExpr : public ASTNode, public IExpr {
+class CastExpr : public Expr {
 public:
     static bool peek(const Token * currentToken);
-    static CastExpr * parse(ParseCtx & parseCtx);
-};
-
-/* PrimaryExpr */
-class CastExprNoCast final : public CastExpr {
-public:
-    CastExprNoCast(PrimaryExpr & expr);
-    
-    virtual void accept(ASTNodeVisitor & visitor) const override;
-    virtual const Token & getStartToken() const override;
-    virtual const Token & getEndToken() const override;
-
-    PrimaryExpr & mExpr;
+    static Expr * parse(ParseCtx & parseCtx);
 };
 
 /* cast ( AssignExpr to Type ) */
 class CastExprCast final : public CastExpr {
 public:
     CastExprCast(const Token & startToken,
-                 AssignExpr & expr,
+                 Expr & expr,
                  Type & type,
                  const Token & endToken);
 
@@ -51,10 +36,10 @@ public:
     virtual const Token & getStartToken() const final override;
     virtual const Token & getEndToken() const final override;
     
-    const Token &   mStartToken;
-    AssignExpr &    mExpr;
+    const Token     mStartToken;
+    Expr &          mExpr;
     Type &          mType;
-    const Token &   mEndToken;
+    const Token     mEndToken;
 };
 
 WC_AST_END_NAMESPACE
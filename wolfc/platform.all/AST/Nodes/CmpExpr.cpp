@@ -7,6 +7,7 @@
 #include "CmpExpr.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "AddExpr.hpp"
 #include "LinearAlloc.hpp"
@@ -18,13 +19,18 @@ WC_AST_BEGIN_NAMESPACE
 // CmpExpr
 //-----------------------------------------------------------------------------
 bool CmpExpr::peek(const Token * tokenPtr) {
-    return AddExpr::peek(tokenPtr);
+    return FirstSets::kCmpExpr.contains(tokenPtr->type);
 }
 
-CmpExpr * CmpExpr::parse(ParseCtx & parseCtx) {
-    AddExpr * leftExpr = AddExpr::parse(parseCtx);
+Expr * CmpExpr::parse(ParseCtx & parseCtx) {
+    Expr * leftExpr = AddExpr::parse(parseCtx);
     WC_GUARD(leftExpr, nullptr);
     
+    // Operators must be on the same line as the left operand: a newline before the operator ends the expression
+    if (parseCtx.tokIsPrecededByNewline()) {
+        return leftExpr;
+    }
+    
     // See if there is a known operator ahead.
     // If we find a known operator parse the operator token, the right operand and
     // return the AST node for the operation.
@@ -32,15 +38,13 @@ CmpExpr * CmpExpr::parse(ParseCtx & parseCtx) {
         case TokenType: {\
             /* Consume the operator token */\
             parseCtx.nextTok();\
-            /* Skip any newlines that follow */\
-            parseCtx.skipNewlines();\
             /* Parse the right side of the operator */\
-            CmpExpr * rightExpr = CmpExpr::parse(parseCtx);\
+            Expr * rightExpr = CmpExpr::parse(parseCtx);\
             WC_GUARD(rightExpr, nullptr);\
             return WC_NEW_AST_NODE(parseCtx, ASTNodeType, *leftExpr, *rightExpr);\
         }
 
-    TokenType nextTokType = parseCtx.tok()->type;
+    TokenType nextTokType = parseCtx.tokType();
     
     switch (nextTokType) {
         PARSE_OP(TokenType::kCmpEQ, CmpExprEQ)  // ==
@@ -59,19 +63,17 @@ CmpExpr * CmpExpr::parse(ParseCtx & parseCtx) {
     if (nextTokType == TokenType::kIs) {
         // Skip 'is'
         parseCtx.nextTok();         // Consume 'is'
-        parseCtx.skipNewlines();    // Skip any newlines that follow
         
         // See if 'not' follows, if it does then it inverses the comparison:
         bool cmpNotEq = false;
         
-        if (parseCtx.tok()->type == TokenType::kNot) {
+        if (parseCtx.tokType() == TokenType::kNot) {
             cmpNotEq = true;
             parseCtx.nextTok();         // Consume 'not'
-            parseCtx.skipNewlines();    // Skip any newlines that follow
         }
         
         // Parse the right expression
-        CmpExpr * rightExpr = CmpExpr::parse(parseCtx);
+        Expr * rightExpr = CmpExpr::parse(parseCtx);
         WC_GUARD(rightExpr, nullptr);
         
         // Now return the operation:
@@ -83,33 +85,14 @@ CmpExpr * CmpExpr::parse(ParseCtx & parseCtx) {
         }
     }
 
-    // Basic no-op expression:
-    return WC_NEW_AST_NODE(parseCtx, CmpExprNoOp, *leftExpr);
-}
-
-//-----------------------------------------------------------------------------
-// CmpExprNoOp
-//-----------------------------------------------------------------------------
-CmpExprNoOp::CmpExprNoOp(AddExpr & expr) : mExpr(expr) {
-    mExpr.mParent = this;
-}
-
-void CmpExprNoOp::accept(ASTNodeVisitor & visitor) const {
-    visitor.visit(*this);
-}
-
-const Token & CmpExprNoOp::getStartToken() const {
-    return mExpr.getStartToken();
-}
-
-const Token & CmpExprNoOp::getEndToken() const {
-    return mExpr.getEndToken();
+    // No operator follows: the expression is just the left operand
+    return leftExpr;
 }
 
 //-----------------------------------------------------------------------------
 // CmpExprTwoOps
 //-----------------------------------------------------------------------------
-CmpExprTwoOps::CmpExprTwoOps(AddExpr & leftExpr, CmpExpr & rightExpr) :
+CmpExprTwoOps::CmpExprTwoOps(Expr & leftExpr, Expr & rightExpr) :
     mLeftExpr(leftExpr),
     mRightExpr(rightExpr)
 {
@@ -128,7 +111,7 @@ const Token & CmpExprTwoOps::getEndToken() const {
 //-----------------------------------------------------------------------------
 // CmpExprEQ
 //-----------------------------------------------------------------------------
-CmpExprEQ::CmpExprEQ(AddExpr & leftExpr, CmpExpr & rightExpr) :
+CmpExprEQ::CmpExprEQ(Expr & leftExpr, Expr & rightExpr) :
     CmpExprTwoOps(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -141,7 +124,7 @@ void CmpExprEQ::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // CmpExprNE
 //-----------------------------------------------------------------------------
-CmpExprNE::CmpExprNE(AddExpr & leftExpr, CmpExpr & rightExpr) :
+CmpExprNE::CmpExprNE(Expr & leftExpr, Expr & rightExpr) :
     CmpExprTwoOps(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -154,7 +137,7 @@ void CmpExprNE::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // CmpExprLT
 //-----------------------------------------------------------------------------
-CmpExprLT::CmpExprLT(AddExpr & leftExpr, CmpExpr & rightExpr) :
+CmpExprLT::CmpExprLT(Expr & leftExpr, Expr & rightExpr) :
     CmpExprTwoOps(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -167,7 +150,7 @@ void CmpExprLT::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // CmpExprLE
 //-----------------------------------------------------------------------------
-CmpExprLE::CmpExprLE(AddExpr & leftExpr, CmpExpr & rightExpr) :
+CmpExprLE::CmpExprLE(Expr & leftExpr, Expr & rightExpr) :
     CmpExprTwoOps(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -180,7 +163,7 @@ void CmpExprLE::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // CmpExprGT
 //-----------------------------------------------------------------------------
-CmpExprGT::CmpExprGT(AddExpr & leftExpr, CmpExpr & rightExpr) :
+CmpExprGT::CmpExprGT(Expr & leftExpr, Expr & rightExpr) :
     CmpExprTwoOps(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -193,7 +176,7 @@ void CmpExprGT::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // CmpExprGE
 //-----------------------------------------------------------------------------
-CmpExprGE::CmpExprGE(AddExpr & leftExpr, CmpExpr & rightExpr) :
+CmpExprGE::CmpExprGE(Expr & leftExpr, Expr & rightExpr) :
     CmpExprTwoOps(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
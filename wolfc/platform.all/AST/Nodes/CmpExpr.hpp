@@ -6,14 +6,11 @@
 
 #pragma once
 
-#include "ASTNode.hpp"
-#include "IExpr.hpp"
+#include "Expr.hpp"
 
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class AddExpr;
-
 /*
 CmpExpr:
     AddExpr
@@ -26,34 +23,22 @@ CmpExpr:
     AddExpr > CmpExpr
     AddExpr >= CmpExpr
 */
-class CmpExpr : public ASTNode, public IExpr {
+class CmpExpr : public Expr {
 public:
     static bool peek(const Token * tokenPtr);
-    static CmpExpr * parse(ParseCtx & parseCtx);
-};
-
-/* AddExpr */
-class CmpExprNoOp final : public CmpExpr {
-public:
-    CmpExprNoOp(AddExpr & expr);
-    
-    virtual void accept(ASTNodeVisitor & visitor) const override;
-    virtual const Token & getStartToken() const override;
-    virtual const Token & getEndToken() const override;
-    
-    AddExpr & mExpr;
+    static Expr * parse(ParseCtx & parseCtx);
 };
 
 /* Base for relational expressions with two operators. */
 class CmpExprTwoOps : public CmpExpr {
 public:
-    CmpExprTwoOps(AddExpr & leftExpr, CmpExpr & rightExpr);
+    CmpExprTwoOps(Expr & leftExpr, Expr & rightExpr);
     
     virtual const Token & getStartToken() const final override;
     virtual const Token & getEndToken() const final override;
     
-    AddExpr & mLeftExpr;
-    CmpExpr & mRightExpr;
+    Expr & mLeftExpr;
+    Expr & mRightExpr;
 };
 
 /**
@@ -62,7 +47,7 @@ public:
  */
 class CmpExprEQ final : public CmpExprTwoOps {
 public:
-    CmpExprEQ(AddExpr & leftExpr, CmpExpr & rightExpr);
+    CmpExprEQ(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -73,7 +58,7 @@ public:
  */
 class CmpExprNE final : public CmpExprTwoOps {
 public:
-    CmpExprNE(AddExpr & leftExpr, CmpExpr & rightExpr);
+    CmpExprNE(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -81,7 +66,7 @@ public:
 /* AddExpr < CmpExpr */
 class CmpExprLT final : public CmpExprTwoOps {
 public:
-    CmpExprLT(AddExpr & leftExpr, CmpExpr & rightExpr);
+    CmpExprLT(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -89,7 +74,7 @@ public:
 /* AddExpr <= CmpExpr */
 class CmpExprLE final : public CmpExprTwoOps {
 public:
-    CmpExprLE(AddExpr & leftExpr, CmpExpr & rightExpr);
+    CmpExprLE(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -97,7 +82,7 @@ public:
 /* AddExpr > CmpExpr */
 class CmpExprGT final : public CmpExprTwoOps {
 public:
-    CmpExprGT(AddExpr & leftExpr, CmpExpr & rightExpr);
+    CmpExprGT(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -105,7 +90,7 @@ public:
 /* AddExpr >= CmpExpr */
 class CmpExprGE final : public CmpExprTwoOps {
 public:
-    CmpExprGE(AddExpr & leftExpr, CmpExpr & rightExpr);
+    CmpExprGE(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
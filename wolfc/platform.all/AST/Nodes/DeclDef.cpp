@@ -7,6 +7,7 @@
 #include "DeclDef.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "Func.hpp"
 #include "LinearAlloc.hpp"
@@ -19,7 +20,7 @@ WC_AST_BEGIN_NAMESPACE
 // DeclDef
 //-----------------------------------------------------------------------------
 bool DeclDef::peek(const Token * tokenPtr) {
-    return Func::peek(tokenPtr) || VarDecl::peek(tokenPtr);
+    return FirstSets::kDeclDef.contains(tokenPtr->type);
 }
 
 DeclDef * DeclDef::parse(ParseCtx & parseCtx) {
@@ -0,0 +1,30 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#pragma once
+
+#include "ASTNode.hpp"
+#include "IExpr.hpp"
+
+WC_BEGIN_NAMESPACE
+WC_AST_BEGIN_NAMESPACE
+
+/**
+ * Base class for the expression nodes that make up the operator precedence levels of the grammar,
+ * from 'AssignExpr' all the way down to 'PrimaryExpr'.
+ *
+ * A node is only created for a precedence level when an operator for that level is actually present.
+ * Otherwise the expression for the level is just the node for its operand, which could be from any lower level.
+ * For example the expression 'x' is represented by a single 'PrimaryExprIdentifier' node rather than by a
+ * chain of nodes for each level (AssignExpr, TernaryExpr, LOrExpr and so on). Because of this the operands
+ * of an expression are referred to through this base class, rather than by the node type for their level.
+ */
+class Expr : public ASTNode, public IExpr {
+    /* Nothing extra in here at the moment */
+};
+
+WC_AST_END_NAMESPACE
+WC_END_NAMESPACE
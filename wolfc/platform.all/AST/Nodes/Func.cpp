@@ -7,7 +7,10 @@
 #include "Func.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
+#include "../ScratchList.hpp"
+#include "Finally.hpp"
 #include "FuncArg.hpp"
 #include "Identifier.hpp"
 #include "LinearAlloc.hpp"
@@ -22,7 +25,7 @@ WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
 bool Func::peek(const Token * tokenPtr) {
-    return tokenPtr->type == TokenType::kFunc;
+    return FirstSets::kFunc.contains(tokenPtr->type);
 }
 
 Func * Func::parse(ParseCtx & parseCtx) {
@@ -32,55 +35,53 @@ Func * Func::parse(ParseCtx & parseCtx) {
         return nullptr;
     }
     
-    // Skip the 'func' token and save location. Also skip any newlines that follow:
+    // Skip the 'func' token and save location:
     const Token * startToken = parseCtx.tok();
     parseCtx.nextTok();
-    parseCtx.skipNewlines();
     
-    // Parse the function identifier and skip any newlines that follow:
+    // Reserve the memory for the function upfront, all nodes created from here on until it is done are inside of it.
+    // If parsing fails then the memory is just left unused.
+    Func * func = parseCtx.reserveASTNode<Func>();
+    Func * outerFunc = parseCtx.setCurrentFunc(func);
+    Finally restoreOuterFunc([&](){ parseCtx.setCurrentFunc(outerFunc); });
+    
+    // Parse the function identifier:
     Identifier * identifier = Identifier::parse(parseCtx);
     WC_GUARD(identifier, nullptr);
-    parseCtx.skipNewlines();
     
     // Expect '('
-    if (parseCtx.tok()->type != TokenType::kLParen) {
+    if (parseCtx.tokType() != TokenType::kLParen) {
         parseCtx.error("'(' expected following function name!");
         return nullptr;
     }
     
     parseCtx.nextTok();         // Skip '('
-    parseCtx.skipNewlines();    // Skip any newlines that follow
     
     // Parse any function arguments that follow:
-    std::vector<FuncArg*> funcArgs;
+    ScratchList<FuncArg> funcArgs(parseCtx);
     
     while (FuncArg::peek(parseCtx.tok())) {
         // Parse the arg
         FuncArg * funcArg = FuncArg::parse(parseCtx);
         
         if (funcArg) {
-            funcArgs.push_back(funcArg);
+            funcArgs.push(funcArg);
         }
         
-        // Skip any newlines that follow
-        parseCtx.skipNewlines();
-        
         // See if a ',' follows
-        if (parseCtx.tok()->type == TokenType::kComma) {
-            // Skip the ',' and any newlines that follow
+        if (parseCtx.tokType() == TokenType::kComma) {
+            // Skip the ','
             parseCtx.nextTok();
-            parseCtx.skipNewlines();
             
             // Expect an argument following
             if (!FuncArg::peek(parseCtx.tok())) {
                 parseCtx.error("Expect an argument following ','!");
-                parseCtx.skipNewlines();
             }
         }
     }
     
     // Expect ')'
-    if (parseCtx.tok()->type != TokenType::kRParen) {
+    if (parseCtx.tokType() != TokenType::kRParen) {
         parseCtx.error("')' expected to close args list of function!");
         return nullptr;
     }
@@ -88,31 +89,27 @@ Func * Func::parse(ParseCtx & parseCtx) {
     // Skip ')'
     parseCtx.nextTok();
     
-    // Skip any newlines that follow. Tentatively mark also whether the function body
-    // is on a new line or not compared to the function opener (note: we may find this
-    // not to be true below)
-    bool funcBodyIsOnNewLine = parseCtx.skipNewlines() > 0;
+    // Tentatively mark whether the function body is on a new line or not compared to
+    // the function opener (note: we may find this not to be true below)
+    bool funcBodyIsOnNewLine = parseCtx.tokIsPrecededByNewline();
     
     // See if a '->' follows for function explicit return type.
     // If it is not present then a 'void' return type is assumed.
     Type * returnType = nullptr;
     
-    if (parseCtx.tok()->type == TokenType::kOpArrow) {
+    if (parseCtx.tokType() == TokenType::kOpArrow) {
         // Explicit return type, skip the '->' first.
         // Also don't regard the the function body as being on a new line for now.
         parseCtx.nextTok();
         funcBodyIsOnNewLine = false;
         
-        // Skip any newlines that follow
-        parseCtx.skipNewlines();
-        
         // Now parse the return type, if that fails then bail
         returnType = Type::parse(parseCtx);
         WC_GUARD(returnType, nullptr);
     }
     
-    // Skip any newlines that follow
-    if (parseCtx.skipNewlines() > 0) {
+    // See if a newline follows
+    if (parseCtx.tokIsPrecededByNewline()) {
         funcBodyIsOnNewLine = true;
     }
     
@@ -120,14 +117,14 @@ Func * Func::parse(ParseCtx & parseCtx) {
     // the same line as the function signature:
     bool funcBodyMustBeOnNewLine = true;
     
-    if (parseCtx.tok()->type == TokenType::kDo) {
+    if (parseCtx.tokType() == TokenType::kDo) {
         // The function body doesn't have to be on a new line, have a 'do' token.
         // Skip this token and lift the newline restriction:
         parseCtx.nextTok();
         funcBodyMustBeOnNewLine = false;
         
-        // Skip any newlines that follow
-        if (parseCtx.skipNewlines() > 0) {
+        // See if a newline follows
+        if (parseCtx.tokIsPrecededByNewline()) {
             funcBodyIsOnNewLine = true;
         }
     }
@@ -142,11 +139,8 @@ Func * Func::parse(ParseCtx & parseCtx) {
     Scope * scope = Scope::parse(parseCtx);
     WC_GUARD(scope, nullptr);
     
-    // Skip any newlines that follow
-    parseCtx.skipNewlines();
-    
     // Must be terminated by an 'end' token
-    if (parseCtx.tok()->type != TokenType::kEnd) {
+    if (parseCtx.tokType() != TokenType::kEnd) {
         parseCtx.error("'end' expected to terminate function definition!");
         return nullptr;
     }
@@ -155,24 +149,27 @@ Func * Func::parse(ParseCtx & parseCtx) {
     const Token * endToken = parseCtx.tok();
     parseCtx.nextTok();
     
-    // Done: return the parsed function
-    return WC_NEW_AST_NODE(parseCtx,
-                           Func,
-                           *startToken,
-                           *identifier,
-                           std::move(funcArgs),
-                           returnType,
-                           *scope,
-                           *endToken);
+    // Done: return the parsed function, which is not inside of itself
+    parseCtx.setCurrentFunc(outerFunc);
+    return WC_NEW_RESERVED_AST_NODE(parseCtx,
+                                    func,
+                                    Func,
+                                    *startToken,
+                                    *identifier,
+                                    funcArgs.finish(),
+                                    returnType,
+                                    *scope,
+                                    *endToken);
 }
 
 Func::Func(const Token & startToken,
            Identifier & identifier,
-           std::vector<FuncArg*> && funcArgs,
+           const Span<FuncArg*> & funcArgs,
            Type * explicitReturnType,
            Scope & scope,
            const Token & endToken)
 :
+    mDeclId(kInvalidDeclId),
     mStartToken(startToken),
     mIdentifier(identifier),
     mFuncArgs(funcArgs),
@@ -6,11 +6,9 @@
 
 #pragma once
 
+#include "AST/NameBindings.hpp"
 #include "ASTNode.hpp"
-
-WC_THIRD_PARTY_INCLUDES_BEGIN
-    #include <vector>
-WC_THIRD_PARTY_INCLUDES_END
+#include "Span.hpp"
 
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
@@ -31,7 +29,7 @@ public:
     
     Func(const Token & startToken,
          Identifier & identifier,
-         std::vector<FuncArg*> && funcArgs,
+         const Span<FuncArg*> & funcArgs,
          Type * explicitReturnType,
          Scope & scope,
          const Token & endToken);
@@ -46,7 +44,7 @@ public:
         return mIdentifier;
     }
     
-    inline const std::vector<FuncArg*> & getArgs() const {
+    inline const Span<FuncArg*> & getArgs() const {
         return mFuncArgs;
     }
     
@@ -58,15 +56,18 @@ public:
         return mScope;
     }
     
+    /* The id of the declaration made by the function. Set by 'NameBinder', see 'NameBindings'. */
+    mutable DeclId mDeclId;
+    
 private:
     /* Start token for the function */
-    const Token & mStartToken;
+    const Token mStartToken;
     
     /* The function name identifier */
     Identifier & mIdentifier;
     
     /* The list of function arguments parsed */
-    std::vector<FuncArg*> mFuncArgs;
+    Span<FuncArg*> mFuncArgs;
     
     /**
      * The explicitly specified return type for this function.
@@ -78,7 +79,7 @@ private:
     Scope & mScope;
     
     /* The end token for the function */
-    const Token & mEndToken;
+    const Token mEndToken;
 };
 
 WC_AST_END_NAMESPACE
@@ -7,6 +7,7 @@
 #include "FuncArg.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "Identifier.hpp"
 #include "LinearAlloc.hpp"
@@ -16,23 +17,21 @@ WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
 bool FuncArg::peek(const Token * currentToken) {
-    return Identifier::peek(currentToken);
+    return FirstSets::kFuncArg.contains(currentToken->type);
 }
 
 FuncArg * FuncArg::parse(ParseCtx & parseCtx) {
-    // Parse the identifier and skip any newlines that follow:
+    // Parse the identifier:
     Identifier * ident = Identifier::parse(parseCtx);
     WC_GUARD(ident, nullptr);
-    parseCtx.skipNewlines();
     
     // Expect ':' following the identifier
-    if (parseCtx.tok()->type != TokenType::kColon) {
+    if (parseCtx.tokType() != TokenType::kColon) {
         parseCtx.error("expect ':' following argument name for function argument!");
         return nullptr;
     }
     
     parseCtx.nextTok();         // Skip ':'
-    parseCtx.skipNewlines();    // Skip any newlines that follow
     
     // Parse the data type
     Type * type = Type::parse(parseCtx);
@@ -44,7 +43,8 @@ FuncArg * FuncArg::parse(ParseCtx & parseCtx) {
 
 FuncArg::FuncArg(Type & type, Identifier & ident) :
     mType(type),
-    mIdent(ident)
+    mIdent(ident),
+    mDeclId(kInvalidDeclId)
 {
     mType.mParent = this;
     mIdent.mParent = this;
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "AST/NameBindings.hpp"
 #include "ASTNode.hpp"
 
 WC_BEGIN_NAMESPACE
@@ -33,6 +34,9 @@ public:
     
     Identifier &    mIdent;
     Type &          mType;
+    
+    /* The id of the declaration made by the argument. Set by 'NameBinder', see 'NameBindings'. */
+    mutable DeclId  mDeclId;
 };
 
 WC_AST_END_NAMESPACE
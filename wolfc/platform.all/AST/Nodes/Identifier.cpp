@@ -7,6 +7,7 @@
 #include "Identifier.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "LinearAlloc.hpp"
 
@@ -14,11 +15,11 @@ WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
 bool Identifier::peek(const Token * tokenPtr) {
-    return tokenPtr->type == TokenType::kIdentifier;
+    return FirstSets::kIdentifier.contains(tokenPtr->type);
 }
 
 Identifier * Identifier::parse(ParseCtx & parseCtx) {
-    if (parseCtx.tok()->type != TokenType::kIdentifier) {
+    if (parseCtx.tokType() != TokenType::kIdentifier) {
         parseCtx.error("Expected identifier!");
         return nullptr;
     }
@@ -28,7 +29,7 @@ Identifier * Identifier::parse(ParseCtx & parseCtx) {
     return intLit;
 }
 
-Identifier::Identifier(const Token & token) : mToken(token) {
+Identifier::Identifier(const Token & token) : mToken(token), mDeclId(kInvalidDeclId) {
     WC_EMPTY_FUNC_BODY();
 }
 
@@ -45,7 +46,11 @@ const Token & Identifier::getEndToken() const {
 }
 
 const char * Identifier::name() const {
-    return mToken.data.strVal.ptr;
+    return mToken.data.identData.name;
+}
+
+SymbolId Identifier::symbolId() const {
+    return mToken.data.identData.symbolId;
 }
 
 WC_AST_END_NAMESPACE
@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include "AST/NameBindings.hpp"
 #include "ASTNode.hpp"
 #include "IExpr.hpp"
+#include "Lexer/SymbolTable.hpp"
 
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
@@ -26,7 +28,16 @@ public:
     
     const char * name() const;
     
-    const Token & mToken;
+    /* The interned symbol id for the name of the identifier. Equal names have equal symbol ids. */
+    SymbolId symbolId() const;
+    
+    const Token mToken;
+    
+    /**
+     * The id of the declaration that the identifier refers to, or 'kInvalidDeclId' if it is unbound.
+     * Set by 'NameBinder', see 'NameBindings'.
+     */
+    mutable DeclId mDeclId;
 };
 
 WC_AST_END_NAMESPACE
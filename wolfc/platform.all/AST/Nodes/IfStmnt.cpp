@@ -7,6 +7,7 @@
 #include "IfStmnt.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "AssignExpr.hpp"
 #include "LinearAlloc.hpp"
@@ -19,8 +20,7 @@ WC_AST_BEGIN_NAMESPACE
 // IfStmnt
 //-----------------------------------------------------------------------------
 bool IfStmnt::peek(const Token * tokenPtr) {
-    TokenType tokenType = tokenPtr->type;
-    return tokenType == TokenType::kIf || tokenType == TokenType::kUnless;
+    return FirstSets::kIfStmnt.contains(tokenPtr->type);
 }
 
 IfStmnt * IfStmnt::parse(ParseCtx & parseCtx) {
@@ -31,21 +31,20 @@ IfStmnt * IfStmnt::parse(ParseCtx & parseCtx) {
     }
     
     // Skip the 'if' or 'unless' token and save location.
-    // Consume the 'if' or 'unless' token and skip any newlines that follow:
+    // Consume the 'if' or 'unless' token:
     const Token * startToken = parseCtx.tok();
     parseCtx.nextTok();
-    parseCtx.skipNewlines();
     
-    // Parse the if condition and skip any newlines that follow:
-    AssignExpr * ifExpr = AssignExpr::parse(parseCtx);
+    // Parse the if condition and see if a newline follows:
+    Expr * ifExpr = AssignExpr::parse(parseCtx);
     WC_GUARD(ifExpr, nullptr);
-    bool thenScopeIsOnNewLine = parseCtx.skipNewlines() > 0;
+    bool thenScopeIsOnNewLine = parseCtx.tokIsPrecededByNewline();
     
     // See if there is a 'then' following. This keyword is optional, but it allows the 'then' scope
     // to be on the same line as the enclosing if statement:
     bool thenScopeRequiresNL = true;
     
-    if (parseCtx.tok()->type == TokenType::kThen) {
+    if (parseCtx.tokType() == TokenType::kThen) {
         // Found a 'then' token: the 'then' scope is allowed to be on the same line:
         parseCtx.nextTok();
         thenScopeRequiresNL = false;
@@ -57,21 +56,21 @@ IfStmnt * IfStmnt::parse(ParseCtx & parseCtx) {
                        "'then' is used after the condition.");
     }
     
-    // Expect a scope following. Parse it and skip any newlines that follow:
+    // Expect a scope following. Parse it:
     Scope * thenScope = Scope::parse(parseCtx);
     WC_GUARD(thenScope, nullptr);
-    parseCtx.skipNewlines();
     
     // 2 possibilities here:
     //
     // 1: 'end' to end the current if block
     // 2: 'else' for an 'else' or 'else if' block.
-    if (parseCtx.tok()->type == TokenType::kElse) {
+    if (parseCtx.tokType() == TokenType::kElse) {
         // 2: 'else' or 'else if' block: consume the 'else' token.
         parseCtx.nextTok();
         
-        // See if there is another chained 'else if' or 'else unless'
-        if (IfStmnt::peek(parseCtx.tok())) {
+        // See if there is another chained 'else if' or 'else unless'.
+        // Note: the 'if' or 'unless' must be on the same line as the 'else' for this to be the case.
+        if (!parseCtx.tokIsPrecededByNewline() && IfStmnt::peek(parseCtx.tok())) {
             // 'else if' block: parse the if statement following the 'else':
             IfStmnt * outerIfStmnt = IfStmnt::parse(parseCtx);
             WC_GUARD(outerIfStmnt, nullptr);
@@ -85,25 +84,20 @@ IfStmnt * IfStmnt::parse(ParseCtx & parseCtx) {
                                    *startToken);
         }
         else {
-            // 'else' block: skip any newlines that follow:
-            parseCtx.skipNewlines();
-            
-            // 'else' may be followed by an optional 'do' to disambiguate
+            // 'else' block: 'else' may be followed by an optional 'do' to disambiguate
             // some parsing cases where it's not clear if we want an 'else' with a
             // child 'if' inside it's block or 'else if' instead:
-            if (parseCtx.tok()->type == TokenType::kDo) {
+            if (parseCtx.tokType() == TokenType::kDo) {
                 // Found an optional 'do' token - skip it:
                 parseCtx.nextTok();
             }
             
-            // Parse the scope for the 'else' block and skip any
-            // newlines that follow after it:
+            // Parse the scope for the 'else' block:
             Scope * elseScope = Scope::parse(parseCtx);
             WC_GUARD(elseScope, nullptr);
-            parseCtx.skipNewlines();
             
             // Else block should be terminated by an 'end' token:
-            if (parseCtx.tok()->type != TokenType::kEnd) {
+            if (parseCtx.tokType() != TokenType::kEnd) {
                 parseCtx.error("'end' expected to terminate 'else' block!");
                 return nullptr;
             }
@@ -124,7 +118,7 @@ IfStmnt * IfStmnt::parse(ParseCtx & parseCtx) {
     }
     else {
         // 1: 'if then' type statement: expect closing 'end'
-        if (parseCtx.tok()->type != TokenType::kEnd) {
+        if (parseCtx.tokType() != TokenType::kEnd) {
             parseCtx.error("'end' expected to terminate 'if' block!");
             return nullptr;
         }
@@ -143,7 +137,7 @@ IfStmnt * IfStmnt::parse(ParseCtx & parseCtx) {
     }
 }
 
-IfStmnt::IfStmnt(AssignExpr & ifExpr,
+IfStmnt::IfStmnt(Expr & ifExpr,
                  Scope & thenScope,
                  const Token & startToken)
 :
@@ -166,7 +160,7 @@ bool IfStmnt::isIfExprInversed() const {
 //-----------------------------------------------------------------------------
 // IfStmntNoElse
 //-----------------------------------------------------------------------------
-IfStmntNoElse::IfStmntNoElse(AssignExpr & ifExpr,
+IfStmntNoElse::IfStmntNoElse(Expr & ifExpr,
                              Scope & thenScope,
                              const Token & startToken,
                              const Token & endToken)
@@ -192,7 +186,7 @@ bool IfStmntNoElse::allCodepathsHaveUncondRet() const {
 //-----------------------------------------------------------------------------
 // IfStmntElse
 //-----------------------------------------------------------------------------
-IfStmntElse::IfStmntElse(AssignExpr & ifExpr,
+IfStmntElse::IfStmntElse(Expr & ifExpr,
                          Scope & thenScope,
                          Scope & elseScope,
                          const Token & startToken,
@@ -221,7 +215,7 @@ bool IfStmntElse::allCodepathsHaveUncondRet() const {
 //-----------------------------------------------------------------------------
 // IfStmntElseIf
 //-----------------------------------------------------------------------------
-IfStmntElseIf::IfStmntElseIf(AssignExpr & ifExpr,
+IfStmntElseIf::IfStmntElseIf(Expr & ifExpr,
                              Scope & thenScope,
                              IfStmnt & outerIfStmnt,
                              const Token & startToken)
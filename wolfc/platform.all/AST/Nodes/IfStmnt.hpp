@@ -12,7 +12,7 @@
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class AssignExpr;
+class Expr;
 class Scope;
 
 /*
@@ -26,7 +26,7 @@ public:
     static bool peek(const Token * tokenPtr);
     static IfStmnt * parse(ParseCtx & parseCtx);
     
-    IfStmnt(AssignExpr & ifExpr,
+    IfStmnt(Expr & ifExpr,
             Scope & thenScope,
             const Token & startToken);
     
@@ -38,15 +38,15 @@ public:
      */
     bool isIfExprInversed() const;
     
-    AssignExpr &    mIfExpr;
+    Expr &          mIfExpr;
     Scope &         mThenScope;
-    const Token &   mStartToken;
+    const Token     mStartToken;
 };
 
 /* if|unless AssignExpr [then] Scope end */
 class IfStmntNoElse final : public IfStmnt {
 public:
-    IfStmntNoElse(AssignExpr & ifExpr,
+    IfStmntNoElse(Expr & ifExpr,
                   Scope & thenScope,
                   const Token & startToken,
                   const Token & endToken);
@@ -57,13 +57,13 @@ public:
     
     virtual bool allCodepathsHaveUncondRet() const override;
     
-    const Token & mEndToken;
+    const Token mEndToken;
 };
 
 /* if|unless AssignExpr [then] Scope else [do] Scope end */
 class IfStmntElse final : public IfStmnt {
 public:
-    IfStmntElse(AssignExpr & ifExpr,
+    IfStmntElse(Expr & ifExpr,
                 Scope & thenScope,
                 Scope & elseScope,
                 const Token & startToken,
@@ -76,13 +76,13 @@ public:
     virtual bool allCodepathsHaveUncondRet() const override;
     
     Scope &         mElseScope;
-    const Token &   mEndToken;
+    const Token     mEndToken;
 };
 
 /* if|unless AssignExpr [then] Scope else IfStmnt */
 class IfStmntElseIf final : public IfStmnt {
 public:
-    IfStmntElseIf(AssignExpr & ifExpr,
+    IfStmntElseIf(Expr & ifExpr,
                   Scope & thenScope,
                   IfStmnt & elseIfStmnt,
                   const Token & startToken);
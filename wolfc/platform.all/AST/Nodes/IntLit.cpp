@@ -7,6 +7,7 @@
 #include "IntLit.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "LinearAlloc.hpp"
 
@@ -16,7 +17,7 @@ WC_AST_BEGIN_NAMESPACE
 // TODO: Make this be for ALL numeric literals
 
 bool IntLit::peek(const Token * tokenPtr) {
-    return tokenPtr->type == TokenType::kIntLit;
+    return FirstSets::kIntLit.contains(tokenPtr->type);
 }
 
 IntLit * IntLit::parse(ParseCtx & parseCtx) {
@@ -26,7 +26,7 @@ public:
     virtual const Token & getStartToken() const override;
     virtual const Token & getEndToken() const override;
     
-    const Token & mToken;
+    const Token mToken;
 };
 
 WC_AST_END_NAMESPACE
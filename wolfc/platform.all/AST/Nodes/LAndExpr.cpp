@@ -7,6 +7,7 @@
 #include "LAndExpr.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "LinearAlloc.hpp"
 #include "NotExpr.hpp"
@@ -18,53 +19,33 @@ WC_AST_BEGIN_NAMESPACE
 // LAndExpr
 //-----------------------------------------------------------------------------
 bool LAndExpr::peek(const Token * tokenPtr) {
-    return NotExpr::peek(tokenPtr);
+    return FirstSets::kLAndExpr.contains(tokenPtr->type);
 }
 
-LAndExpr * LAndExpr::parse(ParseCtx & parseCtx) {
+Expr * LAndExpr::parse(ParseCtx & parseCtx) {
     // Parse the initial expression
-    NotExpr * leftExpr = NotExpr::parse(parseCtx);
+    Expr * leftExpr = NotExpr::parse(parseCtx);
     WC_GUARD(leftExpr, nullptr);
     
-    // See if there is an 'and' for logical and
-    if (parseCtx.tok()->type == TokenType::kAnd) {
-        // And expression with and. Skip the 'and' and any newlines that follow
+    // See if there is an 'and' for logical and, which must be on the same line as the left operand
+    if (!parseCtx.tokIsPrecededByNewline() && parseCtx.tokType() == TokenType::kAnd) {
+        // And expression with and. Skip the 'and'
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
         
         // Parse the following and expression and create the AST node
-        LAndExpr * rightExpr = LAndExpr::parse(parseCtx);
+        Expr * rightExpr = LAndExpr::parse(parseCtx);
         WC_GUARD(rightExpr, nullptr);
         return WC_NEW_AST_NODE(parseCtx, LAndExprAnd, *leftExpr, *rightExpr);
     }
 
-    // Basic no-op expression
-    return WC_NEW_AST_NODE(parseCtx, LAndExprNoOp, *leftExpr);
-}
-
-//-----------------------------------------------------------------------------
-// LAndExprNoOp
-//-----------------------------------------------------------------------------
-LAndExprNoOp::LAndExprNoOp(NotExpr & expr) : mExpr(expr) {
-    mExpr.mParent = this;
-}
-
-void LAndExprNoOp::accept(ASTNodeVisitor & visitor) const {
-    visitor.visit(*this);
-}
-
-const Token & LAndExprNoOp::getStartToken() const {
-    return mExpr.getStartToken();
-}
-
-const Token & LAndExprNoOp::getEndToken() const {
-    return mExpr.getEndToken();
+    // No operator follows: the expression is just the left operand
+    return leftExpr;
 }
 
 //-----------------------------------------------------------------------------
 // LAndExprAnd
 //-----------------------------------------------------------------------------
-LAndExprAnd::LAndExprAnd(NotExpr & leftExpr, LAndExpr & rightExpr) :
+LAndExprAnd::LAndExprAnd(Expr & leftExpr, Expr & rightExpr) :
     mLeftExpr(leftExpr),
     mRightExpr(rightExpr)
 {
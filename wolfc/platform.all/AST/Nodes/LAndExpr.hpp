@@ -6,48 +6,33 @@
 
 #pragma once
 
-#include "ASTNode.hpp"
-#include "IExpr.hpp"
+#include "Expr.hpp"
 
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class NotExpr;
-
 /*
 LAndExpr:
     NotExpr
     NotExpr and LAndExpr
 */
-class LAndExpr : public ASTNode, public IExpr {
+class LAndExpr : public Expr {
 public:
     static bool peek(const Token * tokenPtr);
-    static LAndExpr * parse(ParseCtx & parseCtx);
-};
-
-/* NotExpr */
-class LAndExprNoOp final : public LAndExpr {
-public:
-    LAndExprNoOp(NotExpr & expr);
-    
-    virtual void accept(ASTNodeVisitor & visitor) const override;
-    virtual const Token & getStartToken() const override;
-    virtual const Token & getEndToken() const override;
-    
-    NotExpr & mExpr;
+    static Expr * parse(ParseCtx & parseCtx);
 };
 
 /* NotExpr and AndExpr */
 class LAndExprAnd final : public LAndExpr {
 public:
-    LAndExprAnd(NotExpr & leftExpr, LAndExpr & rightExpr);
+    LAndExprAnd(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
     virtual const Token & getStartToken() const override;
     virtual const Token & getEndToken() const override;
 
-    NotExpr &   mLeftExpr;
-    LAndExpr &  mRightExpr;
+    Expr &      mLeftExpr;
+    Expr &      mRightExpr;
 };
 
 WC_AST_END_NAMESPACE
@@ -7,6 +7,7 @@
 #include "LOrExpr.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "LAndExpr.hpp"
 #include "LinearAlloc.hpp"
@@ -18,53 +19,33 @@ WC_AST_BEGIN_NAMESPACE
 // LOrExpr
 //-----------------------------------------------------------------------------
 bool LOrExpr::peek(const Token * tokenPtr) {
-    return LAndExpr::peek(tokenPtr);
+    return FirstSets::kLOrExpr.contains(tokenPtr->type);
 }
 
-LOrExpr * LOrExpr::parse(ParseCtx & parseCtx) {
+Expr * LOrExpr::parse(ParseCtx & parseCtx) {
     // Parse the initial expression
-    LAndExpr * andExpr = LAndExpr::parse(parseCtx);
+    Expr * andExpr = LAndExpr::parse(parseCtx);
     WC_GUARD(andExpr, nullptr);
     
-    // See if there is an 'or' for logical or:
-    if (parseCtx.tok()->type == TokenType::kOr) {
-        // Or expression with or, skip the 'or' and any newlines that follow:
+    // See if there is an 'or' for logical or, which must be on the same line as the left operand:
+    if (!parseCtx.tokIsPrecededByNewline() && parseCtx.tokType() == TokenType::kOr) {
+        // Or expression with or, skip the 'or':
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
     
         // Parse the following and expression and create the AST node
-        LOrExpr * orExpr = LOrExpr::parse(parseCtx);
+        Expr * orExpr = LOrExpr::parse(parseCtx);
         WC_GUARD(orExpr, nullptr);
         return WC_NEW_AST_NODE(parseCtx, LOrExprOr, *andExpr, *orExpr);
     }
 
-    // Basic no-op expression
-    return WC_NEW_AST_NODE(parseCtx, LOrExprNoOp, *andExpr);
-}
-
-//-----------------------------------------------------------------------------
-// LOrExprNoOp
-//-----------------------------------------------------------------------------
-LOrExprNoOp::LOrExprNoOp(LAndExpr & expr) : mExpr(expr) {
-    mExpr.mParent = this;
-}
-
-void LOrExprNoOp::accept(ASTNodeVisitor & visitor) const {
-    visitor.visit(*this);
-}
-
-const Token & LOrExprNoOp::getStartToken() const {
-    return mExpr.getStartToken();
-}
-
-const Token & LOrExprNoOp::getEndToken() const {
-    return mExpr.getEndToken();
+    // No operator follows: the expression is just the left operand
+    return andExpr;
 }
 
 //-----------------------------------------------------------------------------
 // LOrExprOr
 //-----------------------------------------------------------------------------
-LOrExprOr::LOrExprOr(LAndExpr & leftExpr, LOrExpr & rightExpr) :
+LOrExprOr::LOrExprOr(Expr & leftExpr, Expr & rightExpr) :
     mLeftExpr(leftExpr),
     mRightExpr(rightExpr)
 {
@@ -6,48 +6,33 @@
 
 #pragma once
 
-#include "ASTNode.hpp"
-#include "IExpr.hpp"
+#include "Expr.hpp"
 
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class LAndExpr;
-
 /*
 LOrExpr:
     LAndExpr
     LAndExpr or LOrExpr
 */
-class LOrExpr : public ASTNode, public IExpr {
+class LOrExpr : public Expr {
 public:
     static bool peek(const Token * tokenPtr);
-    static LOrExpr * parse(ParseCtx & parseCtx);
-};
-
-/* LAndExpr */
-class LOrExprNoOp final : public LOrExpr {
-public:
-    LOrExprNoOp(LAndExpr & expr);
-    
-    virtual void accept(ASTNodeVisitor & visitor) const override;
-    virtual const Token & getStartToken() const override;
-    virtual const Token & getEndToken() const override;
-    
-    LAndExpr & mExpr;
+    static Expr * parse(ParseCtx & parseCtx);
 };
 
 /* LAndExpr or LOrExpr */
 class LOrExprOr final : public LOrExpr {
 public:
-    LOrExprOr(LAndExpr & leftExpr, LOrExpr & rightExpr);
+    LOrExprOr(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
     virtual const Token & getStartToken() const override;
     virtual const Token & getEndToken() const override;
     
-    LAndExpr &  mLeftExpr;
-    LOrExpr &   mRightExpr;
+    Expr &      mLeftExpr;
+    Expr &      mRightExpr;
 };
 
 WC_AST_END_NAMESPACE
@@ -7,6 +7,7 @@
 #include "LoopStmnt.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "AssignExpr.hpp"
 #include "LinearAlloc.hpp"
@@ -19,7 +20,7 @@ WC_AST_BEGIN_NAMESPACE
 // LoopStmnt
 //-----------------------------------------------------------------------------
 bool LoopStmnt::peek(const Token * tokenPtr) {
-    return tokenPtr->type == TokenType::kLoop;
+    return FirstSets::kLoopStmnt.contains(tokenPtr->type);
 }
 
 LoopStmnt * LoopStmnt::parse(ParseCtx & parseCtx) {
@@ -29,29 +30,24 @@ LoopStmnt * LoopStmnt::parse(ParseCtx & parseCtx) {
         return nullptr;
     }
     
-    // Skip the 'loop' token and save location, also skip any
-    // newlines which might follow:
+    // Skip the 'loop' token and save location:
     const Token * startToken = parseCtx.tok();
     parseCtx.nextTok();
-    parseCtx.skipNewlines();
     
-    // Parse the body scope and skip any newlines that follow:
+    // Parse the body scope:
     Scope * bodyScope = Scope::parse(parseCtx);
     WC_GUARD(bodyScope, nullptr);
-    parseCtx.skipNewlines();
     
     // See if the current token is 'repeat', if it is then we have a loop/repeat statement
-    if (parseCtx.tok()->type == TokenType::kRepeat) {
+    if (parseCtx.tokType() == TokenType::kRepeat) {
         // Loop block with a condition.
-        // Skip the 'repeat' keyword and any newlines that follow:
+        // Skip the 'repeat' keyword:
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
         
         // Now grab the condition type.
-        // Skip the condition keyword and any newlines that follow:
+        // Skip the condition keyword:
         const Token * condTypeToken = parseCtx.tok();
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
         
         if (condTypeToken->type != TokenType::kWhile && condTypeToken->type != TokenType::kUntil) {
             parseCtx.error("'while' or 'until' expected following 'repeat' token!");
@@ -59,7 +55,7 @@ LoopStmnt * LoopStmnt::parse(ParseCtx & parseCtx) {
         }
         
         // Now expect an assign expression as the condition
-        AssignExpr * loopCondExpr = AssignExpr::parse(parseCtx);
+        Expr * loopCondExpr = AssignExpr::parse(parseCtx);
         WC_GUARD(loopCondExpr, nullptr);
         
         // All done, return the parsed expression:
@@ -72,7 +68,7 @@ LoopStmnt * LoopStmnt::parse(ParseCtx & parseCtx) {
     }
     else {
         // Conditionless loop block: should be terminated by an 'end' token:
-        if (parseCtx.tok()->type != TokenType::kEnd) {
+        if (parseCtx.tokType() != TokenType::kEnd) {
             parseCtx.error("'end' expected to terminate 'loop' block!");
             return nullptr;
         }
@@ -125,7 +121,7 @@ const Token & LoopStmntNoCond::getEndToken() const {
 LoopStmntWithCond::LoopStmntWithCond(Scope & bodyScope,
                                      const Token & startToken,
                                      const Token & condTypeToken,
-                                     AssignExpr & loopCondExpr)
+                                     Expr & loopCondExpr)
 :
     LoopStmnt(bodyScope, startToken),
     mCondTypeToken(condTypeToken),
@@ -12,7 +12,7 @@
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class AssignExpr;
+class Expr;
 
 /*
 LoopStmnt:
@@ -31,7 +31,7 @@ public:
     virtual bool allCodepathsHaveUncondRet() const override;
     
     Scope &         mBodyScope;
-    const Token &   mStartToken;
+    const Token     mStartToken;
 };
 
 /* loop Scope end */
@@ -42,7 +42,7 @@ public:
     virtual void accept(ASTNodeVisitor & visitor) const override;
     virtual const Token & getEndToken() const override;
     
-    const Token & mEndToken;
+    const Token mEndToken;
 };
 
 /* loop Scope repeat while|until AssignExpr */
@@ -51,7 +51,7 @@ public:
     LoopStmntWithCond(Scope & bodyScope,
                       const Token & startToken,
                       const Token & condTypeToken,
-                      AssignExpr & loopCondExpr);
+                      Expr & loopCondExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
     virtual const Token & getEndToken() const override;
@@ -62,8 +62,8 @@ public:
      */
     bool isLoopCondInversed() const;
     
-    const Token &   mCondTypeToken;
-    AssignExpr &    mLoopCondExpr;
+    const Token     mCondTypeToken;
+    Expr &          mLoopCondExpr;
 };
 
 WC_AST_END_NAMESPACE
@@ -8,6 +8,7 @@
 
 #include "../ASTNodeVisitor.hpp"
 #include "../ParseCtx.hpp"
+#include "../ScratchList.hpp"
 #include "DeclDef.hpp"
 #include "LinearAlloc.hpp"
 
@@ -15,85 +16,111 @@ WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
 Module * Module::parse(ParseCtx & parseCtx) {
-    // Skip any newlines and commas (decldef separators) that follow:
-    parseCtx.skipNewlinesAndCommas();
+    // Skip any commas (decldef separators) that follow:
+    parseCtx.skipSeparators();
     
     // Parse a list of decldefs for the module.
     // Try to parse as many as possible so we get multiple error messages for various problems.
-    std::vector<DeclDef*> declDefs;
+    ScratchList<DeclDef> declDefs(parseCtx);
     bool requireNewlineBetweenDeclDefs = false;
     
-    while (parseCtx.tok()->type != TokenType::kEOF) {
-        // Save this in case we need it later
-        const Token * startTok = parseCtx.tok();
+    while (parseCtx.tokType() != TokenType::kEOF) {
+        // Everything before this decldef has been parsed, so the tokens for it are no longer needed
+        parseCtx.commitTokens();
         
-        // Try to parse the decldef
-        DeclDef * declDef = DeclDef::parse(parseCtx);
+        // Parse the decldef and save it, if it didn't fail to parse
+        const DeclDef * prevDeclDef = (declDefs.size() > 0) ? declDefs.back() : nullptr;
+        DeclDef * declDef = parseTopLevelElem(parseCtx, prevDeclDef, requireNewlineBetweenDeclDefs);
         
         if (declDef) {
-            // Each subsequent decldef must be put on a new line, if we find
-            // that not to be the case then issue errors:
-            //
-            // TODO: Allow commas to enable multiple decldefs per line
-            if (requireNewlineBetweenDeclDefs) {
-                DeclDef * lastDeclDef = declDefs.back();
-                const Token & thisDeclDefStart = declDef->getStartToken();
-                const Token & prevDeclDefEnd = lastDeclDef->getEndToken();
-                
-                if (thisDeclDefStart.startLine <= prevDeclDefEnd.startLine) {
-                    parseCtx.error("Top level declarations/definitions must be separated onto different lines, or by ','! "
-                                   "The declaration/definition starting at line %zu, col %zu is on the same line as "
-                                   "the declaration/definition ending at line %zu, col %zu!",
-                                   thisDeclDefStart.startLine + 1,
-                                   thisDeclDefStart.startCol + 1,
-                                   prevDeclDefEnd.startLine + 1,
-                                   prevDeclDefEnd.startCol + 1);
-                }
-            }
+            declDefs.push(declDef);
+        }
+    }
+    
+    // Okay, create and return the module
+    return WC_NEW_AST_NODE(parseCtx, Module, declDefs.finish(), *parseCtx.tok());
+}
+
+DeclDef * Module::parseTopLevelElem(ParseCtx & parseCtx, const DeclDef * prevDeclDef, bool & requireNewline) {
+    // Save this in case we need it later
+    const Token * startTok = parseCtx.tok();
+    
+    // Try to parse the decldef. Mark where its nodes begin, so they can be freed if it fails to parse.
+    ParseCtx::ASTNodeMark declDefMark = parseCtx.markASTNodes();
+    DeclDef * declDef = DeclDef::parse(parseCtx);
+    
+    if (declDef) {
+        // Each subsequent decldef must be put on a new line, if we find
+        // that not to be the case then issue errors:
+        //
+        // TODO: Allow commas to enable multiple decldefs per line
+        if (requireNewline) {
+            WC_ASSERT(prevDeclDef);
+            const Token & thisDeclDefStart = declDef->getStartToken();
+            const Token & prevDeclDefEnd = prevDeclDef->getEndToken();
             
-            // Save the decldef which was parsed
-            declDefs.push_back(declDef);
+            const SourceLineIndex & srcLineIndex = parseCtx.getSrcLineIndex();
             
-            // Skip any newlines and commas that folllow. If any newlines or commas are found, these reset the
-            // requirement for the next decldef to be on a new line.
-            if (parseCtx.skipNewlinesAndCommas() > 0) {
-                requireNewlineBetweenDeclDefs = false;
-            }
-            else {
-                requireNewlineBetweenDeclDefs = true;
+            if (srcLineIndex.getLine(thisDeclDefStart.startSrcOffset) <=
+                srcLineIndex.getLine(prevDeclDefEnd.startSrcOffset))
+            {
+                SourceLoc thisDeclDefStartLoc = srcLineIndex.getLoc(thisDeclDefStart.startSrcOffset);
+                SourceLoc prevDeclDefEndLoc = srcLineIndex.getLoc(prevDeclDefEnd.startSrcOffset);
+                parseCtx.error(thisDeclDefStart,
+                               "Top level declarations/definitions must be separated onto different lines, or by ','! "
+                               "The declaration/definition starting at line %zu, col %zu is on the same line as "
+                               "the declaration/definition ending at line %zu, col %zu!",
+                               size_t(thisDeclDefStartLoc.line) + 1,
+                               size_t(thisDeclDefStartLoc.col) + 1,
+                               size_t(prevDeclDefEndLoc.line) + 1,
+                               size_t(prevDeclDefEndLoc.col) + 1);
             }
         }
+        
+        // Skip any commas that folllow. If any newlines or commas are found, these reset the
+        // requirement for the next decldef to be on a new line.
+        if (parseCtx.skipSeparators()) {
+            requireNewline = false;
+        }
         else {
-            // Just in case the code failed to emit an error
-            if (!parseCtx.hasErrors()) {
-                parseCtx.error(*startTok, "Failed to parse a top level module element! Exact error unknown.");
-            }
-            
-            // Skip junk when getting a DeclDef failed:
-            while (parseCtx.tok()->type != TokenType::kEOF) {
-                if (DeclDef::peek(parseCtx.tok())) {
-                    break;
-                }
-                
-                // Skip both the token and any newlines and commas that follow it
-                parseCtx.nextTok();
-                
-                if (parseCtx.skipNewlinesAndCommas() > 0) {
-                    requireNewlineBetweenDeclDefs = false;
-                }
-            }
+            requireNewline = true;
         }
+        
+        return declDef;
     }
     
-    // Okay, create and return the module
-    return WC_NEW_AST_NODE(parseCtx, Module, std::move(declDefs), *parseCtx.tok());
+    // Nothing refers to the nodes created for the failed decldef, throw them away
+    parseCtx.rollbackASTNodes(declDefMark);
+    
+    // Just in case the code failed to emit an error
+    if (!parseCtx.hasErrors()) {
+        parseCtx.error(*startTok, "Failed to parse a top level module element! Exact error unknown.");
+    }
+    
+    // Skip junk when getting a DeclDef failed:
+    while (parseCtx.tokType() != TokenType::kEOF) {
+        if (DeclDef::peek(parseCtx.tok())) {
+            break;
+        }
+        
+        // Skip both the token and any commas that follow it
+        parseCtx.nextTok();
+        
+        if (parseCtx.skipSeparators()) {
+            requireNewline = false;
+        }
+    }
+    
+    return nullptr;
 }
 
-Module::Module(std::vector<DeclDef*> && declDefs, const Token & eofToken) :
+Module::Module(const Span<DeclDef*> & declDefs, const Token & eofToken) :
     mDeclDefs(declDefs),
     mEOFToken(eofToken)
 {
-    WC_EMPTY_FUNC_BODY();
+    for (DeclDef * declDef : mDeclDefs) {
+        declDef->mParent = this;
+    }
 }
 
 void Module::accept(ASTNodeVisitor & visitor) const {
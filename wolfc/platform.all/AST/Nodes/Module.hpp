@@ -8,11 +8,11 @@
 
 #include "ASTNode.hpp"
 #include "Assert.hpp"
+#include "Span.hpp"
 
 WC_THIRD_PARTY_INCLUDES_BEGIN
     #include <map>
     #include <memory>
-    #include <vector>
 WC_THIRD_PARTY_INCLUDES_END
 
 WC_BEGIN_NAMESPACE
@@ -34,18 +34,28 @@ public:
     /* Parse the code for the module from the given parse context */
     static Module * parse(ParseCtx & parseCtx);
     
-    Module(std::vector<DeclDef*> && mDeclDefs, const Token & eofToken);
+    /**
+     * Parse one top level element of the module at the current token: either a decldef, or something which fails
+     * to parse, in which case an error is emitted and the junk following is skipped. Returns the decldef parsed, or
+     * null on failure. Also used by 'IncrementalParser' to parse just part of a module again.
+     *
+     * If 'requireNewline' is set then the element must be on a new line from the previous decldef parsed, which
+     * must then be given. This is updated for the element following, depending on the separators after this one.
+     */
+    static DeclDef * parseTopLevelElem(ParseCtx & parseCtx, const DeclDef * prevDeclDef, bool & requireNewline);
+    
+    Module(const Span<DeclDef*> & declDefs, const Token & eofToken);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
     virtual const Token & getStartToken() const override;
     virtual const Token & getEndToken() const override;
     
     /* All declarations and definitions in the module/ */
-    const std::vector<DeclDef*> mDeclDefs;
+    const Span<DeclDef*> mDeclDefs;
     
 private:
     /* The EOF token */
-    const Token & mEOFToken;
+    const Token mEOFToken;
 };
 
 WC_AST_END_NAMESPACE
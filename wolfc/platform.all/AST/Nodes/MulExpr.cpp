@@ -7,6 +7,7 @@
 #include "MulExpr.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "LinearAlloc.hpp"
 #include "ShiftExpr.hpp"
@@ -18,13 +19,18 @@ WC_AST_BEGIN_NAMESPACE
 // MulExpr
 //-----------------------------------------------------------------------------
 bool MulExpr::peek(const Token * tokenPtr) {
-    return ShiftExpr::peek(tokenPtr);
+    return FirstSets::kMulExpr.contains(tokenPtr->type);
 }
 
-MulExpr * MulExpr::parse(ParseCtx & parseCtx) {
-    ShiftExpr * leftExpr = ShiftExpr::parse(parseCtx);
+Expr * MulExpr::parse(ParseCtx & parseCtx) {
+    Expr * leftExpr = ShiftExpr::parse(parseCtx);
     WC_GUARD(leftExpr, nullptr);
     
+    // Operators must be on the same line as the left operand: a newline before the operator ends the expression
+    if (parseCtx.tokIsPrecededByNewline()) {
+        return leftExpr;
+    }
+    
     // See if there is a known operator ahead.
     // If we find a known operator parse the operator token, the right operand and
     // return the AST node for the operation.
@@ -32,15 +38,13 @@ MulExpr * MulExpr::parse(ParseCtx & parseCtx) {
         case TokenType: {\
             /* Consume the operator token */\
             parseCtx.nextTok();\
-            /* Skip any newlines that follow */\
-            parseCtx.skipNewlines();\
             /* Parse the right side of the operator */\
-            MulExpr * rightExpr = MulExpr::parse(parseCtx);\
+            Expr * rightExpr = MulExpr::parse(parseCtx);\
             WC_GUARD(rightExpr, nullptr);\
             return WC_NEW_AST_NODE(parseCtx, ASTNodeType, *leftExpr, *rightExpr);\
         }
 
-    switch (parseCtx.tok()->type) {
+    switch (parseCtx.tokType()) {
         PARSE_OP(TokenType::kAsterisk, MulExprMul)      // *
         PARSE_OP(TokenType::kSlash, MulExprDiv)         // /
         PARSE_OP(TokenType::kPercent, MulExprRem)       // %
@@ -50,33 +54,14 @@ MulExpr * MulExpr::parse(ParseCtx & parseCtx) {
             break;
     }
     
-    // Basic no-op expression:
-    return WC_NEW_AST_NODE(parseCtx, MulExprNoOp, *leftExpr);
-}
-
-//-----------------------------------------------------------------------------
-// MulExprNoOp
-//-----------------------------------------------------------------------------
-MulExprNoOp::MulExprNoOp(ShiftExpr & expr) : mExpr(expr) {
-    mExpr.mParent = this;
-}
-
-void MulExprNoOp::accept(ASTNodeVisitor & visitor) const {
-    visitor.visit(*this);
-}
-
-const Token & MulExprNoOp::getStartToken() const {
-    return mExpr.getStartToken();
-}
-
-const Token & MulExprNoOp::getEndToken() const {
-    return mExpr.getEndToken();
+    // No operator follows: the expression is just the left operand
+    return leftExpr;
 }
 
 //-----------------------------------------------------------------------------
 // MulExprTwoOps
 //-----------------------------------------------------------------------------
-MulExprTwoOps::MulExprTwoOps(ShiftExpr & leftExpr, MulExpr & rightExpr) :
+MulExprTwoOps::MulExprTwoOps(Expr & leftExpr, Expr & rightExpr) :
     mLeftExpr(leftExpr),
     mRightExpr(rightExpr)
 {
@@ -95,7 +80,7 @@ const Token & MulExprTwoOps::getEndToken() const {
 //-----------------------------------------------------------------------------
 // MulExprMul
 //-----------------------------------------------------------------------------
-MulExprMul::MulExprMul(ShiftExpr & leftExpr, MulExpr & rightExpr) :
+MulExprMul::MulExprMul(Expr & leftExpr, Expr & rightExpr) :
     MulExprTwoOps(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -108,7 +93,7 @@ void MulExprMul::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // MulExprDiv
 //-----------------------------------------------------------------------------
-MulExprDiv::MulExprDiv(ShiftExpr & leftExpr, MulExpr & rightExpr) :
+MulExprDiv::MulExprDiv(Expr & leftExpr, Expr & rightExpr) :
     MulExprTwoOps(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -121,7 +106,7 @@ void MulExprDiv::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // MulExprRem
 //-----------------------------------------------------------------------------
-MulExprRem::MulExprRem(ShiftExpr & leftExpr, MulExpr & rightExpr) :
+MulExprRem::MulExprRem(Expr & leftExpr, Expr & rightExpr) :
     MulExprTwoOps(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -134,7 +119,7 @@ void MulExprRem::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // MulExprBAnd
 //-----------------------------------------------------------------------------
-MulExprBAnd::MulExprBAnd(ShiftExpr & leftExpr, MulExpr & rightExpr) :
+MulExprBAnd::MulExprBAnd(Expr & leftExpr, Expr & rightExpr) :
     MulExprTwoOps(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -6,14 +6,11 @@
 
 #pragma once
 
-#include "ASTNode.hpp"
-#include "IExpr.hpp"
+#include "Expr.hpp"
 
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class ShiftExpr;
-
 /*
 MulExpr:
     ShiftExpr
@@ -21,40 +18,28 @@ MulExpr:
     ShiftExpr / MulExpr
     ShiftExpr % MulExpr
 */
-class MulExpr : public ASTNode, public IExpr {
+class MulExpr : public Expr {
 public:
     static bool peek(const Token * tokenPtr);
-    static MulExpr * parse(ParseCtx & parseCtx);
-};
-
-/* ShiftExpr */
-class MulExprNoOp final : public MulExpr {
-public:
-    MulExprNoOp(ShiftExpr & expr);
-    
-    virtual void accept(ASTNodeVisitor & visitor) const override;
-    virtual const Token & getStartToken() const override;
-    virtual const Token & getEndToken() const override;
-    
-    ShiftExpr & mExpr;
+    static Expr * parse(ParseCtx & parseCtx);
 };
 
 /* Base class for an MulExpr with two operands */
 class MulExprTwoOps : public MulExpr {
 public:
-    MulExprTwoOps(ShiftExpr & leftExpr, MulExpr & rightExpr);
+    MulExprTwoOps(Expr & leftExpr, Expr & rightExpr);
     
     virtual const Token & getStartToken() const final override;
     virtual const Token & getEndToken() const final override;
     
-    ShiftExpr & mLeftExpr;
-    MulExpr &   mRightExpr;
+    Expr & mLeftExpr;
+    Expr &      mRightExpr;
 };
 
 /* ShiftExpr * MulExpr */
 class MulExprMul final : public MulExprTwoOps {
 public:
-    MulExprMul(ShiftExpr & leftExpr, MulExpr & rightExpr);
+    MulExprMul(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -62,7 +47,7 @@ public:
 /* ShiftExpr / MulExpr */
 class MulExprDiv final : public MulExprTwoOps {
 public:
-    MulExprDiv(ShiftExpr & leftExpr, MulExpr & rightExpr);
+    MulExprDiv(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -70,7 +55,7 @@ public:
 /* ShiftExpr % MulExpr */
 class MulExprRem final : public MulExprTwoOps {
 public:
-    MulExprRem(ShiftExpr & leftExpr, MulExpr & rightExpr);
+    MulExprRem(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -78,7 +63,7 @@ public:
 /* ShiftExpr & MulExpr */
 class MulExprBAnd final : public MulExprTwoOps {
 public:
-    MulExprBAnd(ShiftExpr & leftExpr, MulExpr & rightExpr);
+    MulExprBAnd(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -7,6 +7,7 @@
 #include "NextStmnt.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "AssignExpr.hpp"
 #include "LinearAlloc.hpp"
@@ -18,7 +19,7 @@ WC_AST_BEGIN_NAMESPACE
 // NextStmnt
 //-----------------------------------------------------------------------------
 bool NextStmnt::peek(const Token * tokenPtr) {
-    return tokenPtr->type == TokenType::kNext;
+    return FirstSets::kNextStmnt.contains(tokenPtr->type);
 }
 
 NextStmnt * NextStmnt::parse(ParseCtx & parseCtx) {
@@ -32,15 +33,16 @@ NextStmnt * NextStmnt::parse(ParseCtx & parseCtx) {
     const Token * nextTok = parseCtx.tok();
     parseCtx.nextTok();
     
-    // See whether 'if' or 'unless' follow, in which case the 'next' statement is conditional:
-    if (parseCtx.tok()->type == TokenType::kIf || parseCtx.tok()->type == TokenType::kUnless) {
-        // Parse the condition token and skip any newlines that follow:
+    // See whether 'if' or 'unless' follow on the same line, in which case the 'next' statement is conditional:
+    if (!parseCtx.tokIsPrecededByNewline() &&
+        (parseCtx.tokType() == TokenType::kIf || parseCtx.tokType() == TokenType::kUnless))
+    {
+        // Parse the condition token:
         const Token * condTok = parseCtx.tok();
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
         
         // Parse the condition assign expression:
-        AssignExpr * condExpr = AssignExpr::parse(parseCtx);
+        Expr * condExpr = AssignExpr::parse(parseCtx);
         WC_GUARD(condExpr, nullptr);
         
         // 'next' with a condition:
@@ -83,7 +85,7 @@ bool NextStmntNoCond::allCodepathsHaveUncondRet() const {
 //-----------------------------------------------------------------------------
 NextStmntWithCond::NextStmntWithCond(const Token & nextToken,
                                      const Token & condToken,
-                                     AssignExpr & condExpr)
+                                     Expr & condExpr)
 :
     NextStmnt(nextToken),
     mCondToken(condToken),
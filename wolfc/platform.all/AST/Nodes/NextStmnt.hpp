@@ -12,7 +12,7 @@
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class AssignExpr;
+class Expr;
 
 /*
 NextStmnt:
@@ -29,7 +29,7 @@ public:
     virtual const Token & getStartToken() const final override;
     
     /* The 'next' token */
-    const Token & mNextToken;
+    const Token mNextToken;
 };
 
 /* next */
@@ -48,7 +48,7 @@ class NextStmntWithCond final : public NextStmnt {
 public:
     NextStmntWithCond(const Token & nextToken,
                       const Token & condToken,
-                      AssignExpr & condExpr);
+                      Expr & condExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
     virtual const Token & getEndToken() const override;
@@ -59,10 +59,10 @@ public:
     bool isIfCondInverted() const;
 
     /* This is either 'if' or 'unless' (inverted condition) */
-    const Token & mCondToken;
+    const Token mCondToken;
 
     /* The condition expression itself */
-    AssignExpr & mCondExpr;
+    Expr & mCondExpr;
 };
 
 WC_AST_END_NAMESPACE
@@ -7,6 +7,7 @@
 #include "NoOpStmnt.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "LinearAlloc.hpp"
 
@@ -14,12 +15,12 @@ WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
 bool NoOpStmnt::peek(const Token * tokenPtr) {
-    return tokenPtr->type == TokenType::kNoOp;
+    return FirstSets::kNoOpStmnt.contains(tokenPtr->type);
 }
 
 NoOpStmnt * NoOpStmnt::parse(ParseCtx & parseCtx) {
     // Parse the initial 'noop'
-    if (parseCtx.tok()->type != TokenType::kNoOp) {
+    if (parseCtx.tokType() != TokenType::kNoOp) {
         parseCtx.error("'noop' statement expected!");
         return nullptr;
     }
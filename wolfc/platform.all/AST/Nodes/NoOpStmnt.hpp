@@ -29,7 +29,7 @@ public:
     
     virtual bool allCodepathsHaveUncondRet() const override;
     
-    const Token & mToken;
+    const Token mToken;
 };
 
 WC_AST_END_NAMESPACE
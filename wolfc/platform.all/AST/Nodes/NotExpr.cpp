@@ -7,6 +7,7 @@
 #include "NotExpr.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "CmpExpr.hpp"
 #include "LinearAlloc.hpp"
@@ -18,72 +19,45 @@ WC_AST_BEGIN_NAMESPACE
 // NotExpr
 //-----------------------------------------------------------------------------
 bool NotExpr::peek(const Token * tokenPtr) {
-    TokenType tokenType = tokenPtr->type;
-    
-    return  tokenType == TokenType::kNot ||
-            tokenType == TokenType::kTilde ||
-            CmpExpr::peek(tokenPtr);
+    return FirstSets::kNotExpr.contains(tokenPtr->type);
 }
 
-NotExpr * NotExpr::parse(ParseCtx & parseCtx) {
+Expr * NotExpr::parse(ParseCtx & parseCtx) {
     // Save the first token:
     const Token * startToken = parseCtx.tok();
     
     // See if an actual 'not' or bitwise not ('~') expression:
     if (startToken->type == TokenType::kNot) {
-        // Logical 'not': skip 'not' and any newlines that follow
+        // Logical 'not': skip 'not'
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
         
         // Parse the expression following
-        NotExpr * notExpr = NotExpr::parse(parseCtx);
+        Expr * notExpr = NotExpr::parse(parseCtx);
         WC_GUARD(notExpr, nullptr);
         
         // Alright, return the parsed expr
         return WC_NEW_AST_NODE(parseCtx, NotExprLNot, *notExpr, *startToken);
     }
     else if (startToken->type == TokenType::kTilde) {
-        // Bitwise '~' (not): skip '~' and any newlines that follow
+        // Bitwise '~' (not): skip '~'
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
 
         // Parse the expression following
-        NotExpr * notExpr = NotExpr::parse(parseCtx);
+        Expr * notExpr = NotExpr::parse(parseCtx);
         WC_GUARD(notExpr, nullptr);
 
         // Alright, return the parsed expr
         return WC_NEW_AST_NODE(parseCtx, NotExprBNot, *notExpr, *startToken);
     }
     
-    // No 'not'. Just parse an ordinary no-op expression
-    CmpExpr * addSubExpr = CmpExpr::parse(parseCtx);
-    WC_GUARD(addSubExpr, nullptr);
-    return WC_NEW_AST_NODE(parseCtx, NotExprNoOp, *addSubExpr);
-}
-
-//-----------------------------------------------------------------------------
-// NotExprNoOp
-//-----------------------------------------------------------------------------
-NotExprNoOp::NotExprNoOp(CmpExpr & expr) : mExpr(expr) {
-    mExpr.mParent = this;
-}
-
-void NotExprNoOp::accept(ASTNodeVisitor & visitor) const {
-    visitor.visit(*this);
-}
-
-const Token & NotExprNoOp::getStartToken() const {
-    return mExpr.getStartToken();
-}
-
-const Token & NotExprNoOp::getEndToken() const {
-    return mExpr.getEndToken();
+    // No 'not'. Just parse an ordinary comparison expression
+    return CmpExpr::parse(parseCtx);
 }
 
 //-----------------------------------------------------------------------------
 // NotExprLNot
 //-----------------------------------------------------------------------------
-NotExprLNot::NotExprLNot(NotExpr & expr, const Token & startToken) :
+NotExprLNot::NotExprLNot(Expr & expr, const Token & startToken) :
     mExpr(expr),
     mStartToken(startToken)
 {
@@ -105,7 +79,7 @@ const Token & NotExprLNot::getEndToken() const {
 //-----------------------------------------------------------------------------
 // NotExprBNot
 //-----------------------------------------------------------------------------
-NotExprBNot::NotExprBNot(NotExpr & expr, const Token & startToken) :
+NotExprBNot::NotExprBNot(Expr & expr, const Token & startToken) :
     mExpr(expr),
     mStartToken(startToken)
 {
@@ -7,6 +7,7 @@
 #include "NullLit.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "LinearAlloc.hpp"
 
@@ -14,7 +15,7 @@ WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
 bool NullLit::peek(const Token * tokenPtr) {
-    return tokenPtr->type == TokenType::kNull;
+    return FirstSets::kNullLit.contains(tokenPtr->type);
 }
 
 NullLit * NullLit::parse(ParseCtx & parseCtx) {
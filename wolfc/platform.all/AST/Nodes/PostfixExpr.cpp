@@ -7,7 +7,9 @@
 #include "PostfixExpr.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
+#include "../ScratchList.hpp"
 #include "AssignExpr.hpp"
 #include "CastExpr.hpp"
 #include "LinearAlloc.hpp"
@@ -19,22 +21,26 @@ WC_AST_BEGIN_NAMESPACE
 // PostfixExpr
 //-----------------------------------------------------------------------------
 bool PostfixExpr::peek(const Token * currentToken) {
-    return CastExpr::peek(currentToken);
+    return FirstSets::kPostfixExpr.contains(currentToken->type);
 }
 
-PostfixExpr * PostfixExpr::parse(ParseCtx & parseCtx) {
+Expr * PostfixExpr::parse(ParseCtx & parseCtx) {
     // Parse the initial expression
-    CastExpr * initialCastExpr = CastExpr::parse(parseCtx);
+    Expr * initialCastExpr = CastExpr::parse(parseCtx);
     WC_GUARD(initialCastExpr, nullptr);
 
-    // Save the outermost postfix expression here:
-    PostfixExpr * outerPostfixExpr = WC_NEW_AST_NODE(parseCtx, PostfixExprNoOp, *initialCastExpr);
-    WC_ASSERT(outerPostfixExpr);
+    // Save the outermost postfix expression here, which starts off as just the initial expression:
+    Expr * outerPostfixExpr = initialCastExpr;
     
     // Continue parsing and wrapping function calls, array lookups and
     // increment/decrement etc. while we can...
     while (true) {
-        if (parseCtx.tok()->type == TokenType::kIncrement) {
+        // Postfix operators must be on the same line as the expression they apply to, a newline ends the expression
+        if (parseCtx.tokIsPrecededByNewline()) {
+            break;
+        }
+        
+        if (parseCtx.tokType() == TokenType::kIncrement) {
             // Increment '++' operator. Consume the '++' token and save:
             const Token * endToken = parseCtx.tok();
             parseCtx.nextTok();
@@ -43,7 +49,7 @@ PostfixExpr * PostfixExpr::parse(ParseCtx & parseCtx) {
             outerPostfixExpr = WC_NEW_AST_NODE(parseCtx, PostfixExprInc, *outerPostfixExpr, *endToken);
             WC_ASSERT(outerPostfixExpr);
         }
-        else if (parseCtx.tok()->type == TokenType::kDecrement) {
+        else if (parseCtx.tokType() == TokenType::kDecrement) {
             // Decrement '--' operator. Consume the '--' token and save:
             const Token * endToken = parseCtx.tok();
             parseCtx.nextTok();
@@ -52,35 +58,30 @@ PostfixExpr * PostfixExpr::parse(ParseCtx & parseCtx) {
             outerPostfixExpr = WC_NEW_AST_NODE(parseCtx, PostfixExprDec, *outerPostfixExpr, *endToken);
             WC_ASSERT(outerPostfixExpr);
         }
-        else if (parseCtx.tok()->type == TokenType::kLParen) {
+        else if (parseCtx.tokType() == TokenType::kLParen) {
             // Function call follows:
-            // Save and consume the '(' token as well as newlines following:
+            // Save and consume the '(' token:
             const Token * openingParen = parseCtx.tok();
             parseCtx.nextTok();
-            parseCtx.skipNewlines();
             
             // Start parsing the arg list
-            std::vector<AssignExpr*> argExprs;
+            ScratchList<Expr> argExprs(parseCtx);
 
             while (AssignExpr::peek(parseCtx.tok())) {
-                // Parse the arg and save if it was parsed ok,
-                // also skip any newlines that follow:
-                AssignExpr * argExpr = AssignExpr::parse(parseCtx);
-                parseCtx.skipNewlines();
+                // Parse the arg and save if it was parsed ok:
+                Expr * argExpr = AssignExpr::parse(parseCtx);
                 
                 if (argExpr) {
-                    argExprs.push_back(argExpr);
+                    argExprs.push(argExpr);
                 }
                 
                 // If a comma does not follow then we are done
-                if (parseCtx.tok()->type != TokenType::kComma) {
+                if (parseCtx.tokType() != TokenType::kComma) {
                     break;
                 }
                 
-                // Otherwise continue parsing and skip ',' as well
-                // as any newlines which might follow:
+                // Otherwise continue parsing and skip ',':
                 parseCtx.nextTok();
-                parseCtx.skipNewlines();
             }
             
             // Expect ')'
@@ -101,21 +102,19 @@ PostfixExpr * PostfixExpr::parse(ParseCtx & parseCtx) {
                                                    PostfixExprFuncCall,
                                                    *outerPostfixExpr,
                                                    *openingParen,
-                                                   argExprs,
+                                                   argExprs.finish(),
                                                    *closingParen);
             }
         }
-        else if (parseCtx.tok()->type == TokenType::kLBrack) {
-            // An array lookup follows, skip the '[' and any newlines that follow.
+        else if (parseCtx.tokType() == TokenType::kLBrack) {
+            // An array lookup follows, skip the '['.
             // Expect '[' to be here based on previous if() failing - see while loop.
-            WC_ASSERT(parseCtx.tok()->type == TokenType::kLBrack);
+            WC_ASSERT(parseCtx.tokType() == TokenType::kLBrack);
             parseCtx.nextTok();
-            parseCtx.skipNewlines();
             
-            // Parse the assign expression for the array index and skip any newlines that follow
-            AssignExpr * arrayIndexExpr = AssignExpr::parse(parseCtx);
+            // Parse the assign expression for the array index
+            Expr * arrayIndexExpr = AssignExpr::parse(parseCtx);
             WC_GUARD(arrayIndexExpr, nullptr);
-            parseCtx.skipNewlines();
             
             // Expect a closing ']'
             const Token & endToken = *parseCtx.tok();
@@ -144,29 +143,10 @@ PostfixExpr * PostfixExpr::parse(ParseCtx & parseCtx) {
     return outerPostfixExpr;
 }
 
-//-----------------------------------------------------------------------------
-// PostfixExprNoOp
-//-----------------------------------------------------------------------------
-PostfixExprNoOp::PostfixExprNoOp(CastExpr & expr) : mExpr(expr) {
-    mExpr.mParent = this;
-}
-
-void PostfixExprNoOp::accept(ASTNodeVisitor & visitor) const {
-    visitor.visit(*this);
-}
-
-const Token & PostfixExprNoOp::getStartToken() const {
-    return mExpr.getStartToken();
-}
-
-const Token & PostfixExprNoOp::getEndToken() const {
-    return mExpr.getEndToken();
-}
-
 //-----------------------------------------------------------------------------
 // PostfixExprIncDecBase
 //-----------------------------------------------------------------------------
-PostfixExprIncDecBase::PostfixExprIncDecBase(PostfixExpr & expr, const Token & endToken) :
+PostfixExprIncDecBase::PostfixExprIncDecBase(Expr & expr, const Token & endToken) :
     mExpr(expr),
     mEndToken(endToken)
 {
@@ -184,7 +164,7 @@ const Token & PostfixExprIncDecBase::getEndToken() const {
 //-----------------------------------------------------------------------------
 // PostfixExprInc
 //-----------------------------------------------------------------------------
-PostfixExprInc::PostfixExprInc(PostfixExpr & expr, const Token & endToken) :
+PostfixExprInc::PostfixExprInc(Expr & expr, const Token & endToken) :
     PostfixExprIncDecBase(expr, endToken)
 {
     WC_EMPTY_FUNC_BODY();
@@ -197,7 +177,7 @@ void PostfixExprInc::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // PostfixExprDec
 //-----------------------------------------------------------------------------
-PostfixExprDec::PostfixExprDec(PostfixExpr & expr, const Token & endToken) :
+PostfixExprDec::PostfixExprDec(Expr & expr, const Token & endToken) :
     PostfixExprIncDecBase(expr, endToken)
 {
     WC_EMPTY_FUNC_BODY();
@@ -210,22 +190,20 @@ void PostfixExprDec::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // PostfixExprFuncCall
 //-----------------------------------------------------------------------------
-PostfixExprFuncCall::PostfixExprFuncCall(PostfixExpr & operandExpr,
+PostfixExprFuncCall::PostfixExprFuncCall(Expr & operandExpr,
                                          const Token & callOpeningParen,
-                                         std::vector<AssignExpr*> & argExprs,
+                                         const Span<Expr*> & argExprs,
                                          const Token & callClosingParen)
 :
     mOperandExpr(operandExpr),
     mCallOpeningParen(callOpeningParen),
-    mArgExprs(),
+    mArgExprs(argExprs),
     mCallClosingParen(callClosingParen)
 {
     mOperandExpr.mParent = this;
-    mArgExprs.reserve(argExprs.size());
     
-    for (AssignExpr * argExpr : argExprs) {
+    for (Expr * argExpr : argExprs) {
         argExpr->mParent = this;
-        mArgExprs.push_back(argExpr);
     }
 }
 
@@ -244,8 +222,8 @@ const Token & PostfixExprFuncCall::getEndToken() const {
 //-----------------------------------------------------------------------------
 // PostfixExprArrayLookup
 //-----------------------------------------------------------------------------
-PostfixExprArrayLookup::PostfixExprArrayLookup(PostfixExpr & arrayExpr,
-                                               AssignExpr & indexExpr,
+PostfixExprArrayLookup::PostfixExprArrayLookup(Expr & arrayExpr,
+                                               Expr & indexExpr,
                                                const Token & endToken)
 :
     mArrayExpr(arrayExpr),
@@ -6,19 +6,12 @@
 
 #pragma once
 
-#include "ASTNode.hpp"
-#include "IExpr.hpp"
-
-WC_THIRD_PARTY_INCLUDES_BEGIN
-    #include <vector>
-WC_THIRD_PARTY_INCLUDES_END
+#include "Expr.hpp"
+#include "Span.hpp"
 
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class AssignExpr;
-class CastExpr;
-
 /*
 PostfixExpr:
     CastExpr
@@ -27,40 +20,28 @@ PostfixExpr:
     PostfixExpr ( [0..N: AssignExpr ,][AssignExpr] )
     PostfixExpr [ AssignExpr ]
 */
-class PostfixExpr : public ASTNode, public IExpr {
+class PostfixExpr : public Expr {
 public:
     static bool peek(const Token * currentToken);
-    static PostfixExpr * parse(ParseCtx & parseCtx);
-};
-
-/* CastExpr */
-class PostfixExprNoOp final : public PostfixExpr {
-public:
-    PostfixExprNoOp(CastExpr & expr);
-    
-    virtual void accept(ASTNodeVisitor & visitor) const override;
-    virtual const Token & getStartToken() const override;
-    virtual const Token & getEndToken() const override;
-    
-    CastExpr & mExpr;
+    static Expr * parse(ParseCtx & parseCtx);
 };
 
 /* Base class for increment/decrement postfix expressions */
 class PostfixExprIncDecBase : public PostfixExpr {
 public:
-    PostfixExprIncDecBase(PostfixExpr & expr, const Token & endToken);
+    PostfixExprIncDecBase(Expr & expr, const Token & endToken);
 
     virtual const Token & getStartToken() const final override;
     virtual const Token & getEndToken() const final override;
     
-    PostfixExpr &   mExpr;
-    const Token &   mEndToken;
+    Expr &          mExpr;
+    const Token     mEndToken;
 };
 
 /* PostfixExpr ++ */
 class PostfixExprInc final : public PostfixExprIncDecBase {
 public:
-    PostfixExprInc(PostfixExpr & expr, const Token & endToken);
+    PostfixExprInc(Expr & expr, const Token & endToken);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -68,7 +49,7 @@ public:
 /* PostfixExpr -- */
 class PostfixExprDec final : public PostfixExprIncDecBase {
 public:
-    PostfixExprDec(PostfixExpr & expr, const Token & endToken);
+    PostfixExprDec(Expr & expr, const Token & endToken);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -76,9 +57,9 @@ public:
 /* PostfixExpr ( [0..N: AssignExpr ,][AssignExpr] ) */
 class PostfixExprFuncCall final : public PostfixExpr {
 public:
-    PostfixExprFuncCall(PostfixExpr & operandExpr,
+    PostfixExprFuncCall(Expr & operandExpr,
                         const Token & callOpeningParen,
-                        std::vector<AssignExpr*> & argExprs,
+                        const Span<Expr*> & argExprs,
                         const Token & callClosingParen);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
@@ -86,32 +67,32 @@ public:
     virtual const Token & getEndToken() const override;
     
     /* The thing which the function is being called on */
-    PostfixExpr & mOperandExpr;
+    Expr & mOperandExpr;
     
     /* The opening parenthesis '(' of the function call */
-    const Token & mCallOpeningParen;
+    const Token mCallOpeningParen;
     
     /* The assign expression for all the arguments */
-    std::vector<const AssignExpr*> mArgExprs;
+    Span<const Expr*> mArgExprs;
     
     /* The closing parenthesis ')' of the function call */
-    const Token & mCallClosingParen;
+    const Token mCallClosingParen;
 };
 
 /* PostfixExpr [ AssignExpr ] */
 class PostfixExprArrayLookup final : public PostfixExpr {
 public:
-    PostfixExprArrayLookup(PostfixExpr & arrayExpr,
-                           AssignExpr & indexExpr,
+    PostfixExprArrayLookup(Expr & arrayExpr,
+                           Expr & indexExpr,
                            const Token & endToken);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
     virtual const Token & getStartToken() const override;
     virtual const Token & getEndToken() const override;
     
-    PostfixExpr &   mArrayExpr;
-    AssignExpr &    mIndexExpr;
-    const Token &   mEndToken;
+    Expr &          mArrayExpr;
+    Expr &          mIndexExpr;
+    const Token     mEndToken;
 };
 
 WC_AST_END_NAMESPACE
@@ -7,6 +7,7 @@
 #include "PrefixExpr.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "LinearAlloc.hpp"
 #include "PostfixExpr.hpp"
@@ -18,131 +19,84 @@ WC_AST_BEGIN_NAMESPACE
 // PrefixExpr
 //-----------------------------------------------------------------------------
 bool PrefixExpr::peek(const Token * currentToken) {
-    /*
-        - PrefixExpr
-        + PrefixExpr
-        & PrefixExpr
-        $ PrefixExpr
-        ^ PrefixExpr
-    */
-    TokenType currentTokenType = currentToken->type;
-    
-    if (currentTokenType == TokenType::kMinus ||
-        currentTokenType == TokenType::kPlus ||
-        currentTokenType == TokenType::kAmpersand ||
-        currentTokenType == TokenType::kDollar ||
-        currentTokenType == TokenType::kHat)
-    {
-        ++currentToken;
-        WC_PARSER_SKIP_NEWLINE_TOKENS(currentToken);
-        return PrefixExpr::peek(currentToken);
-    }
-    
-    /* PostfixExpr */
-    return PostfixExpr::peek(currentToken);
+    return FirstSets::kPrefixExpr.contains(currentToken->type);
 }
 
-PrefixExpr * PrefixExpr::parse(ParseCtx & parseCtx) {
-    switch (parseCtx.tok()->type) {
+Expr * PrefixExpr::parse(ParseCtx & parseCtx) {
+    switch (parseCtx.tokType()) {
         /* - PostfixExpr */
         case TokenType::kMinus: {
-            // Skip '-' and any newlines that follow
+            // Skip '-'
             const Token * minusTok = parseCtx.tok();
             parseCtx.nextTok();
-            parseCtx.skipNewlines();
             
             // Parse the operand and create the AST node
-            PrefixExpr * expr = PrefixExpr::parse(parseCtx);
+            Expr * expr = PrefixExpr::parse(parseCtx);
             WC_GUARD(expr, nullptr);
             return WC_NEW_AST_NODE(parseCtx, PrefixExprMinus, *minusTok, *expr);
         }   break;
             
         /* + PostfixExpr */
         case TokenType::kPlus: {
-            // Skip '+' and any newlines that follow
+            // Skip '+'
             const Token * plusTok = parseCtx.tok();
             parseCtx.nextTok();
-            parseCtx.skipNewlines();
             
             // Parse the operand and create the AST node
-            PrefixExpr * expr = PrefixExpr::parse(parseCtx);
+            Expr * expr = PrefixExpr::parse(parseCtx);
             WC_GUARD(expr, nullptr);
             return WC_NEW_AST_NODE(parseCtx, PrefixExprPlus, *plusTok, *expr);
         }   break;
             
         /* & PostfixExpr */
         case TokenType::kAmpersand: {
-            // Skip '&' and any newlines that follow
+            // Skip '&'
             const Token * ampersandTok = parseCtx.tok();
             parseCtx.nextTok();
-            parseCtx.skipNewlines();
             
             // Parse the operand and create the AST node
-            PrefixExpr * expr = PrefixExpr::parse(parseCtx);
+            Expr * expr = PrefixExpr::parse(parseCtx);
             WC_GUARD(expr, nullptr);
             return WC_NEW_AST_NODE(parseCtx, PrefixExprAddrOf, *ampersandTok, *expr);
         }   break;
             
         /* $ PostfixExpr */
         case TokenType::kDollar: {
-            // Skip '$' and any newlines that follow
+            // Skip '$'
             const Token * dollarTok = parseCtx.tok();
             parseCtx.nextTok();
-            parseCtx.skipNewlines();
             
             // Parse the operand and create the AST node
-            PrefixExpr * expr = PrefixExpr::parse(parseCtx);
+            Expr * expr = PrefixExpr::parse(parseCtx);
             WC_GUARD(expr, nullptr);
             return WC_NEW_AST_NODE(parseCtx, PrefixExprPtrDeref, *dollarTok, *expr);
         }   break;
             
         /* ^ PostfixExpr */
         case TokenType::kHat: {
-            // Skip '^' and any newlines that follow
+            // Skip '^'
             const Token * hatTok = parseCtx.tok();
             parseCtx.nextTok();
-            parseCtx.skipNewlines();
             
             // Parse the operand and create the AST node
-            PrefixExpr * expr = PrefixExpr::parse(parseCtx);
+            Expr * expr = PrefixExpr::parse(parseCtx);
             WC_GUARD(expr, nullptr);
             return WC_NEW_AST_NODE(parseCtx, PrefixExprPtrDenull, *hatTok, *expr);
         }   break;
             
         /* PostfixExpr */
         default: {
-            PostfixExpr * expr = PostfixExpr::parse(parseCtx);
-            WC_GUARD(expr, nullptr);
-            return WC_NEW_AST_NODE(parseCtx, PrefixExprNoOp, *expr);
+            return PostfixExpr::parse(parseCtx);
         }   break;
     }
     
     return nullptr;     // Should never reach here
 }
 
-//-----------------------------------------------------------------------------
-// PrefixExprNoOp
-//-----------------------------------------------------------------------------
-PrefixExprNoOp::PrefixExprNoOp(PostfixExpr & expr) : mExpr(expr) {
-    mExpr.mParent = this;
-}
-
-void PrefixExprNoOp::accept(ASTNodeVisitor & visitor) const {
-    visitor.visit(*this);
-}
-
-const Token & PrefixExprNoOp::getStartToken() const {
-    return mExpr.getStartToken();
-}
-
-const Token & PrefixExprNoOp::getEndToken() const {
-    return mExpr.getEndToken();
-}
-
 //-----------------------------------------------------------------------------
 // PrefixExprWithUnaryOp
 //-----------------------------------------------------------------------------
-PrefixExprWithUnaryOp::PrefixExprWithUnaryOp(const Token & startToken, PrefixExpr & expr) :
+PrefixExprWithUnaryOp::PrefixExprWithUnaryOp(const Token & startToken, Expr & expr) :
     mStartToken(startToken),
     mExpr(expr)
 {
@@ -160,7 +114,7 @@ const Token & PrefixExprWithUnaryOp::getEndToken() const {
 //-----------------------------------------------------------------------------
 // PrefixExprPlus
 //-----------------------------------------------------------------------------
-PrefixExprPlus::PrefixExprPlus(const Token & startToken, PrefixExpr & expr) :
+PrefixExprPlus::PrefixExprPlus(const Token & startToken, Expr & expr) :
     PrefixExprWithUnaryOp(startToken, expr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -173,7 +127,7 @@ void PrefixExprPlus::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // PrefixExprMinus
 //-----------------------------------------------------------------------------
-PrefixExprMinus::PrefixExprMinus(const Token & startToken, PrefixExpr & expr) :
+PrefixExprMinus::PrefixExprMinus(const Token & startToken, Expr & expr) :
     PrefixExprWithUnaryOp(startToken, expr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -186,7 +140,7 @@ void PrefixExprMinus::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // PrefixExprAddrOf
 //-----------------------------------------------------------------------------
-PrefixExprAddrOf::PrefixExprAddrOf(const Token & startToken, PrefixExpr & expr) :
+PrefixExprAddrOf::PrefixExprAddrOf(const Token & startToken, Expr & expr) :
     PrefixExprWithUnaryOp(startToken, expr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -199,7 +153,7 @@ void PrefixExprAddrOf::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // PrefixExprPtrDeref
 //-----------------------------------------------------------------------------
-PrefixExprPtrDeref::PrefixExprPtrDeref(const Token & startToken, PrefixExpr & expr) :
+PrefixExprPtrDeref::PrefixExprPtrDeref(const Token & startToken, Expr & expr) :
     PrefixExprWithUnaryOp(startToken, expr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -212,7 +166,7 @@ void PrefixExprPtrDeref::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // PrefixExprPtrDenull
 //-----------------------------------------------------------------------------
-PrefixExprPtrDenull::PrefixExprPtrDenull(const Token & startToken, PrefixExpr & expr) :
+PrefixExprPtrDenull::PrefixExprPtrDenull(const Token & startToken, Expr & expr) :
     PrefixExprWithUnaryOp(startToken, expr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -6,14 +6,11 @@
 
 #pragma once
 
-#include "ASTNode.hpp"
-#include "IExpr.hpp"
+#include "Expr.hpp"
 
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class PostfixExpr;
-
 /*
 PrefixExpr:
 	PostfixExpr
@@ -23,40 +20,28 @@ PrefixExpr:
 	$ PrefixExpr
 	^ PrefixExpr
 */
-class PrefixExpr : public ASTNode, public IExpr {
+class PrefixExpr : public Expr {
 public:
     static bool peek(const Token * currentToken);
-    static PrefixExpr * parse(ParseCtx & parseCtx);
-};
-
-/* PostfixExpr */
-class PrefixExprNoOp : public PrefixExpr {
-public:
-    PrefixExprNoOp(PostfixExpr & expr);
-    
-    virtual void accept(ASTNodeVisitor & visitor) const override;
-    virtual const Token & getStartToken() const override;
-    virtual const Token & getEndToken() const override;
-    
-    PostfixExpr & mExpr;
+    static Expr * parse(ParseCtx & parseCtx);
 };
 
 /* Base class for '+' or '-' etc. unary expression */
 class PrefixExprWithUnaryOp : public PrefixExpr {
 public:
-    PrefixExprWithUnaryOp(const Token & startToken, PrefixExpr & expr);
+    PrefixExprWithUnaryOp(const Token & startToken, Expr & expr);
     
     virtual const Token & getStartToken() const final override;
     virtual const Token & getEndToken() const final override;
     
-    const Token &   mStartToken;
-    PrefixExpr &    mExpr;
+    const Token     mStartToken;
+    Expr &          mExpr;
 };
 
 /* + PrefixExpr */
 class PrefixExprPlus final : public PrefixExprWithUnaryOp {
 public:
-    PrefixExprPlus(const Token & startToken, PrefixExpr & expr);
+    PrefixExprPlus(const Token & startToken, Expr & expr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -64,7 +49,7 @@ public:
 /* - PrefixExpr */
 class PrefixExprMinus final : public PrefixExprWithUnaryOp {
 public:
-    PrefixExprMinus(const Token & startToken, PrefixExpr & expr);
+    PrefixExprMinus(const Token & startToken, Expr & expr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -72,7 +57,7 @@ public:
 /* & PrefixExpr */
 class PrefixExprAddrOf final : public PrefixExprWithUnaryOp {
 public:
-    PrefixExprAddrOf(const Token & startToken, PrefixExpr & expr);
+    PrefixExprAddrOf(const Token & startToken, Expr & expr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -80,7 +65,7 @@ public:
 /* $ PrefixExpr */
 class PrefixExprPtrDeref final : public PrefixExprWithUnaryOp {
 public:
-    PrefixExprPtrDeref(const Token & startToken, PrefixExpr & expr);
+    PrefixExprPtrDeref(const Token & startToken, Expr & expr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -88,7 +73,7 @@ public:
 /* ^ PrefixExpr */
 class PrefixExprPtrDenull final : public PrefixExprWithUnaryOp {
 public:
-    PrefixExprPtrDenull(const Token & startToken, PrefixExpr & expr);
+    PrefixExprPtrDenull(const Token & startToken, Expr & expr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -7,6 +7,7 @@
 #include "PrimaryExpr.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "ArrayLit.hpp"
 #include "AssignExpr.hpp"
@@ -23,74 +24,112 @@
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-//-----------------------------------------------------------------------------
-// PrimaryExpr
-//-----------------------------------------------------------------------------
-bool PrimaryExpr::peek(const Token * currentToken) {
-    return  IntLit::peek(currentToken) ||
-            BoolLit::peek(currentToken) ||
-            StrLit::peek(currentToken) ||
-            NullLit::peek(currentToken) ||
-            ArrayLit::peek(currentToken) ||
-            Identifier::peek(currentToken) ||
-            ReadnumExpr::peek(currentToken) ||
-            TimeExpr::peek(currentToken) ||
-            RandExpr::peek(currentToken) ||
-            currentToken->type == TokenType::kLParen;
+/* Signature for a function that parses one particular kind of primary expression */
+typedef PrimaryExpr * (*PrimaryExprParseFunc)(ParseCtx & parseCtx);
+
+/* Parses an expression node of the given type and wraps it in the given 'PrimaryExpr' node type */
+template <typename ExprT, typename PrimaryExprWrapperT>
+static PrimaryExpr * parsePrimaryExprOfType(ParseCtx & parseCtx) {
+    ExprT * expr = ExprT::parse(parseCtx);
+    WC_GUARD(expr, nullptr);
+    return WC_NEW_AST_NODE(parseCtx, PrimaryExprWrapperT, *expr);
 }
 
-PrimaryExpr * PrimaryExpr::parse(ParseCtx & parseCtx) {
-    /* Useful macro to eliminate a lot of repetition */
-    #define TRY_PARSE_PRIMARY_EXPR_TYPE(ExprType)\
-        if (ExprType::peek(parseCtx.tok())) {\
-            ExprType * expr = ExprType::parse(parseCtx);\
-            WC_GUARD(expr, nullptr);\
-            return WC_NEW_AST_NODE(parseCtx, PrimaryExpr##ExprType, *expr);\
-        }
+/* Parses a primary expression of the form: ( AssignExpr ) */
+static PrimaryExpr * parseParenPrimaryExpr(ParseCtx & parseCtx) {
+    // Save the opening '(' and skip it
+    WC_ASSERT(parseCtx.tokType() == TokenType::kLParen);
+    const Token * openeingParen = parseCtx.tok();
+    parseCtx.nextTok();
     
-    TRY_PARSE_PRIMARY_EXPR_TYPE(IntLit)
-    TRY_PARSE_PRIMARY_EXPR_TYPE(BoolLit)
-    TRY_PARSE_PRIMARY_EXPR_TYPE(StrLit)
-    TRY_PARSE_PRIMARY_EXPR_TYPE(NullLit)
-    TRY_PARSE_PRIMARY_EXPR_TYPE(ArrayLit)
-    TRY_PARSE_PRIMARY_EXPR_TYPE(Identifier)
-    TRY_PARSE_PRIMARY_EXPR_TYPE(ReadnumExpr)
-    TRY_PARSE_PRIMARY_EXPR_TYPE(TimeExpr)
-    TRY_PARSE_PRIMARY_EXPR_TYPE(RandExpr)
-
-    #undef TRY_PARSE_PRIMARY_EXPR_TYPE
+    // Parse the expression inside:
+    Expr * expr = AssignExpr::parse(parseCtx);
+    WC_GUARD(expr, nullptr);
     
-    // ( AssignExpr )
-    if (parseCtx.tok()->type == TokenType::kLParen) {
-        // Save the opening '(' and skip it as well as any newlines that follow
-        const Token * openeingParen = parseCtx.tok();
-        parseCtx.nextTok();
-        parseCtx.skipNewlines();
+    // Expect a closing ')'
+    if (parseCtx.tokType() != TokenType::kRParen) {
+        SourceLoc openingParenLoc = parseCtx.getSrcLineIndex().getLoc(openeingParen->startSrcOffset);
+        parseCtx.error("Expected closing ')' to match '(' at line %zu and column %zu!",
+                       size_t(openingParenLoc.line) + 1,
+                       size_t(openingParenLoc.col) + 1);
         
-        // Parse the expression inside:
-        AssignExpr * expr = AssignExpr::parse(parseCtx);
-        WC_GUARD(expr, nullptr);
-        
-        // Expect a closing ')' - but skip any newlines before it
-        parseCtx.skipNewlines();
+        return nullptr;
+    }
+    
+    const Token * closingParen = parseCtx.tok();
+    parseCtx.nextTok();
+    
+    // Done: return the parsed node
+    return WC_NEW_AST_NODE(parseCtx, PrimaryExprParen, *openeingParen, *expr, *closingParen);
+}
+
+/* Used for tokens which cannot begin a primary expression: just reports the error */
+static PrimaryExpr * parseUnexpectedPrimaryExpr(ParseCtx & parseCtx) {
+    parseCtx.error("Expected primary expression!");
+    return nullptr;
+}
+
+/**
+ * Table giving the function to parse a primary expression with for each token type, built at compile time
+ * from the FIRST sets of each kind of primary expression. This lets 'PrimaryExpr::parse' pick what to parse
+ * with a single lookup rather than peeking at every kind of primary expression in turn.
+ */
+struct PrimaryExprParseTable {
+    constexpr PrimaryExprParseTable() :
+        parseFuncs{},
+        claimedTokenTypes{},
+        hasConflicts(false)
+    {
+        for (PrimaryExprParseFunc & parseFunc : parseFuncs) {
+            parseFunc = parseUnexpectedPrimaryExpr;
+        }
         
-        if (parseCtx.tok()->type != TokenType::kRParen) {
-            parseCtx.error("Expected closing ')' to match '(' at line %zu and column %zu!",
-                           openeingParen->startLine + 1,
-                           openeingParen->startCol + 1);
-            
-            return nullptr;
+        addExprType(FirstSets::kIntLit, parsePrimaryExprOfType<IntLit, PrimaryExprIntLit>);
+        addExprType(FirstSets::kBoolLit, parsePrimaryExprOfType<BoolLit, PrimaryExprBoolLit>);
+        addExprType(FirstSets::kStrLit, parsePrimaryExprOfType<StrLit, PrimaryExprStrLit>);
+        addExprType(FirstSets::kNullLit, parsePrimaryExprOfType<NullLit, PrimaryExprNullLit>);
+        addExprType(FirstSets::kArrayLit, parsePrimaryExprOfType<ArrayLit, PrimaryExprArrayLit>);
+        addExprType(FirstSets::kIdentifier, parsePrimaryExprOfType<Identifier, PrimaryExprIdentifier>);
+        addExprType(FirstSets::kReadnumExpr, parsePrimaryExprOfType<ReadnumExpr, PrimaryExprReadnumExpr>);
+        addExprType(FirstSets::kTimeExpr, parsePrimaryExprOfType<TimeExpr, PrimaryExprTimeExpr>);
+        addExprType(FirstSets::kRandExpr, parsePrimaryExprOfType<RandExpr, PrimaryExprRandExpr>);
+        addExprType(TokenTypeSet{ TokenType::kLParen }, parseParenPrimaryExpr);
+    }
+    
+    /* Use the given parse function for all tokens in the given FIRST set. Flags a conflict if already used. */
+    constexpr void addExprType(const TokenTypeSet & firstSet, PrimaryExprParseFunc parseFunc) {
+        if (claimedTokenTypes.intersects(firstSet)) {
+            hasConflicts = true;
         }
         
-        const Token * closingParen = parseCtx.tok();
-        parseCtx.nextTok();
+        claimedTokenTypes = claimedTokenTypes | firstSet;
         
-        // Done: return the parsed node
-        return WC_NEW_AST_NODE(parseCtx, PrimaryExprParen, *openeingParen, *expr, *closingParen);
+        for (size_t i = 0; i < kNumTokenTypes; ++i) {
+            if (firstSet.contains(static_cast<TokenType>(i))) {
+                parseFuncs[i] = parseFunc;
+            }
+        }
     }
     
-    parseCtx.error("Expected primary expression!");
-    return nullptr;
+    PrimaryExprParseFunc parseFuncs[kNumTokenTypes];
+    TokenTypeSet claimedTokenTypes;
+    bool hasConflicts;
+};
+
+static constexpr const PrimaryExprParseTable kPrimaryExprParseTable{};
+
+static_assert(!kPrimaryExprParseTable.hasConflicts,
+              "The same token can begin more than one kind of primary expression! The grammar is ambiguous.");
+
+//-----------------------------------------------------------------------------
+// PrimaryExpr
+//-----------------------------------------------------------------------------
+bool PrimaryExpr::peek(const Token * currentToken) {
+    return FirstSets::kPrimaryExpr.contains(currentToken->type);
+}
+
+PrimaryExpr * PrimaryExpr::parse(ParseCtx & parseCtx) {
+    return kPrimaryExprParseTable.parseFuncs[static_cast<size_t>(parseCtx.tokType())](parseCtx);
 }
 
 //-----------------------------------------------------------------------------
@@ -271,7 +310,7 @@ const Token & PrimaryExprRandExpr::getEndToken() const {
 //-----------------------------------------------------------------------------
 // PrimaryExprParen
 //-----------------------------------------------------------------------------
-PrimaryExprParen::PrimaryExprParen(const Token & startToken, AssignExpr & expr, const Token & endToken) :
+PrimaryExprParen::PrimaryExprParen(const Token & startToken, Expr & expr, const Token & endToken) :
     mStartToken(startToken),
     mExpr(expr),
     mEndToken(endToken)
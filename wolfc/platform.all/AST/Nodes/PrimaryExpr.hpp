@@ -6,14 +6,12 @@
 
 #pragma once
 
-#include "ASTNode.hpp"
-#include "IExpr.hpp"
+#include "Expr.hpp"
 
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
 class ArrayLit;
-class AssignExpr;
 class BoolLit;
 class Identifier;
 class IntLit;
@@ -36,7 +34,7 @@ PrimaryExpr:
     RandExpr
     ( AssignExpr )
 */
-class PrimaryExpr : public ASTNode, public IExpr {
+class PrimaryExpr : public Expr {
 public:
     static bool peek(const Token * currentToken);
     static PrimaryExpr * parse(ParseCtx & parseCtx);
@@ -155,15 +153,15 @@ public:
 /* ( AssignExpr ) */
 class PrimaryExprParen final : public PrimaryExpr {
 public:
-    PrimaryExprParen(const Token & startToken, AssignExpr & expr, const Token & endToken);
+    PrimaryExprParen(const Token & startToken, Expr & expr, const Token & endToken);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
     virtual const Token & getStartToken() const override;
     virtual const Token & getEndToken() const override;
 
-    const Token &   mStartToken;
-    AssignExpr &    mExpr;
-    const Token &   mEndToken;
+    const Token     mStartToken;
+    Expr &          mExpr;
+    const Token     mEndToken;
 };
 
 WC_AST_END_NAMESPACE
@@ -7,6 +7,7 @@
 #include "PrimitiveType.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "DataType/Types/PrimitiveDataTypes.hpp"
 #include "LinearAlloc.hpp"
@@ -15,7 +16,7 @@ WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
 bool PrimitiveType::peek(const Token * currentToken) {
-    return PrimitiveDataTypes::isLangKeywordPrimitiveType(currentToken->type);
+    return FirstSets::kPrimitiveType.contains(currentToken->type);
 }
 
 PrimitiveType * PrimitiveType::parse(ParseCtx & parseCtx) {
@@ -35,7 +35,7 @@ public:
     /* Tell if this type is the 'any' data type */
     bool isAny() const;
     
-    const Token & mToken;
+    const Token mToken;
 };
 
 WC_AST_END_NAMESPACE
@@ -7,6 +7,7 @@
 #include "PrintStmnt.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "AssignExpr.hpp"
 #include "LinearAlloc.hpp"
@@ -15,36 +16,33 @@ WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
 bool PrintStmnt::peek(const Token * tokenPtr) {
-    return tokenPtr->type == TokenType::kPrint;
+    return FirstSets::kPrintStmnt.contains(tokenPtr->type);
 }
 
 PrintStmnt * PrintStmnt::parse(ParseCtx & parseCtx) {
-    if (parseCtx.tok()->type != TokenType::kPrint) {
+    if (parseCtx.tokType() != TokenType::kPrint) {
         parseCtx.error("Expected keyword 'print' for 'print()' statement!");
         return nullptr;
     }
     
-    // Consume 'print' and skip any newlines that follow
+    // Consume 'print'
     const Token * printTok = parseCtx.tok();
     parseCtx.nextTok();
-    parseCtx.skipNewlines();
     
-    if (parseCtx.tok()->type != TokenType::kLParen) {
+    if (parseCtx.tokType() != TokenType::kLParen) {
         parseCtx.error("Expected '(' following 'print'!");
         return nullptr;
     }
     
-    // Consume '(' and any newlines that follow
+    // Consume '('
     parseCtx.nextTok();
-    parseCtx.skipNewlines();
     
-    // Parse the inner expression and skip any newlines that follow
-    AssignExpr * assignExpr = AssignExpr::parse(parseCtx);
+    // Parse the inner expression
+    Expr * assignExpr = AssignExpr::parse(parseCtx);
     WC_GUARD(assignExpr, nullptr);
-    parseCtx.skipNewlines();
     
     // Expect ')' following all that:
-    if (parseCtx.tok()->type != TokenType::kRParen) {
+    if (parseCtx.tokType() != TokenType::kRParen) {
         parseCtx.error("Expected closing ')' for 'print()' statement!");
         return nullptr;
     }
@@ -57,7 +55,7 @@ PrintStmnt * PrintStmnt::parse(ParseCtx & parseCtx) {
     return WC_NEW_AST_NODE(parseCtx, PrintStmnt, *printTok, *assignExpr, *closingParenTok);
 }
 
-PrintStmnt::PrintStmnt(const Token & startToken, AssignExpr & expr, const Token & endToken) :
+PrintStmnt::PrintStmnt(const Token & startToken, Expr & expr, const Token & endToken) :
     mStartToken(startToken),
     mExpr(expr),
     mEndToken(endToken)
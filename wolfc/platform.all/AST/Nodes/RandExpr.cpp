@@ -7,6 +7,7 @@
 #include "RandExpr.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "AssignExpr.hpp"
 #include "LinearAlloc.hpp"
@@ -18,30 +19,27 @@ WC_AST_BEGIN_NAMESPACE
 // RandExpr
 //-----------------------------------------------------------------------------
 bool RandExpr::peek(const Token * tokenPtr) {
-    TokenType tokenType = tokenPtr->type;
-    return tokenType == TokenType::kRand || tokenType == TokenType::kSRand;
+    return FirstSets::kRandExpr.contains(tokenPtr->type);
 }
 
 RandExpr * RandExpr::parse(ParseCtx & parseCtx) {
-    TokenType tokType = parseCtx.tok()->type;
+    TokenType tokType = parseCtx.tokType();
     
     if (tokType == TokenType::kRand) {
-        // rand() call: consume 'rand', skip any newlines and save start token
+        // rand() call: consume 'rand' and save start token
         const Token * startToken = parseCtx.tok();
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
         
-        // Expect '(', parse it and skip any newlines that follow
-        if (parseCtx.tok()->type != TokenType::kLParen) {
+        // Expect '(', parse it
+        if (parseCtx.tokType() != TokenType::kLParen) {
             parseCtx.error("Expect '(' following 'rand'!");
             return nullptr;
         }
         
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
         
         // Expect ')'
-        if (parseCtx.tok()->type != TokenType::kRParen) {
+        if (parseCtx.tokType() != TokenType::kRParen) {
             parseCtx.error("Expect ')' following 'rand('!");
             return nullptr;
         }
@@ -52,28 +50,24 @@ RandExpr * RandExpr::parse(ParseCtx & parseCtx) {
         return WC_NEW_AST_NODE(parseCtx, RandExprRand, *startToken, *endToken);
     }
     else if (tokType == TokenType::kSRand) {
-        // srand() call: consume 'srand', skip any newlines that follow and save start token
+        // srand() call: consume 'srand' and save start token
         const Token * startToken = parseCtx.tok();
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
         
-        // Expect '(', parse it and skip any newlines that follow
-        if (parseCtx.tok()->type != TokenType::kLParen) {
+        // Expect '(', parse it
+        if (parseCtx.tokType() != TokenType::kLParen) {
             parseCtx.error("Expect '(' following 'srand'!");
             return nullptr;
         }
         
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
         
-        // Parse the inner assign expression for the seed,
-        // also skip any newlines that follow.
-        AssignExpr * seedExpr = AssignExpr::parse(parseCtx);
+        // Parse the inner assign expression for the seed
+        Expr * seedExpr = AssignExpr::parse(parseCtx);
         WC_GUARD(seedExpr, nullptr);
-        parseCtx.skipNewlines();
         
         // Expect ')'
-        if (parseCtx.tok()->type != TokenType::kRParen) {
+        if (parseCtx.tokType() != TokenType::kRParen) {
             parseCtx.error("Expect ')' to close 'srand()' call!");
             return nullptr;
         }
@@ -120,7 +114,7 @@ void RandExprRand::accept(ASTNodeVisitor & visitor) const {
 // RandExprSRand
 //-----------------------------------------------------------------------------
 RandExprSRand::RandExprSRand(const Token & startToken,
-                             AssignExpr & seedExpr,
+                             Expr & seedExpr,
                              const Token & endToken)
 :
     RandExpr(startToken, endToken),
@@ -12,7 +12,7 @@
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class AssignExpr;
+class Expr;
 class StrLit;
 
 /*
@@ -30,8 +30,8 @@ public:
     virtual const Token & getStartToken() const final override;
     virtual const Token & getEndToken() const final override;
     
-    const Token & mStartToken;
-    const Token & mEndToken;
+    const Token mStartToken;
+    const Token mEndToken;
 };
 
 /* rand ( ) */
@@ -46,12 +46,12 @@ public:
 class RandExprSRand final : public RandExpr {
 public:
     RandExprSRand(const Token & startToken,
-                  AssignExpr & seedExpr,
+                  Expr & seedExpr,
                   const Token & endToken);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
     
-    AssignExpr & mSeedExpr;
+    Expr & mSeedExpr;
 };
 
 WC_AST_END_NAMESPACE
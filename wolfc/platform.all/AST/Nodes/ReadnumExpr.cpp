@@ -7,6 +7,7 @@
 #include "ReadnumExpr.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "LinearAlloc.hpp"
 
@@ -14,31 +15,29 @@ WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
 bool ReadnumExpr::peek(const Token * tokenPtr) {
-    return tokenPtr->type == TokenType::kReadnum;
+    return FirstSets::kReadnumExpr.contains(tokenPtr->type);
 }
 
 ReadnumExpr * ReadnumExpr::parse(ParseCtx & parseCtx) {
-    // Consume 'readnum' and skip any newlines that follow
-    if (parseCtx.tok()->type != TokenType::kReadnum) {
+    // Consume 'readnum'
+    if (parseCtx.tokType() != TokenType::kReadnum) {
         parseCtx.error("Expected 'readnum' at begining of readnum() expression!");
         return nullptr;
     }
     
     const Token * readnumTok = parseCtx.tok();
     parseCtx.nextTok();
-    parseCtx.skipNewlines();
     
-    // Parse the '(' following 'readnum' and skip any newlines
-    if (parseCtx.tok()->type != TokenType::kLParen) {
+    // Parse the '(' following 'readnum'
+    if (parseCtx.tokType() != TokenType::kLParen) {
         parseCtx.error("Expect '(' following 'readnum'!");
         return nullptr;
     }
     
     parseCtx.nextTok();
-    parseCtx.skipNewlines();
     
     // Finish up by parsing ')' and return the parsed node
-    if (parseCtx.tok()->type != TokenType::kRParen) {
+    if (parseCtx.tokType() != TokenType::kRParen) {
         parseCtx.error("Expect ')' following '('!");
         return nullptr;
     }
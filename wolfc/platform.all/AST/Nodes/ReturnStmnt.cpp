@@ -7,6 +7,7 @@
 #include "ReturnStmnt.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "AssignExpr.hpp"
 #include "LinearAlloc.hpp"
@@ -14,8 +15,14 @@
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-/* Utility. Tell if a token is a condition token type. */
-static bool isCondTokenType(TokenType tokenType) {
+/* Utility. Tell if a condition token (if/unless) is the current token and is on the same line. */
+static bool isCondTokenAhead(const ParseCtx & parseCtx) {
+    // Note: the condition must be on the same line as the rest of the 'return' statement
+    if (parseCtx.tokIsPrecededByNewline()) {
+        return false;
+    }
+    
+    TokenType tokenType = parseCtx.tokType();
     return tokenType == TokenType::kIf || tokenType == TokenType::kUnless;
 }
 
@@ -23,7 +30,7 @@ static bool isCondTokenType(TokenType tokenType) {
 // ReturnStmnt
 //-----------------------------------------------------------------------------
 bool ReturnStmnt::peek(const Token * tokenPtr) {
-    return tokenPtr->type == TokenType::kReturn;
+    return FirstSets::kReturnStmnt.contains(tokenPtr->type);
 }
 
 ReturnStmnt * ReturnStmnt::parse(ParseCtx & parseCtx) {
@@ -37,14 +44,13 @@ ReturnStmnt * ReturnStmnt::parse(ParseCtx & parseCtx) {
     parseCtx.nextTok();
     
     // See if a condition token follows:
-    if (isCondTokenType(parseCtx.tok()->type)) {
-        // Save the 'if' or 'unless' token and skip any newlines
+    if (isCondTokenAhead(parseCtx)) {
+        // Save the 'if' or 'unless' token
         const Token * condToken = parseCtx.tok();
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
         
         // Parse the assign expression that follows:
-        AssignExpr * condExpr = AssignExpr::parse(parseCtx);
+        Expr * condExpr = AssignExpr::parse(parseCtx);
         WC_GUARD(condExpr, nullptr);
         
         // Conditional 'return' without a value:
@@ -55,21 +61,20 @@ ReturnStmnt * ReturnStmnt::parse(ParseCtx & parseCtx) {
                                *condExpr);
     }
     
-    // See if assign expression follows:
-    if (AssignExpr::peek(parseCtx.tok())) {
+    // See if assign expression follows on the same line:
+    if (!parseCtx.tokIsPrecededByNewline() && AssignExpr::peek(parseCtx.tok())) {
         // Parse the assign expression for the return value:
-        AssignExpr * returnExpr = AssignExpr::parse(parseCtx);
+        Expr * returnExpr = AssignExpr::parse(parseCtx);
         WC_GUARD(returnExpr, nullptr);
         
         // See if a condition token follows:
-        if (isCondTokenType(parseCtx.tok()->type)) {
-            // Save the 'if' or 'unless' token and skip any newlines
+        if (isCondTokenAhead(parseCtx)) {
+            // Save the 'if' or 'unless' token
             const Token * condToken = parseCtx.tok();
             parseCtx.nextTok();
-            parseCtx.skipNewlines();
             
             // Parse the assign expression that follows:
-            AssignExpr * condExpr = AssignExpr::parse(parseCtx);
+            Expr * condExpr = AssignExpr::parse(parseCtx);
             WC_GUARD(condExpr, nullptr);
             
             // Conditional 'return' with a value:
@@ -119,7 +124,7 @@ bool ReturnStmntNoCondVoid::allCodepathsHaveUncondRet() const {
 //-----------------------------------------------------------------------------
 // ReturnStmntNoCondWithValue
 //-----------------------------------------------------------------------------
-ReturnStmntNoCondWithValue::ReturnStmntNoCondWithValue(const Token & returnToken, AssignExpr & returnExpr) :
+ReturnStmntNoCondWithValue::ReturnStmntNoCondWithValue(const Token & returnToken, Expr & returnExpr) :
     ReturnStmnt(returnToken),
     mReturnExpr(returnExpr)
 {
@@ -143,7 +148,7 @@ bool ReturnStmntNoCondWithValue::allCodepathsHaveUncondRet() const {
 //-----------------------------------------------------------------------------
 ReturnStmntWithCondBase::ReturnStmntWithCondBase(const Token & returnToken,
                                                  const Token & condToken,
-                                                 AssignExpr & condExpr)
+                                                 Expr & condExpr)
 :
     ReturnStmnt(returnToken),
     mCondToken(condToken),
@@ -169,7 +174,7 @@ bool ReturnStmntWithCondBase::allCodepathsHaveUncondRet() const {
 //-----------------------------------------------------------------------------
 ReturnStmntWithCondVoid::ReturnStmntWithCondVoid(const Token & returnToken,
                                                  const Token & condToken,
-                                                 AssignExpr & condExpr)
+                                                 Expr & condExpr)
 :
     ReturnStmntWithCondBase(returnToken, condToken, condExpr)
 {
@@ -184,9 +189,9 @@ void ReturnStmntWithCondVoid::accept(ASTNodeVisitor & visitor) const {
 // ReturnStmntWithCondAndValue
 //-----------------------------------------------------------------------------
 ReturnStmntWithCondAndValue::ReturnStmntWithCondAndValue(const Token & returnToken,
-                                                         AssignExpr & returnExpr,
+                                                         Expr & returnExpr,
                                                          const Token & condToken,
-                                                         AssignExpr & condExpr)
+                                                         Expr & condExpr)
 :
     ReturnStmntWithCondBase(returnToken,
                             condToken,
@@ -12,7 +12,7 @@
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class AssignExpr;
+class Expr;
 
 /*
 ReturnStmnt:
@@ -31,7 +31,7 @@ public:
     virtual const Token & getStartToken() const final override;
     
     /* The token for 'return' */
-    const Token & mReturnToken;
+    const Token mReturnToken;
 };
 
 /* return */
@@ -48,7 +48,7 @@ public:
 /* return AssignExpr */
 class ReturnStmntNoCondWithValue final : public ReturnStmnt {
 public:
-    ReturnStmntNoCondWithValue(const Token & returnToken, AssignExpr & returnExpr);
+    ReturnStmntNoCondWithValue(const Token & returnToken, Expr & returnExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
     virtual const Token & getEndToken() const override;
@@ -56,7 +56,7 @@ public:
     virtual bool allCodepathsHaveUncondRet() const override;
     
     /* Expression for the value to return */
-    AssignExpr & mReturnExpr;
+    Expr & mReturnExpr;
 };
 
 /* This is a base class for return statements with a condition */
@@ -64,7 +64,7 @@ class ReturnStmntWithCondBase : public ReturnStmnt {
 public:
     ReturnStmntWithCondBase(const Token & returnToken,
                             const Token & condToken,
-                            AssignExpr & condExpr);
+                            Expr & condExpr);
     
     virtual const Token & getEndToken() const final override;
     
@@ -74,10 +74,10 @@ public:
     bool isCondExprInversed() const;
 
     /* Is either 'if' or 'unless' */
-    const Token & mCondToken;
+    const Token mCondToken;
     
     /* Expression for the return condition */
-    AssignExpr & mCondExpr;
+    Expr & mCondExpr;
 };
 
 /* return if|unless AssignExpr */
@@ -85,7 +85,7 @@ class ReturnStmntWithCondVoid final : public ReturnStmntWithCondBase {
 public:
     ReturnStmntWithCondVoid(const Token & returnToken,
                             const Token & condToken,
-                            AssignExpr & condExpr);
+                            Expr & condExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -94,14 +94,14 @@ public:
 class ReturnStmntWithCondAndValue final : public ReturnStmntWithCondBase {
 public:
     ReturnStmntWithCondAndValue(const Token & returnToken,
-                                AssignExpr & returnExpr,
+                                Expr & returnExpr,
                                 const Token & condToken,
-                                AssignExpr & condExpr);
+                                Expr & condExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 
     /* Expression for the value to return */
-    AssignExpr & mReturnExpr;
+    Expr & mReturnExpr;
 };
 
 WC_AST_END_NAMESPACE
@@ -8,6 +8,7 @@
 
 #include "../ASTNodeVisitor.hpp"
 #include "../ParseCtx.hpp"
+#include "../ScratchList.hpp"
 #include "LinearAlloc.hpp"
 #include "Stmnt.hpp"
 
@@ -15,21 +16,27 @@ WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
 Scope * Scope::parse(ParseCtx & parseCtx) {
-    // Skip any newlines and commas (statement separators) that follow:
-    parseCtx.skipNewlinesAndCommas();
+    // Skip any commas (statement separators) that follow:
+    parseCtx.skipSeparators();
     
     // Save start token:
     const Token * startToken = parseCtx.tok();
     
+    // Reserve the memory for the scope upfront, all nodes created from here on until it is done are inside of it:
+    Scope * scope = parseCtx.reserveASTNode<Scope>();
+    Scope * outerScope = parseCtx.setCurrentScope(scope);
+    
     // Parse all statements we can:
-    std::vector<Stmnt*> stmnts;
+    ScratchList<Stmnt> stmnts(parseCtx);
     bool requireNewlineBetweenStmnts = false;
     
     while (Stmnt::peek(parseCtx.tok())) {
-        // Parse the statement, if that fails then try again:
+        // Parse the statement, if that fails then throw away any nodes created for it and try again:
+        ParseCtx::ASTNodeMark stmntMark = parseCtx.markASTNodes();
         Stmnt * stmnt = Stmnt::parse(parseCtx);
         
         if (!stmnt) {
+            parseCtx.rollbackASTNodes(stmntMark);
             continue;
         }
         
@@ -42,23 +49,30 @@ Scope * Scope::parse(ParseCtx & parseCtx) {
             const Token & thisStmntStart = stmnt->getStartToken();
             const Token & prevStmntEnd = lastStmnt->getEndToken();
             
-            if (thisStmntStart.startLine <= prevStmntEnd.startLine) {
-                parseCtx.error("Statements must be separated onto different lines, or by ','! "
+            const SourceLineIndex & srcLineIndex = parseCtx.getSrcLineIndex();
+            
+            if (srcLineIndex.getLine(thisStmntStart.startSrcOffset) <=
+                srcLineIndex.getLine(prevStmntEnd.startSrcOffset))
+            {
+                SourceLoc thisStmntStartLoc = srcLineIndex.getLoc(thisStmntStart.startSrcOffset);
+                SourceLoc prevStmntEndLoc = srcLineIndex.getLoc(prevStmntEnd.startSrcOffset);
+                parseCtx.error(thisStmntStart,
+                               "Statements must be separated onto different lines, or by ','! "
                                "The statement starting at line %zu, col %zu is on the same line as "
                                "the statement ending at line %zu, col %zu!",
-                               thisStmntStart.startLine + 1,
-                               thisStmntStart.startCol + 1,
-                               prevStmntEnd.startLine + 1,
-                               prevStmntEnd.startCol + 1);
+                               size_t(thisStmntStartLoc.line) + 1,
+                               size_t(thisStmntStartLoc.col) + 1,
+                               size_t(prevStmntEndLoc.line) + 1,
+                               size_t(prevStmntEndLoc.col) + 1);
             }
         }
             
-        // Save the statement and skip any newlines and commas that follow
-        stmnts.push_back(stmnt);
+        // Save the statement
+        stmnts.push(stmnt);
 
-        // Skip any newlines and commas that folllow. If any newlines or commas are found, these reset the
+        // Skip any commas that folllow. If any newlines or commas are found, these reset the
         // requirement for the next statement to be on a new line.
-        if (parseCtx.skipNewlinesAndCommas() > 0) {
+        if (parseCtx.skipSeparators()) {
             requireNewlineBetweenStmnts = false;
         }
         else {
@@ -66,11 +80,12 @@ Scope * Scope::parse(ParseCtx & parseCtx) {
         }
     }
     
-    // Return the parsed scope
-    return WC_NEW_AST_NODE(parseCtx, Scope, *startToken, std::move(stmnts));
+    // Return the parsed scope, which is itself inside of the outer scope
+    parseCtx.setCurrentScope(outerScope);
+    return WC_NEW_RESERVED_AST_NODE(parseCtx, scope, Scope, *startToken, stmnts.finish());
 }
 
-Scope::Scope(const Token & startToken, std::vector<Stmnt*> && stmnts)
+Scope::Scope(const Token & startToken, const Span<Stmnt*> & stmnts)
 :
     mStartToken(startToken),
     mStmnts(stmnts)
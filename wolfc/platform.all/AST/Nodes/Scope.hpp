@@ -9,10 +9,7 @@
 #include "ASTNode.hpp"
 #include "CStrComparator.hpp"
 #include "IStmnt.hpp"
-
-WC_THIRD_PARTY_INCLUDES_BEGIN
-    #include <vector>
-WC_THIRD_PARTY_INCLUDES_END
+#include "Span.hpp"
 
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
@@ -30,7 +27,7 @@ class Scope final : public ASTNode, public IStmnt {
 public:
     static Scope * parse(ParseCtx & parseCtx);
     
-    Scope(const Token & startToken, std::vector<Stmnt*> && stmnts);
+    Scope(const Token & startToken, const Span<Stmnt*> & stmnts);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
     virtual const Token & getStartToken() const override;
@@ -38,17 +35,25 @@ public:
     
     virtual bool allCodepathsHaveUncondRet() const override;
     
+    /**
+     * Get the token that the scope started off with. Unlike 'getStartToken' this does not depend on whether the
+     * scope has any statements.
+     */
+    inline const Token & getScopeStartToken() const {
+        return mStartToken;
+    }
+    
     /* Get all the statements in the scope */
-    inline const std::vector<Stmnt*> & getStmnts() const {
+    inline const Span<Stmnt*> & getStmnts() const {
         return mStmnts;
     }
     
 private:
     /* All the statements in the scope. */
-    std::vector<Stmnt*> mStmnts;
+    Span<Stmnt*> mStmnts;
     
     /* The start token that the scope started off with */
-    const Token & mStartToken;
+    const Token mStartToken;
 };
 
 WC_AST_END_NAMESPACE
@@ -7,6 +7,7 @@
 #include "ScopeStmnt.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "LinearAlloc.hpp"
 #include "Scope.hpp"
@@ -15,7 +16,7 @@ WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
 bool ScopeStmnt::peek(const Token * tokenPtr) {
-    return tokenPtr->type == TokenType::kScope;
+    return FirstSets::kScopeStmnt.contains(tokenPtr->type);
 }
 
 ScopeStmnt * ScopeStmnt::parse(ParseCtx & parseCtx) {
@@ -25,19 +26,16 @@ ScopeStmnt * ScopeStmnt::parse(ParseCtx & parseCtx) {
         return nullptr;
     }
     
-    // Parse the initial 'scope' keyword and save it's location.
-    // Also skip any newlines that follow:
+    // Parse the initial 'scope' keyword and save it's location:
     const Token * startToken = parseCtx.tok();
     parseCtx.nextTok();
-    parseCtx.skipNewlines();
     
-    // Parse the body scope and skip any newlines that follow:
+    // Parse the body scope:
     Scope * bodyScope = Scope::parse(parseCtx);
     WC_GUARD(bodyScope, nullptr);
-    parseCtx.skipNewlines();
     
     // Must be terminated by an 'end' token
-    if (parseCtx.tok()->type != TokenType::kEnd) {
+    if (parseCtx.tokType() != TokenType::kEnd) {
         parseCtx.error("'end' expected to terminate 'scope' block!");
         return nullptr;
     }
@@ -32,8 +32,8 @@ public:
     virtual bool allCodepathsHaveUncondRet() const override;
     
     Scope &         mBodyScope;
-    const Token &   mStartToken;
-    const Token &   mEndToken;
+    const Token     mStartToken;
+    const Token     mEndToken;
 };
 
 WC_AST_END_NAMESPACE
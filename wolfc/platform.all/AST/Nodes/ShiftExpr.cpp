@@ -7,6 +7,7 @@
 #include "ShiftExpr.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "LinearAlloc.hpp"
 #include "PrefixExpr.hpp"
@@ -18,13 +19,18 @@ WC_AST_BEGIN_NAMESPACE
 // ShiftExpr
 //-----------------------------------------------------------------------------
 bool ShiftExpr::peek(const Token * tokenPtr) {
-    return PrefixExpr::peek(tokenPtr);
+    return FirstSets::kShiftExpr.contains(tokenPtr->type);
 }
 
-ShiftExpr * ShiftExpr::parse(ParseCtx & parseCtx) {
-    PrefixExpr * leftExpr = PrefixExpr::parse(parseCtx);
+Expr * ShiftExpr::parse(ParseCtx & parseCtx) {
+    Expr * leftExpr = PrefixExpr::parse(parseCtx);
     WC_GUARD(leftExpr, nullptr);
     
+    // Operators must be on the same line as the left operand: a newline before the operator ends the expression
+    if (parseCtx.tokIsPrecededByNewline()) {
+        return leftExpr;
+    }
+    
     // See if there is a known operator ahead.
     // If we find a known operator parse the operator token, the right operand and
     // return the AST node for the operation.
@@ -32,15 +38,13 @@ ShiftExpr * ShiftExpr::parse(ParseCtx & parseCtx) {
         case TokenType: {\
             /* Consume the operator token */\
             parseCtx.nextTok();\
-            /* Skip any newlines that follow */\
-            parseCtx.skipNewlines();\
             /* Parse the right side of the operator */\
-            ShiftExpr * rightExpr = ShiftExpr::parse(parseCtx);\
+            Expr * rightExpr = ShiftExpr::parse(parseCtx);\
             WC_GUARD(rightExpr, nullptr);\
             return WC_NEW_AST_NODE(parseCtx, ASTNodeType, *leftExpr, *rightExpr);\
         }
 
-    switch (parseCtx.tok()->type) {
+    switch (parseCtx.tokType()) {
         PARSE_OP(TokenType::kLShift, ShiftExprLShift)       // <<
         PARSE_OP(TokenType::kARShift, ShiftExprARShift)     // >>
         PARSE_OP(TokenType::kLRShift, ShiftExprLRShift)     // >>>
@@ -49,33 +53,14 @@ ShiftExpr * ShiftExpr::parse(ParseCtx & parseCtx) {
             break;
     }
     
-    // Basic no-op expression:
-    return WC_NEW_AST_NODE(parseCtx, ShiftExprNoOp, *leftExpr);
-}
-
-//-----------------------------------------------------------------------------
-// ShiftExprNoOp
-//-----------------------------------------------------------------------------
-ShiftExprNoOp::ShiftExprNoOp(PrefixExpr & expr) : mExpr(expr) {
-    mExpr.mParent = this;
-}
-
-void ShiftExprNoOp::accept(ASTNodeVisitor & visitor) const {
-    visitor.visit(*this);
-}
-
-const Token & ShiftExprNoOp::getStartToken() const {
-    return mExpr.getStartToken();
-}
-
-const Token & ShiftExprNoOp::getEndToken() const {
-    return mExpr.getEndToken();
+    // No operator follows: the expression is just the left operand
+    return leftExpr;
 }
 
 //-----------------------------------------------------------------------------
 // ShiftExprTwoOps
 //-----------------------------------------------------------------------------
-ShiftExprTwoOps::ShiftExprTwoOps(PrefixExpr & leftExpr, ShiftExpr & rightExpr) :
+ShiftExprTwoOps::ShiftExprTwoOps(Expr & leftExpr, Expr & rightExpr) :
     mLeftExpr(leftExpr),
     mRightExpr(rightExpr)
 {
@@ -94,7 +79,7 @@ const Token & ShiftExprTwoOps::getEndToken() const {
 //-----------------------------------------------------------------------------
 // ShiftExprLShift
 //-----------------------------------------------------------------------------
-ShiftExprLShift::ShiftExprLShift(PrefixExpr & leftExpr, ShiftExpr & rightExpr) :
+ShiftExprLShift::ShiftExprLShift(Expr & leftExpr, Expr & rightExpr) :
     ShiftExprTwoOps(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -107,7 +92,7 @@ void ShiftExprLShift::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // ShiftExprARShift
 //-----------------------------------------------------------------------------
-ShiftExprARShift::ShiftExprARShift(PrefixExpr & leftExpr, ShiftExpr & rightExpr) :
+ShiftExprARShift::ShiftExprARShift(Expr & leftExpr, Expr & rightExpr) :
     ShiftExprTwoOps(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -120,7 +105,7 @@ void ShiftExprARShift::accept(ASTNodeVisitor & visitor) const {
 //-----------------------------------------------------------------------------
 // ShiftExprLRShift
 //-----------------------------------------------------------------------------
-ShiftExprLRShift::ShiftExprLRShift(PrefixExpr & leftExpr, ShiftExpr & rightExpr) :
+ShiftExprLRShift::ShiftExprLRShift(Expr & leftExpr, Expr & rightExpr) :
     ShiftExprTwoOps(leftExpr, rightExpr)
 {
     WC_EMPTY_FUNC_BODY();
@@ -6,14 +6,11 @@
 
 #pragma once
 
-#include "ASTNode.hpp"
-#include "IExpr.hpp"
+#include "Expr.hpp"
 
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class PrefixExpr;
-
 /*
 ShiftExpr:
     PrefixExpr
@@ -21,40 +18,28 @@ ShiftExpr:
     PrefixExpr >> ShiftExpr
     PrefixExpr >>> ShiftExpr
 */
-class ShiftExpr : public ASTNode, public IExpr {
+class ShiftExpr : public Expr {
 public:
     static bool peek(const Token * tokenPtr);
-    static ShiftExpr * parse(ParseCtx & parseCtx);
-};
-
-/* PrefixExpr */
-class ShiftExprNoOp final : public ShiftExpr {
-public:
-    ShiftExprNoOp(PrefixExpr & expr);
-    
-    virtual void accept(ASTNodeVisitor & visitor) const override;
-    virtual const Token & getStartToken() const override;
-    virtual const Token & getEndToken() const override;
-    
-    PrefixExpr & mExpr;
+    static Expr * parse(ParseCtx & parseCtx);
 };
 
 /* Base class for an ShiftExpr with two operands */
 class ShiftExprTwoOps : public ShiftExpr {
 public:
-    ShiftExprTwoOps(PrefixExpr & leftExpr, ShiftExpr & rightExpr);
+    ShiftExprTwoOps(Expr & leftExpr, Expr & rightExpr);
     
     virtual const Token & getStartToken() const final override;
     virtual const Token & getEndToken() const final override;
     
-    PrefixExpr & mLeftExpr;
-    ShiftExpr & mRightExpr;
+    Expr & mLeftExpr;
+    Expr & mRightExpr;
 };
 
 /* PrefixExpr << ShiftExpr */
 class ShiftExprLShift final : public ShiftExprTwoOps {
 public:
-    ShiftExprLShift(PrefixExpr & leftExpr, ShiftExpr & rightExpr);
+    ShiftExprLShift(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -62,7 +47,7 @@ public:
 /* PrefixExpr >> ShiftExpr */
 class ShiftExprARShift final : public ShiftExprTwoOps {
 public:
-    ShiftExprARShift(PrefixExpr & leftExpr, ShiftExpr & rightExpr);
+    ShiftExprARShift(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -70,7 +55,7 @@ public:
 /* PrefixExpr >>> ShiftExpr */
 class ShiftExprLRShift final : public ShiftExprTwoOps {
 public:
-    ShiftExprLRShift(PrefixExpr & leftExpr, ShiftExpr & rightExpr);
+    ShiftExprLRShift(Expr & leftExpr, Expr & rightExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
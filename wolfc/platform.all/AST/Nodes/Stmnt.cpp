@@ -7,6 +7,7 @@
 #include "Stmnt.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "AssertStmnt.hpp"
 #include "AssignExpr.hpp"
@@ -25,106 +26,81 @@
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
+/* Signature for a function that parses one particular kind of statement */
+typedef Stmnt * (*StmntParseFunc)(ParseCtx & parseCtx);
+
+/* Parses a statement node of the given type and wraps it in the given 'Stmnt' node type */
+template <typename StmntT, typename StmntWrapperT>
+static Stmnt * parseStmntOfType(ParseCtx & parseCtx) {
+    auto stmnt = StmntT::parse(parseCtx);
+    WC_GUARD(stmnt, nullptr);
+    return WC_NEW_AST_NODE(parseCtx, StmntWrapperT, *stmnt);
+}
+
+/**
+ * Table giving the function to parse a statement with for each token type that can start it, built at compile
+ * time from the FIRST sets of each kind of statement. This lets 'Stmnt::parse' pick what to parse with a single
+ * lookup rather than peeking at every kind of statement in turn.
+ */
+struct StmntParseTable {
+    constexpr StmntParseTable() :
+        parseFuncs{},
+        claimedTokenTypes(FirstSets::kAssignExpr),
+        hasConflicts(false)
+    {
+        // If nothing else is ahead then parse an assign expression. Note: this is also done for tokens which
+        // cannot start a statement at all, so the assign expression parsing can report the appropriate error.
+        for (StmntParseFunc & parseFunc : parseFuncs) {
+            parseFunc = parseStmntOfType<AssignExpr, StmntAssignExpr>;
+        }
+        
+        addStmntType(FirstSets::kNoOpStmnt, parseStmntOfType<NoOpStmnt, StmntNoOpStmnt>);
+        addStmntType(FirstSets::kPrintStmnt, parseStmntOfType<PrintStmnt, StmntPrintStmnt>);
+        addStmntType(FirstSets::kAssertStmnt, parseStmntOfType<AssertStmnt, StmntAssertStmnt>);
+        addStmntType(FirstSets::kVarDecl, parseStmntOfType<VarDecl, StmntVarDecl>);
+        addStmntType(FirstSets::kIfStmnt, parseStmntOfType<IfStmnt, StmntIfStmnt>);
+        addStmntType(FirstSets::kWhileStmnt, parseStmntOfType<WhileStmnt, StmntWhileStmnt>);
+        addStmntType(FirstSets::kLoopStmnt, parseStmntOfType<LoopStmnt, StmntLoopStmnt>);
+        addStmntType(FirstSets::kBreakStmnt, parseStmntOfType<BreakStmnt, StmntBreakStmnt>);
+        addStmntType(FirstSets::kScopeStmnt, parseStmntOfType<ScopeStmnt, StmntScopeStmnt>);
+        addStmntType(FirstSets::kNextStmnt, parseStmntOfType<NextStmnt, StmntNextStmnt>);
+        addStmntType(FirstSets::kReturnStmnt, parseStmntOfType<ReturnStmnt, StmntReturnStmnt>);
+    }
+    
+    /* Use the given parse function for all tokens in the given FIRST set. Flags a conflict if already used. */
+    constexpr void addStmntType(const TokenTypeSet & firstSet, StmntParseFunc parseFunc) {
+        if (claimedTokenTypes.intersects(firstSet)) {
+            hasConflicts = true;
+        }
+        
+        claimedTokenTypes = claimedTokenTypes | firstSet;
+        
+        for (size_t i = 0; i < kNumTokenTypes; ++i) {
+            if (firstSet.contains(static_cast<TokenType>(i))) {
+                parseFuncs[i] = parseFunc;
+            }
+        }
+    }
+    
+    StmntParseFunc parseFuncs[kNumTokenTypes];
+    TokenTypeSet claimedTokenTypes;
+    bool hasConflicts;
+};
+
+static constexpr const StmntParseTable kStmntParseTable{};
+
+static_assert(!kStmntParseTable.hasConflicts,
+              "The same token can begin more than one kind of statement! The grammar for 'Stmnt' is ambiguous.");
+
 //-----------------------------------------------------------------------------
 // Stmnt
 //-----------------------------------------------------------------------------
 bool Stmnt::peek(const Token * tokenPtr) {
-    return  NoOpStmnt::peek(tokenPtr) ||
-            PrintStmnt::peek(tokenPtr) ||
-            AssertStmnt::peek(tokenPtr) ||
-            VarDecl::peek(tokenPtr) ||
-            IfStmnt::peek(tokenPtr) ||
-            WhileStmnt::peek(tokenPtr) ||
-            LoopStmnt::peek(tokenPtr) ||
-            ScopeStmnt::peek(tokenPtr) ||
-            BreakStmnt::peek(tokenPtr) ||
-            NextStmnt::peek(tokenPtr) ||
-            ReturnStmnt::peek(tokenPtr) ||
-            AssignExpr::peek(tokenPtr);
+    return FirstSets::kStmnt.contains(tokenPtr->type);
 }
     
 Stmnt * Stmnt::parse(ParseCtx & parseCtx) {
-    // Parse 'noop' statment if ahead
-    if (NoOpStmnt::peek(parseCtx.tok())) {
-        NoOpStmnt * noOpStmnt = NoOpStmnt::parse(parseCtx);
-        WC_GUARD(noOpStmnt, nullptr);
-        return WC_NEW_AST_NODE(parseCtx, StmntNoOpStmnt, *noOpStmnt);
-    }
-    
-    // Parse print expression if ahead
-    if (PrintStmnt::peek(parseCtx.tok())) {
-        PrintStmnt * printStmnt = PrintStmnt::parse(parseCtx);
-        WC_GUARD(printStmnt, nullptr);
-        return WC_NEW_AST_NODE(parseCtx, StmntPrintStmnt, *printStmnt);
-    }
-    
-    // Parse assert expression if ahead
-    if (AssertStmnt::peek(parseCtx.tok())) {
-        AssertStmnt * assertStmnt = AssertStmnt::parse(parseCtx);
-        WC_GUARD(assertStmnt, nullptr);
-        return WC_NEW_AST_NODE(parseCtx, StmntAssertStmnt, *assertStmnt);
-    }
-    
-    // Parse var decl if ahead
-    if (VarDecl::peek(parseCtx.tok())) {
-        VarDecl * varDecl = VarDecl::parse(parseCtx);
-        WC_GUARD(varDecl, nullptr);
-        return WC_NEW_AST_NODE(parseCtx, StmntVarDecl, *varDecl);
-    }
-    
-    // Parse if statement if ahead
-    if (IfStmnt::peek(parseCtx.tok())) {
-        IfStmnt * ifStmnt = IfStmnt::parse(parseCtx);
-        WC_GUARD(ifStmnt, nullptr);
-        return WC_NEW_AST_NODE(parseCtx, StmntIfStmnt, *ifStmnt);
-    }
-    
-    // Parse while statement if ahead
-    if (WhileStmnt::peek(parseCtx.tok())) {
-        WhileStmnt * whileStmnt = WhileStmnt::parse(parseCtx);
-        WC_GUARD(whileStmnt, nullptr);
-        return WC_NEW_AST_NODE(parseCtx, StmntWhileStmnt, *whileStmnt);
-    }
-    
-    // Parse loop statement if ahead
-    if (LoopStmnt::peek(parseCtx.tok())) {
-        LoopStmnt * loopStmnt = LoopStmnt::parse(parseCtx);
-        WC_GUARD(loopStmnt, nullptr);
-        return WC_NEW_AST_NODE(parseCtx, StmntLoopStmnt, *loopStmnt);
-    }
-    
-    // Parse break statement if ahead
-    if (BreakStmnt::peek(parseCtx.tok())) {
-        BreakStmnt * breakStmnt = BreakStmnt::parse(parseCtx);
-        WC_GUARD(breakStmnt, nullptr);
-        return WC_NEW_AST_NODE(parseCtx, StmntBreakStmnt, *breakStmnt);
-    }
-    
-    // Parse scope statement if ahead
-    if (ScopeStmnt::peek(parseCtx.tok())) {
-        ScopeStmnt * scopeStmnt = ScopeStmnt::parse(parseCtx);
-        WC_GUARD(scopeStmnt, nullptr);
-        return WC_NEW_AST_NODE(parseCtx, StmntScopeStmnt, *scopeStmnt);
-    }
-    
-    // Parse next statement if ahead
-    if (NextStmnt::peek(parseCtx.tok())) {
-        NextStmnt * nextStmnt = NextStmnt::parse(parseCtx);
-        WC_GUARD(nextStmnt, nullptr);
-        return WC_NEW_AST_NODE(parseCtx, StmntNextStmnt, *nextStmnt);
-    }
-    
-    // Parse return statement if ahead
-    if (ReturnStmnt::peek(parseCtx.tok())) {
-        ReturnStmnt * returnStmnt = ReturnStmnt::parse(parseCtx);
-        WC_GUARD(returnStmnt, nullptr);
-        return WC_NEW_AST_NODE(parseCtx, StmntReturnStmnt, *returnStmnt);
-    }
-    
-    // Otherwise parse assign expression
-    AssignExpr * assignExpr = AssignExpr::parse(parseCtx);
-    WC_GUARD(assignExpr, nullptr);
-    return WC_NEW_AST_NODE(parseCtx, StmntAssignExpr, *assignExpr);
+    return kStmntParseTable.parseFuncs[static_cast<size_t>(parseCtx.tokType())](parseCtx);
 }
 
 //-----------------------------------------------------------------------------
@@ -383,7 +359,7 @@ bool StmntVarDecl::allCodepathsHaveUncondRet() const {
 //-----------------------------------------------------------------------------
 // StmntAssignExpr
 //-----------------------------------------------------------------------------
-StmntAssignExpr::StmntAssignExpr(AssignExpr & expr) : mExpr(expr) {
+StmntAssignExpr::StmntAssignExpr(Expr & expr) : mExpr(expr) {
     mExpr.mParent = this;
 }
 
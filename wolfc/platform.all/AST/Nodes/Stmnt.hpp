@@ -13,8 +13,8 @@ WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
 class AssertStmnt;
-class AssignExpr;
 class BreakStmnt;
+class Expr;
 class IfStmnt;
 class LoopStmnt;
 class NextStmnt;
@@ -203,7 +203,7 @@ public:
 /* AssignExpr */
 class StmntAssignExpr final : public Stmnt {
 public:
-    StmntAssignExpr(AssignExpr & expr);
+    StmntAssignExpr(Expr & expr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
     virtual const Token & getStartToken() const override;
@@ -211,7 +211,7 @@ public:
     
     virtual bool allCodepathsHaveUncondRet() const override;
     
-    AssignExpr & mExpr;
+    Expr & mExpr;
 };
 
 WC_AST_END_NAMESPACE
@@ -7,6 +7,7 @@
 #include "StrLit.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "LinearAlloc.hpp"
 
@@ -14,7 +15,7 @@ WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
 bool StrLit::peek(const Token * tokenPtr) {
-    return tokenPtr->type == TokenType::kStrLit;
+    return FirstSets::kStrLit.contains(tokenPtr->type);
 }
 
 StrLit * StrLit::parse(ParseCtx & parseCtx) {
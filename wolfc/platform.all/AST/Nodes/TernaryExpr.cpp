@@ -7,6 +7,7 @@
 #include "TernaryExpr.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "AssignExpr.hpp"
 #include "LOrExpr.hpp"
@@ -19,72 +20,50 @@ WC_AST_BEGIN_NAMESPACE
 // TernaryExpr
 //-----------------------------------------------------------------------------
 bool TernaryExpr::peek(const Token * tokenPtr) {
-    return LOrExpr::peek(tokenPtr);
+    return FirstSets::kTernaryExpr.contains(tokenPtr->type);
 }
 
-TernaryExpr * TernaryExpr::parse(ParseCtx & parseCtx) {
+Expr * TernaryExpr::parse(ParseCtx & parseCtx) {
     // Parse the initial expression
-    LOrExpr * firstExpr = LOrExpr::parse(parseCtx);
+    Expr * firstExpr = LOrExpr::parse(parseCtx);
     WC_GUARD(firstExpr, nullptr);
     
-    // See if a '?' follows:
-    if (parseCtx.tok()->type == TokenType::kQMark) {
-        // Alright, consume that '?' and skip any newlines that follow:
+    // See if a '?' follows on the same line:
+    if (!parseCtx.tokIsPrecededByNewline() && parseCtx.tokType() == TokenType::kQMark) {
+        // Alright, consume that '?':
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
         
-        // Now parse the 'true' expression and skip any newlines that follow:
-        AssignExpr * trueExpr = AssignExpr::parse(parseCtx);
+        // Now parse the 'true' expression:
+        Expr * trueExpr = AssignExpr::parse(parseCtx);
         WC_GUARD(trueExpr, nullptr);
-        parseCtx.skipNewlines();
         
         // Expect a colon to separate 'true' from false:
-        if (parseCtx.tok()->type != TokenType::kColon) {
+        if (parseCtx.tokType() != TokenType::kColon) {
             parseCtx.error("Expected ':' following 'true' value in ternary expression.");
             return nullptr;
         }
         
-        // Consume the ':' and skip any newlines that follow
+        // Consume the ':'
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
         
         // Now parse the 'false' expression:
-        AssignExpr * falseExpr = AssignExpr::parse(parseCtx);
+        Expr * falseExpr = AssignExpr::parse(parseCtx);
         WC_GUARD(falseExpr, nullptr);
         
         // All done: return the parsed node:
         return WC_NEW_AST_NODE(parseCtx, TernaryExprWithCond, *firstExpr, *trueExpr, *falseExpr);
     }
 
-    // Ternary expression with no condition:
-    return WC_NEW_AST_NODE(parseCtx, TernaryExprNoCond, *firstExpr);
-}
-
-//-----------------------------------------------------------------------------
-// TernaryExprNoCond
-//-----------------------------------------------------------------------------
-TernaryExprNoCond::TernaryExprNoCond(LOrExpr & expr) : mExpr(expr) {
-    mExpr.mParent = this;
-}
-
-void TernaryExprNoCond::accept(ASTNodeVisitor & visitor) const {
-    visitor.visit(*this);
-}
-
-const Token & TernaryExprNoCond::getStartToken() const {
-    return mExpr.getStartToken();
-}
-
-const Token & TernaryExprNoCond::getEndToken() const {
-    return mExpr.getEndToken();
+    // No condition follows: the expression is just the first operand
+    return firstExpr;
 }
 
 //-----------------------------------------------------------------------------
 // TernaryExprWithCond
 //-----------------------------------------------------------------------------
-TernaryExprWithCond::TernaryExprWithCond(LOrExpr & condExpr,
-                                         AssignExpr & trueExpr,
-                                         AssignExpr & falseExpr)
+TernaryExprWithCond::TernaryExprWithCond(Expr & condExpr,
+                                         Expr & trueExpr,
+                                         Expr & falseExpr)
 :
     mCondExpr(condExpr),
     mTrueExpr(trueExpr),
@@ -6,52 +6,36 @@
 
 #pragma once
 
-#include "ASTNode.hpp"
-#include "IExpr.hpp"
+#include "Expr.hpp"
 
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class AssignExpr;
-class LOrExpr;
-
 /*
 TernaryExpr:
     LOrExpr
     LOrExpr ? AssignExpr : AssignExpr
 */
-class TernaryExpr : public ASTNode, public IExpr {
+class TernaryExpr : public Expr {
 public:
     static bool peek(const Token * tokenPtr);
-    static TernaryExpr * parse(ParseCtx & parseCtx);
-};
-
-/* LOrExpr */
-class TernaryExprNoCond final : public TernaryExpr {
-public:
-    TernaryExprNoCond(LOrExpr & expr);
-    
-    virtual void accept(ASTNodeVisitor & visitor) const override;
-    virtual const Token & getStartToken() const override;
-    virtual const Token & getEndToken() const override;
-    
-    LOrExpr & mExpr;
+    static Expr * parse(ParseCtx & parseCtx);
 };
 
 /* LOrExpr ? AssignExpr : AssignExpr */
 class TernaryExprWithCond final : public TernaryExpr {
 public:
-    TernaryExprWithCond(LOrExpr & condExpr,
-                        AssignExpr & trueExpr,
-                        AssignExpr & falseExpr);
+    TernaryExprWithCond(Expr & condExpr,
+                        Expr & trueExpr,
+                        Expr & falseExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
     virtual const Token & getStartToken() const override;
     virtual const Token & getEndToken() const override;
     
-    LOrExpr &       mCondExpr;
-    AssignExpr &    mTrueExpr;
-    AssignExpr &    mFalseExpr;
+    Expr &          mCondExpr;
+    Expr &          mTrueExpr;
+    Expr &          mFalseExpr;
 };
 
 WC_AST_END_NAMESPACE
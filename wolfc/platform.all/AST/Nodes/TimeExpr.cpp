@@ -7,6 +7,7 @@
 #include "TimeExpr.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "LinearAlloc.hpp"
 
@@ -14,31 +15,29 @@ WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
 bool TimeExpr::peek(const Token * tokenPtr) {
-    return tokenPtr->type == TokenType::kTime;
+    return FirstSets::kTimeExpr.contains(tokenPtr->type);
 }
 
 TimeExpr * TimeExpr::parse(ParseCtx & parseCtx) {
-    // Consume 'time' and skip any newlines that follow
-    if (parseCtx.tok()->type != TokenType::kTime) {
+    // Consume 'time'
+    if (parseCtx.tokType() != TokenType::kTime) {
         parseCtx.error("Expected 'time' at begining of time() expression!");
         return nullptr;
     }
     
     const Token * readnumTok = parseCtx.tok();
     parseCtx.nextTok();
-    parseCtx.skipNewlines();
     
-    // Parse the '(' and skip any newlines that follow
-    if (parseCtx.tok()->type != TokenType::kLParen) {
+    // Parse the '('
+    if (parseCtx.tokType() != TokenType::kLParen) {
         parseCtx.error("Expect '(' following 'time'!");
         return nullptr;
     }
     
     parseCtx.nextTok();
-    parseCtx.skipNewlines();
     
     // Parse the closing ')' and return the parsed node
-    if (parseCtx.tok()->type != TokenType::kRParen) {
+    if (parseCtx.tokType() != TokenType::kRParen) {
         parseCtx.error("Expect ')' following '('!");
         return nullptr;
     }
@@ -29,8 +29,8 @@ public:
     virtual const Token & getStartToken() const override;
     virtual const Token & getEndToken() const override;
     
-    const Token & mStartToken;
-    const Token & mEndToken;
+    const Token mStartToken;
+    const Token mEndToken;
 };
 
 WC_AST_END_NAMESPACE
@@ -7,6 +7,7 @@
 #include "Type.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "AssignExpr.hpp"
 #include "LinearAlloc.hpp"
@@ -19,22 +20,17 @@ WC_AST_BEGIN_NAMESPACE
 // Type
 //-----------------------------------------------------------------------------
 bool Type::peek(const Token * currentToken) {
-    TokenType currentTokenType = currentToken->type;
-    return  currentTokenType == TokenType::kHat ||
-            currentTokenType == TokenType::kQMark ||
-            currentTokenType == TokenType::kLBrack ||
-            PrimitiveType::peek(currentToken);
+    return FirstSets::kType.contains(currentToken->type);
 }
 
 Type * Type::parse(ParseCtx & parseCtx) {
     // See if there is a pointer type following:
-    TokenType currentTokType = parseCtx.tok()->type;
+    TokenType currentTokType = parseCtx.tokType();
     
     if (currentTokType == TokenType::kHat || currentTokType == TokenType::kQMark) {
-        // Array type ahead: skip the '^' or '?' and any newlines that follow
+        // Array type ahead: skip the '^' or '?'
         const Token * startToken = parseCtx.tok();
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
         
         // Parse the type pointed to:
         Type * pointedToType = Type::parse(parseCtx);
@@ -46,26 +42,22 @@ Type * Type::parse(ParseCtx & parseCtx) {
     
     // See if there is an array type following:
     if (currentTokType == TokenType::kLBrack) {
-        // Array type ahead: skip the '[' and any newlines that follow
+        // Array type ahead: skip the '['
         const Token * startToken = parseCtx.tok();
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
         
-        // Parse the inner assign expression for the array size.
-        // Also skip any newlines following it:
-        AssignExpr * arraySizeExpr = AssignExpr::parse(parseCtx);
+        // Parse the inner assign expression for the array size:
+        Expr * arraySizeExpr = AssignExpr::parse(parseCtx);
         WC_GUARD(arraySizeExpr, nullptr);
-        parseCtx.skipNewlines();
         
         // Expect a ']' next:
-        if (parseCtx.tok()->type != TokenType::kRBrack) {
+        if (parseCtx.tokType() != TokenType::kRBrack) {
             parseCtx.error("Expected ']' to close array size specifier!");
             return nullptr;
         }
         
-        // Skip ']' and any newlines that follow
+        // Skip ']'
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
         
         // Parse the inner type following:
         Type * innerType = Type::parse(parseCtx);
@@ -91,7 +83,7 @@ bool Type::isAny() const {
 // TypePrimitive
 //-----------------------------------------------------------------------------
 TypePrimitive::TypePrimitive(PrimitiveType & type) : mType(type) {
-    mParent = this;
+    mType.mParent = this;
 }
 
 void TypePrimitive::accept(ASTNodeVisitor & visitor) const {
@@ -139,7 +131,7 @@ bool TypePtr::isNullablePtr() const {
 //-----------------------------------------------------------------------------
 // TypeArray
 //-----------------------------------------------------------------------------
-TypeArray::TypeArray(const Token & startToken, AssignExpr & sizeExpr, Type & elemType) :
+TypeArray::TypeArray(const Token & startToken, Expr & sizeExpr, Type & elemType) :
     mStartToken(startToken),
     mSizeExpr(sizeExpr),
     mElemType(elemType)
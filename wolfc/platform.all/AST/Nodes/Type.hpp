@@ -11,7 +11,7 @@
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class AssignExpr;
+class Expr;
 class PrimitiveType;
 
 /*
@@ -54,21 +54,21 @@ public:
     
     bool isNullablePtr() const;
     
-    const Token &   mStartToken;
+    const Token     mStartToken;
     Type &          mPointedToType;
 };
 
 /* [ AssignExpr ] Type */
 class TypeArray final : public Type {
 public:
-    TypeArray(const Token & startToken, AssignExpr & sizeExpr, Type & elemType);
+    TypeArray(const Token & startToken, Expr & sizeExpr, Type & elemType);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
     virtual const Token & getStartToken() const override;
     virtual const Token & getEndToken() const override;
     
-    const Token &   mStartToken;
-    AssignExpr &    mSizeExpr;
+    const Token     mStartToken;
+    Expr &          mSizeExpr;
     Type &          mElemType;
 };
 
@@ -7,6 +7,7 @@
 #include "VarDecl.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "AssignExpr.hpp"
 #include "Identifier.hpp"
@@ -20,51 +21,46 @@ WC_AST_BEGIN_NAMESPACE
 // VarDecl
 //-----------------------------------------------------------------------------
 bool VarDecl::peek(const Token * tokenPtr) {
-    return tokenPtr->type == TokenType::kLet;
+    return FirstSets::kVarDecl.contains(tokenPtr->type);
 }
 
 VarDecl * VarDecl::parse(ParseCtx & parseCtx) {
     // Parse 'let' keyword
-    if (parseCtx.tok()->type != TokenType::kLet) {
+    if (parseCtx.tokType() != TokenType::kLet) {
         parseCtx.error("Expected keyword 'let' at start of a variable declaration!");
         return nullptr;
     }
     
-    // Save and skip 'let' and consume any newlines that follow
+    // Save and skip 'let'
     const Token * varToken = parseCtx.tok();
     parseCtx.nextTok();
-    parseCtx.skipNewlines();
     
-    // Parse the identifier ahead and skip any newlines that follow
+    // Parse the identifier ahead
     Identifier * ident = Identifier::parse(parseCtx);
     WC_GUARD(ident, nullptr);
-    parseCtx.skipNewlines();
     
     // See if the type for the variable is specified
     Type * type = nullptr;
     
-    if (parseCtx.tok()->type == TokenType::kColon) {
-        // Type specified, skip the ':' and any newlines that follow
+    if (parseCtx.tokType() == TokenType::kColon) {
+        // Type specified, skip the ':'
         parseCtx.nextTok();
-        parseCtx.skipNewlines();
         
-        // Parse the type and skip any newlines that follow:
+        // Parse the type:
         type = Type::parse(parseCtx);
         WC_GUARD(type, nullptr);
-        parseCtx.skipNewlines();
     }
     
-    // Parse the '=' and skip any newlines that follow
-    if (parseCtx.tok()->type != TokenType::kAssign) {
+    // Parse the '='
+    if (parseCtx.tokType() != TokenType::kAssign) {
         parseCtx.error("Expected '=' following variable name for variable declaration!");
         return nullptr;
     }
     
     parseCtx.nextTok();
-    parseCtx.skipNewlines();
     
     // Parse the init expression and return result of parsing
-    AssignExpr * initExpr = AssignExpr::parse(parseCtx);
+    Expr * initExpr = AssignExpr::parse(parseCtx);
     WC_GUARD(initExpr, nullptr);
     
     if (type) {
@@ -77,11 +73,12 @@ VarDecl * VarDecl::parse(ParseCtx & parseCtx) {
 
 VarDecl::VarDecl(const Token & token,
                  Identifier & ident,
-                 AssignExpr & initExpr)
+                 Expr & initExpr)
 :
     mStartToken(token),
     mIdent(ident),
-    mInitExpr(initExpr)
+    mInitExpr(initExpr),
+    mDeclId(kInvalidDeclId)
 {
     mIdent.mParent = this;
     mInitExpr.mParent = this;
@@ -104,7 +101,7 @@ bool VarDecl::allCodepathsHaveUncondRet() const {
 //-----------------------------------------------------------------------------
 VarDeclInferType::VarDeclInferType(const Token & startToken,
                                    Identifier & ident,
-                                   AssignExpr & initExpr)
+                                   Expr & initExpr)
 :
     VarDecl(startToken, ident, initExpr)
 {
@@ -121,7 +118,7 @@ void VarDeclInferType::accept(ASTNodeVisitor & visitor) const {
 VarDeclExplicitType::VarDeclExplicitType(const Token & startToken,
                                          Identifier & ident,
                                          Type & type,
-                                         AssignExpr & initExpr)
+                                         Expr & initExpr)
 :
     VarDecl(startToken, ident, initExpr),
     mType(type)
@@ -6,13 +6,14 @@
 
 #pragma once
 
+#include "AST/NameBindings.hpp"
 #include "ASTNode.hpp"
 #include "IStmnt.hpp"
 
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class AssignExpr;
+class Expr;
 class Identifier;
 class Module;
 class Type;
@@ -29,16 +30,19 @@ public:
     
     VarDecl(const Token & startToken,
             Identifier & ident,
-            AssignExpr & initExpr);
+            Expr & initExpr);
     
     virtual const Token & getStartToken() const final override;
     virtual const Token & getEndToken() const final override;
     
     virtual bool allCodepathsHaveUncondRet() const final override;
     
-    const Token &   mStartToken;
+    const Token     mStartToken;
     Identifier &    mIdent;
-    AssignExpr &    mInitExpr;
+    Expr &          mInitExpr;
+    
+    /* The id of the declaration made by the variable. Set by 'NameBinder', see 'NameBindings'. */
+    mutable DeclId  mDeclId;
 };
 
 /* let Identifier = AssignExpr */
@@ -46,7 +50,7 @@ class VarDeclInferType final : public VarDecl {
 public:
     VarDeclInferType(const Token & startToken,
                      Identifier & ident,
-                     AssignExpr & initExpr);
+                     Expr & initExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
 };
@@ -57,7 +61,7 @@ public:
     VarDeclExplicitType(const Token & startToken,
                         Identifier & ident,
                         Type & type,
-                        AssignExpr & initExpr);
+                        Expr & initExpr);
     
     virtual void accept(ASTNodeVisitor & visitor) const override;
     
@@ -7,6 +7,7 @@
 #include "WhileStmnt.hpp"
 
 #include "../ASTNodeVisitor.hpp"
+#include "../FirstSets.hpp"
 #include "../ParseCtx.hpp"
 #include "AssignExpr.hpp"
 #include "LinearAlloc.hpp"
@@ -16,13 +17,11 @@ WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
 bool WhileStmnt::peek(const Token * tokenPtr) {
-    TokenType tokenType = tokenPtr->type;
-    return tokenType == TokenType::kWhile || tokenType == TokenType::kUntil;
+    return FirstSets::kWhileStmnt.contains(tokenPtr->type);
 }
 
 WhileStmnt * WhileStmnt::parse(ParseCtx & parseCtx) {
     // Parse the initial 'while' or 'until' keyword.
-    // Skip any newlines that follow this keyword also..
     if (!peek(parseCtx.tok())) {
         parseCtx.error("While statement expected!");
         return nullptr;
@@ -30,18 +29,17 @@ WhileStmnt * WhileStmnt::parse(ParseCtx & parseCtx) {
     
     const Token * startToken = parseCtx.tok();
     parseCtx.nextTok();
-    parseCtx.skipNewlines();
     
-    // Parse the while expression (while condition) and any newlines that follow:
-    AssignExpr * whileExpr = AssignExpr::parse(parseCtx);
+    // Parse the while expression (while condition) and see if a newline follows:
+    Expr * whileExpr = AssignExpr::parse(parseCtx);
     WC_GUARD(whileExpr, nullptr);
-    bool bodyScopeIsOnNewLine = parseCtx.skipNewlines();
+    bool bodyScopeIsOnNewLine = parseCtx.tokIsPrecededByNewline();
     
     // See if there is a 'do' following. This keyword is optional, but it allows the body scope
     // to be on the same line as the enclosing while statement:
     bool bodyScopeRequiresNL = true;
     
-    if (parseCtx.tok()->type == TokenType::kDo) {
+    if (parseCtx.tokType() == TokenType::kDo) {
         // Found a 'do' token: the body scope is allowed to be on the same line:
         parseCtx.nextTok();
         bodyScopeRequiresNL = false;
@@ -53,13 +51,12 @@ WhileStmnt * WhileStmnt::parse(ParseCtx & parseCtx) {
                        "'do' is used after the condition.");
     }
     
-    // Expect scope following. Parse it and skip any newlines that follow:
+    // Expect scope following. Parse it:
     Scope * bodyScope = Scope::parse(parseCtx);
     WC_GUARD(bodyScope, nullptr);
-    parseCtx.skipNewlines();
     
     // While block should be terminated by an 'end' token:
-    if (parseCtx.tok()->type != TokenType::kEnd) {
+    if (parseCtx.tokType() != TokenType::kEnd) {
         parseCtx.error("'end' expected to terminate 'while/until' block!");
         return nullptr;
     }
@@ -72,7 +69,7 @@ WhileStmnt * WhileStmnt::parse(ParseCtx & parseCtx) {
     return WC_NEW_AST_NODE(parseCtx, WhileStmnt, *whileExpr, *bodyScope, *startToken, *endToken);
 }
 
-WhileStmnt::WhileStmnt(AssignExpr & whileExpr,
+WhileStmnt::WhileStmnt(Expr & whileExpr,
                        Scope & bodyScope,
                        const Token & startToken,
                        const Token & endToken)
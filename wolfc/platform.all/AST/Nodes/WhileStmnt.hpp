@@ -12,7 +12,7 @@
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-class AssignExpr;
+class Expr;
 
 /*
 WhileStmnt:
@@ -23,7 +23,7 @@ public:
     static bool peek(const Token * tokenPtr);
     static WhileStmnt * parse(ParseCtx & parseCtx);
     
-    WhileStmnt(AssignExpr & whileExpr,
+    WhileStmnt(Expr & whileExpr,
                Scope & bodyScope,
                const Token & startToken,
                const Token & endToken);
@@ -40,10 +40,10 @@ public:
      */
     bool isWhileExprInversed() const;
     
-    AssignExpr &    mWhileExpr;
+    Expr &          mWhileExpr;
     Scope &         mBodyScope;
-    const Token &   mStartToken;
-    const Token &   mEndToken;
+    const Token     mStartToken;
+    const Token     mEndToken;
 };
 
 WC_AST_END_NAMESPACE
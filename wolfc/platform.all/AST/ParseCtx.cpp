@@ -7,39 +7,69 @@
 #include "ParseCtx.hpp"
 
 #include "Assert.hpp"
+#include "Lexer/Lexer.hpp"
 
 WC_BEGIN_NAMESPACE
 WC_AST_BEGIN_NAMESPACE
 
-ParseCtx::ParseCtx(const Token * startToken, LinearAlloc & linearAlloc) :
+ParseCtx::ParseCtx(const Token * startToken,
+                   const TokenType * startTokenType,
+                   const SourceLineIndex & srcLineIndex,
+                   LinearAlloc & linearAlloc)
+:
     mCurrentToken(startToken),
-    mLinearAlloc(linearAlloc)
+    mCurrentTokenType(startTokenType),
+    mStreamingLexer(nullptr),
+    mTokenWindowLimit(nullptr),
+    mSrcLineIndex(srcLineIndex),
+    mLinearAlloc(linearAlloc),
+    mNumASTNodes(0),
+    mNumASTNodeBytes(0),
+    mCurrentFunc(nullptr),
+    mCurrentScope(nullptr)
 {
     WC_ASSERT(mCurrentToken);
+    WC_ASSERT(mCurrentTokenType);
+    WC_ASSERT(mCurrentToken->type == *mCurrentTokenType);
 }
 
-size_t ParseCtx::skipNewlines() {
-    size_t numSkipped = 0;
-    
-    while (mCurrentToken->type == TokenType::kNewline) {
-        ++mCurrentToken;
-        ++numSkipped;
-    }
-    
-    return numSkipped;
+ParseCtx::ParseCtx(Lexer & streamingLexer, LinearAlloc & linearAlloc)
+:
+    mCurrentToken(nullptr),
+    mCurrentTokenType(nullptr),
+    mStreamingLexer(&streamingLexer),
+    mTokenWindowLimit(nullptr),
+    mSrcLineIndex(streamingLexer.getSrcLineIndex()),
+    mLinearAlloc(linearAlloc),
+    mNumASTNodes(0),
+    mNumASTNodeBytes(0),
+    mCurrentFunc(nullptr),
+    mCurrentScope(nullptr)
+{
+    // Pull in the first window of tokens and start at the first token
+    WC_ASSERT(streamingLexer.getTokenCount() == 0);
+    mStreamingLexer->pullTokens();
+    mCurrentToken = mStreamingLexer->getTokenList();
+    mCurrentTokenType = mStreamingLexer->getTokenTypeList();
+    updateTokenWindowLimit();
+    
+    WC_ASSERT(mCurrentToken->type == *mCurrentTokenType);
 }
 
-size_t ParseCtx::skipNewlinesAndCommas() {
-    size_t numSkipped = 0;
-    TokenType tokenType = mCurrentToken->type;
+bool ParseCtx::skipSeparators() {
+    bool skippedComma = false;
     
-    while (tokenType == TokenType::kNewline || tokenType == TokenType::kComma) {
-        ++mCurrentToken;
-        ++numSkipped;
-        tokenType = mCurrentToken->type;
+    while (*mCurrentTokenType == TokenType::kComma) {
+        nextTok();
+        skippedComma = true;
     }
     
-    return numSkipped;
+    return skippedComma || mCurrentToken->isPrecededByNewline();
+}
+
+void ParseCtx::commitTokens() {
+    WC_GUARD(mStreamingLexer);
+    mStreamingLexer->commitTokens(static_cast<size_t>(mCurrentTokenType - mStreamingLexer->getTokenTypeList()));
 }
 
 bool ParseCtx::hasErrors() const {
@@ -77,10 +107,11 @@ void ParseCtx::error(const Token & atToken, const char * msgFmtStr, std::va_list
     char msgBuf[kMaxMsgLen];
     
     // Print the start of the message
+    SourceLoc srcLoc = mSrcLineIndex.getLoc(atToken.startSrcOffset);
     std::sprintf(msgBuf,
                  "@line %zu, col %zu: Error! ",
-                 atToken.startLine + 1,
-                 atToken.startCol + 1);
+                 size_t(srcLoc.line) + 1,
+                 size_t(srcLoc.col) + 1);
     
     // Get how long the message is so far:
     size_t msgPrefixLen = std::strlen(msgBuf);
@@ -122,10 +153,11 @@ void ParseCtx::warning(const Token & atToken, const char * msgFmtStr, std::va_li
     char msgBuf[kMaxMsgLen];
     
     // Print the start of the message
+    SourceLoc srcLoc = mSrcLineIndex.getLoc(atToken.startSrcOffset);
     std::sprintf(msgBuf,
                  "@line %zu, col %zu: Warning: ",
-                 atToken.startLine + 1,
-                 atToken.startCol + 1);
+                 size_t(srcLoc.line) + 1,
+                 size_t(srcLoc.col) + 1);
     
     // Get how long the message is so far:
     size_t msgPrefixLen = std::strlen(msgBuf);
@@ -140,5 +172,30 @@ void ParseCtx::warning(const Token & atToken, const char * msgFmtStr, std::va_li
     mWarningMsgs.push_back(msgBuf);
 }
 
+void ParseCtx::pullTokens() {
+    // Note: the lexer may move the token list, and drop tokens from the start of it, when pulling.
+    // Figure out where we are in the token list so we can find the current token again afterwards.
+    WC_ASSERT(mStreamingLexer);
+    size_t currentTokenIdx = static_cast<size_t>(mCurrentTokenType - mStreamingLexer->getTokenTypeList());
+    currentTokenIdx -= mStreamingLexer->pullTokens();
+    mCurrentToken = mStreamingLexer->getTokenList() + currentTokenIdx;
+    mCurrentTokenType = mStreamingLexer->getTokenTypeList() + currentTokenIdx;
+    updateTokenWindowLimit();
+}
+
+void ParseCtx::updateTokenWindowLimit() {
+    // If the lexer is done then all the remaining tokens are in the window and there is nothing more to pull
+    if (mStreamingLexer->isFinished()) {
+        mTokenWindowLimit = nullptr;
+        return;
+    }
+    
+    // Otherwise pull more tokens once there is no longer enough lookahead past the current token
+    size_t tokenCount = mStreamingLexer->getTokenCount();
+    WC_ASSERT(tokenCount > kMinTokenLookahead);
+    mTokenWindowLimit = mStreamingLexer->getTokenTypeList() + (tokenCount - kMinTokenLookahead);
+    WC_ASSERT(mCurrentTokenType < mTokenWindowLimit);
+}
+
 WC_AST_END_NAMESPACE
 WC_END_NAMESPACE
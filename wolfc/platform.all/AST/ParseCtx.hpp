@@ -6,8 +6,11 @@
 
 #pragma once
 
+#include "ASTNodeKind.hpp"
 #include "Assert.hpp"
+#include "Lexer/SourceLineIndex.hpp"
 #include "Lexer/Token.hpp"
+#include "LinearAlloc.hpp"
 #include "Macros.hpp"
 
 WC_THIRD_PARTY_INCLUDES_BEGIN
@@ -18,38 +21,75 @@ WC_THIRD_PARTY_INCLUDES_END
 
 WC_BEGIN_NAMESPACE
 
-class LinearAlloc;
+class Lexer;
 struct Token;
 
 WC_AST_BEGIN_NAMESPACE
 
-/* Macro for skipping newline tokens types, given a token pointer */
-#define WC_PARSER_SKIP_NEWLINE_TOKENS(tokenPtr)\
-    do {\
-        while (tokenPtr->type == TokenType::kNewline) {\
-            ++tokenPtr;\
-        }\
-    }   while (0)
+class Func;
+class Scope;
 
 /* Class holding the current context for parsing */
 class ParseCtx {
 public:
-    /* Creates the parse context */
-    ParseCtx(const Token * startToken, LinearAlloc & linearAlloc);
+    /**
+     * The number of tokens following the current token which are guaranteed to be available, unless EOF comes
+     * before that. This only matters in streaming mode, where tokens are pulled from the lexer in windows.
+     * Parsing code must not look further ahead than this from the current token.
+     */
+    static constexpr const size_t kMinTokenLookahead = 1;
+    
+    /* A point in AST node allocation that can be rolled back to, see 'markASTNodes' and 'rollbackASTNodes' */
+    struct ASTNodeMark {
+        LinearAlloc::Mark allocMark;
+        size_t numASTNodes;
+        size_t numASTNodeBytes;
+    };
+    
+    /**
+     * Creates the parse context. Takes the token to start parsing at along with the matching entry
+     * in the token type list of the lexer (see 'Lexer::getTokenTypeList'), and the line index for
+     * the source code that the tokens came from.
+     */
+    ParseCtx(const Token * startToken,
+             const TokenType * startTokenType,
+             const SourceLineIndex & srcLineIndex,
+             LinearAlloc & linearAlloc);
+    
+    /**
+     * Creates a parse context which streams tokens from the given lexer. The lexer must have been started with
+     * 'Lexer::beginStreaming'. Tokens are pulled from the lexer in windows as parsing proceeds, so lexing and
+     * parsing are interleaved. See 'commitTokens' for how the memory for tokens is recycled.
+     */
+    ParseCtx(Lexer & streamingLexer, LinearAlloc & linearAlloc);
     
     /**
      * Get the pointer to the current token we are on.
      * Note that subsequent tokens can be accessed using array indexing if lookahead is required, 
-     * since the tokens are stored in a regular C style array.
+     * since the tokens are stored in a regular C style array. See 'kMinTokenLookahead' however.
      */
     inline const Token * tok() {
         return mCurrentToken;
     }
     
+    /**
+     * Get the type of the current token we are on. This is read from the separate token type list,
+     * which is cheaper than going through the token itself when only the type is needed.
+     */
+    inline TokenType tokType() const {
+        return *mCurrentTokenType;
+    }
+    
     /* Skip onto the next token. Will not move past the current token if we are on EOF */
     inline void nextTok() {
-        if (mCurrentToken->type != TokenType::kEOF) {
+        if (*mCurrentTokenType != TokenType::kEOF) {
             ++mCurrentToken;
+            ++mCurrentTokenType;
+            
+            // In streaming mode, pull more tokens when we get near the end of the current window
+            if (mCurrentTokenType == mTokenWindowLimit) {
+                pullTokens();
+            }
         }
     }
     
@@ -62,22 +102,136 @@ public:
     }
     
     /**
-     * Skip any newline tokens that are found. 
-     * Returns the number of newlines skipped. 
+     * Tells if the current token is preceded by a newline. Newlines are not tokens, so parsing rules which
+     * depend on them (e.g. operators must be on the same line as the left operand) check this instead.
      */
-    size_t skipNewlines();
+    inline bool tokIsPrecededByNewline() const {
+        return mCurrentToken->isPrecededByNewline();
+    }
     
     /**
-     * Skip any newline and comma tokens that are found.
-     * Returns the number of newlines skipped.
+     * Skip any comma tokens that are found. Commas and newlines separate statements and declarations.
+     * Returns true if a separator was found, i.e. one or more commas were skipped or the current token is
+     * preceded by a newline.
+     */
+    bool skipSeparators();
+    
+    /**
+     * Mark all tokens before the current token as being fully parsed. In streaming mode this lets the lexer
+     * recycle the memory for those tokens; nothing happens otherwise.
+     *
+     * This must only be called when nothing is holding pointers to any of the earlier tokens, for instance in
+     * between top level declarations. AST nodes keep their own copies of tokens so they are unaffected.
      */
-    size_t skipNewlinesAndCommas();
+    void commitTokens();
+    
+    /* Get the line index for the source code being parsed, used to get line and column info for tokens */
+    inline const SourceLineIndex & getSrcLineIndex() const {
+        return mSrcLineIndex;
+    }
     
     /* Get the liner allocator for the parse context */
     inline LinearAlloc & getAlloc() {
         return mLinearAlloc;
     }
     
+    /* Allocate the memory for an AST node of the given type and count it. Used by 'WC_NEW_AST_NODE'. */
+    template <typename T>
+    inline void * allocASTNode() {
+        ++mNumASTNodes;
+        mNumASTNodeBytes += sizeof(T);
+        return mLinearAlloc.allocSizeOf<T>();
+    }
+    
+    /**
+     * Reserve the memory for an AST node of the given type, without creating it yet. The node must later be
+     * created in this memory with 'WC_NEW_RESERVED_AST_NODE'. This allows a function or scope node to be
+     * referred to (but not accessed) by the nodes inside of it while they are being parsed.
+     */
+    template <typename T>
+    inline T * reserveASTNode() {
+        return static_cast<T*>(allocASTNode<T>());
+    }
+    
+    /**
+     * Finish off the creation of a new AST node. Sets the kind of the node and the function and scope that it is
+     * inside of. Used by 'WC_NEW_AST_NODE'.
+     */
+    template <typename T>
+    inline T * addASTNode(T * node) {
+        node->mKind = ASTNodeKindOf<T>::kKind;
+        node->mParentFunc = mCurrentFunc;
+        node->mParentScope = mCurrentScope;
+        return node;
+    }
+    
+    /**
+     * Set the function currently being parsed, which all nodes created from here on are inside of.
+     * Returns the previous function so that it can be restored once done parsing the function.
+     */
+    inline Func * setCurrentFunc(Func * func) {
+        Func * prevFunc = mCurrentFunc;
+        mCurrentFunc = func;
+        return prevFunc;
+    }
+    
+    /**
+     * Set the scope currently being parsed, which all nodes created from here on are inside of.
+     * Returns the previous scope so that it can be restored once done parsing the scope.
+     */
+    inline Scope * setCurrentScope(Scope * scope) {
+        Scope * prevScope = mCurrentScope;
+        mCurrentScope = scope;
+        return prevScope;
+    }
+    
+    /**
+     * Allocate the memory for a list of child nodes (or other items) for an AST node, with room for the given
+     * number of items. The memory is counted as AST node memory. See 'ScratchList' for how these are built.
+     */
+    template <typename T>
+    inline T * allocASTNodeList(size_t numItems) {
+        mNumASTNodeBytes += sizeof(T) * numItems;
+        return reinterpret_cast<T*>(mLinearAlloc.alloc(sizeof(T) * numItems, alignof(T)));
+    }
+    
+    /**
+     * Get the current point in AST node allocation, so that any nodes created after this point can be discarded
+     * later with 'rollbackASTNodes'. Used to throw away the nodes for parses which failed.
+     */
+    inline ASTNodeMark markASTNodes() const {
+        return ASTNodeMark{ mLinearAlloc.mark(), mNumASTNodes, mNumASTNodeBytes };
+    }
+    
+    /**
+     * Discard all AST nodes created since the given point, freeing their memory. Nothing may refer to the
+     * discarded nodes, and the nodes being parsed at the time of the mark (such as the current function or
+     * scope) must still be in progress.
+     */
+    inline void rollbackASTNodes(const ASTNodeMark & mark) {
+        mLinearAlloc.rollback(mark.allocMark);
+        mNumASTNodes = mark.numASTNodes;
+        mNumASTNodeBytes = mark.numASTNodeBytes;
+    }
+    
+    /**
+     * Get the scratch stack for the parse context. Lists of child nodes are built on top of this stack while
+     * they are being parsed and then copied into the linear allocator once complete. See 'ScratchList'.
+     */
+    inline std::vector<void*> & getScratchStack() {
+        return mScratchStack;
+    }
+    
+    /* Get the number of AST nodes created so far with this parse context */
+    inline size_t getNumASTNodes() const {
+        return mNumASTNodes;
+    }
+    
+    /* Get the total size in bytes of the AST nodes (and their child lists) created so far with this parse context */
+    inline size_t getNumASTNodeBytes() const {
+        return mNumASTNodeBytes;
+    }
+    
     /* Tells if there are errors in the parse context */
     bool hasErrors() const;
     
@@ -123,12 +277,49 @@ public:
 private:
     WC_DISALLOW_COPY_AND_ASSIGN(ParseCtx)
     
+    /* Streaming mode: pull the next window of tokens from the lexer and update the current token pointers */
+    void pullTokens();
+    
+    /* Streaming mode: update the point in the token window at which more tokens must be pulled */
+    void updateTokenWindowLimit();
+    
     /* The current token we are on. Incremented as parsing happens. */
     const Token * mCurrentToken;
     
+    /* The type of the current token we are on. Always incremented along with the current token. */
+    const TokenType * mCurrentTokenType;
+    
+    /* The lexer that tokens are pulled from in streaming mode, null otherwise */
+    Lexer * mStreamingLexer;
+    
+    /**
+     * Streaming mode: when the current token type reaches this point in the token window, more tokens are pulled.
+     * Null if there are no more tokens to pull or if not in streaming mode.
+     */
+    const TokenType * mTokenWindowLimit;
+    
+    /* Line index for the source code being parsed */
+    const SourceLineIndex & mSrcLineIndex;
+    
     /* A linear allocator that can be used during parsing. Used to allocate AST nodes */
     LinearAlloc & mLinearAlloc;
     
+    /* The number of AST nodes created so far */
+    size_t mNumASTNodes;
+    
+    /* The total size in bytes of the AST nodes created so far, including their lists of child nodes */
+    size_t mNumASTNodeBytes;
+    
+    /**
+     * Scratch stack used to build lists of child nodes during parsing. Reused for every list, so that the
+     * lists themselves only need to be allocated once, at their final size. See 'ScratchList'.
+     */
+    std::vector<void*> mScratchStack;
+    
+    /* The function and scope currently being parsed, if any. See 'setCurrentFunc' and 'setCurrentScope'. */
+    Func * mCurrentFunc;
+    Scope * mCurrentScope;
+    
     /* A list of error messages emitted during parsing */
     std::vector<std::string> mErrorMsgs;
     
@@ -0,0 +1,89 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#pragma once
+
+#include "ParseCtx.hpp"
+#include "Span.hpp"
+
+WC_BEGIN_NAMESPACE
+WC_AST_BEGIN_NAMESPACE
+
+/**
+ * Builds a list of child nodes for an AST node while parsing, on top of the scratch stack of the parse context.
+ * Once the list is complete 'finish' copies it into the linear allocator for the AST in one go, so the list
+ * is laid out contiguously and no heap memory is needed for it (or leaked) once parsing is done.
+ *
+ * Lists can be nested, for example the statements of a scope being parsed in the middle of parsing the
+ * statements of an outer scope. This works because each list only ever adds to the top of the stack and
+ * removes its own items from the stack when it is finished or goes out of scope, so a nested list is always
+ * done with before the list it is nested in adds its next item.
+ */
+template <typename T>
+class ScratchList {
+public:
+    inline ScratchList(ParseCtx & parseCtx) :
+        mParseCtx(parseCtx),
+        mScratchStack(parseCtx.getScratchStack()),
+        mStartIndex(mScratchStack.size())
+    {
+        WC_EMPTY_FUNC_BODY();
+    }
+    
+    inline ~ScratchList() {
+        // Remove the items for this list from the stack, if not already done
+        mScratchStack.resize(mStartIndex);
+    }
+    
+    /* Add an item to the end of the list */
+    inline void push(T * item) {
+        // If this fails then a nested list was not done with before adding to this list
+        WC_ASSERT(mScratchStack.size() >= mStartIndex);
+        mScratchStack.push_back(item);
+    }
+    
+    /* Get the number of items in the list */
+    inline size_t size() const {
+        return mScratchStack.size() - mStartIndex;
+    }
+    
+    /* Get the last item in the list, the list must not be empty */
+    inline T * back() const {
+        WC_ASSERT(size() > 0);
+        return static_cast<T*>(mScratchStack.back());
+    }
+    
+    /**
+     * Copy the completed list into the linear allocator for the parse context, remove it from the scratch
+     * stack and return a span for the copied list.
+     */
+    Span<T*> finish() {
+        size_t numItems = size();
+        T ** items = mParseCtx.allocASTNodeList<T*>(numItems);
+        
+        for (size_t i = 0; i < numItems; ++i) {
+            items[i] = static_cast<T*>(mScratchStack[mStartIndex + i]);
+        }
+        
+        mScratchStack.resize(mStartIndex);
+        return Span<T*>(items, numItems);
+    }
+    
+private:
+    WC_DISALLOW_COPY_AND_ASSIGN(ScratchList)
+    
+    /* The parse context which owns the scratch stack */
+    ParseCtx & mParseCtx;
+    
+    /* The scratch stack that the list is built on */
+    std::vector<void*> & mScratchStack;
+    
+    /* Index on the scratch stack of the first item in the list */
+    size_t mStartIndex;
+};
+
+WC_AST_END_NAMESPACE
+WC_END_NAMESPACE
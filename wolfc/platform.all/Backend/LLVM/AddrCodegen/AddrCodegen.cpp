@@ -218,16 +218,6 @@ WC_IMPL_CANT_TAKE_ADDR_FOR_NODE_TYPE(TimeExpr, "Can't take the address of a time
         astNode.subExprField.accept(*this);\
     }
 
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(AddExprNoOp, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(AssignExprNoAssign, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(CastExprNoCast, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(CmpExprNoOp, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(LAndExprNoOp, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(LOrExprNoOp, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(MulExprNoOp, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(NotExprNoOp, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(PostfixExprNoOp, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(PrefixExprNoOp, mExpr)
 WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(PrimaryExprArrayLit, mLit)
 WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(PrimaryExprBoolLit, mLit)
 WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(PrimaryExprIdentifier, mIdent)
@@ -238,9 +228,7 @@ WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(PrimaryExprRandExpr, mExpr)
 WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(PrimaryExprReadnumExpr, mExpr)
 WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(PrimaryExprStrLit, mLit)
 WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(PrimaryExprTimeExpr, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(ShiftExprNoOp, mExpr)
 WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(StmntAssignExpr, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(TernaryExprNoCond, mExpr)
 
 #undef WC_IMPL_DELEGATE_OP_TO_INNER_EXPR_FOR_NODE_TYPE
 
@@ -290,9 +278,9 @@ void AddrCodegen::visit(const AST::CastExprCast & astNode) {
 void AddrCodegen::visit(const AST::Identifier & astNode) {
     WC_CODEGEN_RECORD_VISITED_NODE();
     
-    // Search for a value declared in the current scope or parent scopes.
+    // Get the value for the declaration that the identifier refers to.
     // When found just return the value, variables are stored by address.
-    const Value * value = mCtx.lookupValueByName(astNode.name());
+    const Value * value = mCtx.lookupValue(astNode);
     
     if (value) {
         mCtx.pushValue(*value);
@@ -478,9 +466,8 @@ void AddrCodegen::cantTakeAddressOfUnaryOpError(const AST::ASTNode & exprNode,
                                                 const char * opSymbol,
                                                 const char * opName)
 {
-    // Get the node as an expression
-    const AST::IExpr * expr = dynamic_cast<const AST::IExpr*>(&exprNode);
-    WC_ASSERT(expr);
+    // The node should be an expression
+    WC_ASSERT(exprNode.isExpr());
     
     // Get the parent of the node (the unary operator node)
     const AST::ASTNode * parent = exprNode.mParent;
@@ -504,11 +491,9 @@ void AddrCodegen::cantTakeAddressOfBinaryOpError(const AST::ASTNode & leftExprNo
                                                  const char * opSymbol,
                                                  const char * opName)
 {
-    // Get the left and right nodes as expressions
-    const AST::IExpr * leftExpr = dynamic_cast<const AST::IExpr*>(&leftExprNode);
-    const AST::IExpr * rightExpr = dynamic_cast<const AST::IExpr*>(&rightExprNode);
-    WC_ASSERT(leftExpr);
-    WC_ASSERT(rightExpr);
+    // The left and right nodes should be expressions
+    WC_ASSERT(leftExprNode.isExpr());
+    WC_ASSERT(rightExprNode.isExpr());
     
     // Get the parent of the left and right expression (the binary operator node)
     const AST::ASTNode * parent = leftExprNode.mParent;
@@ -36,7 +36,6 @@ public:
     virtual void visit(const AST::AddExprAdd & astNode) override;
     virtual void visit(const AST::AddExprBOr & astNode) override;
     virtual void visit(const AST::AddExprBXor & astNode) override;
-    virtual void visit(const AST::AddExprNoOp & astNode) override;
     virtual void visit(const AST::AddExprSub & astNode) override;
     virtual void visit(const AST::ArrayLit & astNode) override;
     virtual void visit(const AST::AssertStmnt & astNode) override;
@@ -52,19 +51,16 @@ public:
     virtual void visit(const AST::AssignExprAssignMul & astNode) override;
     virtual void visit(const AST::AssignExprAssignRem & astNode) override;
     virtual void visit(const AST::AssignExprAssignSub & astNode) override;
-    virtual void visit(const AST::AssignExprNoAssign & astNode) override;
     virtual void visit(const AST::BoolLit & astNode) override;
     virtual void visit(const AST::BreakStmntNoCond & astNode) override;
     virtual void visit(const AST::BreakStmntWithCond & astNode) override;
     virtual void visit(const AST::CastExprCast & astNode) override;
-    virtual void visit(const AST::CastExprNoCast & astNode) override;
     virtual void visit(const AST::CmpExprEQ & astNode) override;
     virtual void visit(const AST::CmpExprGE & astNode) override;
     virtual void visit(const AST::CmpExprGT & astNode) override;
     virtual void visit(const AST::CmpExprLE & astNode) override;
     virtual void visit(const AST::CmpExprLT & astNode) override;
     virtual void visit(const AST::CmpExprNE & astNode) override;
-    virtual void visit(const AST::CmpExprNoOp & astNode) override;
     virtual void visit(const AST::DeclDefFunc & astNode) override;
     virtual void visit(const AST::DeclDefVarDecl & astNode) override;
     virtual void visit(const AST::Func & astNode) override;
@@ -75,8 +71,6 @@ public:
     virtual void visit(const AST::IfStmntNoElse & astNode) override;
     virtual void visit(const AST::IntLit & astNode) override;
     virtual void visit(const AST::LAndExprAnd & astNode) override;
-    virtual void visit(const AST::LAndExprNoOp & astNode) override;
-    virtual void visit(const AST::LOrExprNoOp & astNode) override;
     virtual void visit(const AST::LOrExprOr & astNode) override;
     virtual void visit(const AST::LoopStmntNoCond & astNode) override;
     virtual void visit(const AST::LoopStmntWithCond & astNode) override;
@@ -84,23 +78,19 @@ public:
     virtual void visit(const AST::MulExprBAnd & astNode) override;
     virtual void visit(const AST::MulExprDiv & astNode) override;
     virtual void visit(const AST::MulExprMul & astNode) override;
-    virtual void visit(const AST::MulExprNoOp & astNode) override;
     virtual void visit(const AST::MulExprRem & astNode) override;
     virtual void visit(const AST::NextStmntNoCond & astNode) override;
     virtual void visit(const AST::NextStmntWithCond & astNode) override;
     virtual void visit(const AST::NoOpStmnt & astNode) override;
     virtual void visit(const AST::NotExprBNot & astNode) override;
     virtual void visit(const AST::NotExprLNot & astNode) override;
-    virtual void visit(const AST::NotExprNoOp & astNode) override;
     virtual void visit(const AST::NullLit & astNode) override;
     virtual void visit(const AST::PostfixExprArrayLookup & astNode) override;
     virtual void visit(const AST::PostfixExprDec & astNode) override;
     virtual void visit(const AST::PostfixExprFuncCall & astNode) override;
     virtual void visit(const AST::PostfixExprInc & astNode) override;
-    virtual void visit(const AST::PostfixExprNoOp & astNode) override;
     virtual void visit(const AST::PrefixExprAddrOf & astNode) override;
     virtual void visit(const AST::PrefixExprMinus & astNode) override;
-    virtual void visit(const AST::PrefixExprNoOp & astNode) override;
     virtual void visit(const AST::PrefixExprPlus & astNode) override;
     virtual void visit(const AST::PrefixExprPtrDenull & astNode) override;
     virtual void visit(const AST::PrefixExprPtrDeref & astNode) override;
@@ -128,7 +118,6 @@ public:
     virtual void visit(const AST::ShiftExprARShift & astNode) override;
     virtual void visit(const AST::ShiftExprLRShift & astNode) override;
     virtual void visit(const AST::ShiftExprLShift & astNode) override;
-    virtual void visit(const AST::ShiftExprNoOp & astNode) override;
     virtual void visit(const AST::StmntAssertStmnt & astNode) override;
     virtual void visit(const AST::StmntAssignExpr & astNode) override;
     virtual void visit(const AST::StmntBreakStmnt & astNode) override;
@@ -142,7 +131,6 @@ public:
     virtual void visit(const AST::StmntVarDecl & astNode) override;
     virtual void visit(const AST::StmntWhileStmnt & astNode) override;
     virtual void visit(const AST::StrLit & astNode) override;
-    virtual void visit(const AST::TernaryExprNoCond & astNode) override;
     virtual void visit(const AST::TernaryExprWithCond & astNode) override;
     virtual void visit(const AST::TimeExpr & astNode) override;
     virtual void visit(const AST::TypeArray & astNode) override;
@@ -195,16 +195,6 @@ WC_IMPL_CODEGEN_ADDR_FOR_NODE_TYPE(PrefixExprPtrDeref)
         astNode.subExprField.accept(*this);\
     }
 
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(AddExprNoOp, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(AssignExprNoAssign, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(CastExprNoCast, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(CmpExprNoOp, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(LAndExprNoOp, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(LOrExprNoOp, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(MulExprNoOp, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(NotExprNoOp, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(PostfixExprNoOp, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(PrefixExprNoOp, mExpr)
 WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(PrimaryExprArrayLit, mLit)
 WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(PrimaryExprBoolLit, mLit)
 WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(PrimaryExprIdentifier, mIdent)
@@ -215,9 +205,7 @@ WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(PrimaryExprRandExpr, mExpr)
 WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(PrimaryExprReadnumExpr, mExpr)
 WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(PrimaryExprStrLit, mLit)
 WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(PrimaryExprTimeExpr, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(ShiftExprNoOp, mExpr)
 WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(StmntAssignExpr, mExpr)
-WC_IMPL_DELEGATE_OP_TO_SUB_EXPR_FOR_NODE_TYPE(TernaryExprNoCond, mExpr)
 
 #undef WC_IMPL_DELEGATE_OP_TO_INNER_EXPR_FOR_NODE_TYPE
 
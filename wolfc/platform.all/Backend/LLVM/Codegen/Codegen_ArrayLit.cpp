@@ -36,7 +36,7 @@ void Codegen::visit(const AST::ArrayLit & astNode) {
     std::vector<Value> values;
     values.reserve(subExprsSize);
     
-    for (const AST::AssignExpr * subExpr : subExprs) {
+    for (const AST::Expr * subExpr : subExprs) {
         subExpr->accept(*this);
         values.push_back(mCtx.popValue());
         const Value & value = values.back();
@@ -68,11 +68,11 @@ void Codegen::visit(const AST::AssertStmnt & astNode) {
     WC_GUARD(abortFn && printfFn && exprVal.isValid() && exprIsBool);
     
     // Create basic blocks for assert failed and assert succeeded:
-    std::string failBBLbl = StringUtils::appendLineInfo("AssertStmnt:fail", astNode.getStartToken());
+    std::string failBBLbl = StringUtils::appendLineInfo("AssertStmnt:fail", astNode.getStartToken(), mCtx.getSrcLineIndex());
     llvm::BasicBlock * failBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, failBBLbl, parentFn);
     WC_ASSERT(failBB);
     
-    std::string passBBLbl = StringUtils::appendLineInfo("AssertStmnt:pass", astNode.getPastEndToken());
+    std::string passBBLbl = StringUtils::appendLineInfo("AssertStmnt:pass", astNode.getPastEndSrcOffset(), mCtx.getSrcLineIndex());
     llvm::BasicBlock * passBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, passBBLbl, parentFn);
     WC_ASSERT(passBB);
     
@@ -86,14 +86,15 @@ void Codegen::visit(const AST::AssertStmnt & astNode) {
     {
         const Token & startTok = astNode.mExpr.getStartToken();
         const Token & endTok = astNode.mExpr.getEndToken();
-        size_t exprCodeLength = static_cast<size_t>(endTok.endSrcPtr - startTok.startSrcPtr);
+        SourceLoc startLoc = mCtx.getSrcLineIndex().getLoc(startTok.startSrcOffset);
+        size_t exprCodeLength = endTok.endSrcOffset - startTok.startSrcOffset;
         assertMsgStr.reserve(128 + exprCodeLength);
         assertMsgStr += "Assert failed on line ";
-        assertMsgStr += std::to_string(startTok.startLine + 1);
+        assertMsgStr += std::to_string(startLoc.line + 1);
         assertMsgStr += " char ";
-        assertMsgStr += std::to_string(startTok.startCol + 1);;
+        assertMsgStr += std::to_string(startLoc.col + 1);;
         assertMsgStr += "!: assert(";
-        assertMsgStr.append(startTok.startSrcPtr, exprCodeLength);
+        assertMsgStr.append(mCtx.getSrcText() + startTok.startSrcOffset, exprCodeLength);
         assertMsgStr += ")\n";
     }
     
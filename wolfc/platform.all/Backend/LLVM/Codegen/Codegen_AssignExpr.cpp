@@ -20,11 +20,6 @@
 WC_BEGIN_NAMESPACE
 WC_LLVM_BACKEND_BEGIN_NAMESPACE
 
-void Codegen::visit(const AST::AssignExprNoAssign & astNode) {
-    WC_CODEGEN_RECORD_VISITED_NODE();
-    astNode.mExpr.accept(*this);
-}
-
 void Codegen::visit(const AST::AssignExprAssign & astNode) {
     WC_CODEGEN_RECORD_VISITED_NODE();
     
@@ -71,7 +71,9 @@ void Codegen::visit(const AST::BreakStmntNoCond & astNode) {
     WC_ASSERT(parentFn);
     
     // Create the basic block for the 'break' code
-    std::string breakBBLbl = StringUtils::appendLineInfo("BreakStmntNoCond:break", astNode.getStartToken());
+    std::string breakBBLbl = StringUtils::appendLineInfo("BreakStmntNoCond:break",
+                                                         astNode.getStartToken(),
+                                                         mCtx.getSrcLineIndex());
     llvm::BasicBlock * breakBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, breakBBLbl, parentFn);
     WC_ASSERT(breakBB);
     
@@ -90,12 +92,16 @@ void Codegen::visit(const AST::BreakStmntWithCond & astNode) {
     WC_ASSERT(parentFn);
     
     // Create the basic block for the break code
-    std::string breakBBLbl = StringUtils::appendLineInfo("BreakStmntWithCond:break", astNode.getStartToken());
+    std::string breakBBLbl = StringUtils::appendLineInfo("BreakStmntWithCond:break",
+                                                         astNode.getStartToken(),
+                                                         mCtx.getSrcLineIndex());
     llvm::BasicBlock * breakBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, breakBBLbl, parentFn);
     WC_ASSERT(breakBB);
     
     // Create the basic block for the continue code:
-    std::string continueBBLbl = StringUtils::appendLineInfo("BreakStmntWithCond:continue", astNode.getPastEndToken());
+    std::string continueBBLbl = StringUtils::appendLineInfo("BreakStmntWithCond:continue",
+                                                            astNode.getPastEndSrcOffset(),
+                                                            mCtx.getSrcLineIndex());
     llvm::BasicBlock * continueBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, continueBBLbl, parentFn);
     WC_ASSERT(continueBB);
     
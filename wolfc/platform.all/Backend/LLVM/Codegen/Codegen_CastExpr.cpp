@@ -15,11 +15,6 @@
 WC_BEGIN_NAMESPACE
 WC_LLVM_BACKEND_BEGIN_NAMESPACE
 
-void Codegen::visit(const AST::CastExprNoCast & astNode) {
-    WC_CODEGEN_RECORD_VISITED_NODE();
-    astNode.mExpr.accept(*this);
-}
-
 void Codegen::visit(const AST::CastExprCast & astNode) {
     WC_CODEGEN_RECORD_VISITED_NODE();
     CodegenCastUnaryOp(*this, astNode.mExpr, astNode.mType).codegen();
@@ -56,7 +56,8 @@ static void doDeferredFuncCodegen(Codegen & cg, const AST::Func & astNode, Const
     
     // Create the user function entry block and set it as the insert point for ir builder
     std::string fnUserEntryBBLbl = StringUtils::appendLineInfo("Func:UserEntryBB",
-                                                               astNode.getScope().getStartToken());
+                                                               astNode.getScope().getStartToken(),
+                                                               cg.mCtx.getSrcLineIndex());
     
     llvm::BasicBlock * fnUserEntryBB = llvm::BasicBlock::Create(cg.mCtx.mLLVMCtx,
                                                                 fnUserEntryBBLbl,
@@ -124,6 +125,7 @@ void Codegen::visit(const AST::Func & astNode) {
                                                             nullptr,
                                                             fnCompiledTy,
                                                             astNode,
+                                                            astNode.mDeclId,
                                                             false);
     
     // Create the function object itself:
@@ -142,7 +144,9 @@ void Codegen::visit(const AST::Func & astNode) {
     llvmFn->setDoesNotThrow();
     
     // Create the basic block to hold the function prologue and make it the current insert point
-    std::string fnPrologueBBLbl = StringUtils::appendLineInfo("Func:PrologueBB", astNode.getStartToken());
+    std::string fnPrologueBBLbl = StringUtils::appendLineInfo("Func:PrologueBB",
+                                                              astNode.getStartToken(),
+                                                              mCtx.getSrcLineIndex());
     llvm::BasicBlock * fnPrologueBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, fnPrologueBBLbl, llvmFn);
     WC_ASSERT(fnPrologueBB);
     mCtx.mIRBuilder.SetInsertPoint(fnPrologueBB);
@@ -156,6 +160,7 @@ void Codegen::visit(const AST::Func & astNode) {
                                     fnCompiledTy,
                                     false,
                                     astNode,
+                                    astNode.mDeclId,
                                     true);
     
     // Get the val holder for the function scope, will register the function argument variables in this
@@ -210,6 +215,7 @@ void Codegen::visit(const AST::Func & astNode) {
                                         funcArgCDT,
                                         true,
                                         *funcArg,
+                                        funcArg->mDeclId,
                                         false);
             }
             else {
@@ -18,9 +18,9 @@ WC_LLVM_BACKEND_BEGIN_NAMESPACE
 void Codegen::visit(const AST::Identifier & astNode) {
     WC_CODEGEN_RECORD_VISITED_NODE();
 
-    // Search for a value declared in the current scope or parent scopes.
+    // Get the value for the declaration that the identifier refers to.
     // When found just return the loaded value:
-    const Value * value = mCtx.lookupValueByName(astNode.name());
+    const Value * value = mCtx.lookupValue(astNode);
     
     if (!value) {
         // Couldn't find any value with this name, issue a compile error:
@@ -23,7 +23,7 @@ void Codegen::visit(const AST::IfStmntNoElse & astNode) {
     WC_CODEGEN_RECORD_VISITED_NODE();
     
     // Generate the code for the if statement condition expression:
-    const AST::AssignExpr & ifExpr = astNode.mIfExpr;
+    const AST::Expr & ifExpr = astNode.mIfExpr;
     ifExpr.accept(*this);
     Value ifExprVal = mCtx.popValue();
     
@@ -56,7 +56,9 @@ void Codegen::visit(const AST::IfStmntNoElse & astNode) {
     
     // Create the start basic block for the 'then' scope:
     const AST::Scope & thenScope = astNode.mThenScope;
-    std::string thenBBLbl = StringUtils::appendLineInfo("IfStmntNoElse:then", thenScope.getStartToken());
+    std::string thenBBLbl = StringUtils::appendLineInfo("IfStmntNoElse:then",
+                                                        thenScope.getStartToken(),
+                                                        mCtx.getSrcLineIndex());
     llvm::BasicBlock * thenBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, thenBBLbl, parentFn);
     WC_ASSERT(thenBB);
 
@@ -69,7 +71,9 @@ void Codegen::visit(const AST::IfStmntNoElse & astNode) {
     WC_ASSERT(thenEndBB);
     
     // Create the end basic block for the if statement:
-    std::string endBBLbl = StringUtils::appendLineInfo("IfStmntNoElse:end", astNode.getEndToken());
+    std::string endBBLbl = StringUtils::appendLineInfo("IfStmntNoElse:end",
+                                                       astNode.getEndToken(),
+                                                       mCtx.getSrcLineIndex());
     llvm::BasicBlock * endBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, endBBLbl, parentFn);
     WC_ASSERT(endBB);
     
@@ -103,7 +107,7 @@ void Codegen::visit(const AST::IfStmntElse & astNode) {
     WC_CODEGEN_RECORD_VISITED_NODE();
     
     // Generate the code for the if statement condition expression:
-    const AST::AssignExpr & ifExpr = astNode.mIfExpr;
+    const AST::Expr & ifExpr = astNode.mIfExpr;
     ifExpr.accept(*this);
     Value ifExprVal = mCtx.popValue();
     
@@ -136,7 +140,9 @@ void Codegen::visit(const AST::IfStmntElse & astNode) {
     
     // Create the start basic block for the 'then' scope:
     const AST::Scope & thenScope = astNode.mThenScope;
-    std::string thenBBLbl = StringUtils::appendLineInfo("IfStmntElse:then", thenScope.getStartToken());
+    std::string thenBBLbl = StringUtils::appendLineInfo("IfStmntElse:then",
+                                                        thenScope.getStartToken(),
+                                                        mCtx.getSrcLineIndex());
     llvm::BasicBlock * thenBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, thenBBLbl, parentFn);
     WC_ASSERT(thenBB);
     
@@ -150,7 +156,9 @@ void Codegen::visit(const AST::IfStmntElse & astNode) {
     
     // Create the start basic block for the 'else' scope:
     const AST::Scope & elseScope = astNode.mElseScope;
-    std::string elseBBLbl = StringUtils::appendLineInfo("IfStmntElse:else", elseScope.getStartToken());
+    std::string elseBBLbl = StringUtils::appendLineInfo("IfStmntElse:else",
+                                                        elseScope.getStartToken(),
+                                                        mCtx.getSrcLineIndex());
     llvm::BasicBlock * elseBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, elseBBLbl, parentFn);
     WC_ASSERT(elseBB);
     
@@ -163,7 +171,9 @@ void Codegen::visit(const AST::IfStmntElse & astNode) {
     WC_ASSERT(elseEndBB);
     
     // Create the end basic block for the if statement:
-    std::string endBBLbl = StringUtils::appendLineInfo("IfStmntElse:end", astNode.getEndToken());
+    std::string endBBLbl = StringUtils::appendLineInfo("IfStmntElse:end",
+                                                       astNode.getEndToken(),
+                                                       mCtx.getSrcLineIndex());
     llvm::BasicBlock * endBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, endBBLbl, parentFn);
     WC_ASSERT(endBB);
     
@@ -204,7 +214,7 @@ void Codegen::visit(const AST::IfStmntElseIf & astNode) {
     WC_CODEGEN_RECORD_VISITED_NODE();
 
     // Generate the code for the if statement condition expression:
-    const AST::AssignExpr & ifExpr = astNode.mIfExpr;
+    const AST::Expr & ifExpr = astNode.mIfExpr;
     ifExpr.accept(*this);
     Value ifExprVal = mCtx.popValue();
     
@@ -237,7 +247,9 @@ void Codegen::visit(const AST::IfStmntElseIf & astNode) {
     
     // Create the start basic block for the 'then' scope:
     const AST::Scope & thenScope = astNode.mThenScope;
-    std::string thenBBLbl = StringUtils::appendLineInfo("IfStmntElseIf:then", thenScope.getStartToken());
+    std::string thenBBLbl = StringUtils::appendLineInfo("IfStmntElseIf:then",
+                                                        thenScope.getStartToken(),
+                                                        mCtx.getSrcLineIndex());
     llvm::BasicBlock * thenBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, thenBBLbl, parentFn);
     WC_ASSERT(thenBB);
     
@@ -251,7 +263,9 @@ void Codegen::visit(const AST::IfStmntElseIf & astNode) {
     
     // Create the start basic block for the 'outer if' scope:
     const AST::IfStmnt & elseIfStmnt = astNode.mElseIfStmnt;
-    std::string outerIfBBLbl = StringUtils::appendLineInfo("IfStmntElseIf:outer_if", elseIfStmnt.getStartToken());
+    std::string outerIfBBLbl = StringUtils::appendLineInfo("IfStmntElseIf:outer_if",
+                                                           elseIfStmnt.getStartToken(),
+                                                           mCtx.getSrcLineIndex());
     llvm::BasicBlock * outerIfBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, outerIfBBLbl, parentFn);
     WC_ASSERT(outerIfBB);
     
@@ -264,7 +278,9 @@ void Codegen::visit(const AST::IfStmntElseIf & astNode) {
     WC_ASSERT(outerIfEndBB);
     
     // Create the end basic block for the if statement:
-    std::string endBBLbl = StringUtils::appendLineInfo("IfStmntElseIf:end", astNode.getEndToken());
+    std::string endBBLbl = StringUtils::appendLineInfo("IfStmntElseIf:end",
+                                                       astNode.getEndToken(),
+                                                       mCtx.getSrcLineIndex());
     llvm::BasicBlock * endBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, endBBLbl, parentFn);
     WC_ASSERT(endBB);
     
@@ -35,7 +35,8 @@ void Codegen::visit(const AST::LoopStmntNoCond & astNode) {
     // Note: also make the previous block branch to this block in order to properly terminate it.
     // Note: This is also the target of the 'next' statement.
     std::string startBBLbl = StringUtils::appendLineInfo("LoopStmntNoCond:block",
-                                                         astNode.getStartToken());
+                                                         astNode.getStartToken(),
+                                                         mCtx.getSrcLineIndex());
     
     llvm::BasicBlock * startBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx,
                                                           startBBLbl,
@@ -52,7 +53,8 @@ void Codegen::visit(const AST::LoopStmntNoCond & astNode) {
     // Create the end basic block: we go here on exiting the loop.
     // Note: this is also the target of the 'break' statement.
     std::string endBBLbl = StringUtils::appendLineInfo("LoopStmntNoCond:end",
-                                                       astNode.getPastEndToken());
+                                                       astNode.getPastEndSrcOffset(),
+                                                       mCtx.getSrcLineIndex());
     
     llvm::BasicBlock * endBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx,
                                                         endBBLbl,
@@ -83,7 +85,8 @@ void Codegen::visit(const AST::LoopStmntWithCond & astNode) {
     // Create the 'loop' main block.
     // Note: also make the previous block branch to this block in order to properly terminate it.
     std::string startBBLbl = StringUtils::appendLineInfo("LoopStmntWithCond:block",
-                                                         astNode.getStartToken());
+                                                         astNode.getStartToken(),
+                                                         mCtx.getSrcLineIndex());
     
     llvm::BasicBlock * startBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx,
                                                           startBBLbl,
@@ -100,7 +103,8 @@ void Codegen::visit(const AST::LoopStmntWithCond & astNode) {
     // Note: also make the previous block branch to this block in order to properly terminate it.
     // Note: This is also the target of the 'next' statement.
     std::string loopCondBBLbl = StringUtils::appendLineInfo("LoopStmntWithCond:cond",
-                                                            astNode.mLoopCondExpr.getStartToken());
+                                                            astNode.mLoopCondExpr.getStartToken(),
+                                                            mCtx.getSrcLineIndex());
     
     llvm::BasicBlock * loopCondBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx,
                                                              loopCondBBLbl,
@@ -123,7 +127,8 @@ void Codegen::visit(const AST::LoopStmntWithCond & astNode) {
     // Generate the end basic block:
     // Note: This is also the target of the 'break' statement.
     std::string endBBLbl = StringUtils::appendLineInfo("LoopStmntWithCond:end",
-                                                       astNode.getPastEndToken());
+                                                       astNode.getPastEndSrcOffset(),
+                                                       mCtx.getSrcLineIndex());
     
     llvm::BasicBlock * endBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx,
                                                         endBBLbl,
@@ -71,7 +71,9 @@ void Codegen::visit(const AST::NextStmntNoCond & astNode) {
     WC_ASSERT(parentFn);
     
     // Create the basic block for the 'next' code
-    std::string nextBBLbl = StringUtils::appendLineInfo("NextStmntNoCond:stmnt", astNode.getStartToken());
+    std::string nextBBLbl = StringUtils::appendLineInfo("NextStmntNoCond:stmnt",
+                                                        astNode.getStartToken(),
+                                                        mCtx.getSrcLineIndex());
     llvm::BasicBlock * nextBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, nextBBLbl, parentFn);
     WC_ASSERT(nextBB);
     
@@ -90,12 +92,16 @@ void Codegen::visit(const AST::NextStmntWithCond & astNode) {
     WC_ASSERT(parentFn);
     
     // Create the basic block for the next code
-    std::string nextBBLbl = StringUtils::appendLineInfo("NextStmntWithCond:next", astNode.getStartToken());
+    std::string nextBBLbl = StringUtils::appendLineInfo("NextStmntWithCond:next",
+                                                        astNode.getStartToken(),
+                                                        mCtx.getSrcLineIndex());
     llvm::BasicBlock * nextBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, nextBBLbl, parentFn);
     WC_ASSERT(nextBB);
     
     // Create the basic block for the continue code:
-    std::string continueBBLbl = StringUtils::appendLineInfo("NextStmntWithCond:continue", astNode.getPastEndToken());
+    std::string continueBBLbl = StringUtils::appendLineInfo("NextStmntWithCond:continue",
+                                                            astNode.getPastEndSrcOffset(),
+                                                            mCtx.getSrcLineIndex());
     llvm::BasicBlock * continueBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, continueBBLbl, parentFn);
     WC_ASSERT(continueBB);
     
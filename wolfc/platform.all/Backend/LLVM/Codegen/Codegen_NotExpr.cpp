@@ -14,11 +14,6 @@
 WC_BEGIN_NAMESPACE
 WC_LLVM_BACKEND_BEGIN_NAMESPACE
 
-void Codegen::visit(const AST::NotExprNoOp & astNode) {
-    WC_CODEGEN_RECORD_VISITED_NODE();
-    astNode.mExpr.accept(*this);
-}
-
 void Codegen::visit(const AST::NotExprLNot & astNode) {
     WC_CODEGEN_RECORD_VISITED_NODE();
     CodegenLNotUnaryOp(*this, astNode.mExpr, false).codegen();
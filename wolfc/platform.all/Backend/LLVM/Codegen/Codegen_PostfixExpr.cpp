@@ -18,11 +18,6 @@
 WC_BEGIN_NAMESPACE
 WC_LLVM_BACKEND_BEGIN_NAMESPACE
 
-void Codegen::visit(const AST::PostfixExprNoOp & astNode) {
-    WC_CODEGEN_RECORD_VISITED_NODE();
-    astNode.mExpr.accept(*this);
-}
-
 void Codegen::visit(const AST::PostfixExprInc & astNode) {
     WC_CODEGEN_RECORD_VISITED_NODE();
     CodegenIncUnaryOp(*this, astNode.mExpr).codegen();
@@ -72,7 +67,7 @@ void Codegen::visit(const AST::PostfixExprFuncCall & astNode) {
     funcArgVals.reserve(astNode.mArgExprs.size());
     bool funcArgsOk = true;
     
-    for (const AST::AssignExpr * argExpr : astNode.mArgExprs) {
+    for (const AST::Expr * argExpr : astNode.mArgExprs) {
         // Evaluate the arg value:
         argExpr->accept(*this);
         
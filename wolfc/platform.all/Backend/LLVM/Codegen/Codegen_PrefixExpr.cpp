@@ -14,11 +14,6 @@
 WC_BEGIN_NAMESPACE
 WC_LLVM_BACKEND_BEGIN_NAMESPACE
 
-void Codegen::visit(const AST::PrefixExprNoOp & astNode) {
-    WC_CODEGEN_RECORD_VISITED_NODE();
-    astNode.mExpr.accept(*this);
-}
-
 void Codegen::visit(const AST::PrefixExprPlus & astNode) {
     WC_CODEGEN_RECORD_VISITED_NODE();
     CodegenPlusUnaryOp(*this, astNode.mExpr, false).codegen();
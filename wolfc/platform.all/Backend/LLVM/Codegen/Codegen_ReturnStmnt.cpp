@@ -126,7 +126,8 @@ void Codegen::visit(const AST::ReturnStmntNoCondVoid & astNode) {
     // code to insert after it. Also create an 'unreachable' instruction to let llvm know
     // everything past this can't be reached...
     std::string bbLabel = StringUtils::appendLineInfo("ReturnStmntNoCondVoid:unreachable",
-                                                      astNode.getPastEndToken());
+                                                      astNode.getPastEndSrcOffset(),
+                                                      mCtx.getSrcLineIndex());
     
     llvm::BasicBlock * unreachableBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx,
                                                                 bbLabel,
@@ -171,7 +172,8 @@ void Codegen::visit(const AST::ReturnStmntNoCondWithValue & astNode) {
     // code to insert after it. Also create an 'unreachable' instruction to let llvm know
     // everything past this can't be reached...
     std::string bbLabel = StringUtils::appendLineInfo("ReturnStmntNoCondWithValue:unreachable",
-                                                      astNode.getPastEndToken());
+                                                      astNode.getPastEndSrcOffset(),
+                                                      mCtx.getSrcLineIndex());
     
     llvm::BasicBlock * unreachableBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx,
                                                                 bbLabel,
@@ -225,12 +227,16 @@ void Codegen::visit(const AST::ReturnStmntWithCondVoid & astNode) {
     WC_ASSERT(parentFn);
     
     // Create a basic block for the return logic:
-    std::string returnBBLbl = StringUtils::appendLineInfo("ReturnStmntWithCondVoid:return", astNode.getStartToken());
+    std::string returnBBLbl = StringUtils::appendLineInfo("ReturnStmntWithCondVoid:return",
+                                                          astNode.getStartToken(),
+                                                          mCtx.getSrcLineIndex());
     llvm::BasicBlock * returnBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, returnBBLbl , parentFn);
     WC_ASSERT(returnBB);
     
     // Create a basic block for the continue logic:
-    std::string continueBBLbl = StringUtils::appendLineInfo("ReturnStmntWithCondVoid:continue", astNode.getPastEndToken());
+    std::string continueBBLbl = StringUtils::appendLineInfo("ReturnStmntWithCondVoid:continue",
+                                                            astNode.getPastEndSrcOffset(),
+                                                            mCtx.getSrcLineIndex());
     llvm::BasicBlock * continueBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, "ReturnStmntWithCondVoid:continue", parentFn);
     WC_ASSERT(continueBB);
     
@@ -284,12 +290,16 @@ void Codegen::visit(const AST::ReturnStmntWithCondAndValue & astNode) {
     WC_ASSERT(parentFn);
     
     // Create a basic block for the return logic:
-    std::string returnBBLbl = StringUtils::appendLineInfo("ReturnStmntWithCondAndValue:return", astNode.getStartToken());
+    std::string returnBBLbl = StringUtils::appendLineInfo("ReturnStmntWithCondAndValue:return",
+                                                          astNode.getStartToken(),
+                                                          mCtx.getSrcLineIndex());
     llvm::BasicBlock * returnBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, returnBBLbl, parentFn);
     WC_ASSERT(returnBB);
     
     // Create a basic block for the continue logic:
-    std::string continueBBLbl = StringUtils::appendLineInfo("ReturnStmntWithCondAndValue:continue", astNode.getPastEndToken());
+    std::string continueBBLbl = StringUtils::appendLineInfo("ReturnStmntWithCondAndValue:continue",
+                                                            astNode.getPastEndSrcOffset(),
+                                                            mCtx.getSrcLineIndex());
     llvm::BasicBlock * continueBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, continueBBLbl, parentFn);
     WC_ASSERT(continueBB);
     
@@ -25,7 +25,8 @@ void Codegen::visit(const AST::ScopeStmnt & astNode) {
     // Create the 'scope' main block.
     // Note: also make the previous block branch to this block in order to properly terminate it.
     std::string startBBLabel = StringUtils::appendLineInfo("ScopeStmnt:block",
-                                                           astNode.getStartToken());
+                                                           astNode.getStartToken(),
+                                                           mCtx.getSrcLineIndex());
     
     llvm::BasicBlock * startBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, startBBLabel, parentFn);
     WC_ASSERT(startBB);
@@ -37,7 +38,8 @@ void Codegen::visit(const AST::ScopeStmnt & astNode) {
     
     // Create the end basic block and make the current block branch to it to terminate it:
     std::string endBBLabel = StringUtils::appendLineInfo("ScopeStmnt:end",
-                                                         astNode.getEndToken());
+                                                         astNode.getEndToken(),
+                                                         mCtx.getSrcLineIndex());
     
     llvm::BasicBlock * endBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, endBBLabel, parentFn);
     WC_ASSERT(endBB);
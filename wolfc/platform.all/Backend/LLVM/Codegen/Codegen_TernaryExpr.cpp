@@ -19,11 +19,6 @@
 WC_BEGIN_NAMESPACE
 WC_LLVM_BACKEND_BEGIN_NAMESPACE
 
-void Codegen::visit(const AST::TernaryExprNoCond & astNode) {
-    WC_CODEGEN_RECORD_VISITED_NODE();
-    astNode.mExpr.accept(*this);
-}
-
 void Codegen::visit(const AST::TernaryExprWithCond & astNode) {
     WC_CODEGEN_RECORD_VISITED_NODE();
     
@@ -59,11 +54,15 @@ void Codegen::visit(const AST::TernaryExprWithCond & astNode) {
     WC_ASSERT(parentFn);
     
     // Create a basic block for the true and false follow on expressions:
-    std::string trueBBLbl = StringUtils::appendLineInfo("TernaryExprWithCond:true", astNode.mTrueExpr.getStartToken());
+    std::string trueBBLbl = StringUtils::appendLineInfo("TernaryExprWithCond:true",
+                                                        astNode.mTrueExpr.getStartToken(),
+                                                        mCtx.getSrcLineIndex());
     llvm::BasicBlock * trueBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, trueBBLbl, parentFn);
     WC_ASSERT(trueBB);
     
-    std::string falseBBLbl = StringUtils::appendLineInfo("TernaryExprWithCond:false", astNode.mFalseExpr.getStartToken());
+    std::string falseBBLbl = StringUtils::appendLineInfo("TernaryExprWithCond:false",
+                                                         astNode.mFalseExpr.getStartToken(),
+                                                         mCtx.getSrcLineIndex());
     llvm::BasicBlock * falseBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, falseBBLbl, parentFn);
     WC_ASSERT(falseBB);
     
@@ -98,7 +97,9 @@ void Codegen::visit(const AST::TernaryExprWithCond & astNode) {
     }
     
     // Create the end basic block:
-    std::string endBBLbl = StringUtils::appendLineInfo("TernaryExprWithCond:end", astNode.getPastEndToken());
+    std::string endBBLbl = StringUtils::appendLineInfo("TernaryExprWithCond:end",
+                                                       astNode.getPastEndSrcOffset(),
+                                                       mCtx.getSrcLineIndex());
     llvm::BasicBlock * endBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx, endBBLbl, parentFn);
     WC_ASSERT(endBB);
     
@@ -133,7 +133,7 @@ static void codegenLocalVarDecl(Codegen & cg,
     
     // Makeup the label we will give the var in the IR
     std::string varLabel = kVarLabelPrefix + varDecl.mIdent.name();
-    varLabel = StringUtils::appendLineInfo(varLabel.c_str(), varDecl.getStartToken());
+    varLabel = StringUtils::appendLineInfo(varLabel.c_str(), varDecl.getStartToken(), cg.mCtx.getSrcLineIndex());
     
     // Make the llvm data value for the variable:
     llvm::Value * varAlloca = cg.mCtx.mIRBuilder.CreateAlloca(varCompiledType.getLLVMType(), nullptr, varLabel);
@@ -147,6 +147,7 @@ static void codegenLocalVarDecl(Codegen & cg,
                              varCompiledType,
                              true,
                              varDecl,
+                             varDecl.mDeclId,
                              false);
     
     // Store the initializer expression to the variable if we generated it ok
@@ -203,6 +204,7 @@ static void codegenGlobalVarDecl(Codegen & cg,
         varCompiledType,
         true,
         varDecl,
+        varDecl.mDeclId,
         false
     );
     
@@ -227,6 +229,7 @@ static void codegenGlobalVarDecl(Codegen & cg,
         varInitConst.mLLVMConst,
         varCompiledType,
         varDecl,
+        varDecl.mDeclId,
         true
     );
 }
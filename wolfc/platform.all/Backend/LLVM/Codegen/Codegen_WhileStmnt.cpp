@@ -35,7 +35,8 @@ void Codegen::visit(const AST::WhileStmnt & astNode) {
     // Note: also make the previous block branch to this block in order to properly terminate it.
     // Note: this is also the target of 'next' statements
     std::string whileCondBBLbl = StringUtils::appendLineInfo("WhileStmnt:while_cond",
-                                                             astNode.getStartToken());
+                                                             astNode.getStartToken(),
+                                                             mCtx.getSrcLineIndex());
     
     llvm::BasicBlock * whileCondBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx,
                                                               whileCondBBLbl,
@@ -63,7 +64,8 @@ void Codegen::visit(const AST::WhileStmnt & astNode) {
     
     // Create the 'body' basic block:
     std::string bodyBBLbl = StringUtils::appendLineInfo("WhileStmnt:body",
-                                                        astNode.mBodyScope.getStartToken());
+                                                        astNode.mBodyScope.getStartToken(),
+                                                        mCtx.getSrcLineIndex());
     
     llvm::BasicBlock * bodyBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx,
                                                          bodyBBLbl,
@@ -79,7 +81,8 @@ void Codegen::visit(const AST::WhileStmnt & astNode) {
     // Create the end basic block:
     // Note: this is also where the 'break' statement targets
     std::string endBBLbl = StringUtils::appendLineInfo("WhileStmnt:end",
-                                                       astNode.mBodyScope.getPastEndToken());
+                                                       astNode.mBodyScope.getPastEndSrcOffset(),
+                                                       mCtx.getSrcLineIndex());
     
     llvm::BasicBlock * endBB = llvm::BasicBlock::Create(mCtx.mLLVMCtx,
                                                         endBBLbl,
@@ -10,7 +10,6 @@
 #include "../CodegenCtx.hpp"
 #include "../ImplicitCasts.hpp"
 #include "AST/Nodes/ASTNode.hpp"
-#include "AST/Nodes/IExpr.hpp"
 #include "Assert.hpp"
 #include "DataType/Types/PrimitiveDataTypes.hpp"
 #include "DataType/Types/VoidDataType.hpp"
@@ -40,8 +39,8 @@ CodegenBinaryOp::CodegenBinaryOp(Codegen & cg,
 
 void CodegenBinaryOp::codegen() {
     // Sanity check, left and right operands must be expressions:
-    WC_ASSERT(dynamic_cast<const AST::IExpr*>(&mLeftExpr));
-    WC_ASSERT(dynamic_cast<const AST::IExpr*>(&mRightExpr));
+    WC_ASSERT(mLeftExpr.isExpr());
+    WC_ASSERT(mRightExpr.isExpr());
     
     // Okay, codegen both the left and right expressions.
     // If we want to store the result on the left, codegen the address of the variable instead of it's value.
@@ -11,7 +11,6 @@
 #include "../ImplicitCasts.hpp"
 #include "Assert.hpp"
 #include "AST/Nodes/ASTNode.hpp"
-#include "AST/Nodes/IExpr.hpp"
 #include "DataType/Types/BoolDataType.hpp"
 #include "DataType/Types/PrimitiveDataTypes.hpp"
 #include "StringUtils.hpp"
@@ -47,18 +46,14 @@ void CodegenLazyLogicalBinaryOp::codegen() {
     const char * opName = mOpType == OpType::kAnd ? "logical and" : "logical or";
     
     // Get the expression for both the left and right operands:
-    const AST::IExpr * leftAsExpr = dynamic_cast<const AST::IExpr*>(&mLeftExpr);
-    
-    if (!leftAsExpr) {
+    if (!mLeftExpr.isExpr()) {
         mCG.mCtx.error(mLeftExpr,
                        "Left side of '%s' (%s) operator must be an expression with a value result!",
                        opSymbol,
                        opName);
     }
     
-    const AST::IExpr * rightAsExpr = dynamic_cast<const AST::IExpr*>(&mRightExpr);
-    
-    if (!rightAsExpr) {
+    if (!mRightExpr.isExpr()) {
         mCG.mCtx.error(mRightExpr,
                        "Right side of '%s' (%s) operator must be an expression with a value result!",
                        opSymbol,
@@ -83,7 +78,8 @@ void CodegenLazyLogicalBinaryOp::codegen() {
     // Okay, create a basic block for starting the evaluation of the right side
     std::string evalRightStartBBLbl = StringUtils::appendLineInfo(
         mOpType == OpType::kAnd ? "EvalLAndRightExpr" : "EvalLOrRightExpr",
-        mRightExpr.getStartToken()
+        mRightExpr.getStartToken(),
+        mCG.mCtx.getSrcLineIndex()
     );
     
     llvm::BasicBlock * evalRightStartBB = llvm::BasicBlock::Create(mCG.mCtx.mLLVMCtx,
@@ -128,7 +124,8 @@ void CodegenLazyLogicalBinaryOp::codegen() {
     // Create the end basic block, this will be where we figure out the result of the expression
     std::string evalEndBBLbl = StringUtils::appendLineInfo(
         mOpType == OpType::kAnd ? "EvalLAndEnd" : "EvalLOrEnd",
-        mRightExpr.getPastEndToken()
+        mRightExpr.getPastEndSrcOffset(),
+        mCG.mCtx.getSrcLineIndex()
     );
     
     llvm::BasicBlock * evalEndBB = llvm::BasicBlock::Create(mCG.mCtx.mLLVMCtx,
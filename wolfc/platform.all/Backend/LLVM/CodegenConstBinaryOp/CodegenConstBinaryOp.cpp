@@ -10,7 +10,6 @@
 #include "../ConstCodegen/ConstCodegen.hpp"
 #include "../ImplicitCasts.hpp"
 #include "AST/Nodes/ASTNode.hpp"
-#include "AST/Nodes/IExpr.hpp"
 #include "Assert.hpp"
 
 WC_BEGIN_NAMESPACE
@@ -36,8 +35,8 @@ CodegenConstBinaryOp::CodegenConstBinaryOp(ConstCodegen & cg,
 
 void CodegenConstBinaryOp::codegen() {
     // Sanity check, left and right operands must be expressions:
-    WC_ASSERT(dynamic_cast<const AST::IExpr*>(&mLeftExpr));
-    WC_ASSERT(dynamic_cast<const AST::IExpr*>(&mRightExpr));
+    WC_ASSERT(mLeftExpr.isExpr());
+    WC_ASSERT(mRightExpr.isExpr());
     
     // Okay, codegen both the left and right expressions
     mLeftExpr.accept(mCG);
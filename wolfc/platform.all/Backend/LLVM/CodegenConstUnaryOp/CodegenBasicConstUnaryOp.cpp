@@ -9,7 +9,6 @@
 #include "../CodegenCtx.hpp"
 #include "../ConstCodegen/ConstCodegen.hpp"
 #include "AST/Nodes/ASTNode.hpp"
-#include "AST/Nodes/IExpr.hpp"
 #include "Assert.hpp"
 
 WC_BEGIN_NAMESPACE
@@ -31,9 +30,7 @@ CodegenBasicConstUnaryOp::CodegenBasicConstUnaryOp(ConstCodegen & cg,
 
 void CodegenBasicConstUnaryOp::codegen() {
     // Get the type for the operand:
-    const AST::IExpr * nodeAsExpr = dynamic_cast<const AST::IExpr*>(&mExpr);
-    
-    if (!nodeAsExpr) {
+    if (!mExpr.isExpr()) {
         mCG.mCtx.error(mExpr,
                        "Operand of '%s' (%s) operator must be an expression with a value result!",
                        mOpSymbol,
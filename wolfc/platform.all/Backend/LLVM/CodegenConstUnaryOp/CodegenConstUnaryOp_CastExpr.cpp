@@ -9,14 +9,14 @@
 #include "../CodegenConstCast/CodegenConstCast.hpp"
 #include "../CodegenCtx.hpp"
 #include "../ConstCodegen/ConstCodegen.hpp"
-#include "AST/Nodes/AssignExpr.hpp"
+#include "AST/Nodes/Expr.hpp"
 #include "AST/Nodes/Type.hpp"
 
 WC_BEGIN_NAMESPACE
 WC_LLVM_BACKEND_BEGIN_NAMESPACE
 
 CodegenConstCastUnaryOp::CodegenConstCastUnaryOp(ConstCodegen & cg,
-                                                 const AST::AssignExpr & fromExpr,
+                                                 const AST::Expr & fromExpr,
                                                  const AST::Type & toType)
 :
     mCG(cg),
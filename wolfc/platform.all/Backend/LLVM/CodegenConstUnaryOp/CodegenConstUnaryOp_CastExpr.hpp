@@ -12,7 +12,7 @@
 WC_BEGIN_NAMESPACE
 
 namespace AST {
-    class AssignExpr;
+    class Expr;
     class Type;
 }
 
@@ -23,14 +23,14 @@ class ConstCodegen;
 class CodegenConstCastUnaryOp {
 public:
     CodegenConstCastUnaryOp(ConstCodegen & cg,
-                            const AST::AssignExpr & fromExpr,
+                            const AST::Expr & fromExpr,
                             const AST::Type & toType);
     
     void codegen();
     
 private:
     ConstCodegen &              mCG;
-    const AST::AssignExpr &     mFromExpr;
+    const AST::Expr &           mFromExpr;
     Constant                    mFromConst;
     const AST::Type &           mToType;
     CompiledDataType            mToTypeCDT;
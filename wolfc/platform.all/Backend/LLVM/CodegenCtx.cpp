@@ -6,26 +6,37 @@
 
 #include "CodegenCtx.hpp"
 
+#include "AST/NameBindings.hpp"
 #include "AST/Nodes/ASTNode.hpp"
 #include "AST/Nodes/Func.hpp"
+#include "AST/Nodes/Identifier.hpp"
 #include "AST/Nodes/IRepeatableStmnt.hpp"
 #include "Assert.hpp"
 #include "DataType/Types/PrimitiveDataTypes.hpp"
 #include "DataType/Types/UndefinedDataType.hpp"
+#include "Lexer/SymbolTable.hpp"
 #include "Lexer/Token.hpp"
 #include "RepeatableStmnt.hpp"
 
 WC_BEGIN_NAMESPACE
 WC_LLVM_BACKEND_BEGIN_NAMESPACE
 
-CodegenCtx::CodegenCtx(const std::string & moduleName) :
+CodegenCtx::CodegenCtx(const std::string & moduleName,
+                       const SourceLineIndex & srcLineIndex,
+                       const AST::NameBindings & nameBindings)
+:
     mLLVMCtx(),
     mIRBuilder(mLLVMCtx),
-    mModuleName(moduleName)
+    mModuleName(moduleName),
+    mSrcLineIndex(srcLineIndex),
+    mDeclValues(nameBindings.getNumDecls(), nullptr),
+    mDeclConstants(nameBindings.getNumDecls(), nullptr)
 {
     // Reserving some room for these things
     mASTNodeStack.reserve(4096);
     mScopeStack.reserve(128);
+    mShadowedNames.reserve(256);
+    mScopeNamesStack.reserve(128);
     mValues.reserve(32);
     mConstants.reserve(32);
     mCompiledDataTypes.reserve(32);
@@ -64,11 +75,12 @@ void CodegenCtx::error(const AST::ASTNode & atNode, const char * msgFmtStr, std:
     
     // Print the start of the message
     const Token & startToken = atNode.getStartToken();
+    SourceLoc srcLoc = mSrcLineIndex.getLoc(startToken.startSrcOffset);
     
     std::sprintf(msgBuf,
                  "@line %zu, col %zu: Error! ",
-                 startToken.startLine + 1,
-                 startToken.startCol + 1);
+                 size_t(srcLoc.line) + 1,
+                 size_t(srcLoc.col) + 1);
     
     // Get how long the message is so far:
     size_t msgPrefixLen = std::strlen(msgBuf);
@@ -137,11 +149,12 @@ void CodegenCtx::warning(const AST::ASTNode & atNode, const char * msgFmtStr, st
     
     // Print the start of the message
     const Token & startToken = atNode.getStartToken();
+    SourceLoc srcLoc = mSrcLineIndex.getLoc(startToken.startSrcOffset);
     
     std::sprintf(msgBuf,
                  "@line %zu, col %zu: Warning: ",
-                 startToken.startLine + 1,
-                 startToken.startCol + 1);
+                 size_t(srcLoc.line) + 1,
+                 size_t(srcLoc.col) + 1);
     
     // Get how long the message is so far:
     size_t msgPrefixLen = std::strlen(msgBuf);
@@ -214,9 +227,9 @@ bool CodegenCtx::dumpIRCodeToStdout() {
 RepeatableStmnt & CodegenCtx::getRepeatableStmntForNode(const AST::ASTNode & astNode,
                                                         const AST::IRepeatableStmnt & astNodeAsRepeatableStmnt)
 {
-    // These AST node references should refer to the same thing
-    WC_ASSERT(dynamic_cast<const AST::IRepeatableStmnt*>(&astNode) == &astNodeAsRepeatableStmnt);
-    auto iter = mRepeatableStmnts.find(&astNodeAsRepeatableStmnt);
+    // The AST node should be a repeatable statement, with the other reference being to the same node
+    WC_ASSERT(astNode.isRepeatableStmnt());
+    auto iter = mRepeatableStmnts.find(&astNode);
     
     // If we find an existing data structure for this statement then just return it
     if (iter != mRepeatableStmnts.end()) {
@@ -224,7 +237,7 @@ RepeatableStmnt & CodegenCtx::getRepeatableStmntForNode(const AST::ASTNode & ast
     }
     
     // Otherwise we need to make one
-    auto & ptr = mRepeatableStmnts[&astNodeAsRepeatableStmnt];
+    auto & ptr = mRepeatableStmnts[&astNode];
     ptr.reset(new RepeatableStmnt(astNode, astNodeAsRepeatableStmnt));
     return *ptr.get();
 }
@@ -235,10 +248,9 @@ RepeatableStmnt * CodegenCtx::getCurrentRepeatableStmnt() const {
     
     for (ssize_t i = numNodes - 1; i >= 0; --i) {
         const AST::ASTNode * astNode = mASTNodeStack[static_cast<size_t>(i)];
-        const AST::IRepeatableStmnt * astRepeatableStmt = dynamic_cast<const AST::IRepeatableStmnt*>(astNode);
         
-        if (astRepeatableStmt) {
-            auto iter = mRepeatableStmnts.find(astRepeatableStmt);
+        if (astNode->isRepeatableStmnt()) {
+            auto iter = mRepeatableStmnts.find(astNode);
             
             if (iter != mRepeatableStmnts.end()) {
                 return iter->second.get();
@@ -265,10 +277,29 @@ const AST::ASTNode * CodegenCtx::getCurrentASTNode() const {
 
 void CodegenCtx::pushScope(const AST::Scope & node) {
     mScopeStack.push_back(&node);
+    
+    // Bring everything declared in the scope so far into scope. Values can be declared in a scope before it is
+    // visited, for example function arguments are declared in the scope for the function body.
+    const ValHolder & valHolder = getScopeValHolder(node);
+    mScopeNamesStack.push_back(ScopeNames{ &valHolder, mShadowedNames.size() });
+    bindScopedNames(valHolder, true);
 }
 
 void CodegenCtx::popScope() {
     WC_ASSERT(!mScopeStack.empty());
+    WC_ASSERT(mScopeNamesStack.size() == mScopeStack.size());
+    
+    // Replay the undo log for the scope in reverse, so each name ends up referring to what it did before
+    size_t shadowedNamesStart = mScopeNamesStack.back().shadowedNamesStart;
+    
+    while (mShadowedNames.size() > shadowedNamesStart) {
+        const ShadowedName & shadowedName = mShadowedNames.back();
+        shadowedName.scopedName->mValue = shadowedName.outerValue;
+        shadowedName.scopedName->mConstant = shadowedName.outerConstant;
+        mShadowedNames.pop_back();
+    }
+    
+    mScopeNamesStack.pop_back();
     mScopeStack.pop_back();
 }
 
@@ -364,67 +395,157 @@ ValHolder & CodegenCtx::getScopeValHolder(const AST::Scope & scope) {
 }
 
 const Value * CodegenCtx::lookupValueByName(const char * name) const {
-    // Search through the scope stack first for the value, start with the
-    // innermost scope and work our way down the stack:
+    // The scoped names always hold the innermost value for each name, so this is just one lookup
     WC_ASSERT(name);
-    ssize_t scopeStackSize = static_cast<ssize_t>(mScopeStack.size());
-    
-    for (ssize_t i = scopeStackSize - 1; i >= 0; --i) {
-        // Get this scope in the stack and see if there is a value holder declared for this scope.
-        // If there isn't a value holder then just skip this scope and move search onto the next one:
-        const AST::Scope * scope = mScopeStack[static_cast<size_t>(i)];
-        WC_ASSERT(scope);
-        auto iter = mScopeValHolders.find(scope);
-        
-        if (iter == mScopeValHolders.end()) {
-            continue;
-        }
-        
-        // Get the var holder for the scope and lookup the value in that holder.
-        // If found, then return the value:
-        const ValHolder & varHolder = iter->second;
-        const Value * value = varHolder.getVal(name);
-        
-        if (value) {
-            return value;
-        }
-    }
-    
-    // Value not found in any scope. Search in the global module scope instead and return the
-    // result of that particular search:
-    return mModuleValHolder.getVal(name);
+    size_t nameLen = std::strlen(name);
+    const ScopedName * scopedName = mScopedNames.find(name, nameLen, SymbolTable::hashName(name, nameLen));
+    WC_GUARD(scopedName, nullptr);
+    return scopedName->mValue;
 }
 
 const Constant * CodegenCtx::lookupConstantByName(const char * name) const {
-    // Search through the scope stack first for the value, start with the
-    // innermost scope and work our way down the stack:
+    // The scoped names always hold the innermost constant for each name, so this is just one lookup
     WC_ASSERT(name);
-    ssize_t scopeStackSize = static_cast<ssize_t>(mScopeStack.size());
-    
-    for (ssize_t i = scopeStackSize - 1; i >= 0; --i) {
-        // Get this scope in the stack and see if there is a value holder declared for this scope.
-        // If there isn't a value holder then just skip this scope and move search onto the next one:
-        const AST::Scope * scope = mScopeStack[static_cast<size_t>(i)];
-        WC_ASSERT(scope);
-        auto iter = mScopeValHolders.find(scope);
-        
-        if (iter == mScopeValHolders.end()) {
-            continue;
+    size_t nameLen = std::strlen(name);
+    const ScopedName * scopedName = mScopedNames.find(name, nameLen, SymbolTable::hashName(name, nameLen));
+    WC_GUARD(scopedName, nullptr);
+    return scopedName->mConstant;
+}
+
+void CodegenCtx::registerValue(const ValHolder & valHolder, const Value & value, AST::DeclId declId) {
+    // Save the value for the declaration, if it is one that identifiers can be bound to
+    if (declId != AST::kInvalidDeclId) {
+        WC_ASSERT(declId < mDeclValues.size());
+        mDeclValues[declId] = &value;
+    }
+    
+    bindNewScopedName(valHolder, value.mName, &value, nullptr);
+}
+
+void CodegenCtx::registerConstant(const ValHolder & valHolder, const Constant & constant, AST::DeclId declId) {
+    // Save the constant for the declaration, if it is one that identifiers can be bound to
+    if (declId != AST::kInvalidDeclId) {
+        WC_ASSERT(declId < mDeclConstants.size());
+        mDeclConstants[declId] = &constant;
+    }
+    
+    bindNewScopedName(valHolder, constant.mName, nullptr, &constant);
+}
+
+const Value * CodegenCtx::lookupValue(const AST::Identifier & ident) const {
+    AST::DeclId declId = ident.mDeclId;
+    
+    if (declId != AST::kInvalidDeclId && mDeclValues[declId]) {
+        return mDeclValues[declId];
+    }
+    
+    return lookupValueByName(ident.name());
+}
+
+const Constant * CodegenCtx::lookupConstant(const AST::Identifier & ident) const {
+    AST::DeclId declId = ident.mDeclId;
+    
+    if (declId != AST::kInvalidDeclId && mDeclConstants[declId]) {
+        return mDeclConstants[declId];
+    }
+    
+    return lookupConstantByName(ident.name());
+}
+
+void CodegenCtx::bindScopedName(const std::string & name,
+                                const Value * value,
+                                const Constant * constant,
+                                bool saveShadowedName)
+{
+    // Add an entry for the name if it has never been bound before
+    uint32_t nameHash = SymbolTable::hashName(name.data(), name.size());
+    ScopedName * scopedName = mScopedNames.find(name.data(), name.size(), nameHash);
+    
+    if (!scopedName) {
+        scopedName = &mScopedNames.set(ScopedName{ name, nullptr, nullptr });
+    }
+    
+    // Save what is being shadowed if required and bind the name
+    if (saveShadowedName) {
+        mShadowedNames.push_back(ShadowedName{ scopedName, scopedName->mValue, scopedName->mConstant });
+    }
+    
+    if (value) {
+        scopedName->mValue = value;
+    }
+    
+    if (constant) {
+        scopedName->mConstant = constant;
+    }
+}
+
+void CodegenCtx::bindScopedNames(const ValHolder & valHolder, bool saveShadowedNames) {
+    const NameTable<Value> & values = valHolder.getVals();
+    
+    for (size_t i = 0; i < values.getNumEntries(); ++i) {
+        const Value & value = values.getEntry(i);
+        bindScopedName(value.mName, &value, nullptr, saveShadowedNames);
+    }
+    
+    const NameTable<Constant> & constants = valHolder.getConsts();
+    
+    for (size_t i = 0; i < constants.getNumEntries(); ++i) {
+        const Constant & constant = constants.getEntry(i);
+        bindScopedName(constant.mName, nullptr, &constant, saveShadowedNames);
+    }
+}
+
+void CodegenCtx::bindNewScopedName(const ValHolder & valHolder,
+                                   const std::string & name,
+                                   const Value * value,
+                                   const Constant * constant)
+{
+    // The usual cases: something declared at the module level while no scopes are being visited (the module level
+    // names are never unbound), or something declared in the innermost scope:
+    if (&valHolder == &mModuleValHolder) {
+        if (mScopeNamesStack.empty()) {
+            bindScopedName(name, value, constant, false);
+            return;
+        }
+    }
+    else {
+        if (!mScopeNamesStack.empty() && mScopeNamesStack.back().valHolder == &valHolder) {
+            bindScopedName(name, value, constant, true);
+            return;
         }
         
-        // Get the var holder for the scope and lookup the value in that holder.
-        // If found, then return the value:
-        const ValHolder & varHolder = iter->second;
-        const Constant * constant = varHolder.getConst(name);
+        // If the holder is not for a scope being visited then nothing to do until its scope is pushed
+        bool holderIsInScope = false;
         
-        if (constant) {
-            return constant;
+        for (const ScopeNames & scopeNames : mScopeNamesStack) {
+            if (scopeNames.valHolder == &valHolder) {
+                holderIsInScope = true;
+                break;
+            }
         }
+        
+        WC_GUARD(holderIsInScope);
     }
     
-    // Value not found in any scope. Search in the global module scope instead and return the
-    // result of that particular search:
-    return mModuleValHolder.getConst(name);
+    // Otherwise the name must go underneath the names bound by inner scopes. The undo log can't do this directly
+    // so just bind everything again. Nothing declares names like this at the moment, so this should be rare.
+    rebuildScopedNames();
+}
+
+void CodegenCtx::rebuildScopedNames() {
+    for (size_t i = 0; i < mScopedNames.getNumEntries(); ++i) {
+        ScopedName & scopedName = mScopedNames.getEntry(i);
+        scopedName.mValue = nullptr;
+        scopedName.mConstant = nullptr;
+    }
+    
+    mShadowedNames.clear();
+    bindScopedNames(mModuleValHolder, false);
+    
+    for (ScopeNames & scopeNames : mScopeNamesStack) {
+        scopeNames.shadowedNamesStart = mShadowedNames.size();
+        bindScopedNames(*scopeNames.valHolder, true);
+    }
 }
 
 CodegenCtxPushASTNode::CodegenCtxPushASTNode(const AST::ASTNode & node, CodegenCtx & ctx) : mCtx(ctx) {
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "CompiledDataType.hpp"
+#include "Lexer/SourceLineIndex.hpp"
 #include "Macros.hpp"
 #include "ValHolder.hpp"
 
@@ -24,7 +25,9 @@ class DataType;
 namespace AST {
     class ASTNode;
     class Func;
+    class Identifier;
     class IRepeatableStmnt;
+    class NameBindings;
     class Scope;
 }
 
@@ -35,7 +38,14 @@ class RepeatableStmnt;
 /* Class holding the context for code generation */
 class CodegenCtx {
 public:
-    CodegenCtx(const std::string & moduleName);
+    /**
+     * Create the codegen context. The given line index is for the source code that the AST being compiled
+     * was parsed from, and must remain valid for the lifetime of the context. The name bindings are those made
+     * for the AST by 'AST::NameBinder': the AST must not be bound again while the context is in use.
+     */
+    CodegenCtx(const std::string & moduleName,
+               const SourceLineIndex & srcLineIndex,
+               const AST::NameBindings & nameBindings);
     
     ~CodegenCtx();
     
@@ -82,6 +92,16 @@ public:
         return mModuleName;
     }
     
+    /* Get the source code that the AST being compiled was parsed from */
+    inline const char * getSrcText() const {
+        return mSrcLineIndex.getSrcText();
+    }
+    
+    /* Get the line index for the source code, used to get line and column info for tokens */
+    inline const SourceLineIndex & getSrcLineIndex() const {
+        return mSrcLineIndex;
+    }
+    
     /* Push the current codegen basic block to the stack and save for later popping. */
     void pushInsertBlock();
     
@@ -207,6 +227,29 @@ public:
      */
     const Constant * lookupConstantByName(const char * name) const;
     
+    /**
+     * Let the context know that a value or constant was created in the given value holder. Brings the name into
+     * scope for lookups if the holder is for the module or a scope being visited, and records the value or
+     * constant for the given declaration (if valid) so identifiers bound to it can get at it directly.
+     * Called by 'ValHolder' as each value or constant is created.
+     */
+    void registerValue(const ValHolder & valHolder, const Value & value, AST::DeclId declId);
+    void registerConstant(const ValHolder & valHolder, const Constant & constant, AST::DeclId declId);
+    
+    /**
+     * Lookup the value that the given identifier refers to. This is a direct lookup using the declaration that
+     * the identifier was bound to before codegen. If the identifier is unbound or nothing has been created for
+     * the declaration (due to errors with it) then falls back to searching by name, see 'lookupValueByName'.
+     * Returns nullptr if the value is not found.
+     */
+    const Value * lookupValue(const AST::Identifier & ident) const;
+    
+    /**
+     * Lookup the constant that the given identifier refers to. Works in the same way as 'lookupValue', with
+     * 'lookupConstantByName' as the fallback. Returns nullptr if the constant is not found.
+     */
+    const Constant * lookupConstant(const AST::Identifier & ident) const;
+    
     /* The LLVM context */
     llvm::LLVMContext mLLVMCtx;
     
@@ -232,17 +275,64 @@ public:
 private:
     WC_DISALLOW_COPY_AND_ASSIGN(CodegenCtx)
     
+    /**
+     * What a name refers to in the scopes being visited: the innermost value and the innermost constant of that
+     * name (which may be in different scopes). Either is null if there is none in scope.
+     */
+    struct ScopedName {
+        std::string mName;
+        const Value * mValue;
+        const Constant * mConstant;
+    };
+    
+    /* An entry in the undo log for scoped names: a name that a scope bound, and what it referred to before that */
+    struct ShadowedName {
+        ScopedName * scopedName;
+        const Value * outerValue;
+        const Constant * outerConstant;
+    };
+    
+    /* Info for a scope on the scope stack: its value holder and where its entries in the undo log start */
+    struct ScopeNames {
+        const ValHolder * valHolder;
+        size_t shadowedNamesStart;
+    };
+    
+    /**
+     * Make the given name refer to the given value and/or constant (whichever are not null) in 'mScopedNames'.
+     * If requested, what the name referred to before is saved in the undo log so that 'popScope' can restore it.
+     */
+    void bindScopedName(const std::string & name,
+                        const Value * value,
+                        const Constant * constant,
+                        bool saveShadowedName);
+    
+    /* Bind the names of all the values and constants in the given holder, see 'bindScopedName' */
+    void bindScopedNames(const ValHolder & valHolder, bool saveShadowedNames);
+    
+    /* Bind the name of a value or constant just created in the given holder, if the holder is in scope */
+    void bindNewScopedName(const ValHolder & valHolder,
+                           const std::string & name,
+                           const Value * value,
+                           const Constant * constant);
+    
+    /* Clear out all the scoped names and bind them all again for the module and the scopes on the stack */
+    void rebuildScopedNames();
+    
     /* The name of the module being code generated */
     std::string mModuleName;
     
+    /* Line index for the source code that the AST being compiled was parsed from */
+    const SourceLineIndex & mSrcLineIndex;
+    
     /* The stack of AST nodes being visited */
     std::vector<const AST::ASTNode*> mASTNodeStack;
     
     /* The stack of scopes being visited */
     std::vector<const AST::Scope*> mScopeStack;
     
-    /* A map from repeatable statements to info structures for those statements */
-    std::map<const AST::IRepeatableStmnt*, std::unique_ptr<RepeatableStmnt>> mRepeatableStmnts;
+    /* A map from the AST nodes for repeatable statements to info structures for those statements */
+    std::map<const AST::ASTNode*, std::unique_ptr<RepeatableStmnt>> mRepeatableStmnts;
     
     /**
      * A stack of values created during codegen.
@@ -280,6 +370,28 @@ private:
     
     /* A set of value holders for each scope */
     std::map<const AST::Scope*, ValHolder> mScopeValHolders;
+    
+    /**
+     * What each name refers to in the scopes being visited, so that looking up a name is a single probe.
+     * The values and constants of the module are bound first and are never unbound. Each scope pushed then binds
+     * the names of its own values and constants over these, saving what it shadows in the undo log. When the scope
+     * is popped the undo log is replayed back to where the scope started, restoring the outer bindings.
+     * Names are never removed from the table once added: out of scope names just refer to nothing.
+     */
+    NameTable<ScopedName> mScopedNames;
+    
+    /* The undo log for 'mScopedNames' */
+    std::vector<ShadowedName> mShadowedNames;
+    
+    /* Scoped name info for each scope in the scope stack */
+    std::vector<ScopeNames> mScopeNamesStack;
+    
+    /**
+     * The value and constant created for each declaration, indexed by declaration id (see 'AST::NameBindings').
+     * Null until created. These point into the value holders, which never move the values they hold.
+     */
+    std::vector<const Value*> mDeclValues;
+    std::vector<const Constant*> mDeclConstants;
 };
 
 /* A helper RAII object which pushes and pops a node from the given codegen context. */
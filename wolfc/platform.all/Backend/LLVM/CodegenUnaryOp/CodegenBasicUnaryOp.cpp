@@ -9,7 +9,6 @@
 #include "../Codegen/Codegen.hpp"
 #include "../CodegenCtx.hpp"
 #include "AST/Nodes/ASTNode.hpp"
-#include "AST/Nodes/IExpr.hpp"
 #include "Assert.hpp"
 #include "DataType/Types/PrimitiveDataTypes.hpp"
 #include "DataType/Types/VoidDataType.hpp"
@@ -35,9 +34,7 @@ CodegenBasicUnaryOp::CodegenBasicUnaryOp(Codegen & cg,
 
 void CodegenBasicUnaryOp::codegen() {
     // Get the type for the operand:
-    const AST::IExpr * nodeAsExpr = dynamic_cast<const AST::IExpr*>(&mExpr);
-    
-    if (!nodeAsExpr) {
+    if (!mExpr.isExpr()) {
         mCG.mCtx.error(mExpr,
                        "Operand of '%s' (%s) operator must be an expression with a value result!",
                        mOpSymbol,
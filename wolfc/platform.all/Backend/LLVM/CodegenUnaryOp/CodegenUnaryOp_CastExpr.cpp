@@ -9,14 +9,14 @@
 #include "../Codegen/Codegen.hpp"
 #include "../CodegenCast/CodegenCast.hpp"
 #include "../CodegenCtx.hpp"
-#include "AST/Nodes/AssignExpr.hpp"
+#include "AST/Nodes/Expr.hpp"
 #include "AST/Nodes/Type.hpp"
 
 WC_BEGIN_NAMESPACE
 WC_LLVM_BACKEND_BEGIN_NAMESPACE
 
 CodegenCastUnaryOp::CodegenCastUnaryOp(Codegen & cg,
-                                       const AST::AssignExpr & fromExpr,
+                                       const AST::Expr & fromExpr,
                                        const AST::Type & toType)
 :
     mCG(cg),
@@ -12,7 +12,7 @@
 WC_BEGIN_NAMESPACE
 
 namespace AST {
-    class AssignExpr;
+    class Expr;
     class Type;
 }
 
@@ -23,14 +23,14 @@ class Codegen;
 class CodegenCastUnaryOp {
 public:
     CodegenCastUnaryOp(Codegen & cg,
-                       const AST::AssignExpr & fromExpr,
+                       const AST::Expr & fromExpr,
                        const AST::Type & toType);
     
     void codegen();
     
 private:
     Codegen &                   mCG;
-    const AST::AssignExpr &     mFromExpr;
+    const AST::Expr &           mFromExpr;
     Value                       mFromVal;
     const AST::Type &           mToType;
     CompiledDataType            mToTypeCDT;
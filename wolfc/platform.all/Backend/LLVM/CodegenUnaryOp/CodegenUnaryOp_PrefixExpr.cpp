@@ -9,7 +9,6 @@
 #include "../Codegen/Codegen.hpp"
 #include "../CodegenCtx.hpp"
 #include "AST/Nodes/ASTNode.hpp"
-#include "AST/Nodes/IExpr.hpp"
 #include "DataType/Types/PtrDataType.hpp"
 
 WC_BEGIN_NAMESPACE
@@ -113,9 +112,7 @@ void CodegenAddrOfUnaryOp::codegen() {
     }
     
     // Get the type for the operand:
-    const AST::IExpr * nodeAsExpr = dynamic_cast<const AST::IExpr*>(&mExpr);
-    
-    if (!nodeAsExpr) {
+    if (!mExpr.isExpr()) {
         mCG.mCtx.error(mExpr,
                        "Operand of '%s' (%s) operator must be an expression with a value result!",
                        mOpSymbol,
@@ -165,9 +162,7 @@ void CodegenPtrDerefUnaryOp::codegen() {
     }
     
     // Get the type for the operand:
-    const AST::IExpr * nodeAsExpr = dynamic_cast<const AST::IExpr*>(&mExpr);
-    
-    if (!nodeAsExpr) {
+    if (!mExpr.isExpr()) {
         mCG.mCtx.error(mExpr,
                        "Operand of '%s' (%s) operator must be an expression with a value result!",
                        mOpSymbol,
@@ -34,7 +34,7 @@ void ConstCodegen::visit(const AST::ArrayLit & astNode) {
     std::vector<Constant> constants;
     constants.reserve(subExprsSize);
     
-    for (const AST::AssignExpr * subExpr : subExprs) {
+    for (const AST::Expr * subExpr : subExprs) {
         subExpr->accept(*this);
         constants.push_back(mCtx.popConstant());
     }
@@ -15,11 +15,6 @@
 WC_BEGIN_NAMESPACE
 WC_LLVM_BACKEND_BEGIN_NAMESPACE
 
-void ConstCodegen::visit(const AST::CastExprNoCast & astNode) {
-    WC_CODEGEN_RECORD_VISITED_NODE();
-    astNode.mExpr.accept(*this);
-}
-
 void ConstCodegen::visit(const AST::CastExprCast & astNode) {
     WC_CODEGEN_RECORD_VISITED_NODE();
     CodegenConstCastUnaryOp(*this, astNode.mExpr, astNode.mType).codegen();
@@ -16,7 +16,7 @@ void ConstCodegen::visit(const AST::Identifier & astNode) {
     WC_CODEGEN_RECORD_VISITED_NODE();
     
     // Grab the constant value
-    const Constant * constant = mCtx.lookupConstantByName(astNode.name());
+    const Constant * constant = mCtx.lookupConstant(astNode);
     
     if (!constant) {
         // Couldn't find any value with this name, issue a compile error:
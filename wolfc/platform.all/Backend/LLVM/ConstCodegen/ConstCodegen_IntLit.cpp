@@ -24,7 +24,7 @@ void ConstCodegen::visit(const AST::IntLit & astNode) {
     
     // Codegen the data type for the int
     {
-        const DataType & dataType = PrimitiveDataTypes::getUsingTypeId(tok.data.intData.dataTypeId);
+        const DataType & dataType = PrimitiveDataTypes::getUsingTypeId(tok.intDataTypeId);
         
         if (dataType.isInteger()) {
             dataType.accept(mCodegenDataType);
@@ -41,10 +41,9 @@ void ConstCodegen::visit(const AST::IntLit & astNode) {
     CompiledDataType compiledType = mCtx.popCompiledDataType();
     WC_ASSERT(compiledType.isValid());
     
-    // Figure out how many bits are needed to hold the integer and if we have enough
-    const auto & tokIntData = tok.data.intData;
+    // See if we have enough bits to hold the integer. Note: the lexer figured out how many bits are needed.
     size_t dataTypeSizeInBits = compiledType.getLLVMType()->getScalarSizeInBits();
-    size_t bitsNeededForInt = llvm::APInt::getBitsNeeded(tokIntData.strMinusUS, uint8_t(tokIntData.base));
+    size_t bitsNeededForInt = tok.intBitsRequired;
     
     if (bitsNeededForInt > dataTypeSizeInBits) {
         mCtx.error(astNode,
@@ -57,16 +56,10 @@ void ConstCodegen::visit(const AST::IntLit & astNode) {
         return;
     }
     
-    // Now get the arbitrary precision integer
-    llvm::APInt apInt(unsigned(dataTypeSizeInBits), tokIntData.strMinusUS, uint8_t(tokIntData.base));
-    
-    if (compiledType.getLLVMType()->getScalarSizeInBits() < apInt.getBitWidth()) {
-        mCtx.error(astNode,
-                   "Integer literal cannot fit into target data type '%s'! Target data type is %zu bits "
-                   "but the integer literal requires %zu bits to store!",
-                   size_t(compiledType.getLLVMType()->getScalarSizeInBits()),
-                   apInt.getBitWidth());
-    }
+    // Now get the arbitrary precision integer from the value parsed by the lexer.
+    // Note: any unused high bits are truncated away, they are all zero anyway given the check above.
+    const auto & tokIntData = tok.data.intData;
+    llvm::APInt apInt(unsigned(dataTypeSizeInBits), llvm::makeArrayRef(tokIntData.valueWords));
     
     // Create the constant and save to the stack
     WC_ASSERT(compiledType.getLLVMType());
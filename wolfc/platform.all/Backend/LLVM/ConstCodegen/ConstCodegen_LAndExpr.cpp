@@ -14,11 +14,6 @@
 WC_BEGIN_NAMESPACE
 WC_LLVM_BACKEND_BEGIN_NAMESPACE
 
-void ConstCodegen::visit(const AST::LAndExprNoOp & astNode) {
-    WC_CODEGEN_RECORD_VISITED_NODE();
-    astNode.mExpr.accept(*this);
-}
-
 void ConstCodegen::visit(const AST::LAndExprAnd & astNode) {
     WC_CODEGEN_RECORD_VISITED_NODE();
     CodegenConstLAndBinaryOp(*this, astNode.mLeftExpr, astNode.mRightExpr).codegen();
@@ -14,11 +14,6 @@
 WC_BEGIN_NAMESPACE
 WC_LLVM_BACKEND_BEGIN_NAMESPACE
 
-void ConstCodegen::visit(const AST::PrefixExprNoOp & astNode) {
-    WC_CODEGEN_RECORD_VISITED_NODE();
-    astNode.mExpr.accept(*this);
-}
-
 void ConstCodegen::visit(const AST::PrefixExprPlus & astNode) {
     WC_CODEGEN_RECORD_VISITED_NODE();
     CodegenConstPlusUnaryOp(*this, astNode.mExpr).codegen();
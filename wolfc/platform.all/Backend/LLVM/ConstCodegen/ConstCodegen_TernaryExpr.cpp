@@ -18,11 +18,6 @@
 WC_BEGIN_NAMESPACE
 WC_LLVM_BACKEND_BEGIN_NAMESPACE
 
-void ConstCodegen::visit(const AST::TernaryExprNoCond & astNode) {
-    WC_CODEGEN_RECORD_VISITED_NODE();
-    astNode.mExpr.accept(*this);
-}
-
 void ConstCodegen::visit(const AST::TernaryExprWithCond & astNode) {
     WC_CODEGEN_RECORD_VISITED_NODE();
     
@@ -0,0 +1,148 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#pragma once
+
+#include "Assert.hpp"
+#include "Lexer/SymbolTable.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstddef>
+    #include <cstdint>
+    #include <cstring>
+    #include <deque>
+    #include <string>
+    #include <utility>
+    #include <vector>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+WC_LLVM_BACKEND_BEGIN_NAMESPACE
+
+/**
+ * A flat open addressing hash table of entries keyed by name, using linear probing. Entries of type 'T' must have
+ * a 'std::string' member called 'mName' holding their name, and names are hashed with 'SymbolTable::hashName'.
+ * The slots hold the hash of each name so most mismatches are rejected without comparing names.
+ *
+ * Entries are stored in a deque rather than in the slots since they must never move once created: codegen holds
+ * on to references to them while creating more (e.g the function currently being generated). Entries can't be
+ * removed, only replaced.
+ */
+template <typename T>
+class NameTable {
+public:
+    NameTable() = default;
+    
+    /* Add the given entry under its name, replacing any existing entry of the same name */
+    T & set(T && entry) {
+        // If there is already an entry with this name then replace it, keeping it where it is
+        uint32_t nameHash = SymbolTable::hashName(entry.mName.data(), entry.mName.size());
+        size_t slotIdx = findSlot(entry.mName.data(), entry.mName.size(), nameHash);
+        
+        if (!mSlots.empty() && mSlots[slotIdx].entryIdxPlus1 != 0) {
+            T & existingEntry = mEntries[mSlots[slotIdx].entryIdxPlus1 - 1];
+            existingEntry = std::move(entry);
+            return existingEntry;
+        }
+        
+        // New entry: make room for it first if needed. Keep the load factor at or below 0.5 so probes stay short.
+        if ((mEntries.size() + 1) * 2 > mSlots.size()) {
+            rehash(mSlots.empty() ? 16 : mSlots.size() * 2);
+            slotIdx = findSlot(entry.mName.data(), entry.mName.size(), nameHash);
+        }
+        
+        mEntries.push_back(std::move(entry));
+        mSlots[slotIdx] = Slot{ nameHash, static_cast<uint32_t>(mEntries.size()) };
+        return mEntries.back();
+    }
+    
+    /* Find the entry with the given name and name hash. Returns null if not found. */
+    const T * find(const char * name, size_t nameLen, uint32_t nameHash) const {
+        WC_GUARD(!mSlots.empty(), nullptr);
+        uint32_t entryIdxPlus1 = mSlots[findSlot(name, nameLen, nameHash)].entryIdxPlus1;
+        WC_GUARD(entryIdxPlus1 != 0, nullptr);
+        return &mEntries[entryIdxPlus1 - 1];
+    }
+    
+    T * find(const char * name, size_t nameLen, uint32_t nameHash) {
+        const NameTable & constThis = *this;
+        return const_cast<T*>(constThis.find(name, nameLen, nameHash));
+    }
+    
+    /* Get the number of entries in the table */
+    inline size_t getNumEntries() const {
+        return mEntries.size();
+    }
+    
+    /* Get an entry in the table by index. Entries are indexed in the order they were added. */
+    inline const T & getEntry(size_t entryIdx) const {
+        return mEntries[entryIdx];
+    }
+    
+    inline T & getEntry(size_t entryIdx) {
+        return mEntries[entryIdx];
+    }
+    
+private:
+    /* A slot in the hash table. The entry index is stored plus one, so that zero means the slot is empty. */
+    struct Slot {
+        uint32_t nameHash;
+        uint32_t entryIdxPlus1;
+    };
+    
+    /* Find the slot for the given name: either the slot holding it or the empty slot where it would go */
+    size_t findSlot(const char * name, size_t nameLen, uint32_t nameHash) const {
+        // Note: the table is never full, so this always finds either the entry or an empty slot
+        WC_GUARD(!mSlots.empty(), 0);
+        size_t slotMask = mSlots.size() - 1;
+        size_t slotIdx = nameHash & slotMask;
+        
+        while (const uint32_t entryIdxPlus1 = mSlots[slotIdx].entryIdxPlus1) {
+            if (mSlots[slotIdx].nameHash == nameHash) {
+                const std::string & entryName = mEntries[entryIdxPlus1 - 1].mName;
+                
+                if (entryName.size() == nameLen && std::memcmp(entryName.data(), name, nameLen) == 0) {
+                    break;
+                }
+            }
+            
+            slotIdx = (slotIdx + 1) & slotMask;
+        }
+        
+        return slotIdx;
+    }
+    
+    /* Grow the hash table to the given number of slots, which must be a power of two */
+    void rehash(size_t newCapacity) {
+        WC_ASSERT((newCapacity & (newCapacity - 1)) == 0);
+        std::vector<Slot> oldSlots;
+        oldSlots.swap(mSlots);
+        mSlots.resize(newCapacity, Slot{ 0, 0 });
+        size_t slotMask = newCapacity - 1;
+        
+        // Re-insert all the entries. Note: names are unique, so there is no need to compare them here.
+        for (const Slot & slot : oldSlots) {
+            if (slot.entryIdxPlus1 != 0) {
+                size_t slotIdx = slot.nameHash & slotMask;
+                
+                while (mSlots[slotIdx].entryIdxPlus1 != 0) {
+                    slotIdx = (slotIdx + 1) & slotMask;
+                }
+                
+                mSlots[slotIdx] = slot;
+            }
+        }
+    }
+    
+    /* The hash table, empty until the first entry is added */
+    std::vector<Slot> mSlots;
+    
+    /* All of the entries, in the order they were added */
+    std::deque<T> mEntries;
+};
+
+WC_LLVM_BACKEND_END_NAMESPACE
+WC_END_NAMESPACE
@@ -7,9 +7,15 @@
 #include "ValHolder.hpp"
 
 #include "AST/Nodes/ASTNode.hpp"
+#include "Assert.hpp"
 #include "CodegenCtx.hpp"
+#include "Lexer/SymbolTable.hpp"
 #include "Lexer/Token.hpp"
 
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstring>
+WC_THIRD_PARTY_INCLUDES_END
+
 WC_BEGIN_NAMESPACE
 WC_LLVM_BACKEND_BEGIN_NAMESPACE
 
@@ -19,6 +25,7 @@ Value & ValHolder::createVal(CodegenCtx & ctx,
                              const CompiledDataType & compiledType,
                              bool requiresLoad,
                              const AST::ASTNode & declaringNode,
+                             AST::DeclId declId,
                              bool noDuplicateNameCheck)
 {
     // Start filling in some parts of the value
@@ -41,8 +48,10 @@ Value & ValHolder::createVal(CodegenCtx & ctx,
         value.mName = name;
     }
     
-    // Store the value with the unique name:
-    return mValues[value.mName] = std::move(value);
+    // Store the value with the unique name and let the context know about it, so it can be looked up:
+    Value & storedValue = mValues.set(std::move(value));
+    ctx.registerValue(*this, storedValue, declId);
+    return storedValue;
 }
 
 Constant & ValHolder::createConst(CodegenCtx & ctx,
@@ -50,6 +59,7 @@ Constant & ValHolder::createConst(CodegenCtx & ctx,
                                   llvm::Constant * llvmConst,
                                   const CompiledDataType & compiledType,
                                   const AST::ASTNode & declaringNode,
+                                  AST::DeclId declId,
                                   bool noDuplicateNameCheck)
 {
     // Start filling in some parts of the constant
@@ -71,56 +81,54 @@ Constant & ValHolder::createConst(CodegenCtx & ctx,
         constant.mName = name;
     }
     
-    // Store the constant with the unique name:
-    return mConstants[constant.mName] = std::move(constant);
+    // Store the constant with the unique name and let the context know about it, so it can be looked up:
+    Constant & storedConstant = mConstants.set(std::move(constant));
+    ctx.registerConstant(*this, storedConstant, declId);
+    return storedConstant;
 }
 
 const Value * ValHolder::getVal(const char * name) const {
-    auto iter = mValues.find(name);
-    WC_GUARD(iter != mValues.end(), nullptr);
-    return &iter->second;
+    size_t nameLen = std::strlen(name);
+    return mValues.find(name, nameLen, SymbolTable::hashName(name, nameLen));
 }
 
 const Value * ValHolder::getVal(const std::string & name) const {
-    auto iter = mValues.find(name);
-    WC_GUARD(iter != mValues.end(), nullptr);
-    return &iter->second;
+    return mValues.find(name.data(), name.size(), SymbolTable::hashName(name.data(), name.size()));
 }
 
 Value * ValHolder::getVal(const char * name) {
-    auto iter = mValues.find(name);
-    WC_GUARD(iter != mValues.end(), nullptr);
-    return &iter->second;
+    size_t nameLen = std::strlen(name);
+    return mValues.find(name, nameLen, SymbolTable::hashName(name, nameLen));
 }
 
 Value * ValHolder::getVal(const std::string & name) {
-    auto iter = mValues.find(name);
-    WC_GUARD(iter != mValues.end(), nullptr);
-    return &iter->second;
+    return mValues.find(name.data(), name.size(), SymbolTable::hashName(name.data(), name.size()));
+}
+
+const Value * ValHolder::getVal(const char * name, size_t nameLen, uint32_t nameHash) const {
+    return mValues.find(name, nameLen, nameHash);
 }
 
 const Constant * ValHolder::getConst(const char * name) const {
-    auto iter = mConstants.find(name);
-    WC_GUARD(iter != mConstants.end(), nullptr);
-    return &iter->second;
+    size_t nameLen = std::strlen(name);
+    return mConstants.find(name, nameLen, SymbolTable::hashName(name, nameLen));
 }
 
 const Constant * ValHolder::getConst(const std::string & name) const {
-    auto iter = mConstants.find(name);
-    WC_GUARD(iter != mConstants.end(), nullptr);
-    return &iter->second;
+    return mConstants.find(name.data(), name.size(), SymbolTable::hashName(name.data(), name.size()));
 }
 
 Constant * ValHolder::getConst(const char * name) {
-    auto iter = mConstants.find(name);
-    WC_GUARD(iter != mConstants.end(), nullptr);
-    return &iter->second;
+    size_t nameLen = std::strlen(name);
+    return mConstants.find(name, nameLen, SymbolTable::hashName(name, nameLen));
 }
 
 Constant * ValHolder::getConst(const std::string & name) {
-    auto iter = mConstants.find(name);
-    WC_GUARD(iter != mConstants.end(), nullptr);
-    return &iter->second;
+    return mConstants.find(name.data(), name.size(), SymbolTable::hashName(name.data(), name.size()));
+}
+
+const Constant * ValHolder::getConst(const char * name, size_t nameLen, uint32_t nameHash) const {
+    return mConstants.find(name, nameLen, nameHash);
 }
 
 bool ValHolder::compileCheckNameNotTaken(CodegenCtx & ctx,
@@ -131,22 +139,24 @@ bool ValHolder::compileCheckNameNotTaken(CodegenCtx & ctx,
 {
     // Check to see if it exists in the set of values
     bool duplicateNameError = false;
+    uint32_t nameHash = SymbolTable::hashName(name.data(), name.size());
     
     {
-        auto iter = mValues.find(name);
+        const Value * otherValPtr = mValues.find(name.data(), name.size(), nameHash);
         
-        if (iter != mValues.end()) {
+        if (otherValPtr) {
             // Okay we have a duplicate name error, log it if not in silent mode:
-            const Value & otherVal = iter->second;
+            const Value & otherVal = *otherValPtr;
             const Token & otherValStartTok = otherVal.mDeclaringNode->getStartToken();
+            SourceLoc otherValLoc = ctx.getSrcLineIndex().getLoc(otherValStartTok.startSrcOffset);
             
             ctx.error(declaringNode,
                       "Duplicate declaration named '%s'! Declaration of type '%s' has already been declared "
                       "at line %zu, col %zu as a declaration of type '%s'!",
                       name.c_str(),
                       compiledType.getDataType().name().c_str(),
-                      otherValStartTok.startLine + 1,
-                      otherValStartTok.startCol + 1,
+                      size_t(otherValLoc.line) + 1,
+                      size_t(otherValLoc.col) + 1,
                       otherVal.mCompiledType.getDataType().name().c_str());
             
             // We found an error
@@ -156,20 +166,21 @@ bool ValHolder::compileCheckNameNotTaken(CodegenCtx & ctx,
     
     // Check to see if it exists in the set of constants
     if (!duplicateNameError) {
-        auto iter = mConstants.find(name);
+        const Constant * otherConstPtr = mConstants.find(name.data(), name.size(), nameHash);
         
-        if (iter != mConstants.end()) {
+        if (otherConstPtr) {
             // Okay we have a duplicate name error, log it if not in silent mode:
-            const Constant & otherConst = iter->second;
+            const Constant & otherConst = *otherConstPtr;
             const Token & otherConstStartTok = otherConst.mDeclaringNode->getStartToken();
+            SourceLoc otherConstLoc = ctx.getSrcLineIndex().getLoc(otherConstStartTok.startSrcOffset);
             
             ctx.error(declaringNode,
                       "Duplicate declaration named '%s'! Declaration of type '%s' has already been declared "
                       "at line %zu, col %zu as a declaration of type '%s'!",
                       name.c_str(),
                       compiledType.getDataType().name().c_str(),
-                      otherConstStartTok.startLine + 1,
-                      otherConstStartTok.startCol + 1,
+                      size_t(otherConstLoc.line) + 1,
+                      size_t(otherConstLoc.col) + 1,
                       otherConst.mCompiledType.getDataType().name().c_str());
             
             // We found an error
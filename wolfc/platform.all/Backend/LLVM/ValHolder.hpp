@@ -6,11 +6,14 @@
 
 #pragma once
 
+#include "AST/NameBindings.hpp"
 #include "Constant.hpp"
+#include "NameTable.hpp"
 #include "Value.hpp"
 
 WC_THIRD_PARTY_INCLUDES_BEGIN
-    #include <map>
+    #include <cstddef>
+    #include <cstdint>
     #include <string>
 WC_THIRD_PARTY_INCLUDES_END
 
@@ -40,6 +43,7 @@ public:
      * Create a value within this holder.
      * If the value already exists then a compile error is emitted and the constant is given a '#2', 
      * '#3' etc. suffix in order to allow the value to be created anyway.
+     * The declaration id is the 'mDeclId' of the declaring node, which identifiers can be bound to.
      */
     Value & createVal(CodegenCtx & ctx,
                       const std::string & name,
@@ -47,18 +51,21 @@ public:
                       const CompiledDataType & compiledType,
                       bool requiresLoad,
                       const AST::ASTNode & declaringNode,
+                      AST::DeclId declId,
                       bool noDuplicateNameCheck);
     
     /** 
      * Create a constant within this holder.
      * If the constant already exists then a compile error is emitted and the constant is given a '#2', 
      * '#3' etc. suffix in order to allow the constant to be created anyway.
+     * The declaration id is the 'mDeclId' of the declaring node, which identifiers can be bound to.
      */
     Constant & createConst(CodegenCtx & ctx,
                            const std::string & name,
                            llvm::Constant * llvmConst,
                            const CompiledDataType & compiledType,
                            const AST::ASTNode & declaringNode,
+                           AST::DeclId declId,
                            bool noDuplicateNameCheck);
     
     /**
@@ -76,6 +83,22 @@ public:
     Constant * getConst(const char * name);
     Constant * getConst(const std::string & name);
     
+    /**
+     * Get a value or constant within this holder, given the length of the name and the hash of it from
+     * 'SymbolTable::hashName'. Saves hashing the name again when looking it up in multiple holders.
+     */
+    const Value * getVal(const char * name, size_t nameLen, uint32_t nameHash) const;
+    const Constant * getConst(const char * name, size_t nameLen, uint32_t nameHash) const;
+    
+    /* Get all of the values or constants within this holder, in the order they were created */
+    inline const NameTable<Value> & getVals() const {
+        return mValues;
+    }
+    
+    inline const NameTable<Constant> & getConsts() const {
+        return mConstants;
+    }
+    
 private:
     /**
      * Compile check the given name for a value or constant declaration is not taken.
@@ -90,10 +113,10 @@ private:
                                   const AST::ASTNode & declaringNode) const;
     
     /* The values in the container */
-    std::map<std::string, Value, std::less<>> mValues;
+    NameTable<Value> mValues;
     
     /* The constants in the container */
-    std::map<std::string, Constant, std::less<>> mConstants;
+    NameTable<Constant> mConstants;
 };
 
 WC_LLVM_BACKEND_END_NAMESPACE
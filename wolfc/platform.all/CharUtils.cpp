@@ -8,40 +8,67 @@
 
 WC_BEGIN_NAMESPACE
 
+/* Build the character class table at compile time */
+static constexpr AsciiCharClassTable makeAsciiCharClassTable() {
+    AsciiCharClassTable table{};
+    
+    for (char32_t c = 0; c < 128; ++c) {
+        uint8_t classes = 0;
+        
+        if (CharUtils::isDecimalDigit(c)) {
+            classes |= CharClass::kDecimalDigit;
+        }
+        
+        if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')) {
+            classes |= CharClass::kAlpha;
+        }
+        
+        if (CharUtils::isUnderscore(c)) {
+            classes |= CharClass::kUnderscore;
+        }
+        
+        table.classes[c] = classes;
+    }
+    
+    return table;
+}
+
+const AsciiCharClassTable CharUtils::kAsciiCharClassTable = makeAsciiCharClassTable();
+
 bool CharUtils::isValidIdentifierStartChar(char32_t c) {
-    return isAlpha(c) || isUnderscore(c);
+    // Unicode: accept any char that is not whitespace
+    if (c >= 128) {
+        return !isWhitespace(c);
+    }
+    
+    return (kAsciiCharClassTable.classes[c] & CharClass::kIdentifierStart) != 0;
 }
 
 bool CharUtils::isValidIdentifierMiddleChar(char32_t c) {
-    return isValidIdentifierStartChar(c) || isDecimalDigit(c);
+    // Unicode: accept any char that is not whitespace
+    if (c >= 128) {
+        return !isWhitespace(c);
+    }
+    
+    return (kAsciiCharClassTable.classes[c] & CharClass::kIdentifierMiddle) != 0;
 }
 
 bool CharUtils::isAlpha(char32_t c) {
-    // See if 7-bit Ascii or unicode
-    if (c <= 127) {
-        // 7-bit Ascii: 
-        if (c >= 'A') {
-            if (c <= 'z') {
-                // Somewhere between 'A' and 'z', narrow down search:
-                if (c >= 'a') {
-                    return true;    // Between a-z
-                }
-                
-                if (c <= 'Z') {
-                    return true;    // Between A-Z
-                }
-            }
-        }
-        
-        // Not an alpha char:
-        return false;
+    // Unicode: accept any char that is not whitespace
+    if (c >= 128) {
+        return !isWhitespace(c);
     }
     
-    return !isWhitespace(c);    // Unicode: accept any char that is not whitespace
+    return (kAsciiCharClassTable.classes[c] & CharClass::kAlpha) != 0;
 }
 
 bool CharUtils::isAlphaNumeric(char32_t c) {
-    return isDecimalDigit(c) || isAlpha(c);
+    // Unicode: accept any char that is not whitespace
+    if (c >= 128) {
+        return !isWhitespace(c);
+    }
+    
+    return (kAsciiCharClassTable.classes[c] & (CharClass::kAlpha | CharClass::kDecimalDigit)) != 0;
 }
 
 WC_END_NAMESPACE
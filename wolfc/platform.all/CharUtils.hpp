@@ -10,12 +10,47 @@
 
 WC_THIRD_PARTY_INCLUDES_BEGIN
     #include <cstddef>
+    #include <cstdint>
 WC_THIRD_PARTY_INCLUDES_END
 
 WC_BEGIN_NAMESPACE
 
+/* Bit flags for the class of a 7-bit ascii character. See 'CharUtils::getAsciiCharClass'. */
+namespace CharClass {
+    /* 0-9 */
+    static constexpr const uint8_t kDecimalDigit = 0x01;
+    /* a-z and A-Z */
+    static constexpr const uint8_t kAlpha = 0x02;
+    /* '_' */
+    static constexpr const uint8_t kUnderscore = 0x04;
+    
+    /* Characters that can start an identifier */
+    static constexpr const uint8_t kIdentifierStart = kAlpha | kUnderscore;
+    /* Characters that can follow the start of an identifier */
+    static constexpr const uint8_t kIdentifierMiddle = kAlpha | kUnderscore | kDecimalDigit;
+}
+
+/* Table holding the character class flags (see 'CharClass') for every possible byte value */
+struct AsciiCharClassTable {
+    uint8_t classes[256];
+};
+
 /* Utilities for querying character classes. */
 namespace CharUtils {
+    /**
+     * The character class flags for every possible byte value. Only 7-bit ascii characters have any flags set,
+     * bytes 128-255 (which can only be part of a multi byte utf8 character) always have no flags.
+     */
+    extern const AsciiCharClassTable kAsciiCharClassTable;
+    
+    /**
+     * Get the character class flags (see 'CharClass') for a unicode character via a table lookup.
+     * Characters outside of the 7-bit ascii range have no flags set.
+     */
+    inline uint8_t getAsciiCharClass(char32_t c) {
+        return (c < 128) ? kAsciiCharClassTable.classes[c] : 0;
+    }
+    
     /* Tells if a unicode character is valid to be used in an identifier as the first character. */
     bool isValidIdentifierStartChar(char32_t c);
     
@@ -55,6 +90,11 @@ namespace CharUtils {
         return isHexDigit(c) || isUnderscore(c);
     }
     
+    /* Get the numeric value of a digit in any base up to 16. The character must be a valid hex digit. */
+    inline constexpr uint8_t getDigitValue(char32_t c) {
+        return (c <= '9') ? uint8_t(c - '0') : ((c >= 'a') ? uint8_t(c - 'a' + 10) : uint8_t(c - 'A' + 10));
+    }
+    
     /* Tells if a unicode character is 0-7 */
     inline constexpr bool isOctalDigit(char32_t c) {
         return c >= '0' && c <= '7';
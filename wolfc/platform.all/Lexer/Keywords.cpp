@@ -0,0 +1,172 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#include "Keywords.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstdint>
+    #include <cstring>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+
+/* A language keyword and the token type it maps to */
+struct KeywordDef {
+    const char * str;
+    TokenType type;
+};
+
+/* The list of all language keywords. To add a new keyword simply add it to this list. */
+static constexpr const KeywordDef kKeywordDefs[] = {
+    { "true", TokenType::kTrue },
+    { "false", TokenType::kFalse },
+    { "null", TokenType::kNull },
+    { "void", TokenType::kVoid },
+    { "any", TokenType::kAny },
+    { "nullptr", TokenType::kNullptr },
+    { "int", TokenType::kInt },
+    { "int8", TokenType::kInt8 },
+    { "int16", TokenType::kInt16 },
+    { "int32", TokenType::kInt32 },
+    { "int64", TokenType::kInt64 },
+    { "int128", TokenType::kInt128 },
+    { "uint", TokenType::kUInt },
+    { "uint8", TokenType::kUInt8 },
+    { "uint16", TokenType::kUInt16 },
+    { "uint32", TokenType::kUInt32 },
+    { "uint64", TokenType::kUInt64 },
+    { "uint128", TokenType::kUInt128 },
+    { "bool", TokenType::kBool },
+    { "string", TokenType::kString },
+    { "let", TokenType::kLet },
+    { "is", TokenType::kIs },
+    { "and", TokenType::kAnd },
+    { "or", TokenType::kOr },
+    { "not", TokenType::kNot },
+    { "if", TokenType::kIf },
+    { "unless", TokenType::kUnless },
+    { "then", TokenType::kThen },
+    { "else", TokenType::kElse },
+    { "end", TokenType::kEnd },
+    { "while", TokenType::kWhile },
+    { "until", TokenType::kUntil },
+    { "do", TokenType::kDo },
+    { "break", TokenType::kBreak },
+    { "next", TokenType::kNext },
+    { "loop", TokenType::kLoop },
+    { "repeat", TokenType::kRepeat },
+    { "scope", TokenType::kScope },
+    { "noop", TokenType::kNoOp },
+    { "return", TokenType::kReturn },
+    { "func", TokenType::kFunc },
+    { "cast", TokenType::kCast },
+    { "to", TokenType::kTo },
+    { "time", TokenType::kTime },
+    { "rand", TokenType::kRand },
+    { "srand", TokenType::kSRand },
+    { "print", TokenType::kPrint },
+    { "readnum", TokenType::kReadnum },
+    { "assert", TokenType::kAssert },
+};
+
+/**
+ * Settings for the perfect hash. The multiplier was found by searching for a value which maps
+ * every keyword in the list above to a unique table slot. If a new keyword causes a collision
+ * then the static assert below will fire and a new multiplier (or a bigger table) must be chosen.
+ */
+static constexpr const uint32_t kHashMultiplier = 0x85BE4AE7;
+static constexpr const uint32_t kTableSizeLog2 = 7;
+static constexpr const size_t kTableSize = size_t(1) << kTableSizeLog2;
+
+/* Compile time version of 'strlen' */
+static constexpr size_t constexprStrlen(const char * str) {
+    size_t len = 0;
+    
+    while (str[len] != 0) {
+        ++len;
+    }
+    
+    return len;
+}
+
+/**
+ * Hash the given word into a keyword table slot.
+ * The hash only looks at the first two chars, the last char and the length of the word.
+ * Expects the word to be at least 2 chars long and no more than 255 chars long.
+ */
+static constexpr uint32_t hashWord(const char * word, size_t wordLen) {
+    return ((static_cast<uint32_t>(static_cast<uint8_t>(word[0])) |
+            (static_cast<uint32_t>(static_cast<uint8_t>(word[1])) << 8) |
+            (static_cast<uint32_t>(static_cast<uint8_t>(word[wordLen - 1])) << 16) |
+            (static_cast<uint32_t>(wordLen) << 24)) * kHashMultiplier) >> (32 - kTableSizeLog2);
+}
+
+/* A slot in the keyword hash table. Unused slots have a length of zero. */
+struct KeywordTableSlot {
+    const char * str;
+    size_t len;
+    TokenType type;
+};
+
+/* The keyword hash table, built at compile time */
+struct KeywordTable {
+    constexpr KeywordTable() :
+        slots{},
+        minKeywordLen(SIZE_MAX),
+        maxKeywordLen(0),
+        hasCollisions(false)
+    {
+        for (const KeywordDef & keywordDef : kKeywordDefs) {
+            size_t keywordLen = constexprStrlen(keywordDef.str);
+            KeywordTableSlot & slot = slots[hashWord(keywordDef.str, keywordLen)];
+            
+            if (slot.len != 0) {
+                hasCollisions = true;
+            }
+            
+            slot.str = keywordDef.str;
+            slot.len = keywordLen;
+            slot.type = keywordDef.type;
+            
+            if (keywordLen < minKeywordLen) {
+                minKeywordLen = keywordLen;
+            }
+            
+            if (keywordLen > maxKeywordLen) {
+                maxKeywordLen = keywordLen;
+            }
+        }
+    }
+    
+    KeywordTableSlot slots[kTableSize];
+    size_t minKeywordLen;
+    size_t maxKeywordLen;
+    bool hasCollisions;
+};
+
+static constexpr const KeywordTable kKeywordTable{};
+
+static_assert(!kKeywordTable.hasCollisions, "Keyword hash has collisions! Choose a different hash multiplier.");
+static_assert(kKeywordTable.minKeywordLen >= 2, "Keyword hash requires keywords to be at least 2 chars long!");
+static_assert(kKeywordTable.maxKeywordLen <= 255, "Keyword hash requires keywords to be no more than 255 chars long!");
+
+TokenType Keywords::getTokenType(const char * word, size_t wordLen) {
+    // Words outside of the keyword length range can't be a keyword. This check also keeps the hash safe:
+    if (wordLen < kKeywordTable.minKeywordLen || wordLen > kKeywordTable.maxKeywordLen) {
+        return TokenType::kIdentifier;
+    }
+    
+    // Only one keyword can possibly match, check if it is this word:
+    const KeywordTableSlot & slot = kKeywordTable.slots[hashWord(word, wordLen)];
+    
+    if (slot.len == wordLen && std::memcmp(slot.str, word, wordLen) == 0) {
+        return slot.type;
+    }
+    
+    return TokenType::kIdentifier;
+}
+
+WC_END_NAMESPACE
@@ -0,0 +1,31 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#pragma once
+
+#include "TokenType.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstddef>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+
+/**
+ * Lookup of language keywords for the lexer.
+ *
+ * Keywords are stored in a table which is generated at compile time and indexed by a perfect hash
+ * of the keyword. Looking up a word therefore costs one hash and at most one string compare.
+ */
+namespace Keywords {
+    /**
+     * Get the keyword token type for the given identifier-like word, which is NOT null terminated.
+     * Returns 'TokenType::kIdentifier' if the word is not a language keyword.
+     */
+    TokenType getTokenType(const char * word, size_t wordLen);
+}
+
+WC_END_NAMESPACE
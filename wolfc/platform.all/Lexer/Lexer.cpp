@@ -9,40 +9,195 @@
 #include "Assert.hpp"
 #include "CharUtils.hpp"
 #include "DataType/Types/PrimitiveDataTypes.hpp"
+#include "Keywords.hpp"
+#include "Operators.hpp"
+#include "SourceBuffer.hpp"
+#include "SourceScan.hpp"
 #include "StringUtils.hpp"
 #include "Token.hpp"
 
 WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <algorithm>
     #include <memory>
     #include <cstdarg>
     #include <cstdio>
     #include <cstdlib>
+    #include <limits>
 WC_THIRD_PARTY_INCLUDES_END
 
 WC_BEGIN_NAMESPACE
 
 Lexer::Lexer(size_t initialTokenCapacity) :
     mTokenList(nullptr),
-    mTokenCapacity(initialTokenCapacity),
+    mTokenTypeList(nullptr),
+    mTokenCapacity(0),
     mTokenCount(0),
-    mLexerState{}
+    mIsStreaming(false),
+    mNumCommittedTokens(0),
+    mLexerState{},
+    mLinearAlloc(
+        1024 * 64,      /* 64 KB max alloc */
+        1024 * 1024,    /* 1 MB block size */
+        16,             /* Space in blocks array to reserve */
+        16              /* Space in sys blocks array to reserve */
+    ),
+    mSymbolTable(mLinearAlloc),
+    mEmitErrors(true)
 {
     increaseTokenListCapacity(initialTokenCapacity);
 }
 
 Lexer::~Lexer() {
-    if (mTokenList) {
-        std::free(mTokenList);
-        mTokenList = nullptr;
+    freeTokenList();
+    
+    for (TokenBuffer & tokenBuffer : mRetiredTokenBuffers) {
+        freeTokenBuffer(tokenBuffer);
+    }
+    
+    for (TokenBuffer & tokenBuffer : mFreeTokenBuffers) {
+        freeTokenBuffer(tokenBuffer);
     }
 }
 
 bool Lexer::process(const char * utf8Src) {
-    // Bootstrap the lexer
-    initLexerState(utf8Src);
+    // Bootstrap the lexer and lex all of the source in one go
+    mIsStreaming = false;
+    WC_GUARD(initLexerState(utf8Src), false);
+    return lexTokens(std::numeric_limits<size_t>::max());
+}
+
+bool Lexer::process(const SourceBuffer & utf8Src) {
+    WC_GUARD(checkSrcSize(utf8Src), false);
+    return process(utf8Src.getText());
+}
+
+bool Lexer::beginStreaming(const char * utf8Src) {
+    // Bootstrap the lexer. Note: no tokens are lexed until they are pulled.
+    mIsStreaming = true;
+    return initLexerState(utf8Src);
+}
+
+bool Lexer::beginStreaming(const SourceBuffer & utf8Src) {
+    WC_GUARD(checkSrcSize(utf8Src), false);
+    return beginStreaming(utf8Src.getText());
+}
+
+bool Lexer::processRange(const char * utf8Src,
+                         const char * rangeStartPtr,
+                         const char * rangeEndPtr,
+                         uint8_t firstTokenFlags,
+                         const SourceLineIndex * prevSrcLineIndex)
+{
+    // Bootstrap the lexer for the whole source, so that source offsets are relative to the start of it
+    mIsStreaming = false;
+    WC_GUARD(initLexerState(utf8Src), false);
+    
+    if (prevSrcLineIndex) {
+        mSrcLineIndex.reset(utf8Src, *prevSrcLineIndex, getSrcOffset(rangeStartPtr));
+    }
+    
+    // Now move onto the start of the range
+    mLexerState.srcPtr = rangeStartPtr;
+    mLexerState.srcEndPtr = rangeEndPtr;
+    mLexerState.nextTokenFlags = firstTokenFlags;
+    WC_GUARD(decodeCurrentChar(), false);
+    
+    // Lex the whole range
+    return lexTokens(std::numeric_limits<size_t>::max());
+}
+
+size_t Lexer::pullTokens() {
+    WC_ASSERT(mIsStreaming);
+    WC_GUARD(!mLexerState.finished, 0);
+    
+    // If there is not enough room left for another window of tokens then move the tokens that are still
+    // needed over to another buffer. Tokens that were committed are no longer needed so drop them here.
+    size_t numTokensDropped = 0;
     
+    if (mTokenCapacity - mTokenCount < kStreamWindowSize) {
+        numTokensDropped = mNumCommittedTokens;
+        switchTokenBuffer(numTokensDropped, mTokenCount - numTokensDropped + kStreamWindowSize);
+    }
+    
+    // Lex the next window of tokens. If that fails then end the token list here so that the parser stops:
+    if (!lexTokens(mTokenCount + kStreamWindowSize)) {
+        createEOFToken();
+    }
+    
+    return numTokensDropped;
+}
+
+void Lexer::commitTokens(size_t numTokens) {
+    WC_ASSERT(mIsStreaming);
+    WC_ASSERT(numTokens <= mTokenCount);
+    mNumCommittedTokens = numTokens;
+    
+    // Nothing can be referencing the retired buffers anymore, so recycle them
+    for (TokenBuffer & tokenBuffer : mRetiredTokenBuffers) {
+        if (mFreeTokenBuffers.size() < kMaxFreeTokenBuffers) {
+            mFreeTokenBuffers.push_back(tokenBuffer);
+        }
+        else {
+            freeTokenBuffer(tokenBuffer);
+        }
+    }
+    
+    mRetiredTokenBuffers.clear();
+}
+
+const Token * Lexer::getTokenList() const {
+    return mTokenList;
+}
+
+const TokenType * Lexer::getTokenTypeList() const {
+    return mTokenTypeList;
+}
+
+bool Lexer::initLexerState(const char * utf8Src) {
+    WC_ASSERT(utf8Src);
+    mLexerState.error = false;
+    mLexerState.finished = false;
+    mLexerState.srcStartPtr = utf8Src;
+    mLexerState.srcPtr = utf8Src;
+    mLexerState.srcEndPtr = nullptr;
+    mLexerState.nextTokenFlags = 0;
+    mSrcLineIndex.reset(utf8Src);
+    mTokenCount = 0;
+    mNumCommittedTokens = 0;
+    
+#if DEBUG == 1
+    mDebugTokenList.clear();
+#endif  // #if DEBUG == 1
+    
+    if (!StringUtils::parseUtf8Char(utf8Src, mLexerState.currentChar, mLexerState.currentCharNumBytes)) {
+        error("Malformed utf8 bytes at the start of the source code! Unable to parse!");
+        mLexerState.error = true;
+        mLexerState.currentCharIsNewline = false;
+        return false;
+    }
+    
+    mLexerState.currentCharIsNewline = CharUtils::isLineSeparator(mLexerState.currentChar);
+    return true;
+}
+
+bool Lexer::checkSrcSize(const SourceBuffer & utf8Src) {
+    // Token source locations are stored as 32-bit offsets, so we can't handle anything bigger than this
+    if (utf8Src.getSize() > std::numeric_limits<uint32_t>::max()) {
+        error("Source code is too large to be processed! Source files must be less than 4 GB in size.");
+        return false;
+    }
+    
+    return true;
+}
+
+bool Lexer::lexTokens(size_t maxTokenCount) {
     // Continue until there is no source left
-    while (!mLexerState.error && mLexerState.currentChar != 0) {
+    while (!mLexerState.error && mLexerState.currentChar != 0 && mLexerState.srcPtr != mLexerState.srcEndPtr) {
+        // If we have produced enough tokens for now then stop
+        if (mTokenCount >= maxTokenCount) {
+            return true;
+        }
+        
         // Skip all whitespace before parsing something interesting
         if (trySkipWhitespaceChar()) {
             continue;
@@ -63,6 +218,7 @@ bool Lexer::process(const char * utf8Src) {
                 }\
                 else if (result != ParseResult::kNone) {\
                     /* Parsing failed */\
+                    mLexerState.error = true;\
                     return false;\
                 }\
             }
@@ -76,7 +232,8 @@ bool Lexer::process(const char * utf8Src) {
                                                
         // If we get to here then we have an error
         std::string charAsUtf8Str(mLexerState.srcPtr, mLexerState.currentCharNumBytes);
-        error("Unexpected character '%s' at start of token!", charAsUtf8Str.c_str());
+        error(mLexerState.srcPtr, "Unexpected character '%s' at start of token!", charAsUtf8Str.c_str());
+        mLexerState.error = true;
         return false;
     }
     
@@ -85,29 +242,13 @@ bool Lexer::process(const char * utf8Src) {
         return false;
     }
     
-    // Now add in the end of file token and return true for success
-    createEOFToken();
-    return true;
-}
-
-const Token * Lexer::getTokenList() const {
-    return mTokenList;
-}
-
-bool Lexer::initLexerState(const char * utf8Src) {
-    WC_ASSERT(utf8Src);
-    mLexerState.error = false;
-    mLexerState.srcPtr = utf8Src;
-    mLexerState.srcLine = 0;
-    mLexerState.srcCol = 0;
-    
-    if (!StringUtils::parseUtf8Char(utf8Src, mLexerState.currentChar, mLexerState.currentCharNumBytes)) {
-        error("Malformed utf8 bytes at the start of the source code! Unable to parse!");
-        mLexerState.currentCharIsNewline = false;
-        return false;
+    // If we stopped at the end of a chunk of the source rather than the end of the source then we are done
+    if (mLexerState.currentChar != 0) {
+        return true;
     }
     
-    mLexerState.currentCharIsNewline = CharUtils::isLineSeparator(mLexerState.currentChar);
+    // Now add in the end of file token and return true for success
+    createEOFToken();
     return true;
 }
 
@@ -116,15 +257,20 @@ bool Lexer::trySkipWhitespaceChar() {
     char32_t currentChar = mLexerState.currentChar;
     WC_GUARD(CharUtils::isWhitespace(currentChar), false);
     
-    // Skip this character:
-    moveOntoNextChar();
+    // Skip this character. Runs of spaces and tabs are very common (indentation etc.) so skip those in bulk.
+    if (currentChar == ' ' || currentChar == '\t') {
+        moveOntoNextAsciiChars(SourceScan::countBlankChars(mLexerState.srcPtr));
+    }
+    else {
+        moveOntoNextChar();
+    }
     
     // Parsed a whitespace:
     return true;
 }
 
 void Lexer::skipAnyWhitespaceCharsAhead() {
-    while (!mLexerState.error && mLexerState.currentChar != 0) {
+    while (!mLexerState.error && mLexerState.currentChar != 0 && mLexerState.srcPtr != mLexerState.srcEndPtr) {
         if (!trySkipWhitespaceChar()) {
             break;
         }
@@ -134,42 +280,51 @@ void Lexer::skipAnyWhitespaceCharsAhead() {
 bool Lexer::moveOntoNextChar() {
     // Move along by one char, see if the next char is a newline or just a regular non newline char
     if (mLexerState.currentCharIsNewline) {
-        // Save a newline token into the list of tokens
-        Token & newlineTok = allocToken(TokenType::kNewline);
-        newlineTok.startLine = mLexerState.srcLine;
-        newlineTok.startCol = mLexerState.srcCol;
-        newlineTok.startSrcPtr = mLexerState.srcPtr;
-        newlineTok.endLine = mLexerState.srcLine + 1;
-        newlineTok.endCol = 0;
-        newlineTok.endSrcPtr = mLexerState.srcPtr + 1;
+        // Newlines are not saved as tokens, instead the next token is flagged as being preceded by a newline
+        mLexerState.nextTokenFlags |= TokenFlags::kPrecededByNewline;
         
         // Newline char: have to treat this different
         if (mLexerState.currentChar == '\r' && mLexerState.srcPtr[1] == '\n') {
             // Carriage return and newline utf8 combo: interpret as just one newline
             mLexerState.srcPtr += 2;
-            mLexerState.srcLine++;
-            mLexerState.srcCol = 0;
-            
-            // Move on the end for the newline token by one character
-            newlineTok.endSrcPtr++;
         }
         else {
             // Regular new line
             mLexerState.srcPtr += mLexerState.currentCharNumBytes;
-            mLexerState.srcLine++;
-            mLexerState.srcCol = 0;
         }
+        
+        // Record the start of the new line
+        mSrcLineIndex.addLineStart(getSrcOffset(mLexerState.srcPtr));
     }
     else {
         // Regular char, treat as normal
         mLexerState.srcPtr += mLexerState.currentCharNumBytes;
-        mLexerState.srcCol++;
     }
     
     // Alright, now see what the new character is
-    if (!StringUtils::parseUtf8Char(mLexerState.srcPtr,
-                                    mLexerState.currentChar,
-                                    mLexerState.currentCharNumBytes))
+    return decodeCurrentChar();
+}
+
+bool Lexer::moveOntoNextAsciiChars(size_t numChars) {
+    WC_ASSERT(!mLexerState.currentCharIsNewline);
+    WC_ASSERT(mLexerState.currentCharNumBytes == 1 || numChars == 0);
+    
+    // Each char is one byte and not a newline, so this is simple:
+    mLexerState.srcPtr += numChars;
+    return decodeCurrentChar();
+}
+
+bool Lexer::decodeCurrentChar() {
+    // Fast path for plain 7-bit ascii, otherwise do a full utf8 decode:
+    uint8_t firstByte = static_cast<uint8_t>(mLexerState.srcPtr[0]);
+    
+    if (firstByte < 0x80) {
+        mLexerState.currentChar = firstByte;
+        mLexerState.currentCharNumBytes = 1;
+    }
+    else if (!StringUtils::parseUtf8Char(mLexerState.srcPtr,
+                                         mLexerState.currentChar,
+                                         mLexerState.currentCharNumBytes))
     {
         mLexerState.error = true;
         error("Malformed utf8 bytes at the current location in the source code! Unable to parse!");
@@ -182,223 +337,24 @@ bool Lexer::moveOntoNextChar() {
 }
 
 Lexer::ParseResult Lexer::parseBasicTokens() {
-    switch (mLexerState.currentChar) {
-        case '(': return parseBasicToken(TokenType::kLParen, 1);
-        case ')': return parseBasicToken(TokenType::kRParen, 1);
-        case '[': return parseBasicToken(TokenType::kLBrack, 1);
-        case ']': return parseBasicToken(TokenType::kRBrack, 1);
-            
-        case '+': {
-            if (mLexerState.srcPtr[1] == '+') {
-                // '++' operator
-                return parseBasicToken(TokenType::kIncrement, 2);
-            }
-            else if (mLexerState.srcPtr[1] == '=') {
-                // '+=' operator
-                return parseBasicToken(TokenType::kAssignAdd, 2);
-            }
-            else {
-                // '+' operator
-                return parseBasicToken(TokenType::kPlus, 1);
-            }
-        }
-        
-        case '-': {
-            if (mLexerState.srcPtr[1] == '>') {
-                // '->' operator
-                return parseBasicToken(TokenType::kOpArrow, 2);
-            }
-            else if (mLexerState.srcPtr[1] == '-') {
-                // '--' operator
-                return parseBasicToken(TokenType::kDecrement, 2);
-            }
-            else if (mLexerState.srcPtr[1] == '=') {
-                // '-=' operator
-                return parseBasicToken(TokenType::kAssignSub, 2);
-            }
-            else {
-                // '-' operator
-                return parseBasicToken(TokenType::kMinus, 1);
-            }
-        }
-        
-        case '%': {
-            if (mLexerState.srcPtr[1] == '=') {
-                // '%=' operator
-                return parseBasicToken(TokenType::kAssignRem, 2);
-            }
-            else {
-                // '%' operator
-                return parseBasicToken(TokenType::kPercent, 1);
-            }
-        }
-        
-        case '*': {
-            if (mLexerState.srcPtr[1] == '=') {
-                // '*=' operator
-                return parseBasicToken(TokenType::kAssignMul, 2);
-            }
-            else {
-                // '*' operator
-                return parseBasicToken(TokenType::kAsterisk, 1);
-            }
-        }
-        
-        case '/': {
-            // '/' can be followed immediately by ';', in which case it is a multi line comment opener
-            if (mLexerState.srcPtr[1] == ';') {
-                // Multi line comment: do not interpret the '/' as a token
-                return ParseResult::kNone;
-            }
-            else if (mLexerState.srcPtr[1] == '=') {
-                // '/=' operator
-                return parseBasicToken(TokenType::kAssignDiv, 2);
-            }
-            else {
-                // '/' operator
-                return parseBasicToken(TokenType::kSlash, 1);
-            }
-        }
-            
-        case '<': {
-            if (mLexerState.srcPtr[1] == '=') {
-                // '<=' operator
-                return parseBasicToken(TokenType::kCmpLE, 2);
-            }
-            else if (mLexerState.srcPtr[1] == '<') {
-                if (mLexerState.srcPtr[2] == '=') {
-                    // '<<=' operator
-                    return parseBasicToken(TokenType::kAssignLShift, 3);
-                }
-                else {
-                    // '<<' operator
-                    return parseBasicToken(TokenType::kLShift, 2);
-                }
-            }
-            else {
-                // '<' operator
-                return parseBasicToken(TokenType::kCmpLT, 1);
-            }
-        }
-            
-        case '>': {
-            if (mLexerState.srcPtr[1] == '=') {
-                // '>=' operator
-                return parseBasicToken(TokenType::kCmpGE, 2);
-            }
-            else if (mLexerState.srcPtr[1] == '>') {
-                if (mLexerState.srcPtr[2] == '>') {
-                    if (mLexerState.srcPtr[3] == '=') {
-                        // '>>>=' operator
-                        return parseBasicToken(TokenType::kAssignLRShift, 4);
-                    }
-                    else {
-                        // '>>>' operator
-                        return parseBasicToken(TokenType::kLRShift, 3);
-                    }
-                }
-                else {
-                    if (mLexerState.srcPtr[2] == '=') {
-                        // '>>=' operator
-                        return parseBasicToken(TokenType::kAssignARShift, 3);
-                    }
-                    else {
-                        // '>>=' operator
-                        return parseBasicToken(TokenType::kARShift, 2);
-                    }
-                }
-            }
-            else {
-                // '>' operator
-                return parseBasicToken(TokenType::kCmpGT, 1);
-            }
-        }
-            
-        case '=': {
-            if (mLexerState.srcPtr[1] == '=') {
-                // '==' operator
-                return parseBasicToken(TokenType::kCmpEQ, 2);
-            }
-            else {
-                // '=' operator
-                return parseBasicToken(TokenType::kAssign, 1);
-            }
-        }
-            
-        case '!': {
-            if (mLexerState.srcPtr[1] == '=') {
-                // '!=' operator
-                return parseBasicToken(TokenType::kCmpNE, 2);
-            }
-            else {
-                // '!' operator
-                return parseBasicToken(TokenType::kExclamation, 1);
-            }
-        }
-            
-        case ',': return parseBasicToken(TokenType::kComma, 1);
-        case ':': return parseBasicToken(TokenType::kColon, 1);
-        case '?': return parseBasicToken(TokenType::kQMark, 1);
-        case '~': return parseBasicToken(TokenType::kTilde, 1);
-        case '$': return parseBasicToken(TokenType::kDollar, 1);
-            
-        case '&': {
-            if (mLexerState.srcPtr[1] == '=') {
-                // '&=' operator
-                return parseBasicToken(TokenType::kAssignBAnd, 2);
-            }
-            else {
-                // '&' operator
-                return parseBasicToken(TokenType::kAmpersand, 1);
-            }
-        }
-            
-        case '^': {
-            if (mLexerState.srcPtr[1] == '=') {
-                // '^=' operator
-                return parseBasicToken(TokenType::kAssignBXor, 2);
-            }
-            else {
-                // '^' operator
-                return parseBasicToken(TokenType::kHat, 1);
-            }
-        }
-        
-        case '|': {
-            if (mLexerState.srcPtr[1] == '=') {
-                // '|=' operator
-                return parseBasicToken(TokenType::kAssignBOr, 2);
-            }
-            else {
-                // '|' operator
-                return parseBasicToken(TokenType::kVBar, 1);
-            }
-        }
-            
-        default:
-            break;
+    // '/' can be followed immediately by ';', in which case it is a multi line comment opener.
+    // Do not interpret the '/' as a token in that case.
+    if (mLexerState.currentChar == '/' && mLexerState.srcPtr[1] == ';') {
+        return ParseResult::kNone;
     }
     
-    return ParseResult::kNone;
+    // Match the longest operator or punctuation token here, if any
+    TokenType tokenType = TokenType::kEOF;
+    size_t numCharsInToken = Operators::match(mLexerState.srcPtr, tokenType);
+    WC_GUARD(numCharsInToken > 0, ParseResult::kNone);
+    return parseBasicToken(tokenType, numCharsInToken);
 }
 
 Lexer::ParseResult Lexer::parseBasicToken(TokenType tokenType, size_t numCharsInToken) {
-    Token & tok = allocToken(tokenType);
-    tok.startLine = mLexerState.srcLine;
-    tok.startCol = mLexerState.srcCol;
-    tok.startSrcPtr = mLexerState.srcPtr;
-    
-    while (numCharsInToken > 0) {
-        --numCharsInToken;
-        
-        if (!moveOntoNextChar()) {
-            return ParseResult::kFail;
-        }
-    }
-    
-    tok.endLine = mLexerState.srcLine;
-    tok.endCol = mLexerState.srcCol;
-    tok.endSrcPtr = mLexerState.srcPtr;
+    // Note: operators and punctuation are all made up of ascii chars that are not newlines
+    Token & tok = allocToken(tokenType, mLexerState.srcPtr);
+    WC_GUARD(moveOntoNextAsciiChars(numCharsInToken), ParseResult::kFail);
+    tok.endSrcOffset = getSrcOffset(mLexerState.srcPtr);
     return ParseResult::kSuccess;
 }
 
@@ -409,8 +365,6 @@ Lexer::ParseResult Lexer::parseNumericLiteral() {
     
     // Save the start of the literal
     const char * tokStartPtr = mLexerState.srcPtr;
-    const size_t tokStartLine = mLexerState.srcLine;
-    const size_t tokStartCol = mLexerState.srcCol;
     
     // Save the start of the integer literal digits.
     // Note: may need to move this on later below...
@@ -422,7 +376,7 @@ Lexer::ParseResult Lexer::parseNumericLiteral() {
     // See what type of literal we are dealing with, base 2, 8, 10, or 16.
     // Once we figure out that parse until the end of the iteral:
     const char32_t secondChar = mLexerState.currentChar;
-    size_t numberBase = 10;
+    uint8_t numberBase = 10;
     
     if (firstChar == '0') {
         if (secondChar == 'b' || secondChar == 'B') {
@@ -577,60 +531,73 @@ Lexer::ParseResult Lexer::parseNumericLiteral() {
     }
     
     // Fill in the basic info for the token
-    Token & token = allocToken(TokenType::kIntLit);
-    token.startSrcPtr = tokStartPtr;
-    token.startLine = tokStartLine;
-    token.startCol = tokStartCol;
-    token.endSrcPtr = mLexerState.srcPtr;
-    token.endLine = mLexerState.srcLine;
-    token.endCol = mLexerState.srcCol;
-    
-    // Set the integer base and data type
-    auto & tokIntData = token.data.intData;
-    tokIntData.base = numberBase;
-    tokIntData.dataTypeId = dataTypeId;
+    Token & token = allocToken(TokenType::kIntLit, tokStartPtr);
+    token.endSrcOffset = getSrcOffset(mLexerState.srcPtr);
     
-    // Makeup the string for the integer literal without underscores:
-    // TODO: What allocates this string?
-    char * intLitStrWithoutUS = new char[
-        static_cast<size_t>(intDigitsEndPtr - intDigitsStartPtr) + 1
-    ];
+    // Set the integer data type
+    token.intDataTypeId = dataTypeId;
     
-    tokIntData.strMinusUS = intLitStrWithoutUS;
-    size_t & tokLenMinusUS = tokIntData.strMinusUSLen;
-    tokLenMinusUS = 0;
+    // Parse the value of the integer literal, skipping underscores. The value is accumulated as an unsigned 128-bit
+    // integer made up of 32-bit words (least significant word first) so that overflow can be detected easily.
+    constexpr const size_t kNumValueWords32 = 4;
+    uint32_t valueWords32[kNumValueWords32] = {};
+    size_t numDigits = 0;
     
-    {
-        // Run through the string and make it up without underscores
-        const char * src = intDigitsStartPtr;
-        char * dst = intLitStrWithoutUS;
+    for (const char * digitPtr = intDigitsStartPtr; digitPtr < intDigitsEndPtr; ++digitPtr) {
+        char c = digitPtr[0];
         
-        while (src < intDigitsEndPtr) {
-            char c = src[0];
-            
-            if (c == 0) {
-                break;
-            }
-            
-            if (c != '_') {
-                *dst = c;
-                ++dst;
-                ++tokLenMinusUS;
-            }
+        if (c == '_') {
+            continue;
+        }
+        
+        // value = value * base + digit
+        uint64_t carry = CharUtils::getDigitValue(static_cast<char32_t>(c));
+        
+        for (size_t i = 0; i < kNumValueWords32; ++i) {
+            uint64_t wordResult = uint64_t(valueWords32[i]) * numberBase + carry;
+            valueWords32[i] = static_cast<uint32_t>(wordResult);
+            carry = wordResult >> 32;
+        }
+        
+        // If anything is carried out of the most significant word then the value is too big
+        if (carry != 0) {
+            error(tokStartPtr,
+                  "Integer literal is too large! Integer literals must be able to fit in an unsigned 128-bit integer.");
             
-            ++src;
+            return ParseResult::kFail;
         }
         
-        // Null termiante the string
-        *dst = 0;
+        ++numDigits;
     }
     
     // There must be at least one non underscore character in the integer literal:
-    if (tokLenMinusUS <= 0) {
+    if (numDigits <= 0) {
         error("An integer literal must have at least 1 digit character that is not an underscore!");
         return ParseResult::kFail;
     }
     
+    // Save the value and figure out how many bits are needed to hold it. Note: zero still requires 1 bit.
+    auto & tokIntData = token.data.intData;
+    tokIntData.valueWords[0] = uint64_t(valueWords32[0]) | (uint64_t(valueWords32[1]) << 32);
+    tokIntData.valueWords[1] = uint64_t(valueWords32[2]) | (uint64_t(valueWords32[3]) << 32);
+    token.intBitsRequired = 1;
+    
+    for (size_t i = kNumValueWords32; i > 0; --i) {
+        uint32_t word = valueWords32[i - 1];
+        
+        if (word != 0) {
+            uint8_t wordBitsRequired = 0;
+            
+            while (word != 0) {
+                ++wordBitsRequired;
+                word >>= 1;
+            }
+            
+            token.intBitsRequired = static_cast<uint8_t>((i - 1) * 32 + wordBitsRequired);
+            break;
+        }
+    }
+    
     // All went well
     return ParseResult::kSuccess;
 }
@@ -639,68 +606,128 @@ Lexer::ParseResult Lexer::parseDoubleQuotedStringLiteral() {
     // Must start with a double quote
     WC_GUARD(mLexerState.currentChar == '"', ParseResult::kNone);
     
-    // Alright skip the opening '"'
+    // Find the extents of the string and allocate the token for this literal
     const char * tokStartPtr = mLexerState.srcPtr;
-    size_t tokStartLine = mLexerState.srcLine;
-    size_t tokStartCol = mLexerState.srcCol;
+    const char * strStartPtr = nullptr;
+    const char * strEndPtr = nullptr;
+    bool strHasEscapes = false;
+    WC_GUARD(scanDoubleQuotedStringLiteral(strStartPtr, strEndPtr, strHasEscapes), ParseResult::kFail);
     
-    if (!moveOntoNextChar()) {
-        return ParseResult::kFail;
+    Token & tok = allocToken(TokenType::kStrLit, tokStartPtr);
+    tok.endSrcOffset = getSrcOffset(mLexerState.srcPtr);
+    
+    // Now decode the actual string data into the literal.
+    // Note: the string is owned by the linear allocator of the lexer.
+    auto & tokStrVal = tok.data.strVal;
+    tokStrVal.ptr = allocTokenPayload(static_cast<size_t>(strEndPtr - strStartPtr) + 1);
+    WC_GUARD(decodeStringLiteralChars(strStartPtr, strEndPtr, strHasEscapes, tokStrVal.ptr, tokStrVal.size),
+             ParseResult::kFail);
+    
+    tokStrVal.ptr[tokStrVal.size] = 0;
+    
+    // If we find multiple string literals in succession then join them together (similar to C/C++).
+    // The following strings are decoded one after the other into a scratch buffer, which is then copied over
+    // to the linear allocator in one go. This keeps the cost linear in the total length of the strings.
+    skipAnyWhitespaceCharsAhead();
+    WC_GUARD(mLexerState.currentChar == '"', ParseResult::kSuccess);
+    mStrLitJoinBuffer.assign(tokStrVal.ptr, tokStrVal.ptr + tokStrVal.size);
+    
+    while (mLexerState.currentChar == '"') {
+        // Any newlines in between the strings being joined do not precede the token following the strings
+        mLexerState.nextTokenFlags = 0;
+        
+        // Find the extents of the next string and decode it onto the end of the joined string
+        WC_GUARD(scanDoubleQuotedStringLiteral(strStartPtr, strEndPtr, strHasEscapes), ParseResult::kFail);
+        
+        size_t joinedStrSize = mStrLitJoinBuffer.size();
+        size_t nextStrSize = 0;
+        mStrLitJoinBuffer.resize(joinedStrSize + static_cast<size_t>(strEndPtr - strStartPtr));
+        
+        WC_GUARD(decodeStringLiteralChars(strStartPtr,
+                                          strEndPtr,
+                                          strHasEscapes,
+                                          mStrLitJoinBuffer.data() + joinedStrSize,
+                                          nextStrSize),
+                 ParseResult::kFail);
+        
+        mStrLitJoinBuffer.resize(joinedStrSize + nextStrSize);
+        skipAnyWhitespaceCharsAhead();
     }
     
-    // Save the start of the actual string data
-    const char * strStartPtr = mLexerState.srcPtr;
+    // Now save the joined string on the token for the first string.
+    // The memory for the first string is released along with the linear allocator of the lexer.
+    tokStrVal.size = mStrLitJoinBuffer.size();
+    tokStrVal.ptr = allocTokenPayload(tokStrVal.size + 1);
+    std::memcpy(tokStrVal.ptr, mStrLitJoinBuffer.data(), tokStrVal.size);
+    tokStrVal.ptr[tokStrVal.size] = 0;
+    
+    // Succeeded in parsing this string!
+    return ParseResult::kSuccess;
+}
+
+bool Lexer::scanDoubleQuotedStringLiteral(const char *& strStartPtr, const char *& strEndPtr, bool & strHasEscapes) {
+    // Skip the opening '"' and save the start of the actual string data
+    WC_ASSERT(mLexerState.currentChar == '"');
+    WC_GUARD(moveOntoNextChar(), false);
+    strStartPtr = mLexerState.srcPtr;
+    strHasEscapes = false;
     
-    // Search for the end of the string until we reach '"':
-    while (mLexerState.currentChar != '"') {
+    // Search for the end of the string until we reach '"'.
+    // Runs of plain ascii chars are skipped in bulk, so only escape sequences, non ascii chars and errors
+    // need to be looked at one by one.
+    while (true) {
+        size_t numPlainChars = SourceScan::countStringLiteralChars(mLexerState.srcPtr);
+        
+        if (numPlainChars > 0) {
+            WC_GUARD(moveOntoNextAsciiChars(numPlainChars), false);
+        }
+        
+        if (mLexerState.currentChar == '"') {
+            break;
+        }
+        
         // Bail with an error if we hit null
         if (mLexerState.currentChar == 0) {
             error("Unexpected EOF while parsing double quoted string! Is the closing '\"' present?");
-            return ParseResult::kFail;
+            return false;
         }
         
         // If we hit a newline then that is an error also
         if (CharUtils::isLineSeparator(mLexerState.currentChar)) {
             error("Unexpected newline while parsing double quoted string! Newline characters must be escaped!");
-            return ParseResult::kFail;
+            return false;
         }
         
-        // Consume the char and move onto the next
-        if (!moveOntoNextChar()) {
-            return ParseResult::kFail;
+        // Note if we see an escape sequence, otherwise the string data can just be copied when decoding
+        if (mLexerState.currentChar == '\\') {
+            strHasEscapes = true;
         }
+        
+        // Consume the char and move onto the next
+        WC_GUARD(moveOntoNextChar(), false);
     }
     
-    // Now we have the end of the string data
-    const char * strEndPtr = mLexerState.srcPtr;
-    
-    // Skip the end '"'
-    if (!moveOntoNextChar()) {
-        return ParseResult::kFail;
+    // Now we have the end of the string data, skip the end '"'
+    strEndPtr = mLexerState.srcPtr;
+    return moveOntoNextChar();
+}
+
+bool Lexer::decodeStringLiteralChars(const char * strStartPtr,
+                                     const char * strEndPtr,
+                                     bool strHasEscapes,
+                                     char * outputPtr,
+                                     size_t & outputSize)
+{
+    // If there are no escape sequences then the string data is the same as in the source
+    if (!strHasEscapes) {
+        outputSize = static_cast<size_t>(strEndPtr - strStartPtr);
+        std::memcpy(outputPtr, strStartPtr, outputSize);
+        return true;
     }
     
-    const char * tokEndPtr = mLexerState.srcPtr;
-    size_t tokEndLine = mLexerState.srcLine;
-    size_t tokEndCol = mLexerState.srcCol;
-    
-    // Compute the size of the buffer we need to hold the string in:
-    size_t strBufferSize = static_cast<size_t>(strEndPtr - strStartPtr + 1);
-    
-    // Allocate the token for this literal
-    Token & tok = allocToken(TokenType::kStrLit);
-    tok.startSrcPtr = tokStartPtr;
-    tok.startLine = tokStartLine;
-    tok.startCol = tokStartCol;
-    tok.endSrcPtr = tokEndPtr;
-    tok.endLine = tokEndLine;
-    tok.endCol = tokEndCol;
+    // Otherwise decode the escape sequences one by one
+    char * decodedStrPtr = outputPtr;
     
-    // Now decode the actual string data into the literal.
-    // FIXME: what manages this memory?
-    tok.data.strVal.ptr = new char[strBufferSize];
-    char * decodedStrPtr = tok.data.strVal.ptr;
-    
-    // Now decode the string into the buffer
     for (const char * strCurPtr = strStartPtr; strCurPtr != strEndPtr; ++strCurPtr) {
         // See if escaped char:
         char c1 = strCurPtr[0];
@@ -708,11 +735,10 @@ Lexer::ParseResult Lexer::parseDoubleQuotedStringLiteral() {
         if (c1 == '\\') {
             // Possible escaped char: must not be at the end of the string though
             if (strCurPtr + 1 >= strEndPtr) {
-                error(tokStartLine,
-                      tokStartCol + 1 + static_cast<size_t>(strCurPtr - strStartPtr),
+                error(strCurPtr,
                       "Unexpected end string while parsing '\\' escape sequence!");
                 
-                return ParseResult::kFail;
+                return false;
             }
             
             // Read ahead and see what char we have
@@ -743,18 +769,17 @@ Lexer::ParseResult Lexer::parseDoubleQuotedStringLiteral() {
                 char32_t escapedCharUtf32 = 0;
                 size_t escapedCharNumUtf8Bytes = 0;
 
-                if (!StringUtils::parseUtf8Char(strCurPtr, escapedCharUtf32, escapedCharNumUtf8Bytes)) {
+                if (!StringUtils::parseUtf8Char(strCurPtr + 1, escapedCharUtf32, escapedCharNumUtf8Bytes)) {
                     WC_RAISE_ASSERTION("Should't ever reach this case! Must be valid utf8 if we reached this point.");
-                    return ParseResult::kFail;
+                    return false;
                 }
                 
-                std::string escapedCharUtf8(strCurPtr, escapedCharNumUtf8Bytes);
-                error(tokStartLine,
-                      tokStartCol + 1 + static_cast<size_t>(strCurPtr - strStartPtr),
+                std::string escapedCharUtf8(strCurPtr + 1, escapedCharNumUtf8Bytes);
+                error(strCurPtr,
                       "Unrecognized escape sequence '\\%s'!",
                       escapedCharUtf8.c_str());
                 
-                return ParseResult::kFail;
+                return false;
             }
             
             // Save the escaped char. Note: Need to skip two characters for this
@@ -768,75 +793,10 @@ Lexer::ParseResult Lexer::parseDoubleQuotedStringLiteral() {
         
         // Move along in the decoded string buffer
         ++decodedStrPtr;
-        
-        // Increase the size of the parsed string
-        tok.data.strVal.size++;
     }
     
-    // Null terminate the decoded string when done
-    tok.data.strVal.ptr[tok.data.strVal.size] = 0;
-    
-    // Save the index of the current token we are on, will need down below
-    size_t thisStrLitTokenNum = mTokenCount;
-
-    // Try to parse another string: if we find multiple string literals in succession
-    // then join them together (similar to C/C++)
-    skipAnyWhitespaceCharsAhead();
-    ParseResult nextStringParseResult = parseDoubleQuotedStringLiteral();
-
-    if (nextStringParseResult != ParseResult::kNone) {
-        // Another string literal follows, see if that was parsed ok:
-        if (nextStringParseResult == ParseResult::kSuccess) {
-            // Get the length of the next string literal:
-            Token & nextTok = mTokenList[mTokenCount - 1];
-            auto & nextTokStrVal = nextTok.data.strVal;
-            size_t nextStrLen = nextTokStrVal.size;
-
-            // If the next string is zero length then just pop the token for it and return this string:
-            if (nextStrLen == 0) {
-                // Zero length string ahead, just pop it off (and any newlines in between) to consume it
-                while (mTokenCount > thisStrLitTokenNum) {
-                    popToken();
-                }
-            }
-            else {
-                // Alright, we want to concatenate the strings from the two sources:
-                auto & curTokStrVal = tok.data.strVal;
-                size_t curStrLen = tok.data.strVal.size;
-                size_t concatStrSize = curStrLen + nextStrLen + 1;
-
-                // FIXME: what manages this memory?
-                // Concatenate the two strings:
-                char * concatStrPtr = new char[concatStrSize];
-                
-                {
-                    char * curConcatStrPtr = concatStrPtr;
-                    std::memcpy(curConcatStrPtr, curTokStrVal.ptr, curStrLen);
-                    curConcatStrPtr += curStrLen;
-                    std::memcpy(curConcatStrPtr, nextTokStrVal.ptr, nextStrLen);
-                    curConcatStrPtr += nextStrLen;
-                    *curConcatStrPtr = 0;
-                }
-
-                // FIXME: how to free the old memory?
-                // Now save the newly concatenated string details on the CURRENT string
-                curTokStrVal.ptr = concatStrPtr;
-                curTokStrVal.size = concatStrSize;
-
-                // Done with the next token, pop it off the stack (and any newlines in between)
-                while (mTokenCount > thisStrLitTokenNum) {
-                    popToken();
-                }
-            }
-        }
-        else {
-            // Failed to parse the following string literal. Therefore parsing of this string fails too:
-            return ParseResult::kFail;
-        }
-    }
-
-    // Succeeded in parsing this string!
-    return ParseResult::kSuccess;
+    outputSize = static_cast<size_t>(decodedStrPtr - outputPtr);
+    return true;
 }
 
 Lexer::ParseResult Lexer::parseKeywordsAndLiterals() {
@@ -845,138 +805,49 @@ Lexer::ParseResult Lexer::parseKeywordsAndLiterals() {
     
     // Keep parsing until we reach the end of the literal/keyword
     const char * tokStartPtr = mLexerState.srcPtr;
-    size_t tokStartLine = mLexerState.srcLine;
-    size_t tokStartCol = mLexerState.srcCol;
     
     if (!moveOntoNextChar()) {
         return ParseResult::kFail;
     }
     
     while (CharUtils::isValidIdentifierMiddleChar(mLexerState.currentChar)) {
-        if (!moveOntoNextChar()) {
+        // Runs of ascii identifier chars are by far the most common case, skip over those in one go
+        const char * asciiCharsEndPtr = mLexerState.srcPtr;
+        
+        while (CharUtils::getAsciiCharClass(static_cast<uint8_t>(*asciiCharsEndPtr)) & CharClass::kIdentifierMiddle) {
+            ++asciiCharsEndPtr;
+        }
+        
+        if (asciiCharsEndPtr != mLexerState.srcPtr) {
+            WC_GUARD(moveOntoNextAsciiChars(static_cast<size_t>(asciiCharsEndPtr - mLexerState.srcPtr)),
+                     ParseResult::kFail);
+        }
+        else if (!moveOntoNextChar()) {
             return ParseResult::kFail;
         }
     }
     
     const char * tokEndPtr = mLexerState.srcPtr;
-    size_t tokEndLine = mLexerState.srcLine;
-    size_t tokEndCol = mLexerState.srcCol;
     size_t tokLenInCodeUnits = static_cast<size_t>(tokEndPtr - tokStartPtr);
     
-    // Check for these keywords
-    // TODO: this is slow, use some sort of binary search method BST
-    auto parseKeyword = [&](const char * keywordStr, TokenType keywordTokenType) -> bool {
-        // Compute length of keyword
-        size_t keywordLenInCodeUnits = std::strlen(keywordStr);
-        
-        // If the lengths do not match then it cannot be this keyword
-        if (keywordLenInCodeUnits != tokLenInCodeUnits) {
-            return false;
-        }
-        
-        // Go through the keyword string and make sure each char matches with the given string
-        const char * tokCurPtr = tokStartPtr;
-        const char * keywordCurPtr = keywordStr;
-        
-        while (true) {
-            // Get the current char in both strings
-            char keywordChar = keywordCurPtr[0];
-            char tokChar = tokCurPtr[0];
-            
-            // See if we reached the end of the keyword:
-            if (keywordChar == 0) {
-                break;
-            }
-            
-            // See if we find a mismatch:
-            if (keywordChar != tokChar) {
-                return false;
-            }
-            
-            // Move onto the next chars
-            ++tokCurPtr;
-            ++keywordCurPtr;
-        }
-        
-        // Reached keyword end and both strings match: create a keyword token
-        Token & tok = allocToken(keywordTokenType);
-        tok.startSrcPtr = tokStartPtr;
-        tok.startLine = tokStartLine;
-        tok.startCol = tokStartCol;
-        tok.endSrcPtr = tokEndPtr;
-        tok.endLine = tokEndLine;
-        tok.endCol = tokEndCol;
-        return true;
-    };
-    
-    if (parseKeyword("true", TokenType::kTrue) ||
-        parseKeyword("false", TokenType::kFalse) ||
-        parseKeyword("null", TokenType::kNull) ||
-        parseKeyword("void", TokenType::kVoid) ||
-        parseKeyword("any", TokenType::kAny) ||
-        parseKeyword("nullptr", TokenType::kNullptr) ||
-        parseKeyword("int", TokenType::kInt) ||
-        parseKeyword("int8", TokenType::kInt8) ||
-        parseKeyword("int16", TokenType::kInt16) ||
-        parseKeyword("int32", TokenType::kInt32) ||
-        parseKeyword("int64", TokenType::kInt64) ||
-        parseKeyword("int128", TokenType::kInt128) ||
-        parseKeyword("uint", TokenType::kUInt) ||
-        parseKeyword("uint8", TokenType::kUInt8) ||
-        parseKeyword("uint16", TokenType::kUInt16) ||
-        parseKeyword("uint32", TokenType::kUInt32) ||
-        parseKeyword("uint64", TokenType::kUInt64) ||
-        parseKeyword("uint128", TokenType::kUInt128) ||
-        parseKeyword("bool", TokenType::kBool) ||
-        parseKeyword("string", TokenType::kString) ||
-        parseKeyword("let", TokenType::kLet) ||
-        parseKeyword("is", TokenType::kIs) ||
-        parseKeyword("and", TokenType::kAnd) ||
-        parseKeyword("or", TokenType::kOr) ||
-        parseKeyword("not", TokenType::kNot) ||
-        parseKeyword("if", TokenType::kIf) ||
-        parseKeyword("unless", TokenType::kUnless) ||
-        parseKeyword("then", TokenType::kThen) ||
-        parseKeyword("else", TokenType::kElse) ||
-        parseKeyword("end", TokenType::kEnd) ||
-        parseKeyword("while", TokenType::kWhile) ||
-        parseKeyword("until", TokenType::kUntil) ||
-        parseKeyword("do", TokenType::kDo) ||
-        parseKeyword("break", TokenType::kBreak) ||
-        parseKeyword("next", TokenType::kNext) ||
-        parseKeyword("loop", TokenType::kLoop) ||
-        parseKeyword("repeat", TokenType::kRepeat) ||
-        parseKeyword("scope", TokenType::kScope) ||
-        parseKeyword("noop", TokenType::kNoOp) ||
-        parseKeyword("return", TokenType::kReturn) ||
-        parseKeyword("func", TokenType::kFunc) ||
-        parseKeyword("cast", TokenType::kCast) ||
-        parseKeyword("to", TokenType::kTo) ||
-        parseKeyword("time", TokenType::kTime) ||
-        parseKeyword("rand", TokenType::kRand) ||
-        parseKeyword("srand", TokenType::kSRand) ||
-        parseKeyword("print", TokenType::kPrint) ||
-        parseKeyword("readnum", TokenType::kReadnum) ||
-        parseKeyword("assert", TokenType::kAssert))
-    {
+    // See if the word is a keyword, if so then create a keyword token:
+    TokenType keywordTokenType = Keywords::getTokenType(tokStartPtr, tokLenInCodeUnits);
+    
+    if (keywordTokenType != TokenType::kIdentifier) {
+        Token & tok = allocToken(keywordTokenType, tokStartPtr);
+        tok.endSrcOffset = getSrcOffset(tokEndPtr);
         return ParseResult::kSuccess;
     }
     
-    // TODO: Figure out memory management here
     // If we've got to here we are dealing with an identifier.
-    // Allocate enough memory to store the identifier and save:
-    Token & tok = allocToken(TokenType::kIdentifier);
-    tok.startSrcPtr = tokStartPtr;
-    tok.startLine = tokStartLine;
-    tok.startCol = tokStartCol;
-    tok.endSrcPtr = tokEndPtr;
-    tok.endLine = tokEndLine;
-    tok.endCol = tokEndCol;
-    
-    tok.data.strVal.ptr = new char[tokLenInCodeUnits + 1];
-    std::memcpy(tok.data.strVal.ptr, tokStartPtr, tokLenInCodeUnits * sizeof(char));
-    tok.data.strVal.ptr[tokLenInCodeUnits] = 0;
-    tok.data.strVal.size = tokLenInCodeUnits;
+    // Intern the name so that each distinct identifier name is only stored once:
+    Token & tok = allocToken(TokenType::kIdentifier, tokStartPtr);
+    tok.endSrcOffset = getSrcOffset(tokEndPtr);
+    
+    SymbolId symbolId = mSymbolTable.intern(tokStartPtr, tokLenInCodeUnits);
+    tok.data.identData.name = mSymbolTable.getSymbolName(symbolId);
+    tok.data.identData.nameLen = static_cast<uint32_t>(tokLenInCodeUnits);
+    tok.data.identData.symbolId = symbolId;
     
     // All good!
     return ParseResult::kSuccess;
@@ -986,11 +857,23 @@ Lexer::ParseResult Lexer::parseSingleLineComments() {
     // Check start character is the start of a single or multi line comment: ';'
     WC_GUARD(mLexerState.currentChar == ';', ParseResult::kNone);
     
-    // Keep skipping chars until a newline is encountered
-    while (moveOntoNextChar() && mLexerState.currentChar != 0) {
-        if (CharUtils::isLineSeparator(mLexerState.currentChar)) {
+    // Keep skipping chars until a newline is encountered.
+    // Runs of plain ascii chars are skipped in bulk, anything else is skipped one char at a time.
+    moveOntoNextChar();
+    
+    while (!mLexerState.error && mLexerState.currentChar != 0) {
+        if (mLexerState.currentCharIsNewline) {
             break;  // Newline reached: end of comment
         }
+        
+        size_t numAsciiChars = SourceScan::countSingleLineCommentChars(mLexerState.srcPtr);
+        
+        if (numAsciiChars > 0) {
+            moveOntoNextAsciiChars(numAsciiChars);
+        }
+        else {
+            moveOntoNextChar();
+        }
     }
     
     // Single line comments always succeed!
@@ -1006,8 +889,9 @@ Lexer::ParseResult Lexer::parseMultiLineComments() {
     
     // Skip the first two chars
     moveOntoNextChar();
+    moveOntoNextChar();
     
-    while (moveOntoNextChar() && mLexerState.currentChar != 0) {
+    while (!mLexerState.error && mLexerState.currentChar != 0) {
         // Look for the end two chars:
         if (mLexerState.currentChar == ';' && mLexerState.srcPtr[1] == '/') {
             // End of the multi line comment block, consume the closing '/'
@@ -1017,6 +901,16 @@ Lexer::ParseResult Lexer::parseMultiLineComments() {
             // Parsed successfully!
             return ParseResult::kSuccess;
         }
+        
+        // Skip runs of plain ascii chars in bulk, anything else (newlines etc.) one char at a time
+        size_t numAsciiChars = SourceScan::countMultiLineCommentChars(mLexerState.srcPtr);
+        
+        if (numAsciiChars > 0) {
+            moveOntoNextAsciiChars(numAsciiChars);
+        }
+        else {
+            moveOntoNextChar();
+        }
     }
     
     // If we reached the end of file before the comment is terminated then that is an error
@@ -1025,22 +919,119 @@ Lexer::ParseResult Lexer::parseMultiLineComments() {
 }
 
 void Lexer::increaseTokenListCapacity(size_t newCapacity) {
-    WC_GUARD(newCapacity >= mTokenCapacity);
+    WC_GUARD(newCapacity > mTokenCapacity);
     mTokenCapacity = newCapacity;
     mTokenList = reinterpret_cast<Token*>(std::realloc(mTokenList, mTokenCapacity * sizeof(Token)));
+    mTokenTypeList = reinterpret_cast<TokenType*>(std::realloc(mTokenTypeList, mTokenCapacity * sizeof(TokenType)));
+}
+
+void Lexer::growTokenList() {
+    // Grow capacity according to the Golden ratio (approx 1.6) and add 1 to ensure we alloc at least one token.
+    size_t newCapacity = ((mTokenCapacity * 16) / 10) + 1;
+    
+    // Note: in streaming mode the parser may be holding pointers into the token list so it can't be
+    // reallocated in place. No tokens can be dropped here either, since the lexer may be referring to
+    // tokens by index (e.g. when joining string literals).
+    if (mIsStreaming) {
+        switchTokenBuffer(0, newCapacity);
+    }
+    else {
+        increaseTokenListCapacity(newCapacity);
+    }
+}
+
+void Lexer::switchTokenBuffer(size_t numTokensToDrop, size_t minCapacity) {
+    WC_ASSERT(mIsStreaming);
+    WC_ASSERT(numTokensToDrop <= mNumCommittedTokens);
+    
+    // Get the new buffer and copy over the tokens that are being kept
+    TokenBuffer newBuffer = acquireTokenBuffer(std::max(minCapacity, mTokenCapacity));
+    size_t numTokensToKeep = mTokenCount - numTokensToDrop;
+    std::memcpy(newBuffer.tokenList, mTokenList + numTokensToDrop, numTokensToKeep * sizeof(Token));
+    std::memcpy(newBuffer.tokenTypeList, mTokenTypeList + numTokensToDrop, numTokensToKeep * sizeof(TokenType));
+    
+    // Retire the old buffer and switch over to the new one
+    mRetiredTokenBuffers.push_back(TokenBuffer{ mTokenList, mTokenTypeList, mTokenCapacity });
+    mTokenList = newBuffer.tokenList;
+    mTokenTypeList = newBuffer.tokenTypeList;
+    mTokenCapacity = newBuffer.capacity;
+    mTokenCount = numTokensToKeep;
+    mNumCommittedTokens -= numTokensToDrop;
+    
+#if DEBUG == 1
+    // Debug only: the old token pointers are no longer valid, point to the new buffer instead
+    mDebugTokenList.clear();
+    
+    for (size_t i = 0; i < mTokenCount; ++i) {
+        mDebugTokenList.push_back(mTokenList + i);
+    }
+#endif  // #if DEBUG == 1
 }
 
-Token & Lexer::allocToken(TokenType tokenType)
+void Lexer::freeTokenList() {
+    if (mTokenList) {
+        std::free(mTokenList);
+        mTokenList = nullptr;
+    }
+    
+    if (mTokenTypeList) {
+        std::free(mTokenTypeList);
+        mTokenTypeList = nullptr;
+    }
+    
+    mTokenCapacity = 0;
+    mTokenCount = 0;
+}
+
+Lexer::TokenBuffer Lexer::acquireTokenBuffer(size_t minCapacity) {
+    // Try to reuse a free buffer first
+    for (auto iter = mFreeTokenBuffers.begin(); iter != mFreeTokenBuffers.end(); ++iter) {
+        if (iter->capacity >= minCapacity) {
+            TokenBuffer tokenBuffer = *iter;
+            mFreeTokenBuffers.erase(iter);
+            return tokenBuffer;
+        }
+    }
+    
+    // Otherwise allocate a new one
+    TokenBuffer tokenBuffer;
+    tokenBuffer.tokenList = reinterpret_cast<Token*>(std::malloc(minCapacity * sizeof(Token)));
+    tokenBuffer.tokenTypeList = reinterpret_cast<TokenType*>(std::malloc(minCapacity * sizeof(TokenType)));
+    tokenBuffer.capacity = minCapacity;
+    return tokenBuffer;
+}
+
+void Lexer::freeTokenBuffer(TokenBuffer & tokenBuffer) {
+    std::free(tokenBuffer.tokenList);
+    std::free(tokenBuffer.tokenTypeList);
+    tokenBuffer.tokenList = nullptr;
+    tokenBuffer.tokenTypeList = nullptr;
+    tokenBuffer.capacity = 0;
+}
+
+Token & Lexer::allocToken(TokenType tokenType, const char * tokStartPtr)
 {
-    // If not enough room, grow capacity according to the Golden ratio (approx 1.6) and add 1 to ensure we alloc at least one token.
+    // If not enough room then grow the token list
     if (mTokenCount + 1 > mTokenCapacity) {
-        increaseTokenListCapacity(((mTokenCapacity * 16) / 10) + 1);
+        growTokenList();
     }
     
     // Initialize the token
+    uint32_t tokStartSrcOffset = getSrcOffset(tokStartPtr);
     Token * token = mTokenList + mTokenCount;
     std::memset(token, 0, sizeof(Token));
     token->type = tokenType;
+    token->flags = mLexerState.nextTokenFlags;
+    token->startSrcOffset = tokStartSrcOffset;
+    mTokenTypeList[mTokenCount] = tokenType;
+    
+    // Let the previous token know where the token following it starts
+    if (mTokenCount > 0) {
+        mTokenList[mTokenCount - 1].nextTokenSrcOffset = tokStartSrcOffset;
+    }
+    
+    // Any pending flags (e.g a preceding newline) are consumed by this token
+    mLexerState.nextTokenFlags = 0;
     
 #if DEBUG == 1
     // Debug only: put the token into this list for ease of inspection
@@ -1060,26 +1051,35 @@ void Lexer::popToken() {
     mDebugTokenList.pop_back();
 #endif  // #if DEBUG == 1
     
-    // TODO: cleanup token data here?
+    // Note: no cleanup of token data is required here, any data for the token is owned by the linear allocator.
     --mTokenCount;
 }
 
+uint32_t Lexer::getSrcOffset(const char * srcPtr) const {
+    WC_ASSERT(srcPtr >= mLexerState.srcStartPtr);
+    return static_cast<uint32_t>(srcPtr - mLexerState.srcStartPtr);
+}
+
+char * Lexer::allocTokenPayload(size_t numBytes) {
+    return reinterpret_cast<char*>(mLinearAlloc.alloc(numBytes));
+}
+
 void Lexer::createEOFToken() {
-    Token & tok = allocToken(TokenType::kEOF);
-    tok.startLine = mLexerState.srcLine;
-    tok.endLine = mLexerState.srcLine;
-    tok.startCol = mLexerState.srcCol;
-    tok.endCol = mLexerState.srcCol;
-    tok.startSrcPtr = mLexerState.srcPtr;
-    tok.endSrcPtr = mLexerState.srcPtr;
+    Token & tok = allocToken(TokenType::kEOF, mLexerState.srcPtr);
+    tok.endSrcOffset = tok.startSrcOffset;
+    tok.nextTokenSrcOffset = tok.startSrcOffset;
+    mLexerState.finished = true;
 }
 
-void Lexer::error(size_t srcLine, size_t srcCol, const char * msg, ...) {
+void Lexer::error(const char * atSrcPtr, const char * msg, ...) {
+    WC_GUARD(mEmitErrors);
+    
     // Generic error info
+    SourceLoc srcLoc = mSrcLineIndex.getLoc(getSrcOffset(atSrcPtr));
     std::fprintf(stderr,
                  "Error! Failed to parse the given source into tokens at: line %zu, column %zu\n",
-                 srcLine + 1,
-                 srcCol + 1);
+                 size_t(srcLoc.line) + 1,
+                 size_t(srcLoc.col) + 1);
     
     // Specific error message
     std::va_list args;
@@ -1090,11 +1090,14 @@ void Lexer::error(size_t srcLine, size_t srcCol, const char * msg, ...) {
 }
 
 void Lexer::error(const char * msg, ...) {
+    WC_GUARD(mEmitErrors);
+    
     // Generic error info
+    SourceLoc srcLoc = mSrcLineIndex.getLoc(getSrcOffset(mLexerState.srcPtr));
     std::fprintf(stderr,
                  "Error! Failed to parse the given source into tokens at: line %zu, column %zu\n",
-                 mLexerState.srcLine + 1,
-                 mLexerState.srcCol + 1);
+                 size_t(srcLoc.line) + 1,
+                 size_t(srcLoc.col) + 1);
     
     // Specific error message
     std::va_list args;
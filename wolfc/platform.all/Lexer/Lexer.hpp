@@ -6,25 +6,49 @@
 
 #pragma once
 
+#include "LinearAlloc.hpp"
+#include "SourceLineIndex.hpp"
+#include "SymbolTable.hpp"
 #include "TokenType.hpp"
 
 WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <memory>
     #include <vector>
 WC_THIRD_PARTY_INCLUDES_END
 
 WC_BEGIN_NAMESPACE
 
+class SourceBuffer;
 struct Token;
 
 /**
  * Splits input source text into Wolf tokens.
  * See WCToken for more info on valid tokens in the language.
+ *
+ * The lexer can work in one of two modes:
+ *
+ *  (1) All at once, via 'process'. The entire source is lexed up front into one big token list.
+ *  (2) All at once but in parallel, via 'processParallel'. The source is split into chunks which are lexed on
+ *      separate threads, and the tokens for each chunk are then stitched together into one big token list.
+ *  (3) Streaming, via 'beginStreaming'. Tokens are lexed on demand in fixed size windows as the parser
+ *      pulls them (see 'pullTokens'). Once the parser has committed past a group of tokens (see 'commitTokens')
+ *      the memory for those tokens is recycled, so the memory used for tokens stays bounded no matter how
+ *      large the source is.
  */
 class Lexer {
 public:
     /* The default token capacity for the lexer */
     static constexpr const size_t kDefaultInitialTokenCapacity = 1024 * 32;
     
+    /* The number of tokens lexed at a time in streaming mode */
+    static constexpr const size_t kStreamWindowSize = 1024 * 4;
+    
+    /* The maximum number of unused token buffers kept around for recycling in streaming mode */
+    static constexpr const size_t kMaxFreeTokenBuffers = 2;
+    
+    /* The smallest chunk of source code that is worth lexing on a separate thread when lexing in parallel */
+    static constexpr const size_t kMinParallelChunkSize = 1024 * 256;
+    
     /**
      * Creates the lexer. The given number of tokens is allocated
      * for the initial token capacity.
@@ -39,19 +63,130 @@ public:
      */
     bool process(const char * utf8Src);
     
-    /* Give the token list for the lexer */
+    /**
+     * Same as the other process function, but takes the source text from the given buffer.
+     * No copy of the source is made, the tokens produced point directly into the buffer.
+     */
+    bool process(const SourceBuffer & utf8Src);
+    
+    /**
+     * Same as 'process', but the source is split into chunks which are lexed in parallel using up to the given
+     * number of threads. The result is exactly the same as what 'process' produces.
+     *
+     * Sources which are too small to be worth splitting are just lexed serially. If lexing any chunk fails then
+     * the whole source is also lexed again serially, so that errors are reported exactly as they normally are.
+     */
+    bool processParallel(const SourceBuffer & utf8Src, size_t numThreads);
+    
+    /**
+     * Begin lexing the given source string (encoded in UTF8 format) in streaming mode.
+     * No tokens are produced until they are requested with 'pullTokens'.
+     * Returns false and saves an error message if the lexer could not be started.
+     */
+    bool beginStreaming(const char * utf8Src);
+    
+    /* Same as the other 'beginStreaming' function, but takes the source text from the given buffer */
+    bool beginStreaming(const SourceBuffer & utf8Src);
+    
+    /**
+     * Lex just part of the given source, between the given start and end pointers. The range must start in
+     * between tokens, and the first token lexed is given the specified flags (see 'TokenFlags'). Token offsets are
+     * still relative to the start of the whole source. Used to lex part of a source again after it is edited.
+     *
+     * If the end pointer is null then lexing goes on until the end of the source and the EOF token is added.
+     * Otherwise lexing stops at the end of the range and no EOF token is added, unless a token or comment runs
+     * past the end of the range. In that case lexing goes on until the end of the source, see 'isFinished'.
+     *
+     * If a line index is given then the line starts before the range are copied from it, so that the line index
+     * for the lexer (and the line numbers in error messages) are right for the whole source.
+     */
+    bool processRange(const char * utf8Src,
+                      const char * rangeStartPtr,
+                      const char * rangeEndPtr,
+                      uint8_t firstTokenFlags,
+                      const SourceLineIndex * prevSrcLineIndex);
+    
+    /**
+     * Streaming mode only: lex the next window of tokens and add them to the end of the token list.
+     * If lexing fails then an error is emitted and the token list is ended with an EOF token.
+     *
+     * Note: this may move the token list to a different buffer, so any pointers into the token list must be
+     * re-fetched after calling. When this happens, committed tokens are dropped from the start of the token list.
+     * The number of tokens that were dropped is returned so that the caller can adjust its position in the list.
+     * The old buffer remains valid until the next call to 'commitTokens' however.
+     */
+    size_t pullTokens();
+    
+    /**
+     * Streaming mode only: mark the first 'numTokens' tokens in the token list as no longer needed.
+     * Their memory can then be reused the next time the token list is moved to a new buffer.
+     *
+     * This also recycles any buffers that the token list previously moved out of. Therefore the caller must not
+     * be holding onto pointers to any tokens other than those in the current token list.
+     */
+    void commitTokens(size_t numTokens);
+    
+    /* Give the token list for the lexer. In streaming mode this is just the current window of tokens. */
     const Token * getTokenList() const;
     
+    /**
+     * Give the list of token types for the lexer. This mirrors the token list, with one entry per token.
+     * Storing the types separately allows code that just scans over token types to touch much less memory.
+     */
+    const TokenType * getTokenTypeList() const;
+    
+    /* Give the number of tokens currently in the token list */
+    inline size_t getTokenCount() const {
+        return mTokenCount;
+    }
+    
+    /* Tells if the lexer has finished, i.e. the EOF token has been added to the token list */
+    inline bool isFinished() const {
+        return mLexerState.finished;
+    }
+    
+    /* Tells if the lexer encountered an error */
+    inline bool hasErrors() const {
+        return mLexerState.error;
+    }
+    
+    /**
+     * Get the flags that the next token lexed will be given (see 'TokenFlags'). Once 'processRange' stops at the end
+     * of the range, these are the flags for the token which follows the range.
+     */
+    inline uint8_t getNextTokenFlags() const {
+        return mLexerState.nextTokenFlags;
+    }
+    
+    /* Give the index of line start offsets for the source code processed by the lexer */
+    inline const SourceLineIndex & getSrcLineIndex() const {
+        return mSrcLineIndex;
+    }
+    
+    /* Give the symbol table holding all of the identifier names interned by the lexer */
+    inline const SymbolTable & getSymbolTable() const {
+        return mSymbolTable;
+    }
+    
 private:
-    /* Struct holding lexer state, current source pointer and line/col info */
+    /* Struct holding lexer state: the current source pointer and char, and pending flags for the next token */
     struct LexerState {
         bool error;
+        bool finished;
+        const char * srcStartPtr;
         const char * srcPtr;
-        size_t srcLine;
-        size_t srcCol;
+        const char * srcEndPtr;     /* Where to stop if the null terminator is not reached first, may be null */
         char32_t currentChar;
         size_t currentCharNumBytes;
         bool currentCharIsNewline;
+        uint8_t nextTokenFlags;
+    };
+    
+    /* A buffer holding a list of tokens along with their types */
+    struct TokenBuffer {
+        Token * tokenList;
+        TokenType * tokenTypeList;
+        size_t capacity;
     };
     
     /* Result of parsing */
@@ -64,6 +199,24 @@ private:
     /* Initialize the lexer state. */
     bool initLexerState(const char * utf8Src);
     
+    /**
+     * Parallel lexing: lex the chunk of the given source between the given start and end pointers. The chunk must
+     * start at the beginning of a line. See 'processRange'.
+     */
+    bool processChunk(const char * utf8Src, const char * chunkStartPtr, const char * chunkEndPtr);
+    
+    /* Parallel lexing: join together the tokens and line starts from the lexers for each chunk of the source */
+    void stitchChunks(const char * utf8Src);
+    
+    /* Check that the given source is small enough to be lexed. Emits an error and returns false if not. */
+    bool checkSrcSize(const SourceBuffer & utf8Src);
+    
+    /**
+     * Lex tokens until there is no source left, or until the token list contains the given number of tokens.
+     * If the end of the source is reached then the EOF token is added. Returns false if lexing fails.
+     */
+    bool lexTokens(size_t maxTokenCount);
+    
     /* Try to consume some whitespace. Return false if no whitespace was consumed. */
     bool trySkipWhitespaceChar();
 
@@ -73,7 +226,16 @@ private:
     /* Move onto the next character. */
     bool moveOntoNextChar();
     
-    /* Try to parse some basic tokens. */
+    /**
+     * Move forward by the given number of chars in one go. The current char and the chars following it which
+     * are skipped over must all be single byte ascii chars that are not newlines.
+     */
+    bool moveOntoNextAsciiChars(size_t numChars);
+    
+    /* Decode the character at the current source pointer and make it the current character. */
+    bool decodeCurrentChar();
+    
+    /* Try to parse operator and punctuation tokens. See 'Operators' for the full list. */
     ParseResult parseBasicTokens();
     
     /**
@@ -85,9 +247,25 @@ private:
     /* Try to parse a numeric literal. */
     ParseResult parseNumericLiteral();
     
-    /* Try to parse a double quoted string literal. */
+    /* Try to parse a double quoted string literal. Any string literals immediately following are joined onto it. */
     ParseResult parseDoubleQuotedStringLiteral();
     
+    /**
+     * Move past the double quoted string literal at the current position, saving where the string data (between
+     * the quotes) starts and ends and whether it contains any escape sequences. Returns false on error.
+     */
+    bool scanDoubleQuotedStringLiteral(const char *& strStartPtr, const char *& strEndPtr, bool & strHasEscapes);
+    
+    /**
+     * Decode the escape sequences in the given string literal data and save the result to the given output buffer.
+     * The buffer must be as big as the undecoded string. Saves the decoded size and returns false on error.
+     */
+    bool decodeStringLiteralChars(const char * strStartPtr,
+                                  const char * strEndPtr,
+                                  bool strHasEscapes,
+                                  char * outputPtr,
+                                  size_t & outputSize);
+    
     /* Try to parse keywords and literals. */
     ParseResult parseKeywordsAndLiterals();
     
@@ -100,24 +278,52 @@ private:
     /* Increase the token list capacity to the given capacity. If smaller than old capacity, nothing happens. */
     void increaseTokenListCapacity(size_t newCapacity);
     
+    /* Grow the token list when it is full. In streaming mode the token list is moved to a bigger buffer. */
+    void growTokenList();
+    
+    /**
+     * Streaming mode only: move the token list to another buffer with at least the given capacity, dropping
+     * the given number of tokens from the start of the list. The old buffer is retired rather than freed, since
+     * the parser may still be holding pointers into it. It is recycled on the next call to 'commitTokens'.
+     */
+    void switchTokenBuffer(size_t numTokensToDrop, size_t minCapacity);
+    
+    /* Get a token buffer with at least the given capacity, reusing a free buffer if there is a suitable one */
+    TokenBuffer acquireTokenBuffer(size_t minCapacity);
+    
+    /* Free the memory for the token list */
+    void freeTokenList();
+    
+    /* Free the memory for the given token buffer */
+    static void freeTokenBuffer(TokenBuffer & tokenBuffer);
+    
     /**
-     * Allocate a token from the token list. 
-     * All fields in the token are default initialized apart from token type.
+     * Allocate a token from the token list, starting at the given position in the source.
+     * All fields in the token are default initialized apart from token type, flags and start offset.
      * It is up to the callee to perform any other initialization that is required.
      */
-    Token & allocToken(TokenType tokenType);
+    Token & allocToken(TokenType tokenType, const char * tokStartPtr);
 
     /* Pop the top token off the token list. Expects that there is at least one token allocated. */
     void popToken();
     
+    /* Get the offset of the given source pointer from the start of the source code */
+    uint32_t getSrcOffset(const char * srcPtr) const;
+    
+    /**
+     * Allocate memory for additional token data, such as the decoded text of a string literal.
+     * The memory is owned by the linear allocator of the lexer and is released in bulk when the lexer is destroyed.
+     */
+    char * allocTokenPayload(size_t numBytes);
+    
     /* Create the EOF token and add it to the end of the token list */
     void createEOFToken();
 
     /**
      * Emit a lexer error to stderror followed by a newline.
-     * The given line and column information are emitted also.
+     * The line and column information for the given location in the source are emitted also.
      */
-    void error(size_t srcLine, size_t srcCol, const char * msg, ...);
+    void error(const char * atSrcPtr, const char * msg, ...);
     
     /**
      * Emit a lexer error to stderror follwed by a newline.
@@ -128,15 +334,54 @@ private:
     /* The list of parsed tokens */
     Token * mTokenList;
     
+    /* The type of each parsed token, stored separately from the token list */
+    TokenType * mTokenTypeList;
+    
     /* The number of tokens currently allocated */
     size_t mTokenCapacity;
     
     /* The number of tokens actually in the token list */
     size_t mTokenCount;
     
+    /* True if the lexer is working in streaming mode */
+    bool mIsStreaming;
+    
+    /* Streaming mode: the number of tokens at the start of the token list which the parser no longer needs */
+    size_t mNumCommittedTokens;
+    
+    /* Streaming mode: buffers the token list has moved out of, which may still be referenced by the parser */
+    std::vector<TokenBuffer> mRetiredTokenBuffers;
+    
+    /* Streaming mode: unused token buffers which are kept around for recycling */
+    std::vector<TokenBuffer> mFreeTokenBuffers;
+    
     /* The current state of the lexer */
     LexerState mLexerState;
     
+    /**
+     * Linear allocator owned by the lexer, used for all token data (string literals, identifier names etc.).
+     * All of this memory is released in bulk when the lexer is destroyed.
+     */
+    LinearAlloc mLinearAlloc;
+    
+    /* Records where each line of the source code starts */
+    SourceLineIndex mSrcLineIndex;
+    
+    /* Interns identifier names, so that each distinct name is only stored once */
+    SymbolTable mSymbolTable;
+    
+    /* Scratch buffer used to join together string literals that follow each other */
+    std::vector<char> mStrLitJoinBuffer;
+    
+    /* If false then no error messages are emitted. Used by the lexers for each chunk when lexing in parallel. */
+    bool mEmitErrors;
+    
+    /**
+     * Parallel lexing: the lexers used for each chunk of the source. These own the memory for the token data
+     * (string literals etc.) of the tokens from each chunk, so they are kept alive along with this lexer.
+     */
+    std::vector<std::unique_ptr<Lexer>> mChunkLexers;
+    
 #if DEBUG == 1
     /* A list for ease of debugging/inspection not used for release builds - list of parsed tokens */
     std::vector<Token*> mDebugTokenList;
@@ -0,0 +1,309 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#include "Lexer.hpp"
+
+#include "Assert.hpp"
+#include "SourceBuffer.hpp"
+#include "Token.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <algorithm>
+    #include <cstring>
+    #include <thread>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+
+/**
+ * Tells if a line separator (as defined by 'CharUtils::isLineSeparator') starts at the given pointer.
+ * Works on the raw utf8 bytes so the multi byte separators (NEL, LS and PS) are matched by their encodings.
+ */
+static bool isLineSeparatorAt(const char * ptr) {
+    const uint8_t * bytes = reinterpret_cast<const uint8_t*>(ptr);
+    
+    switch (bytes[0]) {
+        case 0x0A:      // Line Feed (LF)
+        case 0x0B:      // Vertical tab (VT)
+        case 0x0C:      // Form Feed (FF)
+        case 0x0D:      // Carriage Return (CR)
+            return true;
+        
+        case 0xC2:      // Next Line (NEL): C2 85
+            return bytes[1] == 0x85;
+        
+        case 0xE2:      // Line Separator (LS): E2 80 A8, Paragraph Separator (PS): E2 80 A9
+            return bytes[1] == 0x80 && (bytes[2] == 0xA8 || bytes[2] == 0xA9);
+        
+        default:
+            break;
+    }
+    
+    return false;
+}
+
+/**
+ * Tells if the source can be split just before the given pointer, which must be at the start of a line.
+ *
+ * The lexer joins string literals which follow each other, even across lines. If the next thing after the split
+ * is a string literal then the split could separate two strings that should be joined, so this is not allowed.
+ * To keep things simple any non ascii char ahead (which could be unicode whitespace) also prevents the split.
+ * Splitting is also pointless if there is nothing but whitespace left in the source.
+ */
+static bool isSafeSplitPoint(const char * ptr) {
+    while (true) {
+        switch (*ptr) {
+            case ' ':
+            case '\t':
+            case '\n':
+            case '\v':
+            case '\f':
+            case '\r':
+                ++ptr;
+                break;
+            
+            default:
+                return *ptr != 0 && *ptr != '"' && static_cast<uint8_t>(*ptr) < 0x80;
+        }
+    }
+}
+
+/**
+ * Find where to split the given source into roughly equally sized chunks for lexing in parallel.
+ * Returns the start of each chunk after the first, and may find fewer split points than asked for.
+ *
+ * Splits are only made at the start of a line where the lexer is in between tokens, i.e. not inside a string
+ * literal or a comment. To figure this out a quick scan over the source is done which tracks just enough state
+ * to know whether we are in a string or comment. This mirrors how the lexer finds the extents of these.
+ */
+static std::vector<const char*> findChunkSplitPoints(const char * src, size_t srcSize, size_t numChunks) {
+    // What we are currently scanning over
+    enum class ScanState {
+        kCode,
+        kString,
+        kSingleLineComment,
+        kMultiLineComment
+    };
+    
+    std::vector<const char*> splitPoints;
+    WC_GUARD(numChunks > 1, splitPoints);
+    
+    const size_t targetChunkSize = srcSize / numChunks;
+    const char * const srcEndPtr = src + srcSize;
+    const char * nextSplitTargetPtr = src + targetChunkSize;
+    const char * ptr = src;
+    ScanState state = ScanState::kCode;
+    
+    while (ptr < srcEndPtr) {
+        // Note: the lexer stops at the first null, so do the same here
+        char c = *ptr;
+        
+        if (c == 0) {
+            break;
+        }
+        
+        switch (state) {
+            case ScanState::kCode: {
+                if (c == '"') {
+                    state = ScanState::kString;
+                }
+                else if (c == ';') {
+                    state = ScanState::kSingleLineComment;
+                }
+                else if (c == '/' && ptr[1] == ';') {
+                    state = ScanState::kMultiLineComment;
+                    ++ptr;
+                }
+                else if (c == '\n' && ptr + 1 >= nextSplitTargetPtr && isSafeSplitPoint(ptr + 1)) {
+                    // Split here, stop if we have enough chunks
+                    splitPoints.push_back(ptr + 1);
+                    
+                    if (splitPoints.size() + 1 >= numChunks) {
+                        return splitPoints;
+                    }
+                    
+                    nextSplitTargetPtr = ptr + 1 + targetChunkSize;
+                }
+            }   break;
+            
+            case ScanState::kString: {
+                // Note: strings end at the first '"', escape sequences are only decoded after the end is found.
+                // Strings can't span lines either, the lexer reports an error in that case.
+                if (c == '"' || isLineSeparatorAt(ptr)) {
+                    state = ScanState::kCode;
+                }
+            }   break;
+            
+            case ScanState::kSingleLineComment: {
+                // The comment ends at the line separator, which is then handled as code (may be a split point)
+                if (isLineSeparatorAt(ptr)) {
+                    state = ScanState::kCode;
+                    continue;
+                }
+            }   break;
+            
+            case ScanState::kMultiLineComment: {
+                // Jump straight to the next ';' since only ';/' can end the comment
+                const char * semicolonPtr = reinterpret_cast<const char*>(
+                    std::memchr(ptr, ';', static_cast<size_t>(srcEndPtr - ptr))
+                );
+                
+                WC_GUARD(semicolonPtr, splitPoints);
+                ptr = semicolonPtr;
+                
+                if (ptr[1] == '/') {
+                    state = ScanState::kCode;
+                    ++ptr;
+                }
+            }   break;
+        }
+        
+        ++ptr;
+    }
+    
+    return splitPoints;
+}
+
+bool Lexer::processParallel(const SourceBuffer & utf8Src, size_t numThreads) {
+    WC_GUARD(checkSrcSize(utf8Src), false);
+    const char * src = utf8Src.getText();
+    
+    // Figure out how many chunks to split the source into. If it's not worth splitting then just lex serially.
+    size_t numChunks = std::min(numThreads, utf8Src.getSize() / kMinParallelChunkSize);
+    std::vector<const char*> splitPoints = findChunkSplitPoints(src, utf8Src.getSize(), numChunks);
+    
+    if (splitPoints.empty()) {
+        return process(src);
+    }
+    
+    // Make a lexer for each chunk. Each has its own token list and linear allocator so they don't interfere.
+    numChunks = splitPoints.size() + 1;
+    mChunkLexers.clear();
+    
+    for (size_t i = 0; i < numChunks; ++i) {
+        mChunkLexers.emplace_back(new Lexer());
+        mChunkLexers.back()->mEmitErrors = false;
+    }
+    
+    // Lex the first chunk on this thread and the rest on worker threads.
+    // Note: the last chunk has no end pointer, so it goes on until the end of the source.
+    std::unique_ptr<uint8_t[]> chunkSucceeded(new uint8_t[numChunks]);
+    std::vector<std::thread> workerThreads;
+    
+    for (size_t i = 1; i < numChunks; ++i) {
+        const char * chunkStartPtr = splitPoints[i - 1];
+        const char * chunkEndPtr = (i < splitPoints.size()) ? splitPoints[i] : nullptr;
+        
+        workerThreads.emplace_back([this, &chunkSucceeded, src, i, chunkStartPtr, chunkEndPtr](){
+            chunkSucceeded[i] = mChunkLexers[i]->processChunk(src, chunkStartPtr, chunkEndPtr);
+        });
+    }
+    
+    chunkSucceeded[0] = mChunkLexers[0]->processChunk(src, src, splitPoints[0]);
+    
+    for (std::thread & workerThread : workerThreads) {
+        workerThread.join();
+    }
+    
+    // If any of the chunks failed then lex everything again serially, which will emit the appropriate errors
+    for (size_t i = 0; i < numChunks; ++i) {
+        if (!chunkSucceeded[i]) {
+            mChunkLexers.clear();
+            return process(src);
+        }
+    }
+    
+    // Join the results from each chunk together
+    stitchChunks(src);
+    return true;
+}
+
+bool Lexer::processChunk(const char * utf8Src, const char * chunkStartPtr, const char * chunkEndPtr) {
+    // Since the chunk starts at the beginning of a line, the first token in the chunk must be preceded by a newline
+    // (unless it is the first chunk of course). Note: errors are not emitted for chunks, so the line starts before
+    // the chunk are not needed.
+    uint8_t firstTokenFlags = (chunkStartPtr != utf8Src) ? TokenFlags::kPrecededByNewline : 0;
+    return processRange(utf8Src, chunkStartPtr, chunkEndPtr, firstTokenFlags, nullptr);
+}
+
+void Lexer::stitchChunks(const char * utf8Src) {
+    // Reset our own state for the whole source
+    mIsStreaming = false;
+    initLexerState(utf8Src);
+    
+    // Make room for all the tokens in one go
+    size_t totalNumTokens = 0;
+    
+    for (const std::unique_ptr<Lexer> & chunkLexer : mChunkLexers) {
+        totalNumTokens += chunkLexer->mTokenCount;
+    }
+    
+    increaseTokenListCapacity(totalNumTokens);
+    
+    // Append the tokens from each chunk in order
+    std::vector<SymbolId> symbolIdMapping;
+    
+    for (const std::unique_ptr<Lexer> & chunkLexer : mChunkLexers) {
+        // The symbol ids handed out by the chunk lexer are only valid for that lexer. Intern all of its names in
+        // our own symbol table to figure out what each id maps to. Note: since the symbols in each chunk are
+        // interned in the order they first appear, the ids come out the same as they would for a serial lex.
+        const SymbolTable & chunkSymbolTable = chunkLexer->mSymbolTable;
+        symbolIdMapping.resize(chunkSymbolTable.getNumSymbols());
+        
+        for (size_t i = 0; i < symbolIdMapping.size(); ++i) {
+            SymbolId chunkSymbolId = static_cast<SymbolId>(i);
+            symbolIdMapping[i] = mSymbolTable.intern(chunkSymbolTable.getSymbolName(chunkSymbolId),
+                                                     chunkSymbolTable.getSymbolNameLen(chunkSymbolId));
+        }
+        
+        // Copy over the tokens
+        size_t numChunkTokens = chunkLexer->mTokenCount;
+        
+        if (numChunkTokens > 0) {
+            // The last token before this chunk needs to know where the first token in this chunk starts
+            if (mTokenCount > 0) {
+                mTokenList[mTokenCount - 1].nextTokenSrcOffset = chunkLexer->mTokenList[0].startSrcOffset;
+            }
+            
+            Token * chunkTokens = mTokenList + mTokenCount;
+            TokenType * chunkTokenTypes = mTokenTypeList + mTokenCount;
+            std::memcpy(chunkTokens, chunkLexer->mTokenList, numChunkTokens * sizeof(Token));
+            std::memcpy(chunkTokenTypes, chunkLexer->mTokenTypeList, numChunkTokens * sizeof(TokenType));
+            
+            // Fix up the symbol ids and names for identifiers
+            for (size_t i = 0; i < numChunkTokens; ++i) {
+                if (chunkTokenTypes[i] == TokenType::kIdentifier) {
+                    auto & identData = chunkTokens[i].data.identData;
+                    identData.symbolId = symbolIdMapping[identData.symbolId];
+                    identData.name = mSymbolTable.getSymbolName(identData.symbolId);
+                }
+            }
+            
+            mTokenCount += numChunkTokens;
+        }
+        
+        // Add in the line starts for this chunk
+        mSrcLineIndex.appendLineStarts(chunkLexer->mSrcLineIndex);
+        
+        // Don't need the token list for the chunk anymore. Note: the chunk lexer itself is kept alive however,
+        // since it owns the data for the tokens.
+        chunkLexer->freeTokenList();
+    }
+    
+    // The last chunk always ends with the EOF token
+    WC_ASSERT(mTokenCount > 0);
+    WC_ASSERT(mTokenTypeList[mTokenCount - 1] == TokenType::kEOF);
+    mLexerState.finished = true;
+    
+#if DEBUG == 1
+    // Debug only: put the tokens into this list for ease of inspection
+    for (size_t i = 0; i < mTokenCount; ++i) {
+        mDebugTokenList.push_back(mTokenList + i);
+    }
+#endif  // #if DEBUG == 1
+}
+
+WC_END_NAMESPACE
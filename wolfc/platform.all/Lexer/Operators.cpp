@@ -0,0 +1,169 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#include "Operators.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstdint>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+
+/* An operator or punctuation token and the token type it maps to */
+struct OperatorDef {
+    const char * str;
+    TokenType type;
+};
+
+/* The list of all operators and punctuation. To add a new operator simply add it to this list. */
+static constexpr const OperatorDef kOperatorDefs[] = {
+    { "(", TokenType::kLParen },
+    { ")", TokenType::kRParen },
+    { "[", TokenType::kLBrack },
+    { "]", TokenType::kRBrack },
+    { "+", TokenType::kPlus },
+    { "-", TokenType::kMinus },
+    { "++", TokenType::kIncrement },
+    { "--", TokenType::kDecrement },
+    { "%", TokenType::kPercent },
+    { "*", TokenType::kAsterisk },
+    { "/", TokenType::kSlash },
+    { "=", TokenType::kAssign },
+    { "<<=", TokenType::kAssignLShift },
+    { ">>=", TokenType::kAssignARShift },
+    { ">>>=", TokenType::kAssignLRShift },
+    { "|=", TokenType::kAssignBOr },
+    { "^=", TokenType::kAssignBXor },
+    { "&=", TokenType::kAssignBAnd },
+    { "+=", TokenType::kAssignAdd },
+    { "-=", TokenType::kAssignSub },
+    { "*=", TokenType::kAssignMul },
+    { "/=", TokenType::kAssignDiv },
+    { "%=", TokenType::kAssignRem },
+    { "==", TokenType::kCmpEQ },
+    { "!=", TokenType::kCmpNE },
+    { "<", TokenType::kCmpLT },
+    { "<=", TokenType::kCmpLE },
+    { ">", TokenType::kCmpGT },
+    { ">=", TokenType::kCmpGE },
+    { "<<", TokenType::kLShift },
+    { ">>", TokenType::kARShift },
+    { ">>>", TokenType::kLRShift },
+    { "!", TokenType::kExclamation },
+    { ",", TokenType::kComma },
+    { "->", TokenType::kOpArrow },
+    { ":", TokenType::kColon },
+    { "?", TokenType::kQMark },
+    { "~", TokenType::kTilde },
+    { "&", TokenType::kAmpersand },
+    { "$", TokenType::kDollar },
+    { "^", TokenType::kHat },
+    { "|", TokenType::kVBar },
+};
+
+/**
+ * Size limits for the state machine. The state machine is a trie of all the operators, so it needs one state
+ * for each distinct operator prefix (plus the start state). Each distinct char used in an operator needs
+ * a column in the transition table, plus column 0 which is used for all other chars.
+ * If these are exceeded then the static asserts below will fire and the limits must be raised.
+ */
+static constexpr const size_t kMaxStates = 64;
+static constexpr const size_t kMaxColumns = 32;
+
+/**
+ * The operator state machine, built at compile time.
+ * State 0 is the start state. Since no transition ever leads back to the start state, a transition
+ * to state 0 is used to mean that there is no transition (i.e. matching ends).
+ */
+struct OperatorDFA {
+    constexpr OperatorDFA() :
+        charColumns{},
+        transitions{},
+        acceptTypes{},
+        isAcceptState{},
+        numStates(1),
+        numColumns(1),
+        hasDuplicates(false),
+        isTooBig(false)
+    {
+        for (const OperatorDef & operatorDef : kOperatorDefs) {
+            // Walk the chars of the operator, adding columns and states as needed
+            uint8_t state = 0;
+            
+            for (const char * charPtr = operatorDef.str; *charPtr != 0; ++charPtr) {
+                uint8_t & column = charColumns[static_cast<uint8_t>(*charPtr)];
+                
+                if (column == 0) {
+                    if (numColumns >= kMaxColumns) {
+                        isTooBig = true;
+                        return;
+                    }
+                    
+                    column = static_cast<uint8_t>(numColumns++);
+                }
+                
+                uint8_t & nextState = transitions[state][column];
+                
+                if (nextState == 0) {
+                    if (numStates >= kMaxStates) {
+                        isTooBig = true;
+                        return;
+                    }
+                    
+                    nextState = static_cast<uint8_t>(numStates++);
+                }
+                
+                state = nextState;
+            }
+            
+            // The state at the end of the operator chars accepts the operator
+            if (isAcceptState[state]) {
+                hasDuplicates = true;
+            }
+            
+            isAcceptState[state] = true;
+            acceptTypes[state] = operatorDef.type;
+        }
+    }
+    
+    uint8_t charColumns[256];
+    uint8_t transitions[kMaxStates][kMaxColumns];
+    TokenType acceptTypes[kMaxStates];
+    bool isAcceptState[kMaxStates];
+    size_t numStates;
+    size_t numColumns;
+    bool hasDuplicates;
+    bool isTooBig;
+};
+
+static constexpr const OperatorDFA kOperatorDFA{};
+
+static_assert(!kOperatorDFA.isTooBig, "Operator state machine is too big! Raise 'kMaxStates' or 'kMaxColumns'.");
+static_assert(!kOperatorDFA.hasDuplicates, "The same operator is defined more than once!");
+static_assert(kOperatorDFA.charColumns[0] == 0, "The null terminator must never be part of an operator!");
+
+size_t Operators::match(const char * src, TokenType & tokenType) {
+    // Follow transitions until there are no more, remembering the longest operator matched along the way
+    size_t matchLen = 0;
+    uint8_t state = 0;
+    
+    for (size_t i = 0; ; ++i) {
+        state = kOperatorDFA.transitions[state][kOperatorDFA.charColumns[static_cast<uint8_t>(src[i])]];
+        
+        if (state == 0) {
+            break;
+        }
+        
+        if (kOperatorDFA.isAcceptState[state]) {
+            matchLen = i + 1;
+            tokenType = kOperatorDFA.acceptTypes[state];
+        }
+    }
+    
+    return matchLen;
+}
+
+WC_END_NAMESPACE
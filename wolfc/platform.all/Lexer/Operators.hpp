@@ -0,0 +1,31 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#pragma once
+
+#include "TokenType.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstddef>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+
+/**
+ * Matching of operator and punctuation tokens for the lexer.
+ *
+ * All operators are stored in a state machine (DFA) which is generated at compile time from a list of the
+ * operators. Matching an operator is then just a loop of table lookups, one per char of the operator.
+ */
+namespace Operators {
+    /**
+     * Match the longest operator or punctuation token at the start of the given null terminated source.
+     * Returns the number of chars in the operator and saves its type to 'tokenType' if found, otherwise 0.
+     */
+    size_t match(const char * src, TokenType & tokenType);
+}
+
+WC_END_NAMESPACE
@@ -0,0 +1,116 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#include "SourceLineIndex.hpp"
+
+#include "CharUtils.hpp"
+#include "StringUtils.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <algorithm>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+
+/* Default number of lines to reserve room for in the index */
+static constexpr const size_t kDefaultReserveNumLines = 1024;
+
+SourceLineIndex::SourceLineIndex() :
+    mSrcText("")
+{
+    mLineStartOffsets.reserve(kDefaultReserveNumLines);
+    mLineStartOffsets.push_back(0);
+}
+
+void SourceLineIndex::reset(const char * srcText) {
+    WC_ASSERT(srcText);
+    mSrcText = srcText;
+    mLineStartOffsets.clear();
+    mLineStartOffsets.push_back(0);
+}
+
+void SourceLineIndex::reset(const char * srcText, const SourceLineIndex & other, uint32_t endSrcOffset) {
+    WC_ASSERT(srcText);
+    WC_ASSERT(&other != this);
+    mSrcText = srcText;
+    auto endIter = std::upper_bound(other.mLineStartOffsets.begin(), other.mLineStartOffsets.end(), endSrcOffset);
+    mLineStartOffsets.assign(other.mLineStartOffsets.begin(), endIter);
+}
+
+void SourceLineIndex::appendLineStarts(const SourceLineIndex & other) {
+    WC_ASSERT(other.mSrcText == mSrcText);
+    WC_GUARD(other.mLineStartOffsets.size() > 1);
+    WC_ASSERT(other.mLineStartOffsets[1] > mLineStartOffsets.back());
+    mLineStartOffsets.insert(mLineStartOffsets.end(), other.mLineStartOffsets.begin() + 1, other.mLineStartOffsets.end());
+}
+
+void SourceLineIndex::appendMovedLineStarts(const SourceLineIndex & other,
+                                            uint32_t afterSrcOffset,
+                                            int64_t srcOffsetDelta)
+{
+    WC_ASSERT(&other != this);
+    auto startIter = std::upper_bound(other.mLineStartOffsets.begin(), other.mLineStartOffsets.end(), afterSrcOffset);
+    
+    for (auto iter = startIter; iter != other.mLineStartOffsets.end(); ++iter) {
+        addLineStart(static_cast<uint32_t>(*iter + srcOffsetDelta));
+    }
+}
+
+void SourceLineIndex::scanLineStarts(uint32_t startSrcOffset, uint32_t endSrcOffset) {
+    const char * srcPtr = mSrcText + startSrcOffset;
+    const char * srcEndPtr = mSrcText + endSrcOffset;
+    
+    while (srcPtr < srcEndPtr) {
+        // Note: skip over any malformed utf8 a byte at a time, the lexer fails on it
+        char32_t c;
+        size_t charNumBytes;
+        
+        if (!StringUtils::parseUtf8Char(srcPtr, c, charNumBytes)) {
+            ++srcPtr;
+            continue;
+        }
+        
+        srcPtr += charNumBytes;
+        
+        if (CharUtils::isLineSeparator(c)) {
+            // A CR LF pair counts as a single line separator, same as in the lexer
+            if (c == '\r' && *srcPtr == '\n') {
+                ++srcPtr;
+            }
+            
+            addLineStart(static_cast<uint32_t>(srcPtr - mSrcText));
+        }
+    }
+}
+
+uint32_t SourceLineIndex::getLine(uint32_t srcOffset) const {
+    // Find the first line which starts after the offset, the line we want is the one before that.
+    // Note: the first line always starts at offset 0 so there is always a line before.
+    auto nextLineIter = std::upper_bound(mLineStartOffsets.begin(), mLineStartOffsets.end(), srcOffset);
+    WC_ASSERT(nextLineIter != mLineStartOffsets.begin());
+    return static_cast<uint32_t>((nextLineIter - mLineStartOffsets.begin()) - 1);
+}
+
+SourceLoc SourceLineIndex::getLoc(uint32_t srcOffset) const {
+    SourceLoc loc;
+    loc.line = getLine(srcOffset);
+    loc.col = 0;
+    
+    // The column is the number of utf8 characters between the start of the line and the offset.
+    // Count every byte that is not a utf8 continuation byte (bit pattern 10??????).
+    const char * lineStartPtr = mSrcText + mLineStartOffsets[loc.line];
+    const char * endPtr = mSrcText + srcOffset;
+    
+    for (const char * curPtr = lineStartPtr; curPtr < endPtr; ++curPtr) {
+        if ((static_cast<uint8_t>(*curPtr) & 0xC0) != 0x80) {
+            ++loc.col;
+        }
+    }
+    
+    return loc;
+}
+
+WC_END_NAMESPACE
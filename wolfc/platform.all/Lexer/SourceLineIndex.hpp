@@ -0,0 +1,103 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#pragma once
+
+#include "Assert.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstddef>
+    #include <cstdint>
+    #include <vector>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+
+/* A line and column location in the source code, with 0 being the first line and first column. */
+struct SourceLoc {
+    uint32_t line;
+    uint32_t col;
+};
+
+/**
+ * Index of where each line in the source code starts, built by the lexer as it goes.
+ *
+ * Tokens only record byte offsets into the source code. Line and column numbers are only needed for
+ * diagnostics and debug labels, so rather than tracking them for every character they are worked out
+ * on demand: the line by binary searching the line start offsets and the column by counting the
+ * utf8 characters between the start of the line and the offset.
+ */
+class SourceLineIndex {
+public:
+    SourceLineIndex();
+    
+    /* Reset the index for the given source code. Initially there is a single line starting at offset 0. */
+    void reset(const char * srcText);
+    
+    /**
+     * Reset the index for the given source code, copying over the line starts from another index which are at or
+     * before the given offset. The other index can be for an older version of the source code, so long as the
+     * source code up until the offset is the same.
+     */
+    void reset(const char * srcText, const SourceLineIndex & other, uint32_t endSrcOffset);
+    
+    /* Record that a new line starts at the given offset. Lines must be added in order. */
+    inline void addLineStart(uint32_t srcOffset) {
+        WC_ASSERT(srcOffset > mLineStartOffsets.back());
+        mLineStartOffsets.push_back(srcOffset);
+    }
+    
+    /**
+     * Append the line starts recorded in another index, which must be for a later part of the same source code.
+     * The initial line at offset 0 in the other index is skipped. Used to join the line indexes built when
+     * lexing chunks of the source code in parallel.
+     */
+    void appendLineStarts(const SourceLineIndex & other);
+    
+    /**
+     * Append the line starts from another index which are after the given offset, moved along by the given amount.
+     * Used when part of the source code is edited: the lines after the edit are the same but have moved, so they
+     * can be carried over from the index for the source code before the edit.
+     */
+    void appendMovedLineStarts(const SourceLineIndex & other, uint32_t afterSrcOffset, int64_t srcOffsetDelta);
+    
+    /**
+     * Scan the given range of the source code for line separators and record the lines which start in it.
+     * The lines are found the same way the lexer finds them, for where the source code could not be lexed.
+     */
+    void scanLineStarts(uint32_t startSrcOffset, uint32_t endSrcOffset);
+    
+    /* Get the source code that this index is for */
+    inline const char * getSrcText() const {
+        return mSrcText;
+    }
+    
+    /* Get the number of lines recorded in the index */
+    inline size_t getNumLines() const {
+        return mLineStartOffsets.size();
+    }
+    
+    /* Get the offset in the source code that the given line starts at */
+    inline uint32_t getLineStart(size_t line) const {
+        WC_ASSERT(line < mLineStartOffsets.size());
+        return mLineStartOffsets[line];
+    }
+    
+    /* Get the line that the given source offset lies on */
+    uint32_t getLine(uint32_t srcOffset) const;
+    
+    /* Get the line and column for the given source offset */
+    SourceLoc getLoc(uint32_t srcOffset) const;
+    
+private:
+    /* The source code that this index is for */
+    const char * mSrcText;
+    
+    /* The offset from the start of the source code to the start of each line, in ascending order */
+    std::vector<uint32_t> mLineStartOffsets;
+};
+
+WC_END_NAMESPACE
@@ -0,0 +1,220 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#include "SourceScan.hpp"
+
+// Figure out which instruction set to scan with
+#if defined(__AVX2__)
+    #define WC_SOURCE_SCAN_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define WC_SOURCE_SCAN_SSE2 1
+#endif
+
+/**
+ * The vector scan reads whole aligned vectors, so it can read past the null terminator of the string (though never
+ * into another page). Address sanitizer rightly reports these reads, so turn it off for the vector loads and the scan
+ * in sanitizer builds.
+ * Note: the scan stops at the null terminator regardless of what follows it, so the extra bytes read never matter.
+ */
+#if defined(__SANITIZE_ADDRESS__)
+    #if defined(_MSC_VER)
+        #define WC_SOURCE_SCAN_NO_SANITIZE_ADDRESS __declspec(no_sanitize_address)
+    #else
+        #define WC_SOURCE_SCAN_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+    #endif
+#elif defined(__has_feature)
+    #if __has_feature(address_sanitizer)
+        #define WC_SOURCE_SCAN_NO_SANITIZE_ADDRESS __attribute__((no_sanitize("address")))
+    #endif
+#endif
+
+#ifndef WC_SOURCE_SCAN_NO_SANITIZE_ADDRESS
+    #define WC_SOURCE_SCAN_NO_SANITIZE_ADDRESS
+#endif
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstdint>
+    
+    #if defined(WC_SOURCE_SCAN_AVX2)
+        #include <immintrin.h>
+    #elif defined(WC_SOURCE_SCAN_SSE2)
+        #include <emmintrin.h>
+    #endif
+    
+    #ifdef _MSC_VER
+        #include <intrin.h>
+    #endif
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+
+#if defined(WC_SOURCE_SCAN_AVX2) || defined(WC_SOURCE_SCAN_SSE2)
+
+#if defined(WC_SOURCE_SCAN_AVX2)
+    /* AVX2: examine 32 bytes at a time */
+    typedef __m256i Vector;
+    static constexpr const size_t kVectorSize = 32;
+    
+    WC_SOURCE_SCAN_NO_SANITIZE_ADDRESS static inline Vector vecLoadAligned(const uint8_t * ptr) {
+        return _mm256_load_si256(reinterpret_cast<const Vector*>(ptr));
+    }
+    
+    static inline Vector vecSplat(uint8_t value) { return _mm256_set1_epi8(static_cast<char>(value)); }
+    static inline Vector vecCmpEq(Vector a, Vector b) { return _mm256_cmpeq_epi8(a, b); }
+    static inline Vector vecOr(Vector a, Vector b) { return _mm256_or_si256(a, b); }
+    static inline Vector vecSub(Vector a, Vector b) { return _mm256_sub_epi8(a, b); }
+    static inline Vector vecMinU8(Vector a, Vector b) { return _mm256_min_epu8(a, b); }
+    static inline uint32_t vecMoveMask(Vector a) { return static_cast<uint32_t>(_mm256_movemask_epi8(a)); }
+    static constexpr const uint32_t kAllLanesMask = 0xFFFFFFFFu;
+#else
+    /* SSE2: examine 16 bytes at a time */
+    typedef __m128i Vector;
+    static constexpr const size_t kVectorSize = 16;
+    
+    WC_SOURCE_SCAN_NO_SANITIZE_ADDRESS static inline Vector vecLoadAligned(const uint8_t * ptr) {
+        return _mm_load_si128(reinterpret_cast<const Vector*>(ptr));
+    }
+    
+    static inline Vector vecSplat(uint8_t value) { return _mm_set1_epi8(static_cast<char>(value)); }
+    static inline Vector vecCmpEq(Vector a, Vector b) { return _mm_cmpeq_epi8(a, b); }
+    static inline Vector vecOr(Vector a, Vector b) { return _mm_or_si128(a, b); }
+    static inline Vector vecSub(Vector a, Vector b) { return _mm_sub_epi8(a, b); }
+    static inline Vector vecMinU8(Vector a, Vector b) { return _mm_min_epu8(a, b); }
+    static inline uint32_t vecMoveMask(Vector a) { return static_cast<uint32_t>(_mm_movemask_epi8(a)); }
+    static constexpr const uint32_t kAllLanesMask = 0xFFFFu;
+#endif
+
+/* Get the index of the lowest set bit in the given mask, which must be non zero */
+static inline size_t lowestSetBitIndex(uint32_t mask) {
+    #ifdef _MSC_VER
+        unsigned long index = 0;
+        _BitScanForward(&index, mask);
+        return index;
+    #else
+        return static_cast<size_t>(__builtin_ctz(mask));
+    #endif
+}
+
+/* Tell which lanes of the vector hold an ascii line separator: bytes 0x0A-0x0D */
+static inline Vector vecIsAsciiLineSeparator(Vector bytes) {
+    Vector offsetBytes = vecSub(bytes, vecSplat(0x0A));
+    return vecCmpEq(vecMinU8(offsetBytes, vecSplat(0x03)), offsetBytes);
+}
+
+#endif  // #if defined(WC_SOURCE_SCAN_AVX2) || defined(WC_SOURCE_SCAN_SSE2)
+
+/* Matches the bytes at which 'countBlankChars' stops */
+struct BlankCharStopMatcher {
+    static inline bool isStopByte(uint8_t byte) {
+        return byte != ' ' && byte != '\t';
+    }
+    
+#if defined(WC_SOURCE_SCAN_AVX2) || defined(WC_SOURCE_SCAN_SSE2)
+    static inline uint32_t getStopMask(Vector bytes) {
+        Vector isBlank = vecOr(vecCmpEq(bytes, vecSplat(' ')), vecCmpEq(bytes, vecSplat('\t')));
+        return ~vecMoveMask(isBlank) & kAllLanesMask;
+    }
+#endif
+};
+
+/* Matches the bytes at which 'countSingleLineCommentChars' stops */
+struct SingleLineCommentStopMatcher {
+    static inline bool isStopByte(uint8_t byte) {
+        return byte == 0 || (byte >= 0x0A && byte <= 0x0D) || byte >= 0x80;
+    }
+    
+#if defined(WC_SOURCE_SCAN_AVX2) || defined(WC_SOURCE_SCAN_SSE2)
+    static inline uint32_t getStopMask(Vector bytes) {
+        // Note: the move mask picks up the top bit of each byte, so non-ascii bytes are matched for free
+        Vector isNullOrNewline = vecOr(vecCmpEq(bytes, vecSplat(0)), vecIsAsciiLineSeparator(bytes));
+        return vecMoveMask(vecOr(isNullOrNewline, bytes));
+    }
+#endif
+};
+
+/* Matches the bytes at which 'countMultiLineCommentChars' stops */
+struct MultiLineCommentStopMatcher {
+    static inline bool isStopByte(uint8_t byte) {
+        return byte == ';' || SingleLineCommentStopMatcher::isStopByte(byte);
+    }
+    
+#if defined(WC_SOURCE_SCAN_AVX2) || defined(WC_SOURCE_SCAN_SSE2)
+    static inline uint32_t getStopMask(Vector bytes) {
+        return vecMoveMask(vecCmpEq(bytes, vecSplat(';'))) | SingleLineCommentStopMatcher::getStopMask(bytes);
+    }
+#endif
+};
+
+/* Matches the bytes at which 'countStringLiteralChars' stops */
+struct StringLiteralStopMatcher {
+    static inline bool isStopByte(uint8_t byte) {
+        return byte == '"' || byte == '\\' || SingleLineCommentStopMatcher::isStopByte(byte);
+    }
+    
+#if defined(WC_SOURCE_SCAN_AVX2) || defined(WC_SOURCE_SCAN_SSE2)
+    static inline uint32_t getStopMask(Vector bytes) {
+        Vector isQuoteOrBackslash = vecOr(vecCmpEq(bytes, vecSplat('"')), vecCmpEq(bytes, vecSplat('\\')));
+        return vecMoveMask(isQuoteOrBackslash) | SingleLineCommentStopMatcher::getStopMask(bytes);
+    }
+#endif
+};
+
+/**
+ * Count the number of bytes at the start of the string before the first byte matched by the given matcher.
+ * The matcher must always match the null terminator so that the scan ends.
+ */
+template <typename StopMatcher>
+WC_SOURCE_SCAN_NO_SANITIZE_ADDRESS static size_t countBytesBeforeStop(const char * str) {
+    const uint8_t * startPtr = reinterpret_cast<const uint8_t*>(str);
+    const uint8_t * curPtr = startPtr;
+    
+#if defined(WC_SOURCE_SCAN_AVX2) || defined(WC_SOURCE_SCAN_SSE2)
+    // Check bytes one at a time until aligned to the vector size
+    while (reinterpret_cast<uintptr_t>(curPtr) % kVectorSize != 0) {
+        if (StopMatcher::isStopByte(*curPtr)) {
+            return static_cast<size_t>(curPtr - startPtr);
+        }
+        
+        ++curPtr;
+    }
+    
+    // Now check a whole vector at a time. Since the loads are aligned they can never straddle a page boundary.
+    while (true) {
+        uint32_t stopMask = StopMatcher::getStopMask(vecLoadAligned(curPtr));
+        
+        if (stopMask != 0) {
+            return static_cast<size_t>(curPtr - startPtr) + lowestSetBitIndex(stopMask);
+        }
+        
+        curPtr += kVectorSize;
+    }
+#else
+    // No vector instructions available, check bytes one at a time
+    while (!StopMatcher::isStopByte(*curPtr)) {
+        ++curPtr;
+    }
+    
+    return static_cast<size_t>(curPtr - startPtr);
+#endif
+}
+
+size_t SourceScan::countBlankChars(const char * str) {
+    return countBytesBeforeStop<BlankCharStopMatcher>(str);
+}
+
+size_t SourceScan::countSingleLineCommentChars(const char * str) {
+    return countBytesBeforeStop<SingleLineCommentStopMatcher>(str);
+}
+
+size_t SourceScan::countMultiLineCommentChars(const char * str) {
+    return countBytesBeforeStop<MultiLineCommentStopMatcher>(str);
+}
+
+size_t SourceScan::countStringLiteralChars(const char * str) {
+    return countBytesBeforeStop<StringLiteralStopMatcher>(str);
+}
+
+WC_END_NAMESPACE
@@ -0,0 +1,51 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#pragma once
+
+#include "Macros.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstddef>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+
+/**
+ * Fast scanning of runs of plain 7-bit ascii source text for the lexer.
+ *
+ * Each function counts how many bytes from the start of the given null terminated string can be
+ * skipped over as simple single column ascii chars, stopping at the first byte which needs closer
+ * attention from the lexer (a newline, a non-ascii byte, the null terminator etc.). Where available
+ * SSE2 or AVX2 is used to examine 16 or 32 bytes at a time, otherwise the bytes are checked one by one.
+ *
+ * Note: the vectorized versions may read past the null terminator, but never across an aligned
+ * 16 or 32 byte boundary and therefore never onto another memory page.
+ */
+namespace SourceScan {
+    /* Count the number of space and horizontal tab chars at the start of the string */
+    size_t countBlankChars(const char * str);
+    
+    /**
+     * Count the number of chars at the start of the string which can be skipped inside a single line comment.
+     * Stops at the null terminator, any ascii line separator and any non-ascii byte.
+     */
+    size_t countSingleLineCommentChars(const char * str);
+    
+    /**
+     * Count the number of chars at the start of the string which can be skipped inside a multi line comment.
+     * Stops at the same bytes as for single line comments, and also at ';' since it may begin the closing ';/'.
+     */
+    size_t countMultiLineCommentChars(const char * str);
+    
+    /**
+     * Count the number of chars at the start of the string which can be skipped inside a double quoted string literal.
+     * Stops at the same bytes as for single line comments, and also at '"' and '\\' (the start of an escape sequence).
+     */
+    size_t countStringLiteralChars(const char * str);
+}
+
+WC_END_NAMESPACE
@@ -0,0 +1,105 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#include "SymbolTable.hpp"
+
+#include "Assert.hpp"
+#include "LinearAlloc.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <algorithm>
+    #include <cstring>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+
+SymbolTable::SymbolTable(LinearAlloc & linearAlloc, size_t initialCapacity) :
+    mLinearAlloc(linearAlloc)
+{
+    // Capacity must be a power of two:
+    size_t capacity = 16;
+    
+    while (capacity < initialCapacity) {
+        capacity *= 2;
+    }
+    
+    mSlots.resize(capacity, 0);
+    mSymbols.reserve(capacity / 2);
+}
+
+SymbolId SymbolTable::intern(const char * name, size_t nameLen) {
+    WC_ASSERT(name);
+    
+    // Search for the name in the table using linear probing:
+    uint32_t hash = hashName(name, nameLen);
+    size_t slotMask = mSlots.size() - 1;
+    size_t slotIdx = hash & slotMask;
+    
+    while (Slot slot = mSlots[slotIdx]) {
+        const Symbol & symbol = mSymbols[slot - 1];
+        
+        if (symbol.hash == hash &&
+            symbol.nameLen == nameLen &&
+            std::memcmp(symbol.name, name, nameLen) == 0)
+        {
+            // Already interned:
+            return static_cast<SymbolId>(slot - 1);
+        }
+        
+        slotIdx = (slotIdx + 1) & slotMask;
+    }
+    
+    // New symbol: save a null terminated copy of the name
+    char * nameCopy = reinterpret_cast<char*>(mLinearAlloc.alloc(nameLen + 1));
+    std::memcpy(nameCopy, name, nameLen);
+    nameCopy[nameLen] = 0;
+    
+    SymbolId symbolId = static_cast<SymbolId>(mSymbols.size());
+    mSymbols.push_back(Symbol{ nameCopy, nameLen, hash });
+    mSlots[slotIdx] = symbolId + 1;
+    
+    // Keep the load factor at or below 0.5 so probe sequences stay short
+    if (mSymbols.size() * 2 > mSlots.size()) {
+        rehash(mSlots.size() * 2);
+    }
+    
+    return symbolId;
+}
+
+void SymbolTable::clear() {
+    mSymbols.clear();
+    std::fill(mSlots.begin(), mSlots.end(), 0);
+}
+
+uint32_t SymbolTable::hashName(const char * name, size_t nameLen) {
+    // 32-bit FNV-1a hash
+    uint32_t hash = 2166136261u;
+    
+    for (size_t i = 0; i < nameLen; ++i) {
+        hash ^= static_cast<uint8_t>(name[i]);
+        hash *= 16777619u;
+    }
+    
+    return hash;
+}
+
+void SymbolTable::rehash(size_t newCapacity) {
+    WC_ASSERT((newCapacity & (newCapacity - 1)) == 0);
+    mSlots.assign(newCapacity, 0);
+    size_t slotMask = newCapacity - 1;
+    
+    for (size_t symbolIdx = 0; symbolIdx < mSymbols.size(); ++symbolIdx) {
+        size_t slotIdx = mSymbols[symbolIdx].hash & slotMask;
+        
+        while (mSlots[slotIdx]) {
+            slotIdx = (slotIdx + 1) & slotMask;
+        }
+        
+        mSlots[slotIdx] = static_cast<Slot>(symbolIdx + 1);
+    }
+}
+
+WC_END_NAMESPACE
@@ -0,0 +1,96 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#pragma once
+
+#include "Macros.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstddef>
+    #include <cstdint>
+    #include <vector>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+
+class LinearAlloc;
+
+/**
+ * A dense id for an interned identifier name. Ids are handed out sequentially starting at zero,
+ * so they can be used to index arrays and two names are equal only if their ids are equal.
+ */
+typedef uint32_t SymbolId;
+
+/**
+ * Interns identifier names. Each distinct name is stored only once in the given linear allocator and 
+ * is given a unique symbol id. The text for each name is null terminated and remains valid for the 
+ * lifetime of the linear allocator.
+ */
+class SymbolTable {
+public:
+    /* The default number of slots in the hash table for the symbol table */
+    static constexpr const size_t kDefaultInitialCapacity = 1024;
+    
+    /* Create the symbol table. The text for all symbols is allocated from the given linear allocator. */
+    SymbolTable(LinearAlloc & linearAlloc, size_t initialCapacity = kDefaultInitialCapacity);
+    
+    /**
+     * Intern the given name, which is NOT null terminated, and return the symbol id for it.
+     * If the name has already been interned then the existing symbol id is returned.
+     */
+    SymbolId intern(const char * name, size_t nameLen);
+    
+    /**
+     * Remove all symbols from the table, so that symbol ids are handed out from zero again. The memory for the
+     * names of the symbols is not freed: that is up to the owner of the linear allocator.
+     */
+    void clear();
+    
+    /* Get the number of symbols in the table */
+    inline size_t getNumSymbols() const {
+        return mSymbols.size();
+    }
+    
+    /* Get the null terminated text for the given symbol */
+    inline const char * getSymbolName(SymbolId symbolId) const {
+        return mSymbols[symbolId].name;
+    }
+    
+    /* Get the length of the text for the given symbol */
+    inline size_t getSymbolNameLen(SymbolId symbolId) const {
+        return mSymbols[symbolId].nameLen;
+    }
+    
+    /* Hash the given string with the same hash function used by the symbol table */
+    static uint32_t hashName(const char * name, size_t nameLen);
+
+private:
+    WC_DISALLOW_COPY_AND_ASSIGN(SymbolTable)
+    
+    /* Info for a symbol in the table */
+    struct Symbol {
+        const char * name;
+        size_t nameLen;
+        uint32_t hash;
+    };
+    
+    /* A slot in the hash table. Holds the index of a symbol plus one, or zero if the slot is empty. */
+    typedef uint32_t Slot;
+    
+    /* Grow the hash table to the given number of slots, which must be a power of two */
+    void rehash(size_t newCapacity);
+    
+    /* The linear allocator used to allocate symbol names */
+    LinearAlloc & mLinearAlloc;
+    
+    /* All of the symbols in the table, indexed by symbol id */
+    std::vector<Symbol> mSymbols;
+    
+    /* The hash table slots. The number of slots is always a power of two. */
+    std::vector<Slot> mSlots;
+};
+
+WC_END_NAMESPACE
@@ -8,6 +8,7 @@
 
 #include "DataType/DataTypeId.hpp"
 #include "Macros.hpp"
+#include "SymbolTable.hpp"
 #include "TokenType.hpp"
 
 WC_THIRD_PARTY_INCLUDES_BEGIN
@@ -17,55 +18,81 @@ WC_THIRD_PARTY_INCLUDES_END
 
 WC_BEGIN_NAMESPACE
 
+/* Bit flags for a token, stored in the 'flags' field of the token */
+namespace TokenFlags {
+    /**
+     * Set when one or more newlines separate the token from the previous token.
+     * Newlines are not tokens themselves, the lexer instead flags the first token following them.
+     */
+    static constexpr const uint8_t kPrecededByNewline = 0x01;
+}
+
 /**
  * Class representing a token. Contains the token type, source information and additional data that
  * varies depending on the token type (if applicable)
+ *
+ * Tokens are stored in arrays by the lexer and the parser walks through them linearly, so the
+ * token is kept compact (32 bytes on a 64-bit platform) to make the best use of the cache. To that end
+ * source locations are stored as 32-bit byte offsets, which limits source files to 4 GB in size.
+ * Line and column numbers are not stored; when needed they are looked up using the 'SourceLineIndex'
+ * built by the lexer.
  */
 struct Token {
-    /* The type of token. See enum definition for more details. */
+    /**
+     * The type of token. See enum definition for more details.
+     * Note: the lexer also stores token types in a separate array for fast scanning, see 'Lexer::getTokenTypeList'.
+     */
     TokenType type;
     
-    /* Line in the source where the token starts, with 0 being the first line. */
-    size_t startLine;
+    /* Bit flags for the token. See 'TokenFlags' for the possible values. */
+    uint8_t flags;
     
-    /* Column in the source where the token starts, with 0 being the first column */
-    size_t startCol;
+    /**
+     * Integer literals only: what data type the integer literal should be stored in. This lives outside of 'data'
+     * (in space that would otherwise be padding) because the value of the integer literal fills all of 'data'.
+     */
+    DataTypeId intDataTypeId;
     
-    /* Line in the source where the token ends, with 0 being the first line. */
-    size_t endLine;
+    /* Integer literals only: how many bits are needed to store the value of the integer literal (1-128). */
+    uint8_t intBitsRequired;
     
-    /* Column in the source where the token ends, with 0 being the first column */
-    size_t endCol;
+    /* Offset in bytes from the start of the source code to where the token starts. */
+    uint32_t startSrcOffset;
     
-    /**
-     * Pointer to the location in the source code where the token started.
-     * This class does NOT own this memory. And it must remain valid for the lifetime of the token.
-     */
-    const char * startSrcPtr;
+    /* Offset in bytes from the start of the source code to where the token ends (exclusive). */
+    uint32_t endSrcOffset;
     
     /**
-     * Pointer to the location in the source code where the token ended.
-     * This class does NOT own this memory. And it must remain valid for the lifetime of the token.
+     * Offset in bytes from the start of the source code to where the next token starts. This allows the location
+     * following a token to be found without needing access to the token list. For the EOF token this is the same
+     * as the start offset of the token.
      */
-    const char * endSrcPtr;
+    uint32_t nextTokenSrcOffset;
     
     /* This holds the actual data for the token. Unused/undefined for anything other than a literal or identifier. */
     union {
         /* The raw bytes of the data */
-        uint8_t rawBytes[32];
+        uint8_t rawBytes[16];
         
-        /* Additional data for when the string is interpreted as an int */
+        /**
+         * The data when the token is an integer literal: the value of the literal, which is parsed by the lexer.
+         * The value is an unsigned 128-bit integer split into 64-bit words, with the least significant word first.
+         * See also 'intDataTypeId' and 'intBitsRequired'.
+         */
         struct IntData {
-            /* The string representation of the integer literal minus underscores */
-            const char * strMinusUS;
-            /* The length of the string representation of the integer literal minus underscores */
-            size_t strMinusUSLen;
-            /* What base the number is to be interpreted in: 2, 8, 10, 16 */
-            size_t base;
-            /* What data type the integer literal should be stored in */
-            DataTypeId dataTypeId;
+            uint64_t valueWords[2];
         } intData;
         
+        /* The data when the token is an identifier */
+        struct IdentData {
+            /* Pointer to the interned null terminated name. Owned by the symbol table of the lexer. */
+            const char * name;
+            /* Size of the name in code units (byte length) */
+            uint32_t nameLen;
+            /* The id of the interned name: two identifiers have the same name only if their ids match */
+            SymbolId symbolId;
+        } identData;
+        
         /* The data when interpreted as a string */
         struct StrData {
             /* Pointer to the string */
@@ -74,6 +101,16 @@ struct Token {
             size_t size;
         } strVal;
     } data;
+    
+    /* Tells if one or more newlines separate this token from the previous token */
+    inline bool isPrecededByNewline() const {
+        return (flags & TokenFlags::kPrecededByNewline) != 0;
+    }
+    
+    /* Get the size of the token in the source code, in bytes */
+    inline uint32_t getSrcLength() const {
+        return endSrcOffset - startSrcOffset;
+    }
 };
 
 WC_END_NAMESPACE
@@ -9,6 +9,7 @@
 #include "Macros.hpp"
 
 WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstddef>
     #include <cstdint>
 WC_THIRD_PARTY_INCLUDES_END
 
@@ -20,13 +21,14 @@ enum class TokenType : uint8_t {
     | Special / other
     =========================================================================*/
     
-    /* End of file token. Always the last token in a sequence */
+    /**
+     * End of file token. Always the last token in a sequence.
+     * Note: there is no token for newlines, see 'TokenFlags::kPrecededByNewline' instead.
+     */
     kEOF,
-    /* New line token */
-    kNewline,
     /**
      * A name/idenifier component for variables, function and class names etc.
-     * The identifeir name is stored in the 'data' field as 'strVal'.
+     * The identifeir name is stored in the 'data' field as 'identData'.
      */
     kIdentifier,
     
@@ -34,7 +36,7 @@ enum class TokenType : uint8_t {
     | Literals
     =========================================================================*/
     
-    /* Unsigned integer literal, like '01203'. The value is stored in the 'data' field as 'intVal'. */
+    /* Unsigned integer literal, like '01203'. The value is stored in the 'data' field as 'intData'. */
     kIntLit,
     /* String literal, like "Hello World". The value is store in the 'data' field as 'strVal'. */
     kStrLit,
@@ -237,4 +239,7 @@ enum class TokenType : uint8_t {
     kAssert,
 };
 
+/* The number of token types. Note: this must be kept up to date if token types are added after 'kAssert'. */
+static constexpr const size_t kNumTokenTypes = static_cast<size_t>(TokenType::kAssert) + 1;
+
 WC_END_NAMESPACE
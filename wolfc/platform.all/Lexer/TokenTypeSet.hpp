@@ -0,0 +1,74 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#pragma once
+
+#include "TokenType.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstddef>
+    #include <cstdint>
+    #include <initializer_list>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+
+/**
+ * A set of token types, stored as a bitset with one bit per token type.
+ * Sets can be built and combined at compile time and testing whether a token type is in the set is a single
+ * lookup. Used by the parser for the FIRST sets of each grammar production, see 'AST/FirstSets.hpp'.
+ */
+class TokenTypeSet {
+public:
+    /* Create an empty set */
+    constexpr TokenTypeSet() : mBits{} {
+        WC_EMPTY_FUNC_BODY();
+    }
+    
+    /* Create a set containing the given token types */
+    constexpr TokenTypeSet(std::initializer_list<TokenType> tokenTypes) : mBits{} {
+        for (TokenType tokenType : tokenTypes) {
+            size_t bitIndex = static_cast<size_t>(tokenType);
+            mBits[bitIndex / 64] |= uint64_t(1) << (bitIndex % 64);
+        }
+    }
+    
+    /* Tells if the given token type is in the set */
+    constexpr bool contains(TokenType tokenType) const {
+        return ((mBits[static_cast<size_t>(tokenType) / 64] >> (static_cast<size_t>(tokenType) % 64)) & 1) != 0;
+    }
+    
+    /* Tells if the set has any token types in common with the given set */
+    constexpr bool intersects(const TokenTypeSet & other) const {
+        for (size_t i = 0; i < kNumWords; ++i) {
+            if ((mBits[i] & other.mBits[i]) != 0) {
+                return true;
+            }
+        }
+        
+        return false;
+    }
+    
+    /* Return the union of this set and the given set */
+    constexpr TokenTypeSet operator | (const TokenTypeSet & other) const {
+        TokenTypeSet result;
+        
+        for (size_t i = 0; i < kNumWords; ++i) {
+            result.mBits[i] = mBits[i] | other.mBits[i];
+        }
+        
+        return result;
+    }
+    
+private:
+    /* The number of 64-bit words needed to hold a bit for every token type */
+    static constexpr const size_t kNumWords = (kNumTokenTypes + 63) / 64;
+    
+    /* The bits for the set, one bit per token type */
+    uint64_t mBits[kNumWords];
+};
+
+WC_END_NAMESPACE
@@ -7,8 +7,11 @@
 #include "LinearAlloc.hpp"
 
 #include "Assert.hpp"
+#include "LinearAllocPool.hpp"
 
 WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstddef>
+    #include <cstdint>
     #include <cstdlib>
 WC_THIRD_PARTY_INCLUDES_END
 
@@ -20,26 +23,27 @@ LinearAlloc::LinearAlloc(size_t maxAllocSize,
                          size_t reserveNumSysBlocks)
 :
     mMaxAllocSize(maxAllocSize),
-    mBlockSize(blockSize)
+    mBlockSize(blockSize),
+    mPool(nullptr),
+    mPeakNumBytesUsed(0),
+    mPeakNumBlocks(0)
 {
-    // Sanity checks: max alloc size and block size must be at least this size
-    WC_ASSERT(maxAllocSize >= kAlign * 2);
-    WC_ASSERT(blockSize >= kAlign * 2);
-    
-    // Sanity checks: block size must be at least same size as max alloc size
-    WC_ASSERT(blockSize >= maxAllocSize);
-    
-    // Reserving:
-    mMemBlocks.reserve(reserveNumBlocks);
-    mSysMemBlocks.reserve(reserveNumSysBlocks);
-    
-    // Make sure there is always at least one mem block
-    allocMemBlock();
+    init(reserveNumBlocks, reserveNumSysBlocks);
+}
+
+LinearAlloc::LinearAlloc(LinearAllocPool & pool, size_t reserveNumBlocks, size_t reserveNumSysBlocks) :
+    mMaxAllocSize(pool.getMaxAllocSize()),
+    mBlockSize(pool.getBlockSize()),
+    mPool(&pool),
+    mPeakNumBytesUsed(0),
+    mPeakNumBlocks(0)
+{
+    init(reserveNumBlocks, reserveNumSysBlocks);
 }
 
 LinearAlloc::~LinearAlloc() {
     for (const MemBlock & block : mMemBlocks) {
-        std::free(block.startPtr);
+        freeMemBlock(block.startPtr);
     }
     
     for (const SysMemBlock & block : mSysMemBlocks) {
@@ -47,62 +51,187 @@ LinearAlloc::~LinearAlloc() {
     }
 }
 
-void * LinearAlloc::alloc(size_t numBytes) {
+void * LinearAlloc::alloc(size_t numBytes, size_t align) {
     // Zero sized allocs do nothing
     if (numBytes == 0) {
         return nullptr;
     }
     
-    // If the alloc is too big then do a system alloc instead
-    if (numBytes > mMaxAllocSize) {
-        return sysAlloc(numBytes);
+    // Alignment must be a power of 2, and is at least the default alignment
+    WC_ASSERT(align > 0 && (align & (align - 1)) == 0);
+    
+    if (align < kAlign) {
+        align = kAlign;
+    }
+    
+    // If the alloc is too big then do a system alloc instead.
+    // Note: blocks always start on a 'kAlign' boundary, so this also makes sure the alloc would fit
+    // in a new block when it needs to be aligned further than that.
+    if (numBytes + (align - kAlign) > mMaxAllocSize) {
+        return sysAlloc(numBytes, align);
     }
     
     // See if we have enough room in the currently allocated block to satisfy the alloc:
     {
         MemBlock & lastBlock = mMemBlocks.back();
+        size_t allocOffset = alignBlockOffset(lastBlock, align);
         
-        if (lastBlock.currentOffset + numBytes <= mBlockSize) {
-            // Happy days- we can service this alloc: compute the return pointer, move along in the block
-            // and give back the mem...
-            void * returnPtr = reinterpret_cast<int8_t*>(lastBlock.startPtr) + lastBlock.currentOffset;
-            lastBlock.currentOffset = alignBlockOffset(lastBlock.currentOffset + numBytes);
-            return returnPtr;
+        if (allocOffset + numBytes <= mBlockSize) {
+            // Happy days- we can service this alloc: move along in the block and give back the mem...
+            lastBlock.currentOffset = allocOffset + numBytes;
+            return reinterpret_cast<int8_t*>(lastBlock.startPtr) + allocOffset;
         }
     }
     
     // Can't service this request with the currently allocated block, make a new one!
-    // Move along the current block offset then and return the start block pointer.
+    // Note: the rest of the current block goes to waste.
+    // Move along the current block offset then and return the pointer to the alloc.
     allocMemBlock();
     MemBlock & lastBlock = mMemBlocks.back();
-    lastBlock.currentOffset = alignBlockOffset(numBytes);
-    return lastBlock.startPtr;
+    size_t allocOffset = alignBlockOffset(lastBlock, align);
+    WC_ASSERT(allocOffset + numBytes <= mBlockSize);
+    lastBlock.currentOffset = allocOffset + numBytes;
+    return reinterpret_cast<int8_t*>(lastBlock.startPtr) + allocOffset;
+}
+
+LinearAlloc::Mark LinearAlloc::mark() const {
+    return Mark{ mMemBlocks.size(), mMemBlocks.back().currentOffset, mSysMemBlocks.size() };
+}
+
+void LinearAlloc::rollback(const Mark & mark) {
+    // Sanity checks: the mark must be for a point that we have not already rolled back past
+    WC_ASSERT(mark.numMemBlocks > 0);
+    WC_ASSERT(mark.numMemBlocks <= mMemBlocks.size());
+    WC_ASSERT(mark.numSysMemBlocks <= mSysMemBlocks.size());
+    WC_ASSERT(mark.numMemBlocks < mMemBlocks.size() ||
+              mark.lastBlockOffset <= mMemBlocks.back().currentOffset);
+    
+    // Save the peak number of bytes used before it goes down
+    size_t numBytesUsed = getNumBytesUsed();
+    
+    if (numBytesUsed > mPeakNumBytesUsed) {
+        mPeakNumBytesUsed = numBytesUsed;
+    }
+    
+    // Free any blocks allocated since the mark
+    for (size_t i = mark.numMemBlocks; i < mMemBlocks.size(); ++i) {
+        freeMemBlock(mMemBlocks[i].startPtr);
+    }
+    
+    for (size_t i = mark.numSysMemBlocks; i < mSysMemBlocks.size(); ++i) {
+        std::free(mSysMemBlocks[i].startPtr);
+    }
+    
+    mMemBlocks.resize(mark.numMemBlocks);
+    mSysMemBlocks.resize(mark.numSysMemBlocks);
+    
+    // Move back to where we were in the last block
+    mMemBlocks.back().currentOffset = mark.lastBlockOffset;
+}
+
+LinearAlloc::Stats LinearAlloc::getStats() const {
+    // Every block except the last is done with, whatever is left at the end of those is wasted
+    size_t numBytesWasted = 0;
+    
+    for (size_t i = 0; i + 1 < mMemBlocks.size(); ++i) {
+        numBytesWasted += mBlockSize - mMemBlocks[i].currentOffset;
+    }
+    
+    size_t numBytesUsed = getNumBytesUsed();
+    
+    return Stats{
+        numBytesUsed,
+        numBytesWasted,
+        mMemBlocks.size(),
+        mSysMemBlocks.size(),
+        (numBytesUsed > mPeakNumBytesUsed) ? numBytesUsed : mPeakNumBytesUsed,
+        mPeakNumBlocks
+    };
+}
+
+void LinearAlloc::init(size_t reserveNumBlocks, size_t reserveNumSysBlocks) {
+    // Sanity checks: max alloc size and block size must be at least this size
+    WC_ASSERT(mMaxAllocSize >= kAlign * 2);
+    WC_ASSERT(mBlockSize >= kAlign * 2);
+    
+    // Sanity checks: block size must be at least same size as max alloc size
+    WC_ASSERT(mBlockSize >= mMaxAllocSize);
+    
+    // Reserving:
+    mMemBlocks.reserve(reserveNumBlocks);
+    mSysMemBlocks.reserve(reserveNumSysBlocks);
+    
+    // Make sure there is always at least one mem block
+    allocMemBlock();
 }
 
 void LinearAlloc::allocMemBlock() {
     mMemBlocks.resize(mMemBlocks.size() + 1);
     MemBlock & block = mMemBlocks.back();
-    block.startPtr = std::malloc(mBlockSize);
     
-    if (!block.startPtr) {
-        std::exit(-1);   // Out of memory!
+    if (mPool) {
+        block.startPtr = mPool->allocBlock();
+    }
+    else {
+        block.startPtr = std::malloc(mBlockSize);
+        
+        if (!block.startPtr) {
+            std::exit(-1);   // Out of memory!
+        }
     }
     
     block.currentOffset = 0;
+    
+    if (mMemBlocks.size() > mPeakNumBlocks) {
+        mPeakNumBlocks = mMemBlocks.size();
+    }
 }
 
-void * LinearAlloc::sysAlloc(size_t numBytes) {
-    return std::malloc(numBytes);
+void LinearAlloc::freeMemBlock(void * blockPtr) {
+    if (mPool) {
+        mPool->freeBlock(blockPtr);
+    }
+    else {
+        std::free(blockPtr);
+    }
 }
 
-size_t LinearAlloc::alignBlockOffset(size_t offset) {
-    size_t remainder = offset % kAlign;
+void * LinearAlloc::sysAlloc(size_t numBytes, size_t align) {
+    // Allocate enough extra to be able to align the memory, if the system allocator doesn't guarantee the alignment
+    size_t numExtraBytes = (align > alignof(std::max_align_t)) ? align - 1 : 0;
+    void * memPtr = std::malloc(numBytes + numExtraBytes);
     
-    if (remainder > 0) {
-        offset += kAlign - remainder;
+    if (!memPtr) {
+        std::exit(-1);   // Out of memory!
     }
     
-    return offset;
+    // Save the block so that it gets freed when the allocator is destroyed or rolled back
+    mSysMemBlocks.push_back(SysMemBlock{ memPtr, numBytes });
+    
+    // Return the aligned pointer
+    uintptr_t alignedAddr = (reinterpret_cast<uintptr_t>(memPtr) + numExtraBytes) & ~uintptr_t(align - 1);
+    return reinterpret_cast<void*>(alignedAddr);
+}
+
+size_t LinearAlloc::getNumBytesUsed() const {
+    size_t numBytesUsed = 0;
+    
+    for (const MemBlock & block : mMemBlocks) {
+        numBytesUsed += block.currentOffset;
+    }
+    
+    for (const SysMemBlock & block : mSysMemBlocks) {
+        numBytesUsed += block.size;
+    }
+    
+    return numBytesUsed;
+}
+
+size_t LinearAlloc::alignBlockOffset(const MemBlock & block, size_t align) {
+    // Note: align the actual address rather than just the offset, since the block itself may be less aligned
+    uintptr_t startAddr = reinterpret_cast<uintptr_t>(block.startPtr);
+    uintptr_t allocAddr = (startAddr + block.currentOffset + (align - 1)) & ~uintptr_t(align - 1);
+    return static_cast<size_t>(allocAddr - startAddr);
 }
 
 WC_END_NAMESPACE
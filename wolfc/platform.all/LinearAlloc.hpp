@@ -9,43 +9,101 @@
 #include "Macros.hpp"
 
 WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstddef>
     #include <vector>
 WC_THIRD_PARTY_INCLUDES_END
 
 WC_BEGIN_NAMESPACE
 
+class LinearAllocPool;
+
 /**
  * A linear allocator used by the compiler/lexer to improve performance. Has the following properties:
  *
  * 1 - Memory is preallocated in large chunks and then dished out in a linear fashion.
- * 2 - Freeing memory is not supported. The allocator is designed for usage patterns where this 
- *     limitation is generally not a problem.
- * 3 - When the allocator is destroyed all memory allocated by this allocator is freed.
- * 4 - All memory allocated is aligned along sizeof(void*) bounds.
+ * 2 - Freeing individual allocs is not supported. Instead the allocator can be rolled back to a previous
+ *     point with 'mark' and 'rollback', which frees everything allocated since that point.
+ * 3 - When the allocator is destroyed all memory allocated by this allocator is freed, including allocs
+ *     which were too big for the preallocated chunks and which were done with the system allocator instead.
+ * 4 - All memory allocated is aligned along sizeof(void*) bounds by default. Greater (power of 2)
+ *     alignments can be requested per alloc.
+ * 5 - Preallocated chunks can come from a 'LinearAllocPool', so they can be recycled between allocators.
  */
 class LinearAlloc {
 public:
-    /* The alignment for the allocator. All allocs are aligned on this num-bytes boundary. */
+    /* The default alignment for the allocator. All allocs are aligned on at least this num-bytes boundary. */
     static constexpr const size_t kAlign = sizeof(void*);
     
+    /* A point in the allocator that can be rolled back to, see 'mark' and 'rollback' */
+    struct Mark {
+        size_t numMemBlocks;
+        size_t lastBlockOffset;
+        size_t numSysMemBlocks;
+    };
+    
+    /* Stats on the memory usage of the allocator, see 'getStats' */
+    struct Stats {
+        /* The total size of all allocs currently in use (including alignment padding), and including system allocs */
+        size_t numBytesUsed;
+        
+        /* The number of bytes left unused at the end of blocks, because an alloc did not fit in the rest of a block */
+        size_t numBytesWasted;
+        
+        /* The number of preallocated blocks and the number of allocs done with the system allocator */
+        size_t numBlocks;
+        size_t numSysBlocks;
+        
+        /* The highest the number of bytes used and the number of blocks have been, before any rollbacks */
+        size_t peakNumBytesUsed;
+        size_t peakNumBlocks;
+    };
+    
     /* Create the allocator with the given settings */
     LinearAlloc(size_t maxAllocSize,
                 size_t blockSize,
                 size_t reserveNumBlocks = 0,
                 size_t reserveNumSysBlocks = 0);
     
+    /**
+     * Create an allocator which gets its memory blocks from the given pool, and gives them back to it when done.
+     * Uses the max alloc and block size settings of the pool. The pool must outlive the allocator.
+     */
+    LinearAlloc(LinearAllocPool & pool,
+                size_t reserveNumBlocks = 0,
+                size_t reserveNumSysBlocks = 0);
+    
     ~LinearAlloc();
     
-    /* Allocate a chunk of memory */
-    void * alloc(size_t numBytes);
+    /**
+     * Allocate a chunk of memory. The alignment must be a power of 2, and is raised to 'kAlign' if less than
+     * that. Allocs which are too big for the preallocated blocks are done with the system allocator instead.
+     */
+    void * alloc(size_t numBytes, size_t align = kAlign);
     
-    /* Allocate the the size of a given type */
+    /* Allocate the the size of a given type, with the alignment of that type */
     template <typename T>
     void * allocSizeOf() {
-        return alloc(sizeof(T));
+        return alloc(sizeof(T), alignof(T));
     }
     
+    /* Get the current point in the allocator, which can be rolled back to later */
+    Mark mark() const;
+    
+    /**
+     * Roll the allocator back to the given point, freeing everything allocated since then.
+     * Marks must be rolled back to in reverse order: rolling back to a mark invalidates all marks taken after it.
+     */
+    void rollback(const Mark & mark);
+    
+    /**
+     * Get stats on the memory usage of the allocator. These are worked out from the blocks when requested,
+     * rather than being counted on every alloc, so this is not free to call.
+     */
+    Stats getStats() const;
+    
 private:
+    WC_DISALLOW_COPY_AND_ASSIGN(LinearAlloc)
+    
     /* A memory block preallocated in the linear allocator */
     struct MemBlock {
         void * startPtr;
@@ -55,16 +113,29 @@ private:
     /* Type for a block allocated with the system allocator */
     struct SysMemBlock {
         void * startPtr;
+        size_t size;
     };
     
+    /* Shared setup for the constructors: checks the settings and allocates the first memory block */
+    void init(size_t reserveNumBlocks, size_t reserveNumSysBlocks);
+    
     /* Allocates a memory block */
     void allocMemBlock();
     
-    /* Allocate a chunk of memory from the system and return it's pointer. The chunk is saved as a sys mem block. */
-    void * sysAlloc(size_t numBytes);
+    /* Frees a memory block, or gives it back to the pool if the allocator has one */
+    void freeMemBlock(void * blockPtr);
+    
+    /* Get the total size of all allocs currently in use, see 'Stats' */
+    size_t getNumBytesUsed() const;
     
-    /* Utility, align the given block offset */
-    size_t alignBlockOffset(size_t offset);
+    /**
+     * Allocate a chunk of memory from the system with the given alignment and return it's pointer.
+     * The chunk is saved as a sys mem block.
+     */
+    void * sysAlloc(size_t numBytes, size_t align);
+    
+    /* Utility, get the offset in the given block of the next alloc with the given alignment */
+    static size_t alignBlockOffset(const MemBlock & block, size_t align);
     
     /* Max alloc size */
     size_t mMaxAllocSize;
@@ -72,11 +143,23 @@ private:
     /* Block size */
     size_t mBlockSize;
     
+    /* The pool that memory blocks come from, if any. If there is no pool then blocks come from the system. */
+    LinearAllocPool * mPool;
+    
     /* The list of memory blocks allocated */
     std::vector<MemBlock> mMemBlocks;
     
     /* The list of system memory blocks allocated */
     std::vector<SysMemBlock> mSysMemBlocks;
+    
+    /**
+     * The highest the number of bytes used has been. Only updated when rolling back, since the number of bytes
+     * used can only go down then. See 'getStats'.
+     */
+    size_t mPeakNumBytesUsed;
+    
+    /* The highest the number of blocks has been */
+    size_t mPeakNumBlocks;
 };
 
 WC_END_NAMESPACE
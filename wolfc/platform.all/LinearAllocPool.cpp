@@ -0,0 +1,191 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#include "LinearAllocPool.hpp"
+
+#include "Assert.hpp"
+#include "LinearAlloc.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <atomic>
+    #include <cstdlib>
+    
+    #ifndef _MSC_VER
+        #include <sys/mman.h>
+    #endif
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+
+/* Source for pool ids, see 'LinearAllocPool::mPoolId'. Ids start at 1 so that 0 can mean 'no pool'. */
+static std::atomic<uint64_t> gNextPoolId(1);
+
+/**
+ * The pool and allocator last used by 'LinearAllocPool::getThreadAlloc' on this thread.
+ * Saves having to lock the pool and look up the allocator for the thread every time, in the common case
+ * where a thread only uses the one pool.
+ */
+static thread_local uint64_t gThreadAllocPoolId = 0;
+static thread_local LinearAlloc * gThreadAlloc = nullptr;
+
+LinearAllocPool::LinearAllocPool(size_t maxAllocSize, size_t blockSize, BlockMemType blockMemType) :
+    mMaxAllocSize(maxAllocSize),
+    mBlockSize(blockSize),
+    mBlockMemType(blockMemType),
+    mPoolId(gNextPoolId++),
+    mNumBlocksInUse(0)
+{
+    #ifdef _MSC_VER
+        // Mapping memory directly is not supported on this platform yet, use the heap instead
+        mBlockMemType = BlockMemType::kHeap;
+    #endif
+}
+
+LinearAllocPool::~LinearAllocPool() {
+    // Destroy the allocators still in the pool, which gives their blocks back to it.
+    // Note: the map is moved out first since destroying the allocators locks the pool.
+    {
+        auto threadAllocs = std::move(mThreadAllocs);
+        mThreadAllocs.clear();
+    }
+    
+    // Forget the allocator last used by this thread, if it was from this pool
+    if (gThreadAllocPoolId == mPoolId) {
+        gThreadAllocPoolId = 0;
+        gThreadAlloc = nullptr;
+    }
+    
+    // If this fails then allocators taken out of the pool were not destroyed before it
+    WC_ASSERT(mNumBlocksInUse == 0);
+    
+    for (void * blockPtr : mFreeBlocks) {
+        sysFreeBlock(blockPtr);
+    }
+}
+
+LinearAlloc & LinearAllocPool::getThreadAlloc() {
+    // Fast path: see if this is the pool the thread last got its allocator from
+    if (gThreadAllocPoolId == mPoolId) {
+        return *gThreadAlloc;
+    }
+    
+    // Otherwise find or make the allocator for the thread.
+    // Note: a new allocator must be made without holding the lock, since it gets its first block from the pool.
+    LinearAlloc * threadAlloc = findThreadAlloc();
+    
+    if (!threadAlloc) {
+        std::unique_ptr<LinearAlloc> newThreadAlloc(new LinearAlloc(*this));
+        threadAlloc = newThreadAlloc.get();
+        std::lock_guard<std::mutex> lock(mMutex);
+        mThreadAllocs[std::this_thread::get_id()] = std::move(newThreadAlloc);
+    }
+    
+    gThreadAllocPoolId = mPoolId;
+    gThreadAlloc = threadAlloc;
+    return *threadAlloc;
+}
+
+std::unique_ptr<LinearAlloc> LinearAllocPool::takeThreadAlloc() {
+    // The allocator is no longer in the pool, so the thread can't use it via the fast path anymore
+    if (gThreadAllocPoolId == mPoolId) {
+        gThreadAllocPoolId = 0;
+        gThreadAlloc = nullptr;
+    }
+    
+    std::unique_ptr<LinearAlloc> threadAlloc;
+    
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto threadAllocIter = mThreadAllocs.find(std::this_thread::get_id());
+        
+        if (threadAllocIter != mThreadAllocs.end()) {
+            threadAlloc = std::move(threadAllocIter->second);
+            mThreadAllocs.erase(threadAllocIter);
+        }
+    }
+    
+    // If the thread didn't have an allocator then give it an empty one.
+    // Note: this must be done without holding the lock, since the allocator gets its first block from the pool.
+    if (!threadAlloc) {
+        threadAlloc.reset(new LinearAlloc(*this));
+    }
+    
+    return threadAlloc;
+}
+
+LinearAlloc * LinearAllocPool::findThreadAlloc() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto threadAllocIter = mThreadAllocs.find(std::this_thread::get_id());
+    return (threadAllocIter != mThreadAllocs.end()) ? threadAllocIter->second.get() : nullptr;
+}
+
+void * LinearAllocPool::allocBlock() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        ++mNumBlocksInUse;
+        
+        if (!mFreeBlocks.empty()) {
+            void * blockPtr = mFreeBlocks.back();
+            mFreeBlocks.pop_back();
+            return blockPtr;
+        }
+    }
+    
+    // No free blocks, need a new one. Note: don't need the lock for this.
+    return sysAllocBlock();
+}
+
+void LinearAllocPool::freeBlock(void * blockPtr) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    WC_ASSERT(mNumBlocksInUse > 0);
+    --mNumBlocksInUse;
+    mFreeBlocks.push_back(blockPtr);
+}
+
+size_t LinearAllocPool::getNumFreeBlocks() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mFreeBlocks.size();
+}
+
+void * LinearAllocPool::sysAllocBlock() const {
+    #ifndef _MSC_VER
+        if (mBlockMemType == BlockMemType::kHugePages) {
+            void * blockPtr = mmap(nullptr, mBlockSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            
+            if (blockPtr == MAP_FAILED) {
+                std::exit(-1);   // Out of memory!
+            }
+            
+            // Not all platforms support this, in which case we just get regular pages
+            #ifdef MADV_HUGEPAGE
+                madvise(blockPtr, mBlockSize, MADV_HUGEPAGE);
+            #endif
+            
+            return blockPtr;
+        }
+    #endif
+    
+    void * blockPtr = std::malloc(mBlockSize);
+    
+    if (!blockPtr) {
+        std::exit(-1);   // Out of memory!
+    }
+    
+    return blockPtr;
+}
+
+void LinearAllocPool::sysFreeBlock(void * blockPtr) const {
+    #ifndef _MSC_VER
+        if (mBlockMemType == BlockMemType::kHugePages) {
+            munmap(blockPtr, mBlockSize);
+            return;
+        }
+    #endif
+    
+    std::free(blockPtr);
+}
+
+WC_END_NAMESPACE
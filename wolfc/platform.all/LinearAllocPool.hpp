@@ -0,0 +1,133 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#pragma once
+
+#include "Macros.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstddef>
+    #include <cstdint>
+    #include <memory>
+    #include <mutex>
+    #include <thread>
+    #include <unordered_map>
+    #include <vector>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+
+class LinearAlloc;
+
+/**
+ * A pool of linear allocators for compiler work spread across multiple threads. Has the following properties:
+ *
+ * 1 - Each thread gets its own 'LinearAlloc' from the pool with 'getThreadAlloc', so threads can allocate
+ *     without any locking or contention with each other.
+ * 2 - The memory blocks for the allocators of the pool are recycled: when an allocator frees a block (when it
+ *     is rolled back or destroyed) the block goes back to the pool to be reused by any thread.
+ *     Only getting or giving back a whole block needs a lock, which is rare compared to individual allocs.
+ * 3 - Once a thread is done with its allocator it can be taken out of the pool with 'takeThreadAlloc' and
+ *     handed to whatever owns the results, for example the owner of the AST for a compilation unit.
+ *     Allocators taken out of the pool still get (and give back) their blocks from it, so the pool must
+ *     outlive them.
+ * 4 - Optionally, blocks can be mapped directly from the OS and backed with huge pages, see 'BlockMemType'.
+ */
+class LinearAllocPool {
+public:
+    /* How the memory for the blocks of the pool is allocated */
+    enum class BlockMemType {
+        /* Blocks are allocated with the system allocator */
+        kHeap,
+        
+        /**
+         * Blocks are mapped directly from the OS and the OS is advised to back them with huge pages, which cuts
+         * down on TLB misses when walking large amounts of memory such as an AST. Only worthwhile for large block
+         * sizes (multiple MB). Falls back to 'kHeap' on platforms where this is not supported.
+         */
+        kHugePages
+    };
+    
+    /* Create the pool. The max alloc and block size settings are used for every allocator in the pool. */
+    LinearAllocPool(size_t maxAllocSize, size_t blockSize, BlockMemType blockMemType = BlockMemType::kHeap);
+    
+    /**
+     * Destroys the pool along with all of the allocators still in it, and frees all memory blocks.
+     * Allocators taken out of the pool with 'takeThreadAlloc' must have been destroyed before this point.
+     */
+    ~LinearAllocPool();
+    
+    inline size_t getMaxAllocSize() const {
+        return mMaxAllocSize;
+    }
+    
+    inline size_t getBlockSize() const {
+        return mBlockSize;
+    }
+    
+    /**
+     * Get the allocator in the pool for the calling thread, creating it if it doesn't exist yet.
+     * The allocator must only be used by the calling thread while it is in the pool.
+     */
+    LinearAlloc & getThreadAlloc();
+    
+    /**
+     * Take the allocator for the calling thread out of the pool, passing ownership of it (and of everything
+     * allocated with it) to the caller. If the thread asks for an allocator again after this, then it gets
+     * a new one. Returns an empty allocator if the thread did not have one.
+     */
+    std::unique_ptr<LinearAlloc> takeThreadAlloc();
+    
+    /* Get a memory block for an allocator in the pool, reusing a free block if there is one */
+    void * allocBlock();
+    
+    /* Give a memory block obtained with 'allocBlock' back to the pool so that it can be reused */
+    void freeBlock(void * blockPtr);
+    
+    /* Get the number of free blocks held by the pool, waiting to be reused */
+    size_t getNumFreeBlocks() const;
+    
+private:
+    WC_DISALLOW_COPY_AND_ASSIGN(LinearAllocPool)
+    
+    /* Find the allocator in the pool for the calling thread, returns null if it doesn't have one */
+    LinearAlloc * findThreadAlloc() const;
+    
+    /* Get a new memory block from the system */
+    void * sysAllocBlock() const;
+    
+    /* Give a memory block back to the system */
+    void sysFreeBlock(void * blockPtr) const;
+    
+    /* Max alloc size for the allocators of the pool */
+    size_t mMaxAllocSize;
+    
+    /* Block size for the allocators of the pool */
+    size_t mBlockSize;
+    
+    /* How the memory for blocks is allocated */
+    BlockMemType mBlockMemType;
+    
+    /**
+     * Unique id for this pool, never reused by another pool. Used to tell if the allocator a thread last used is
+     * for this pool, see 'getThreadAlloc'.
+     */
+    uint64_t mPoolId;
+    
+    /* Lock for everything below */
+    mutable std::mutex mMutex;
+    
+    /* The allocator for each thread which has one in the pool */
+    std::unordered_map<std::thread::id, std::unique_ptr<LinearAlloc>> mThreadAllocs;
+    
+    /* Memory blocks which are free to be reused */
+    std::vector<void*> mFreeBlocks;
+    
+    /* The number of blocks currently given out to allocators */
+    size_t mNumBlocksInUse;
+};
+
+WC_END_NAMESPACE
@@ -0,0 +1,171 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#include "SourceBuffer.hpp"
+
+#include "FileUtils.hpp"
+#include "Finally.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cerrno>
+    #include <cstring>
+    
+    #ifndef _MSC_VER
+        #include <fcntl.h>
+        #include <sys/mman.h>
+        #include <sys/stat.h>
+        #include <unistd.h>
+    #endif
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+
+/* Text used for the buffer when it is empty */
+static const char * const kEmptyText = "";
+
+/* The size of each chunk read when reading a file that cannot be memory mapped */
+static constexpr const size_t kReadChunkSize = 64 * 1024;
+
+SourceBuffer::SourceBuffer() :
+    mText(kEmptyText),
+    mSize(0),
+    mMappedSize(0),
+    mHeapText(nullptr)
+{
+    WC_EMPTY_FUNC_BODY();
+}
+
+SourceBuffer::~SourceBuffer() {
+    clear();
+}
+
+bool SourceBuffer::load(const char * filePath) {
+    clear();
+    
+    #ifdef _MSC_VER
+        // Memory mapping is not supported on this platform yet, just read the file into a heap buffer
+        size_t fileSize = 0;
+        mHeapText = FileUtils::readTextFileAsCString(filePath, fileSize);
+        WC_GUARD(mHeapText, false);
+        mText = mHeapText;
+        mSize = fileSize;
+        return true;
+    #else
+        // Open the file
+        int fileDescriptor = open(filePath, O_RDONLY);
+        WC_GUARD(fileDescriptor >= 0, false);
+        
+        // This cleans up when we are done. Note that closing the file does not affect any mapping of it.
+        Finally closeFile([&](){
+            close(fileDescriptor);
+        });
+        
+        // Only regular files with some content can be mapped, read anything else (pipes etc.) the slow way
+        struct stat fileStat;
+        WC_GUARD(fstat(fileDescriptor, &fileStat) == 0, false);
+        
+        if (S_ISREG(fileStat.st_mode) && fileStat.st_size > 0) {
+            if (tryMapFile(fileDescriptor, static_cast<size_t>(fileStat.st_size))) {
+                return true;
+            }
+        }
+        
+        return readFile(fileDescriptor);
+    #endif
+}
+
+void SourceBuffer::clear() {
+    #ifndef _MSC_VER
+        if (mMappedSize > 0) {
+            munmap(const_cast<char*>(mText), mMappedSize);
+        }
+    #endif
+    
+    WC_SAFE_DELETE_ARRAY_NULL(mHeapText);
+    mText = kEmptyText;
+    mSize = 0;
+    mMappedSize = 0;
+}
+
+#ifndef _MSC_VER
+
+bool SourceBuffer::tryMapFile(int fileDescriptor, size_t fileSize) {
+    // Figure out the size of the mapping, rounded up to a whole number of pages.
+    // The remainder of the last page of a mapped file is zero filled, which gives us our null terminator for free.
+    // If the file exactly fills its last page however then an extra padding page is needed for the terminator.
+    size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t mapSize = ((fileSize + pageSize - 1) / pageSize) * pageSize;
+    
+    if (mapSize == fileSize) {
+        mapSize += pageSize;
+    }
+    
+    // Reserve the entire range as zero filled memory first and then map the file over the start of it.
+    // This guarantees that the padding page (if any) is directly after the file contents.
+    void * reservePtr = mmap(nullptr, mapSize, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    WC_GUARD(reservePtr != MAP_FAILED, false);
+    void * filePtr = mmap(reservePtr, fileSize, PROT_READ, MAP_PRIVATE | MAP_FIXED, fileDescriptor, 0);
+    
+    if (filePtr == MAP_FAILED) {
+        munmap(reservePtr, mapSize);
+        return false;
+    }
+    
+    // The lexer walks the file from start to end, let the OS know so it can read ahead
+    madvise(filePtr, mapSize, MADV_SEQUENTIAL);
+    
+    mText = reinterpret_cast<const char*>(filePtr);
+    mSize = fileSize;
+    mMappedSize = mapSize;
+    return true;
+}
+
+bool SourceBuffer::readFile(int fileDescriptor) {
+    // Read in chunks until the end of the file is reached, growing the buffer as we go.
+    // Always leave room for the null terminator.
+    size_t bufferSize = kReadChunkSize;
+    size_t bufferUsed = 0;
+    char * buffer = new char[bufferSize];
+    
+    while (true) {
+        if (bufferSize - bufferUsed < kReadChunkSize + 1) {
+            size_t newBufferSize = bufferSize * 2;
+            char * newBuffer = new char[newBufferSize];
+            std::memcpy(newBuffer, buffer, bufferUsed);
+            delete[] buffer;
+            buffer = newBuffer;
+            bufferSize = newBufferSize;
+        }
+        
+        ssize_t numBytesRead = read(fileDescriptor, buffer + bufferUsed, kReadChunkSize);
+        
+        if (numBytesRead < 0) {
+            if (errno == EINTR) {
+                continue;   // Interrupted by a signal, try again
+            }
+            
+            delete[] buffer;
+            return false;
+        }
+        
+        if (numBytesRead == 0) {
+            break;  // End of file
+        }
+        
+        bufferUsed += static_cast<size_t>(numBytesRead);
+    }
+    
+    // Null terminate buffer and save
+    buffer[bufferUsed] = 0;
+    mHeapText = buffer;
+    mText = buffer;
+    mSize = bufferUsed;
+    return true;
+}
+
+#endif  // #ifndef _MSC_VER
+
+WC_END_NAMESPACE
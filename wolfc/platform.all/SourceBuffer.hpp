@@ -0,0 +1,80 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#pragma once
+
+#include "Macros.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstddef>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+
+/**
+ * Holds the source text for a file being compiled. The text is always null terminated.
+ *
+ * Where possible the file is memory mapped read only so that the lexer (and the tokens it produces) can
+ * point directly into the file contents without first copying them onto the heap. A zero filled padding
+ * page after the end of the file provides the null terminator if the file size is an exact multiple of
+ * the page size. For inputs which cannot be mapped (pipes, empty files etc.) the text is read into a heap
+ * buffer instead.
+ *
+ * The buffer must outlive any tokens or AST nodes that reference the source text.
+ */
+class SourceBuffer {
+public:
+    SourceBuffer();
+    
+    ~SourceBuffer();
+    
+    /**
+     * Load the contents of the given file into the buffer, replacing any existing contents.
+     * Returns false on failure, in which case the buffer is left empty.
+     */
+    bool load(const char * filePath);
+    
+    /* Free the contents of the buffer, leaving it empty */
+    void clear();
+    
+    /* Get the null terminated source text. Never returns null, even if the buffer is empty. */
+    inline const char * getText() const {
+        return mText;
+    }
+    
+    /* Get the size of the source text in bytes, excluding the null terminator */
+    inline size_t getSize() const {
+        return mSize;
+    }
+    
+    /* Tell if the source text is memory mapped rather than read into a heap buffer */
+    inline bool isMemoryMapped() const {
+        return mMappedSize > 0;
+    }
+    
+    WC_DISALLOW_COPY_AND_ASSIGN(SourceBuffer)
+    
+private:
+    /* Try to memory map the given open file of the given size. Returns false if it can't be mapped. */
+    bool tryMapFile(int fileDescriptor, size_t fileSize);
+    
+    /* Read the entire contents of the given open file into a heap buffer */
+    bool readFile(int fileDescriptor);
+    
+    /* The null terminated source text */
+    const char * mText;
+    
+    /* Size of the source text in bytes, excluding the null terminator */
+    size_t mSize;
+    
+    /* If the text is memory mapped then this is the total size of the mapping, including padding */
+    size_t mMappedSize;
+    
+    /* If the text was read into a heap buffer then this is the buffer */
+    char * mHeapText;
+};
+
+WC_END_NAMESPACE
@@ -0,0 +1,81 @@
+//==============================================================================
+// The Wolf Programming Language.
+//      Copyright (c) 2016, Darragh Coy.
+//      See LICENSE.txt for license details.
+//==============================================================================
+
+#pragma once
+
+#include "Assert.hpp"
+
+WC_THIRD_PARTY_INCLUDES_BEGIN
+    #include <cstddef>
+WC_THIRD_PARTY_INCLUDES_END
+
+WC_BEGIN_NAMESPACE
+
+/**
+ * A read only view of a contiguous array of items: just a pointer to the first item and a count.
+ * The span does not own the items, the memory for them is expected to be owned by something which outlives
+ * the span, such as a 'LinearAlloc'. Used for the lists of child nodes in the AST, see 'AST/ScratchList.hpp'.
+ */
+template <typename T>
+class Span {
+public:
+    /* Create an empty span */
+    constexpr Span() : mItems(nullptr), mSize(0) {
+        WC_EMPTY_FUNC_BODY();
+    }
+    
+    /* Create a span over the given items */
+    constexpr Span(const T * items, size_t size) : mItems(items), mSize(size) {
+        WC_EMPTY_FUNC_BODY();
+    }
+    
+    /**
+     * Create a span from a span of another item type, where pointers to the other item type can be converted
+     * to pointers to this item type. For example this allows a span of 'Expr*' to be viewed as a span of
+     * 'const Expr*'.
+     */
+    template <typename U>
+    constexpr Span(const Span<U> & other) : mItems(other.begin()), mSize(other.size()) {
+        WC_EMPTY_FUNC_BODY();
+    }
+    
+    inline const T * begin() const {
+        return mItems;
+    }
+    
+    inline const T * end() const {
+        return mItems + mSize;
+    }
+    
+    inline size_t size() const {
+        return mSize;
+    }
+    
+    inline bool empty() const {
+        return mSize == 0;
+    }
+    
+    inline const T & operator [] (size_t index) const {
+        WC_ASSERT(index < mSize);
+        return mItems[index];
+    }
+    
+    inline const T & front() const {
+        WC_ASSERT(mSize > 0);
+        return mItems[0];
+    }
+    
+    inline const T & back() const {
+        WC_ASSERT(mSize > 0);
+        return mItems[mSize - 1];
+    }
+    
+private:
+    const T *   mItems;
+    size_t      mSize;
+};
+
+WC_END_NAMESPACE
@@ -7,6 +7,7 @@
 #include "StringUtils.hpp"
 
 #include "Assert.hpp"
+#include "Lexer/SourceLineIndex.hpp"
 #include "Lexer/Token.hpp"
 
 WC_THIRD_PARTY_INCLUDES_BEGIN
@@ -426,19 +427,32 @@ char * StringUtils::convertUtf32ToUtf8(const char32_t * utf32Str, size_t stringL
     return utf8StrBuffer;
 }
 
-std::string StringUtils::appendLineInfo(const char * str, const Token & atToken) {
+std::string StringUtils::appendLineInfo(const char * str,
+                                        const Token & atToken,
+                                        const SourceLineIndex & srcLineIndex)
+{
+    return appendLineInfo(str, atToken.startSrcOffset, srcLineIndex);
+}
+
+std::string StringUtils::appendLineInfo(const char * str,
+                                        uint32_t atSrcOffset,
+                                        const SourceLineIndex & srcLineIndex)
+{
     // Get the length of the string
     WC_ASSERT(str);
     size_t strLen = std::strlen(str);
     
+    // Figure out the line and column for the source offset
+    SourceLoc srcLoc = srcLineIndex.getLoc(atSrcOffset);
+    
     // Do the append
     std::string returnStr;
     returnStr.reserve(strLen + 24);
     returnStr.append(str, strLen);
     returnStr += "@l";
-    returnStr += std::to_string(atToken.startLine + 1);
+    returnStr += std::to_string(srcLoc.line + 1);
     returnStr += ",c";
-    returnStr += std::to_string(atToken.startCol + 1);
+    returnStr += std::to_string(srcLoc.col + 1);
     return returnStr;
 }
 
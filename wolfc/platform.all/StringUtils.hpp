@@ -16,6 +16,7 @@ WC_THIRD_PARTY_INCLUDES_END
 
 WC_BEGIN_NAMESPACE
 
+class SourceLineIndex;
 struct Token;
 
 namespace StringUtils {
@@ -50,8 +51,14 @@ namespace StringUtils {
      */
     char * convertUtf32ToUtf8(const char32_t * utf32Str, size_t stringLength);
     
-    /* Appends line and column info for the given token to the given string */
-    std::string appendLineInfo(const char * str, const Token & atToken);
+    /**
+     * Appends line and column info for the given token to the given string.
+     * The line and column are looked up from the given line index for the token's source.
+     */
+    std::string appendLineInfo(const char * str, const Token & atToken, const SourceLineIndex & srcLineIndex);
+    
+    /* Same as above, but appends line and column info for the given offset into the source code */
+    std::string appendLineInfo(const char * str, uint32_t atSrcOffset, const SourceLineIndex & srcLineIndex);
 }
 
 WC_END_NAMESPACE
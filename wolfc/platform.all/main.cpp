@@ -4,17 +4,19 @@
 //      See LICENSE.txt for license details.
 //==============================================================================
 
+#include "AST/NameBinder.hpp"
+#include "AST/NameBindings.hpp"
 #include "AST/Nodes/Module.hpp"
 #include "AST/ParseCtx.hpp"
 #include "Backend/LLVM/Codegen/Codegen.hpp"
 #include "Backend/LLVM/CodegenCtx.hpp"
-#include "FileUtils.hpp"
 #include "Lexer/Lexer.hpp"
 #include "LinearAlloc.hpp"
+#include "LinearAllocPool.hpp"
+#include "SourceBuffer.hpp"
 
 WC_THIRD_PARTY_INCLUDES_BEGIN
     #include <cstdio>
-    #include <memory>
 
     #ifdef _MSC_VER
         #include <Windows.h>
@@ -27,10 +29,21 @@ WC_THIRD_PARTY_INCLUDES_END
  */
 static const std::string kModuleName = "WolfTest";
 
+/* Settings for the linear allocators used to allocate AST nodes */
+static constexpr const size_t kASTAllocMaxAllocSize = 1024 * 1024;      /* 1 MB max alloc */
+static constexpr const size_t kASTAllocBlockSize = 1024 * 1024 * 16;    /* 16 MB block size */
+
 /* Compiles the given AST */
-static bool compileAST(const Wolfc::AST::Module * astModule, const char * fromSrcFile) {
+static bool compileAST(const Wolfc::AST::Module * astModule,
+                       const Wolfc::SourceLineIndex & srcLineIndex,
+                       const char * fromSrcFile)
+{
+    // Resolve what each identifier refers to ahead of codegen
+    Wolfc::AST::NameBindings nameBindings;
+    Wolfc::AST::NameBinder::bind(*astModule, nameBindings);
+    
     // Create a codegen context and do the code generation using the LLVM backend
-    Wolfc::LLVMBackend::CodegenCtx codegenCtx(kModuleName);
+    Wolfc::LLVMBackend::CodegenCtx codegenCtx(kModuleName, srcLineIndex, nameBindings);
     Wolfc::LLVMBackend::Codegen codegen(codegenCtx);
     codegen.visit(*astModule);
     
@@ -63,20 +76,28 @@ static bool compileAST(const Wolfc::AST::Module * astModule, const char * fromSr
     return true;
 }
 
-/* Compiles the given list of tokens */
-static bool compileTokens(const Wolfc::Token * tokenList, const char * fromSrcFile) {
-    // Linear allocator that we can use
+/**
+ * Compiles the tokens produced by the given lexer, which must be in streaming mode.
+ * Tokens are lexed on demand as the parser pulls them.
+ */
+static bool compileTokens(Wolfc::Lexer & lexer, const char * fromSrcFile) {
+    // Linear allocator that we can use, getting its memory blocks from a pool
+    Wolfc::LinearAllocPool linearAllocPool(kASTAllocMaxAllocSize, kASTAllocBlockSize);
     Wolfc::LinearAlloc linearAlloc(
-        1024 * 1024,        /* 1 MB max alloc */
-        1024 * 1024 * 16,   /* 16 MB block size */
+        linearAllocPool,
         128,                /* Space in blocks array to reserve */
         1024 * 4            /* Space in sys blocks array to reserve */
     );
 
     // Declare and parse the module AST
-    Wolfc::AST::ParseCtx parseCtx(tokenList, linearAlloc);
+    Wolfc::AST::ParseCtx parseCtx(lexer, linearAlloc);
     Wolfc::AST::Module * astModule = Wolfc::AST::Module::parse(parseCtx);
     
+    // If the lexer failed then it has already emitted an error, just fail here
+    if (lexer.hasErrors()) {
+        return false;
+    }
+    
     // Emit parse warnings to stdout if there are any
     if (parseCtx.hasWarnings()) {
         std::fprintf(stdout, "Parse warnings emitted for source file '%s'! Warning messages follow:\n", fromSrcFile);
@@ -98,34 +119,35 @@ static bool compileTokens(const Wolfc::Token * tokenList, const char * fromSrcFi
     }
     
     // Compile the AST
-    return compileAST(astModule, fromSrcFile);
+    return compileAST(astModule, lexer.getSrcLineIndex(), fromSrcFile);
 }
 
 /* Compiles the given source text */
-static bool compileSourceText(const char * srcText, const char * fromSrcFile) {
-    // Split the text up into language tokens with the lexer
+static bool compileSourceText(const Wolfc::SourceBuffer & srcText, const char * fromSrcFile) {
+    // Split the text up into language tokens with the lexer.
+    // Note: the lexer is used in streaming mode so that tokens are only lexed as the parser needs them.
     Wolfc::Lexer lexer;
     
-    if (!lexer.process(srcText)) {
+    if (!lexer.beginStreaming(srcText)) {
         return false;
     }
     
-    // Compile the list of tokens generated
-    return compileTokens(lexer.getTokenList(), fromSrcFile);
+    // Compile the tokens generated
+    return compileTokens(lexer, fromSrcFile);
 }
 
 /* Compiles the given source file */
 static bool compileSourceFile(const char * srcFilePath) {
-    // Read the source file
-    std::unique_ptr<char[]> inputSrc(Wolfc::FileUtils::readTextFileAsCString(srcFilePath));
+    // Read the source file. Note: the file is memory mapped where possible rather than copied.
+    Wolfc::SourceBuffer inputSrc;
     
-    if (!inputSrc) {
+    if (!inputSrc.load(srcFilePath)) {
         std::printf("Failed to read input Wolf source file '%s'!\n", srcFilePath);
         return false;
     }
     
     // Compile the source text
-    return compileSourceText(inputSrc.get(), srcFilePath);
+    return compileSourceText(inputSrc, srcFilePath);
 }
 
 /* The actual implementation of main */
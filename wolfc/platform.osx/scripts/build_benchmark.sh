@@ -0,0 +1,55 @@
+# Small script that builds one of the compiler front end benchmarks (or tools, e.g 'CorpusGenerator') in the
+# 'benchmarks' folder.
+# The benchmark is compiled together with all of the compiler sources, apart from the LLVM backend and 'main.cpp'.
+# Benchmarks which need the backend (e.g 'CodegenBenchmark') can have it compiled in and linked against LLVM too.
+#
+# Args:
+# 	$1 - name of the benchmark to build (e.g 'LexerBenchmark')
+#	$2 - folder for the output executable
+#	$3 - optional, 'backend' to also compile the LLVM backend and link against LLVM
+
+# Get the folder that this file is in and the folders for the compiler sources and benchmarks
+THIS_FILE_DIR="$( cd "$( dirname "$0" )" && pwd )"
+SRC_DIR="${THIS_FILE_DIR}/../../platform.all"
+BENCHMARKS_DIR="${THIS_FILE_DIR}/../../benchmarks"
+
+BENCHMARK_NAME="${1}"
+EXECUTABLE_OUTPUT_DIR="${2}"
+WITH_BACKEND="${3}"
+mkdir -p "${EXECUTABLE_OUTPUT_DIR}"
+
+if [ $? != 0 ]; then
+	echo "Failed to create executable output folder '${EXECUTABLE_OUTPUT_DIR}'"
+	exit 1
+fi
+
+# Gather up all the compiler front end sources
+FRONT_END_SOURCES=`find "${SRC_DIR}" -name "*.cpp" -not -path "*/Backend/*" -not -name "main.cpp"`
+
+# Gather up the backend sources and LLVM flags if needed. These match the settings in the Xcode project.
+BACKEND_SOURCES=""
+BACKEND_FLAGS=""
+
+if [ "${WITH_BACKEND}" == "backend" ]; then
+	BACKEND_SOURCES=`find "${SRC_DIR}/Backend" -name "*.cpp"`
+	BACKEND_FLAGS="-I/usr/local/include -L/usr/local/lib -lLLVMCore -lLLVMSupport"
+elif [ -n "${WITH_BACKEND}" ]; then
+	echo "Unknown option '${WITH_BACKEND}'! Expected 'backend' or nothing."
+	exit 1
+fi
+
+# Compile the benchmark
+OUTPUT_BIN_FILE_PATH="${EXECUTABLE_OUTPUT_DIR}/${BENCHMARK_NAME}"
+${CXX:-clang++} -std=c++14 -O3 -DNDEBUG -I"${SRC_DIR}" \
+	-o "${OUTPUT_BIN_FILE_PATH}" \
+	"${BENCHMARKS_DIR}/${BENCHMARK_NAME}.cpp" \
+	${FRONT_END_SOURCES} \
+	${BACKEND_SOURCES} \
+	${BACKEND_FLAGS}
+
+if [ $? != 0 ]; then
+    echo "Compiling benchmark '${BENCHMARK_NAME}' failed!"
+    exit 1
+fi
+
+exit 0